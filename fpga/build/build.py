@@ -44,16 +44,26 @@ and reports to the main work directory before continuing.
   closure is under the x3 overconstraint, and we always still want the
   unconstrained route to run. Step 8 is the last possible step and always
   writes final.dcp.
+
+Synthesis results are cached under <board>/synth_cache, keyed by a hash of
+every synthesis input (RTL file list and headers, constraints, build/BD
+scripts, software memory images, directive, retiming). When nothing
+synthesis-relevant changed, a build reuses the cached post_synth.dcp and goes
+straight to implementation. sweep_builds.py leans on this plus --work-root and
+--no-directive-sweep to run many configuration builds in parallel from one
+shared synthesis checkpoint.
 """
 
 import argparse
 from dataclasses import dataclass
+import hashlib
 import os
 import re
 import shutil
 import signal
 import subprocess
 import sys
+import tempfile
 import time
 from pathlib import Path
 from typing import TextIO, TypedDict
@@ -265,6 +275,168 @@ def extract_timing_from_report(timing_rpt_path: Path) -> TimingSummary:
     return result
 
 
+# =============================================================================
+# Synthesis checkpoint cache
+# =============================================================================
+
+# Outputs shared through the synthesis cache. The checkpoint is mandatory;
+# the reports are copied when present so cache-hit builds keep their paper
+# trail in the work directory.
+_SYNTH_CACHE_FILES = [
+    "post_synth.dcp",
+    "post_synth_timing.rpt",
+    "post_synth_util.rpt",
+    "post_synth_high_fanout.rpt",
+    "post_synth_failing_paths.csv",
+    "post_synth_vivado.log",
+]
+
+# Header extensions hashed from +incdir+ directories in the RTL file list.
+_INCDIR_HASH_SUFFIXES = (".sv", ".svh", ".v", ".vh")
+
+# Software memory images read during the synth step (see build_step.tcl).
+_SYNTH_MEM_FILES = [
+    "sw.mem",
+    "sw_imem_even.mem",
+    "sw_imem_odd.mem",
+    "sw_imem_even_sideband.mem",
+    "sw_imem_odd_sideband.mem",
+]
+
+
+def flatten_rtl_file_list(file_list_path: Path, project_root: Path) -> list[str]:
+    """Expand a .f file list (and nested -f lists) into source/incdir entries.
+
+    Python port of the flatten_rtl_file_list proc in build_step.tcl; the two
+    must walk the same files so the cache key covers exactly what synth_design
+    reads. A missing list yields no entries — synthesis itself reports it.
+    """
+    if not file_list_path.is_file():
+        return []
+
+    entries: list[str] = []
+    for raw_line in file_list_path.read_text().splitlines():
+        line = raw_line.strip()
+        if not line or line.startswith("#"):
+            continue
+        line = line.replace("$(ROOT)", str(project_root))
+        if line.startswith("-f "):
+            nested_list = Path(line.split(None, 1)[1].strip())
+            entries.extend(flatten_rtl_file_list(nested_list, project_root))
+        else:
+            entries.append(line)
+    return entries
+
+
+def _hash_file_into(digest: "hashlib._Hash", label: str, path: Path) -> None:
+    """Mix one input file (or its absence) into the cache-key digest."""
+    digest.update(f"file={label}\n".encode())
+    if path.is_file():
+        digest.update(path.read_bytes())
+    else:
+        digest.update(b"<missing>")
+    digest.update(b"\n")
+
+
+def compute_synth_cache_key(
+    project_root: Path,
+    script_dir: Path,
+    board_name: str,
+    synth_directive: str,
+    retiming: bool,
+    software_mem_dir: Path,
+) -> str:
+    """Hash every synthesis input into a short cache key.
+
+    Covers the flattened RTL file list (nested lists and +incdir+ headers
+    included), the board constraints, the build/BD scripts, the software
+    memory images read during synth, and the synthesis settings themselves.
+    Note the XDC is a synthesis input in this flow (build_step.tcl reads it
+    before synth_design), so constraint edits re-synthesize; only directive,
+    seed-style configuration, and downstream-step changes reuse the cache.
+    """
+    digest = hashlib.sha256()
+    digest.update(
+        f"v1 board={board_name} directive={synth_directive} "
+        f"retiming={int(retiming)}\n".encode()
+    )
+
+    board_dir = project_root / "boards" / board_name
+
+    def relative_label(path: Path) -> str:
+        try:
+            return str(path.relative_to(project_root))
+        except ValueError:
+            return str(path)
+
+    script_inputs = [
+        script_dir / "build_step.tcl",
+        script_dir / f"{board_name}_ddr_bd.tcl",
+    ]
+    if board_name == "genesys2":
+        script_inputs.append(board_dir / "mem_reset_control.v")
+    for path in script_inputs:
+        _hash_file_into(digest, relative_label(path), path)
+
+    rtl_file_list = board_dir / f"{board_name}_frost.f"
+    for entry in flatten_rtl_file_list(rtl_file_list, project_root):
+        if entry.startswith("+incdir+"):
+            incdir = Path(entry[len("+incdir+") :])
+            headers = sorted(
+                header
+                for header in incdir.glob("*")
+                if header.suffix in _INCDIR_HASH_SUFFIXES
+            )
+            for header in headers:
+                _hash_file_into(digest, relative_label(header), header)
+        else:
+            _hash_file_into(digest, relative_label(Path(entry)), Path(entry))
+
+    constraints_file = board_dir / "constr" / f"{board_name}.xdc"
+    _hash_file_into(digest, relative_label(constraints_file), constraints_file)
+
+    for mem_name in _SYNTH_MEM_FILES:
+        _hash_file_into(digest, f"software_mem/{mem_name}", software_mem_dir / mem_name)
+
+    return digest.hexdigest()[:16]
+
+
+def fetch_cached_synth(cache_dir: Path, key: str, main_work: Path) -> bool:
+    """Copy a cached synthesis checkpoint and reports into the work directory."""
+    entry_dir = cache_dir / key
+    if not (entry_dir / "post_synth.dcp").exists():
+        return False
+    main_work.mkdir(parents=True, exist_ok=True)
+    for name in _SYNTH_CACHE_FILES:
+        src = entry_dir / name
+        if src.exists():
+            shutil.copy2(src, main_work / name)
+    return True
+
+
+def store_synth_in_cache(cache_dir: Path, key: str, main_work: Path) -> None:
+    """Publish the work directory's synthesis outputs under the cache key."""
+    if not (main_work / "post_synth.dcp").exists():
+        return
+    cache_dir.mkdir(parents=True, exist_ok=True)
+    entry_dir = cache_dir / key
+    if entry_dir.exists():
+        return
+    # Stage into a temp sibling and rename, so concurrent builds never see a
+    # half-written cache entry; the loser of a rename race just discards.
+    staging = Path(tempfile.mkdtemp(dir=cache_dir, prefix=f".{key}."))
+    try:
+        for name in _SYNTH_CACHE_FILES:
+            src = main_work / name
+            if src.exists():
+                shutil.copy2(src, staging / name)
+        staging.rename(entry_dir)
+    except OSError:
+        shutil.rmtree(staging, ignore_errors=True)
+        return
+    print(f"  Cached synthesis checkpoint: {entry_dir}")
+
+
 def compile_hello_world(project_root: Path, output_dir: Path, clock_freq: int) -> bool:
     """Compile hello_world application for initial BRAM contents."""
     app_dir = project_root / "sw" / "apps" / "hello_world"
@@ -522,6 +694,7 @@ def terminate_x3_directive_sweep_runs(
 
 def run_x3_step_directive_sweep(
     script_dir: Path,
+    work_root: Path,
     step: str,
     directives: list[str],
     sweep_kind: str,
@@ -531,7 +704,7 @@ def run_x3_step_directive_sweep(
     """Run every x3 directive in parallel and promote the best-WNS run."""
     board_name = "x3"
     tcl_report_prefix = _TCL_REPORT_PREFIX[step]
-    main_work = script_dir / board_name / "work"
+    main_work = work_root / board_name / "work"
     main_work.mkdir(parents=True, exist_ok=True)
 
     required_checkpoint = STEP_REQUIRES_CHECKPOINT[step]
@@ -557,7 +730,7 @@ def run_x3_step_directive_sweep(
     runs: list[DirectiveSweepRun] = []
     try:
         for directive in directives:
-            work_dir = script_dir / board_name / f"work_{step}_{directive}"
+            work_dir = work_root / board_name / f"work_{step}_{directive}"
             if work_dir.exists():
                 shutil.rmtree(work_dir)
             work_dir.mkdir(parents=True, exist_ok=True)
@@ -738,6 +911,7 @@ def run_x3_step_directive_sweep(
 
 def run_step(
     script_dir: Path,
+    work_root: Path,
     board_name: str,
     step: str,
     directive: str,
@@ -753,7 +927,7 @@ def run_step(
     (final-eligible step + WNS>=0, or post_second_route_physopt unconditionally),
     otherwise the step's non-final canonical prefix.
     """
-    main_work = script_dir / board_name / "work"
+    main_work = work_root / board_name / "work"
     main_work.mkdir(parents=True, exist_ok=True)
 
     # Check input checkpoint
@@ -767,7 +941,7 @@ def run_step(
         input_checkpoint = None
 
     tcl_report_prefix = _TCL_REPORT_PREFIX[step]
-    work_dir = script_dir / board_name / f"work_{step}_{directive}"
+    work_dir = work_root / board_name / f"work_{step}_{directive}"
     work_dir.mkdir(parents=True, exist_ok=True)
 
     print(f"\n{'='*70}")
@@ -845,11 +1019,12 @@ def run_step(
 
 def generate_bitstream(
     script_dir: Path,
+    work_root: Path,
     board_name: str,
     vivado_path: str,
 ) -> bool:
     """Generate bitstream from final checkpoint."""
-    main_work = script_dir / board_name / "work"
+    main_work = work_root / board_name / "work"
     final_checkpoint = main_work / "final.dcp"
 
     if not final_checkpoint.exists():
@@ -983,6 +1158,28 @@ Examples:
         action="store_true",
         help="Keep temporary work directories",
     )
+    parser.add_argument(
+        "--work-root",
+        type=Path,
+        default=None,
+        help="Root directory for <board>/work and step temp directories "
+        "(default: this script's directory). Lets sweep_builds.py run whole "
+        "builds in parallel without colliding work directories.",
+    )
+    parser.add_argument(
+        "--force-synth",
+        action="store_true",
+        help="Re-run synthesis even when the synthesis cache already holds a "
+        "checkpoint for the current RTL hash and synth settings",
+    )
+    parser.add_argument(
+        "--no-directive-sweep",
+        action="store_true",
+        help="Run place/route/second_route with their single configured "
+        "directives even on x3, instead of the parallel directive sweeps. "
+        "Used by sweep_builds.py, which parallelizes across whole "
+        "configurations instead.",
+    )
     parser.add_argument(
         "--synth-directive",
         choices=SYNTH_DIRECTIVES,
@@ -1031,12 +1228,13 @@ Examples:
     board_name = args.board_name
     script_dir = Path(__file__).parent.resolve()
     project_root = script_dir.parent.parent
+    work_root = args.work_root.resolve() if args.work_root else script_dir
 
     # Get board configuration
     board_config = BOARD_CONFIG[board_name]
     clock_freq = board_config["clock_freq"]
     is_ultrascale = board_config["is_ultrascale"]
-    if board_name == "x3":
+    if board_name == "x3" and not args.no_directive_sweep:
         place_directive = "Sweep"
         route_directive = "Sweep"
         second_route_directive = "Sweep"
@@ -1068,24 +1266,25 @@ Examples:
     ]
     if directives_summary:
         print(f"# Directives: {', '.join(directives_summary)}")
-    if board_name == "x3" and args.place_directive is not None:
+    x3_sweeps = board_name == "x3" and not args.no_directive_sweep
+    if x3_sweeps and args.place_directive is not None:
         print(
             "# Note: --place-directive is ignored for x3; "
             "the place stage sweeps all placer directives."
         )
-    if board_name == "x3" and args.route_directive != "AggressiveExplore":
+    if x3_sweeps and args.route_directive != "AggressiveExplore":
         print(
             "# Note: --route-directive is ignored for x3; "
             "the first route stage sweeps all router directives."
         )
-    if board_name == "x3" and args.second_route_directive != "Explore":
+    if x3_sweeps and args.second_route_directive != "Explore":
         print(
             "# Note: --second-route-directive is ignored for x3; "
             "the second route stage sweeps all router directives."
         )
     print(f"{'#'*70}")
 
-    main_work = script_dir / board_name / "work"
+    main_work = work_root / board_name / "work"
     software_mem_dir = main_work / "hello_world"
 
     # Compile hello_world (skip if resuming from a checkpoint)
@@ -1120,6 +1319,21 @@ Examples:
             sys.exit(1)
         print(f"Starting from checkpoint: {checkpoint_path}")
 
+    # Synthesis checkpoint cache: one shared entry per RTL hash + synth
+    # settings, stored next to this script so every work root reuses it.
+    synth_cache_dir = script_dir / board_name / "synth_cache"
+    synth_cache_key = None
+    if "synth" in steps_to_run:
+        synth_cache_key = compute_synth_cache_key(
+            project_root,
+            script_dir,
+            board_name,
+            args.synth_directive,
+            args.retiming,
+            software_mem_dir,
+        )
+        print(f"\nSynthesis cache key: {synth_cache_key}")
+
     # Run steps
     final_produced = False
     bitstream_generated = False
@@ -1128,18 +1342,32 @@ Examples:
         directive = step_directives[step]
         retiming = args.retiming if step == "synth" else False
 
-        if board_name == "x3" and step == "place":
+        if (
+            step == "synth"
+            and synth_cache_key is not None
+            and not args.force_synth
+            and fetch_cached_synth(synth_cache_dir, synth_cache_key, main_work)
+        ):
+            print(
+                f"\nReusing cached synthesis checkpoint "
+                f"{synth_cache_dir / synth_cache_key / 'post_synth.dcp'} "
+                f"(no synthesis input changed; --force-synth overrides)."
+            )
+            success, wns, actual_prefix = True, None, "post_synth"
+        elif x3_sweeps and step == "place":
             success, wns, actual_prefix = run_x3_step_directive_sweep(
                 script_dir,
+                work_root,
                 step,
                 PLACER_DIRECTIVES,
                 "placer",
                 args.vivado_path,
                 keep_temps=args.keep_temps,
             )
-        elif board_name == "x3" and step in {"route", "second_route"}:
+        elif x3_sweeps and step in {"route", "second_route"}:
             success, wns, actual_prefix = run_x3_step_directive_sweep(
                 script_dir,
+                work_root,
                 step,
                 ROUTER_SWEEP_DIRECTIVES,
                 "router",
@@ -1149,6 +1377,7 @@ Examples:
         else:
             success, wns, actual_prefix = run_step(
                 script_dir,
+                work_root,
                 board_name,
                 step,
                 directive,
@@ -1161,6 +1390,9 @@ Examples:
             print(f"\nError: Step '{step}' failed!")
             sys.exit(1)
 
+        if step == "synth" and synth_cache_key is not None:
+            store_synth_in_cache(synth_cache_dir, synth_cache_key, main_work)
+
         last_report_prefix = actual_prefix
         if actual_prefix == "final":
             final_produced = True
@@ -1179,19 +1411,22 @@ Examples:
 
     # Generate bitstream whenever this run produced final.dcp
     if final_produced:
-        if not generate_bitstream(script_dir, board_name, args.vivado_path):
+        if not generate_bitstream(script_dir, work_root, board_name, args.vivado_path):
             sys.exit(1)
         bitstream_generated = True
 
-    # Update README.md utilization tables
-    from extract_timing_and_util_summary import (
-        collect_all_board_utilization,
-        update_readme_utilization,
-    )
+    # Update README.md utilization tables. Skipped for alternate work roots:
+    # the tables track the canonical build, and parallel sweep builds must not
+    # race each other rewriting the README.
+    if work_root == script_dir:
+        from extract_timing_and_util_summary import (
+            collect_all_board_utilization,
+            update_readme_utilization,
+        )
 
-    all_util = collect_all_board_utilization(script_dir)
-    if all_util:
-        update_readme_utilization(script_dir, all_util)
+        all_util = collect_all_board_utilization(script_dir)
+        if all_util:
+            update_readme_utilization(script_dir, all_util)
 
     # Final summary — read from whichever prefix the last completed step wrote
     print(f"\n{'#'*70}")
@@ -0,0 +1,564 @@
+#!/usr/bin/env python3
+
+#    Copyright 2026 Two Sigma Open Source, LLC
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+
+"""Run multiple FPGA build configurations in parallel from shared synthesis.
+
+Timing-closure sweeps used to mean running build.py once per configuration,
+serially, resynthesizing every time. This script splits the sweep into two
+phases:
+
+1. Synthesis: each *unique* (synth directive, retiming) pair among the
+   requested configurations is synthesized once, through build.py's synthesis
+   cache (keyed by a hash of every synthesis input). Unchanged RTL means this
+   phase is a cache hit and finishes in seconds.
+2. Implementation: every configuration gets its own --work-root seeded with
+   the shared post_synth.dcp, and up to --jobs build.py pipelines
+   (opt -> place -> phys_opt -> route -> ... -> bitstream) run concurrently
+   with --no-directive-sweep, so each job is one serial Vivado pipeline and
+   the parallelism lives across configurations.
+
+A configuration is NAME[:key=value,...] with keys synth, opt, place, route,
+second_route (directive names from build.py) and retiming (0/1). Unset keys
+take build.py's tuned defaults. Results land in build/<board>/sweep/<NAME>/
+and a WNS-ranked summary matrix is printed at the end.
+
+Examples (from the repo root):
+
+    # Default configuration matrix, four concurrent builds
+    ./fpga/build/sweep_builds.py x3
+
+    # Hand-picked placer seeds, two at a time
+    ./fpga/build/sweep_builds.py x3 -j2 \\
+        --config explore:place=Explore \\
+        --config netdelay:place=ExtraNetDelay_high \\
+        --config spread:place=AltSpreadLogic_medium
+
+    # Stop every configuration after the first route
+    ./fpga/build/sweep_builds.py genesys2 --stop-after route
+"""
+
+import argparse
+import os
+import re
+import shutil
+import signal
+import subprocess
+import sys
+import time
+from dataclasses import dataclass
+from pathlib import Path
+from typing import TextIO
+
+SCRIPT_DIR = Path(__file__).resolve().parent
+sys.path.insert(0, str(SCRIPT_DIR))
+from build import (  # noqa: E402
+    _SYNTH_CACHE_FILES,
+    OPT_DIRECTIVES,
+    PLACER_DIRECTIVES,
+    ROUTER_SWEEP_DIRECTIVES,
+    STEP_REPORT_PREFIX,
+    STEPS,
+    SYNTH_DIRECTIVES,
+    extract_timing_from_report,
+    format_sweep_elapsed,
+    format_sweep_ns,
+)
+
+# Default sweep matrix: build.py's tuned defaults plus the placer/opt/synth
+# variations that have historically closed x3 timing when the baseline did
+# not. Vivado has no placer seed, so "seeds" here are directive choices.
+DEFAULT_CONFIG_SPECS = [
+    "baseline",
+    "remap:opt=ExploreWithRemap",
+    "explore:place=Explore",
+    "netdelay:place=ExtraNetDelay_high",
+    "spread:place=AltSpreadLogic_medium",
+    "retimed:retiming=1",
+]
+
+_CONFIG_DIRECTIVE_KEYS = {
+    "synth": SYNTH_DIRECTIVES,
+    "opt": OPT_DIRECTIVES,
+    "place": PLACER_DIRECTIVES,
+    "route": ROUTER_SWEEP_DIRECTIVES,
+    "second_route": ROUTER_SWEEP_DIRECTIVES,
+}
+
+
+@dataclass
+class BuildConfig:
+    """One named build configuration for the parallel sweep."""
+
+    name: str
+    synth: str = "AlternateRoutability"
+    opt: str = "Explore"
+    place: str = "ExtraTimingOpt"
+    route: str = "AggressiveExplore"
+    second_route: str = "Explore"
+    retiming: bool = False
+
+    def synth_key(self) -> tuple[str, bool]:
+        """Synthesis settings this configuration shares with others."""
+        return (self.synth, self.retiming)
+
+
+@dataclass
+class ConfigRun:
+    """Runtime state for one configuration's build.py subprocess."""
+
+    config: BuildConfig
+    work_root: Path
+    log_path: Path
+    command: list[str]
+    process: subprocess.Popen[bytes] | None = None
+    log_handle: TextIO | None = None
+    start_time: float | None = None
+    returncode: int | None = None
+    elapsed_s: float | None = None
+    report_prefix: str | None = None
+    wns: float | None = None
+    tns: float | None = None
+    launch_error: str | None = None
+
+
+def parse_config_spec(spec: str) -> BuildConfig:
+    """Parse a NAME[:key=value,...] configuration specification."""
+    name, _, rest = spec.partition(":")
+    name = name.strip()
+    if not re.fullmatch(r"[A-Za-z0-9_.-]+", name or ""):
+        raise ValueError(f"invalid configuration name in '{spec}'")
+
+    config = BuildConfig(name=name)
+    if not rest.strip():
+        return config
+
+    for item in rest.split(","):
+        key, sep, value = item.strip().partition("=")
+        if not sep:
+            raise ValueError(f"expected key=value in '{spec}', got '{item.strip()}'")
+        if key == "retiming":
+            if value not in ("0", "1"):
+                raise ValueError(f"retiming must be 0 or 1 in '{spec}'")
+            config.retiming = value == "1"
+        elif key in _CONFIG_DIRECTIVE_KEYS:
+            if value not in _CONFIG_DIRECTIVE_KEYS[key]:
+                raise ValueError(f"unknown {key} directive '{value}' in '{spec}'")
+            setattr(config, key, value)
+        else:
+            raise ValueError(f"unknown configuration key '{key}' in '{spec}'")
+    return config
+
+
+def synth_phase_work_root(sweep_root: Path, synth_directive: str, retiming: bool) -> Path:
+    """Work root for the shared synthesis run of one synth setting."""
+    suffix = "_retimed" if retiming else ""
+    return sweep_root / f"synth_{synth_directive}{suffix}"
+
+
+def run_synth_phase(
+    board_name: str,
+    sweep_root: Path,
+    configs: list[BuildConfig],
+    vivado_path: str,
+    force_synth: bool,
+) -> dict[tuple[str, bool], Path]:
+    """Synthesize each unique synth setting once; return per-setting work dirs.
+
+    Runs serially on purpose: distinct synth settings are rare in a sweep,
+    synth_design already fans out to general.maxThreads cores, and the
+    hello_world compile in sw/apps is not safe to run concurrently with
+    itself. Repeat sweeps hit build.py's synthesis cache and finish fast.
+    """
+    synth_work: dict[tuple[str, bool], Path] = {}
+    unique_keys = []
+    for config in configs:
+        if config.synth_key() not in synth_work:
+            synth_work[config.synth_key()] = Path()
+            unique_keys.append(config.synth_key())
+
+    print(f"\n{'='*70}")
+    print(f"PHASE 1: shared synthesis ({len(unique_keys)} unique synth setting(s))")
+    print(f"{'='*70}")
+
+    for synth_directive, retiming in unique_keys:
+        work_root = synth_phase_work_root(sweep_root, synth_directive, retiming)
+        work_root.mkdir(parents=True, exist_ok=True)
+        log_path = work_root / "synth_build.log"
+
+        command = [
+            sys.executable,
+            str(SCRIPT_DIR / "build.py"),
+            board_name,
+            "--stop-after",
+            "synth",
+            "--work-root",
+            str(work_root),
+            "--synth-directive",
+            synth_directive,
+            "--vivado-path",
+            vivado_path,
+        ]
+        if retiming:
+            command.append("--retiming")
+        if force_synth:
+            command.append("--force-synth")
+
+        label = f"{synth_directive}{' +retiming' if retiming else ''}"
+        print(f"\nSynthesizing: {label}")
+        print(f"  log: {log_path}")
+        start = time.monotonic()
+        with log_path.open("w") as log_handle:
+            result = subprocess.run(
+                command, stdout=log_handle, stderr=subprocess.STDOUT
+            )
+        elapsed = time.monotonic() - start
+        if result.returncode != 0:
+            print(f"Error: synthesis failed for {label}; see {log_path}")
+            raise SystemExit(1)
+        print(f"  done ({format_sweep_elapsed(elapsed)})")
+        synth_work[(synth_directive, retiming)] = work_root / board_name / "work"
+
+    return synth_work
+
+
+def seed_config_work_root(
+    board_name: str,
+    run: ConfigRun,
+    synth_work_dir: Path,
+) -> None:
+    """Reset a configuration's work root and seed it with the synth outputs."""
+    if run.work_root.exists():
+        shutil.rmtree(run.work_root)
+    main_work = run.work_root / board_name / "work"
+    main_work.mkdir(parents=True, exist_ok=True)
+    for name in _SYNTH_CACHE_FILES:
+        src = synth_work_dir / name
+        if src.exists():
+            shutil.copy2(src, main_work / name)
+
+
+def terminate_config_runs(runs: list[ConfigRun]) -> None:
+    """Terminate active configuration build process groups."""
+    active = [r for r in runs if r.process is not None and r.process.poll() is None]
+    if active:
+        print("\nTerminating active sweep builds...")
+    for run in active:
+        process = run.process
+        if process is None:
+            continue
+        print(f"  SIGTERM {run.config.name:<20} pid={process.pid}")
+        try:
+            os.killpg(process.pid, signal.SIGTERM)
+        except (ProcessLookupError, OSError):
+            pass
+    deadline = time.monotonic() + 10.0
+    while time.monotonic() < deadline:
+        if all(r.process is None or r.process.poll() is not None for r in active):
+            break
+        time.sleep(0.5)
+    for run in active:
+        process = run.process
+        if process is None or process.poll() is not None:
+            continue
+        print(f"  SIGKILL {run.config.name:<20} pid={process.pid}")
+        try:
+            os.killpg(process.pid, signal.SIGKILL)
+        except (ProcessLookupError, OSError):
+            pass
+    for run in runs:
+        if run.log_handle is not None:
+            run.log_handle.close()
+            run.log_handle = None
+
+
+def collect_run_timing(board_name: str, run: ConfigRun) -> None:
+    """Record the last produced timing summary for a finished configuration."""
+    main_work = run.work_root / board_name / "work"
+    prefixes = ["final"]
+    for step in reversed(STEPS):
+        prefix = STEP_REPORT_PREFIX[step]
+        if prefix not in prefixes:
+            prefixes.append(prefix)
+    for prefix in prefixes:
+        timing_rpt = main_work / f"{prefix}_timing.rpt"
+        if not timing_rpt.exists():
+            continue
+        timing = extract_timing_from_report(timing_rpt)
+        if timing.get("wns_ns") is None:
+            continue
+        run.report_prefix = prefix
+        run.wns = timing.get("wns_ns")
+        run.tns = timing.get("tns_ns")
+        return
+
+
+def finish_run(board_name: str, run: ConfigRun, returncode: int) -> None:
+    """Close out one configuration run and report its result."""
+    run.returncode = returncode
+    if run.start_time is not None:
+        run.elapsed_s = time.monotonic() - run.start_time
+    if run.log_handle is not None:
+        run.log_handle.close()
+        run.log_handle = None
+    collect_run_timing(board_name, run)
+    if returncode == 0:
+        result = (
+            f"WNS={format_sweep_ns(run.wns)} ns after {run.report_prefix}"
+            if run.report_prefix
+            else "completed without timing data"
+        )
+    else:
+        result = f"failed with exit code {returncode} (see {run.log_path})"
+    print(
+        f"  Finished {run.config.name:<20} {result} "
+        f"({format_sweep_elapsed(run.elapsed_s)})"
+    )
+
+
+def run_implementation_phase(
+    board_name: str, runs: list[ConfigRun], jobs: int
+) -> None:
+    """Dispatch configuration builds, at most `jobs` concurrently."""
+    print(f"\n{'='*70}")
+    print(f"PHASE 2: implementation ({len(runs)} configuration(s), -j{jobs})")
+    print(f"{'='*70}\n")
+
+    queue = list(runs)
+    active: list[ConfigRun] = []
+    try:
+        while queue or active:
+            while queue and len(active) < jobs:
+                run = queue.pop(0)
+                try:
+                    run.log_handle = run.log_path.open("w")
+                    run.process = subprocess.Popen(
+                        run.command,
+                        stdout=run.log_handle,
+                        stderr=subprocess.STDOUT,
+                        start_new_session=True,
+                    )
+                except OSError as e:
+                    if run.log_handle is not None:
+                        run.log_handle.close()
+                        run.log_handle = None
+                    run.returncode = -1
+                    run.elapsed_s = 0.0
+                    run.launch_error = str(e)
+                    print(f"  {run.config.name:<20} launch failed: {e}")
+                    continue
+                run.start_time = time.monotonic()
+                active.append(run)
+                print(
+                    f"  Launched {run.config.name:<20} pid={run.process.pid:<8} "
+                    f"log={run.log_path}"
+                )
+
+            for run in list(active):
+                process = run.process
+                if process is None:
+                    active.remove(run)
+                    continue
+                returncode = process.poll()
+                if returncode is None:
+                    continue
+                finish_run(board_name, run, returncode)
+                active.remove(run)
+
+            if queue or active:
+                time.sleep(5)
+    except KeyboardInterrupt:
+        terminate_config_runs(runs)
+        print("Interrupted; configuration sweep stopped.")
+        raise SystemExit(130)
+
+
+def print_sweep_summary(
+    board_name: str, runs: list[ConfigRun], best_run: ConfigRun | None
+) -> None:
+    """Print the WNS-ranked configuration sweep result matrix."""
+    print(f"\nConfiguration sweep results ({board_name}):")
+    print(
+        f"{'Sel':<3} {'Config':<20} {'Status':<10} {'Last step':<12} "
+        f"{'WNS(ns)':>9} {'TNS(ns)':>11} {'Elapsed':>8}"
+    )
+    print("-" * 80)
+    for run in runs:
+        if run.launch_error:
+            status = "LAUNCH"
+        elif run.returncode is None:
+            status = "UNKNOWN"
+        elif run.returncode != 0:
+            status = f"FAIL {run.returncode}"
+        elif run.wns is None:
+            status = "NO WNS"
+        elif run.wns >= 0:
+            status = "MET"
+        else:
+            status = "OK"
+        selected = "*" if best_run is run else ""
+        print(
+            f"{selected:<3} {run.config.name:<20} {status:<10} "
+            f"{run.report_prefix or 'N/A':<12} "
+            f"{format_sweep_ns(run.wns):>9} "
+            f"{format_sweep_ns(run.tns):>11} "
+            f"{format_sweep_elapsed(run.elapsed_s):>8}"
+        )
+
+
+def main() -> int:
+    """Run the parallel configuration sweep."""
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+    )
+    parser.add_argument(
+        "board_name",
+        nargs="?",
+        default="x3",
+        choices=["x3", "genesys2"],
+        help="Target board (default: x3)",
+    )
+    parser.add_argument(
+        "-j",
+        "--jobs",
+        type=int,
+        default=4,
+        help="Maximum concurrent implementation builds (default: 4)",
+    )
+    parser.add_argument(
+        "--config",
+        action="append",
+        default=None,
+        metavar="NAME[:key=value,...]",
+        help="Configuration to build; repeatable. Keys: "
+        f"{', '.join(_CONFIG_DIRECTIVE_KEYS)}, retiming. "
+        "Default: a built-in closure matrix (see DEFAULT_CONFIG_SPECS).",
+    )
+    parser.add_argument(
+        "--stop-after",
+        choices=STEPS,
+        help="Stop every configuration after this step",
+    )
+    parser.add_argument(
+        "--vivado-path",
+        default="vivado",
+        help="Path to Vivado executable (default: vivado from PATH)",
+    )
+    parser.add_argument(
+        "--keep-temps",
+        action="store_true",
+        help="Keep per-step temporary work directories in each configuration",
+    )
+    parser.add_argument(
+        "--force-synth",
+        action="store_true",
+        help="Resynthesize even when the synthesis cache matches",
+    )
+    args = parser.parse_args()
+
+    if args.jobs < 1:
+        parser.error("--jobs must be at least 1")
+
+    specs = args.config if args.config else DEFAULT_CONFIG_SPECS
+    try:
+        configs = [parse_config_spec(spec) for spec in specs]
+    except ValueError as e:
+        parser.error(str(e))
+    names = [config.name for config in configs]
+    duplicates = {name for name in names if names.count(name) > 1}
+    if duplicates:
+        parser.error(f"duplicate configuration name(s): {', '.join(sorted(duplicates))}")
+
+    board_name = args.board_name
+    sweep_root = SCRIPT_DIR / board_name / "sweep"
+
+    print(f"\n{'#'*70}")
+    print(f"# FROST FPGA configuration sweep — {board_name.upper()}")
+    print(f"# Configurations: {', '.join(names)}")
+    print(f"# Jobs: {args.jobs}")
+    print(f"{'#'*70}")
+
+    synth_work = run_synth_phase(
+        board_name, sweep_root, configs, args.vivado_path, args.force_synth
+    )
+
+    runs = []
+    for config in configs:
+        work_root = sweep_root / config.name
+        command = [
+            sys.executable,
+            str(SCRIPT_DIR / "build.py"),
+            board_name,
+            "--start-at",
+            "opt",
+            "--work-root",
+            str(work_root),
+            "--no-directive-sweep",
+            "--opt-directive",
+            config.opt,
+            "--place-directive",
+            config.place,
+            "--route-directive",
+            config.route,
+            "--second-route-directive",
+            config.second_route,
+            "--vivado-path",
+            args.vivado_path,
+        ]
+        if args.stop_after:
+            command.extend(["--stop-after", args.stop_after])
+        if args.keep_temps:
+            command.append("--keep-temps")
+        run = ConfigRun(
+            config=config,
+            work_root=work_root,
+            log_path=work_root / "build.log",
+            command=command,
+        )
+        seed_config_work_root(board_name, run, synth_work[config.synth_key()])
+        runs.append(run)
+
+    run_implementation_phase(board_name, runs, args.jobs)
+
+    eligible = [run for run in runs if run.returncode == 0 and run.wns is not None]
+    best_run = None
+    if eligible:
+        best_run = max(
+            eligible,
+            key=lambda run: (
+                run.wns if run.wns is not None else float("-inf"),
+                run.tns if run.tns is not None else float("-inf"),
+            ),
+        )
+
+    print_sweep_summary(board_name, runs, best_run)
+
+    if best_run is not None:
+        best_work = best_run.work_root / board_name / "work"
+        print(
+            f"\nBest configuration: {best_run.config.name} "
+            f"(WNS={format_sweep_ns(best_run.wns)} ns after {best_run.report_prefix})"
+        )
+        print(f"  Outputs: {best_work}")
+        bitstream = best_work / f"{board_name}_frost.bit"
+        if bitstream.exists():
+            print(f"  Bitstream: {bitstream}")
+
+    return 1 if any(run.returncode != 0 for run in runs) else 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
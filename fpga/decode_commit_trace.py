@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+
+#    Copyright 2026 Two Sigma Open Source, LLC
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+
+"""Decode a commit-trace buffer dump into a gprof-style flat profile.
+
+The commit-trace buffer (hw/rtl/peripherals/commit_trace_buffer.sv) records
+one entry per retired branch/jump: the branch PC, its outcome, and the cycle
+delta since the previous entry. Firmware drains the ring over UART with
+ctrace_dump() (sw/lib/src/ctrace.c) as a text block:
+
+    CTRACE-BEGIN <count> <wrapped>
+    <lo_hex> <hi_hex>          (one entry per line, oldest first)
+    CTRACE-END
+
+where lo = {pc[31:1], taken} and hi = the cycle delta. This script parses
+that block out of a captured console log, attributes each delta to the
+function containing the branch PC, and prints a flat profile.
+
+Symbols come from the ELF's symbol table via ``nm``: pass either the ELF
+itself (--elf, decoded with --nm-tool, default riscv64-unknown-elf-nm) or a
+pre-captured ``nm -n`` listing (--symbols). Without symbols the profile is
+keyed by raw PC instead.
+
+Attribution is by the PC of the branch that *ends* each straight-line run,
+so cycles spent in a function's body land on that function; a long run that
+crosses an inlined call boundary is charged to where it retired its next
+branch. That is the same granularity gprof's sampling gives, captured at
+full speed on hardware instead of in Verilator.
+
+Example:
+    fpga/decode_commit_trace.py capture.log --elf tomasulo_perf.elf
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+from pathlib import Path
+
+ENTRY_RE = re.compile(r"^([0-9a-fA-F]{8}) ([0-9a-fA-F]{8})\s*$")
+BEGIN_RE = re.compile(r"^CTRACE-BEGIN (\d+) (\d+)\s*$")
+# nm line: "<addr> <type> <name>"; keep text symbols (functions).
+NM_RE = re.compile(r"^([0-9a-fA-F]+)\s+([tTwW])\s+(\S+)\s*$")
+
+
+def parse_capture(path: Path) -> tuple[list[tuple[int, bool, int]], bool]:
+    """Extract trace entries from a console log.
+
+    Returns:
+        (entries, wrapped) where each entry is (pc, taken, cycle_delta),
+        oldest first. The last CTRACE block in the log wins.
+    """
+    entries: list[tuple[int, bool, int]] = []
+    wrapped = False
+    in_block = False
+    for line in path.read_text(errors="replace").splitlines():
+        begin = BEGIN_RE.match(line)
+        if begin:
+            entries = []
+            wrapped = begin.group(2) != "0"
+            in_block = True
+            continue
+        if line.startswith("CTRACE-END"):
+            in_block = False
+            continue
+        if not in_block:
+            continue
+        entry = ENTRY_RE.match(line)
+        if entry:
+            lo = int(entry.group(1), 16)
+            hi = int(entry.group(2), 16)
+            entries.append((lo & ~1, bool(lo & 1), hi))
+    return entries, wrapped
+
+
+def load_symbols(args: argparse.Namespace) -> list[tuple[int, str]]:
+    """Return function symbols as (address, name), sorted by address."""
+    if args.symbols:
+        nm_text = Path(args.symbols).read_text()
+    elif args.elf:
+        result = subprocess.run(
+            [args.nm_tool, "-n", args.elf],
+            capture_output=True,
+            text=True,
+            check=True,
+        )
+        nm_text = result.stdout
+    else:
+        return []
+
+    symbols = []
+    for line in nm_text.splitlines():
+        match = NM_RE.match(line)
+        if match:
+            symbols.append((int(match.group(1), 16), match.group(3)))
+    symbols.sort()
+    return symbols
+
+
+def lookup(symbols: list[tuple[int, str]], pc: int) -> str:
+    """Name of the function containing pc (binary search), or the raw PC."""
+    lo, hi = 0, len(symbols)
+    while lo < hi:
+        mid = (lo + hi) // 2
+        if symbols[mid][0] <= pc:
+            lo = mid + 1
+        else:
+            hi = mid
+    if lo == 0:
+        return f"0x{pc:08x}"
+    return symbols[lo - 1][1]
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(
+        description="Decode a commit-trace dump into a flat profile"
+    )
+    parser.add_argument("capture", type=Path, help="console log containing a CTRACE block")
+    parser.add_argument("--elf", help="ELF to take function symbols from (via nm)")
+    parser.add_argument("--symbols", help="pre-captured 'nm -n' listing instead of --elf")
+    parser.add_argument(
+        "--nm-tool",
+        default="riscv64-unknown-elf-nm",
+        help="nm executable used with --elf (default: %(default)s)",
+    )
+    parser.add_argument(
+        "--top", type=int, default=0, help="only print the top N functions (default: all)"
+    )
+    args = parser.parse_args()
+
+    entries, wrapped = parse_capture(args.capture)
+    if not entries:
+        print("error: no CTRACE block found in capture", file=sys.stderr)
+        return 1
+    symbols = load_symbols(args)
+
+    # Per-function accumulation: cycles, branch count, taken count.
+    profile: dict[str, list[int]] = {}
+    total_cycles = 0
+    for pc, taken, delta in entries:
+        name = lookup(symbols, pc)
+        stats = profile.setdefault(name, [0, 0, 0])
+        stats[0] += delta
+        stats[1] += 1
+        stats[2] += int(taken)
+        total_cycles += delta
+
+    rows = sorted(profile.items(), key=lambda kv: kv[1][0], reverse=True)
+    if args.top:
+        rows = rows[: args.top]
+
+    print(f"{len(entries)} entries, {total_cycles} cycles"
+          f"{' (ring wrapped: oldest entries dropped)' if wrapped else ''}")
+    print(f"{'cycles':>12} {'%':>6} {'branches':>9} {'taken':>7}  function")
+    for name, (cycles, branches, taken) in rows:
+        pct = 100.0 * cycles / total_cycles if total_cycles else 0.0
+        print(f"{cycles:>12} {pct:>6.2f} {branches:>9} {taken:>7}  {name}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+
+#    Copyright 2026 Two Sigma Open Source, LLC
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+
+"""Decode a pcprof histogram dump into a symbolized flat profile.
+
+The firmware sampling profiler (sw/lib/src/pcprof.c) records the interrupted
+PC of each mtimecmp tick into fixed-granularity address buckets and dumps
+them over UART with pcprof_report() as a text block:
+
+    PCPROF-BEGIN <base_hex> <shift> <samples> <other>
+    <bucket_index> <count>       (one line per non-zero bucket)
+    PCPROF-END
+
+This script parses that block out of a captured console log, maps each
+bucket's base address (base + index * 2^shift) to the function containing
+it, and prints a flat profile by sample count. Symbols come from the ELF's
+symbol table via ``nm``: pass either the ELF itself (--elf, decoded with
+--nm-tool, default riscv64-unknown-elf-nm) or a pre-captured ``nm -n``
+listing (--symbols). Without symbols the profile is keyed by bucket address.
+
+A bucket wider than a small function charges all of its samples to the
+function containing the bucket base; tighten pcprof_init()'s window to
+shrink the buckets when that matters.
+
+Example:
+    fpga/decode_pcprof.py capture.log --elf tomasulo_perf.elf
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+from pathlib import Path
+
+ENTRY_RE = re.compile(r"^(\d+) (\d+)\s*$")
+BEGIN_RE = re.compile(r"^PCPROF-BEGIN ([0-9a-fA-F]{8}) (\d+) (\d+) (\d+)\s*$")
+# nm line: "<addr> <type> <name>"; keep text symbols (functions).
+NM_RE = re.compile(r"^([0-9a-fA-F]+)\s+([tTwW])\s+(\S+)\s*$")
+
+
+def parse_capture(path: Path) -> tuple[list[tuple[int, int]], int, int, int, int]:
+    """Extract the histogram from a console log.
+
+    Returns:
+        (buckets, base, shift, samples, other) where each bucket is
+        (index, count). The last PCPROF block in the log wins.
+    """
+    buckets: list[tuple[int, int]] = []
+    base = shift = samples = other = 0
+    in_block = False
+    for line in path.read_text(errors="replace").splitlines():
+        begin = BEGIN_RE.match(line)
+        if begin:
+            buckets = []
+            base = int(begin.group(1), 16)
+            shift = int(begin.group(2))
+            samples = int(begin.group(3))
+            other = int(begin.group(4))
+            in_block = True
+            continue
+        if line.startswith("PCPROF-END"):
+            in_block = False
+            continue
+        if not in_block:
+            continue
+        entry = ENTRY_RE.match(line)
+        if entry:
+            buckets.append((int(entry.group(1)), int(entry.group(2))))
+    return buckets, base, shift, samples, other
+
+
+def load_symbols(args: argparse.Namespace) -> list[tuple[int, str]]:
+    """Return function symbols as (address, name), sorted by address."""
+    if args.symbols:
+        nm_text = Path(args.symbols).read_text()
+    elif args.elf:
+        result = subprocess.run(
+            [args.nm_tool, "-n", args.elf],
+            capture_output=True,
+            text=True,
+            check=True,
+        )
+        nm_text = result.stdout
+    else:
+        return []
+
+    symbols = []
+    for line in nm_text.splitlines():
+        match = NM_RE.match(line)
+        if match:
+            symbols.append((int(match.group(1), 16), match.group(3)))
+    symbols.sort()
+    return symbols
+
+
+def lookup(symbols: list[tuple[int, str]], pc: int) -> str:
+    """Name of the function containing pc (binary search), or the raw PC."""
+    lo, hi = 0, len(symbols)
+    while lo < hi:
+        mid = (lo + hi) // 2
+        if symbols[mid][0] <= pc:
+            lo = mid + 1
+        else:
+            hi = mid
+    if lo == 0:
+        return f"0x{pc:08x}"
+    return symbols[lo - 1][1]
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(
+        description="Decode a pcprof dump into a flat profile"
+    )
+    parser.add_argument("capture", type=Path, help="console log containing a PCPROF block")
+    parser.add_argument("--elf", help="ELF to take function symbols from (via nm)")
+    parser.add_argument("--symbols", help="pre-captured 'nm -n' listing instead of --elf")
+    parser.add_argument(
+        "--nm-tool",
+        default="riscv64-unknown-elf-nm",
+        help="nm executable used with --elf (default: %(default)s)",
+    )
+    parser.add_argument(
+        "--top", type=int, default=0, help="only print the top N functions (default: all)"
+    )
+    args = parser.parse_args()
+
+    buckets, base, shift, samples, other = parse_capture(args.capture)
+    if not buckets and samples == 0:
+        print("error: no PCPROF block found in capture", file=sys.stderr)
+        return 1
+    symbols = load_symbols(args)
+
+    profile: dict[str, int] = {}
+    for index, count in buckets:
+        name = lookup(symbols, base + (index << shift))
+        profile[name] = profile.get(name, 0) + count
+
+    rows = sorted(profile.items(), key=lambda kv: kv[1], reverse=True)
+    if args.top:
+        rows = rows[: args.top]
+
+    print(f"{samples} samples, {1 << shift}-byte buckets at 0x{base:08x}"
+          f"{f', {other} outside window' if other else ''}")
+    print(f"{'samples':>10} {'%':>6}  function")
+    for name, count in rows:
+        pct = 100.0 * count / samples if samples else 0.0
+        print(f"{count:>10} {pct:>6.2f}  {name}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
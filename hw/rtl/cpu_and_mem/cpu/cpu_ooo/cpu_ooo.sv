@@ -31,7 +31,9 @@ module cpu_ooo #(
     parameter int unsigned XLEN = riscv_pkg::XLEN,
     parameter int unsigned MEM_BYTE_ADDR_WIDTH = 16,
     parameter int unsigned MMIO_ADDR = 32'h4000_0000,
-    parameter int unsigned MMIO_SIZE_BYTES = 32'h2C,
+    parameter int unsigned MMIO_SIZE_BYTES = 32'h98,
+    // Hart index reported by mhartid (distinct per core in multi-core tops).
+    parameter int unsigned HART_ID = 0,
     // Cached memory tier (high-address region). Loads/stores to [CACHED_BASE,
     // CACHED_BASE+CACHED_SIZE_BYTES) are served by the cache hierarchy with
     // handshake (variable-latency) completion; the low BRAM range + MMIO stay
@@ -87,6 +89,15 @@ module cpu_ooo #(
     // only reaches it through the rare, ROB-head-serialized cached AMO.
     output logic [XLEN-1:0] o_data_mem_cached_wr_data,
     output logic o_data_mem_cached_read_enable,
+    // Cached-tier AMO RMW sideband riding the cached read enable: the adapter
+    // applies the new value at the cache when the old word returns, so a
+    // cached AMO costs a single round trip (see cached_tier_adapter.sv).
+    output logic o_data_mem_cached_read_is_amo,
+    output riscv_pkg::instr_op_e o_data_mem_cached_amo_op,
+    output logic [XLEN-1:0] o_data_mem_cached_amo_operand,
+    // Cached write fired this cycle must bypass the adapter's write-combine
+    // buffer (two-phase cached AMO writes; dormant with the RMW sideband on).
+    output logic o_data_mem_cached_write_no_combine,
     input logic [XLEN-1:0] i_cached_read_data,
     input logic i_cached_read_valid,
     input logic i_cached_write_done,
@@ -97,6 +108,11 @@ module cpu_ooo #(
     output logic o_mmio_fifo0_read_pulse,
     output logic o_mmio_fifo1_read_pulse,
     output logic o_mmio_uart_rx_ready_pulse,
+    // Committed-branch trace stream (commit_trace_buffer peripheral): one
+    // pulse per retired branch/jump with its PC and outcome.
+    output logic o_commit_trace_valid,
+    output logic [XLEN-1:0] o_commit_trace_pc,
+    output logic o_commit_trace_taken,
     // Status
     output logic o_rst_done,
     output logic o_vld,
@@ -137,11 +153,14 @@ module cpu_ooo #(
   logic [31:0] perf_counter_count;
   logic [7:0] wrapper_perf_counter_select;
   logic [63:0] wrapper_perf_counter_data;
+  // Per-cycle event bits from the aggregator for the programmable hpmcounters.
+  logic [riscv_pkg::HpmEventCount-1:0] hpm_events;
 
   // CSR dispatch fence: the CDB carries rs1 (write operand) for CSR ops,
   // not the CSR read result (which is only available at commit). Stall
   // dispatch after a CSR until it commits so no dependent instruction
-  // picks up the wrong CDB value.
+  // picks up the wrong CDB value. Renamed CSRR_CNT counter reads are exempt:
+  // they put the real counter value on the CDB and never set is_csr.
   logic csr_in_flight;
   logic csr_wb_pending;
   localparam int unsigned BranchInFlightCountWidth = $clog2(riscv_pkg::ReorderBufferDepth + 1);
@@ -318,6 +337,14 @@ module cpu_ooo #(
   assign dbg_commit_has_checkpoint = rob_commit_comb.has_checkpoint;
   assign dbg_commit_predicted_taken = rob_commit_comb.predicted_taken;
   assign dbg_commit_branch_taken = rob_commit_comb.branch_taken;
+
+  // Committed-branch trace stream for the commit_trace_buffer peripheral.
+  // Branches never retire in the widen-commit second slot (the head_next
+  // eligibility in reorder_buffer.sv excludes them), so the head commit port
+  // sees every retired branch/jump.
+  assign o_commit_trace_valid = rob_commit_comb.valid && rob_commit_comb.is_branch;
+  assign o_commit_trace_pc = rob_commit_comb.pc;
+  assign o_commit_trace_taken = rob_commit_comb.branch_taken;
   assign dbg_pd_pc = from_pd_to_id.program_counter;
   assign dbg_pd_instr = from_pd_to_id.instruction;
   assign dbg_id_pc = from_id_to_ex.program_counter;
@@ -548,6 +575,10 @@ module cpu_ooo #(
       .i_rf_to_id(rf_to_fwd),
       .i_fp_rf_to_id(fp_rf_to_fwd),
       .i_from_ma_to_wb(from_ma_to_wb_commit),
+      // mstatus.FS == Off turns FP instructions illegal (lazy FP context
+      // switching). Safe to consume at decode: CSR writes serialize the
+      // front end, so no FP instruction decoded under a stale FS survives.
+      .i_fp_disabled(csr_fp_disabled),
       .o_from_id_to_ex(from_id_to_ex),
       // Slot-2 (2-wide dispatch).  i_from_pd_to_id_2 carries the real second
       // instruction of the bundle; o_from_id_to_ex_2 is its decoded form, and
@@ -862,6 +893,9 @@ module cpu_ooo #(
   logic lq_mem_addr_valid;
   logic [XLEN-1:0] lq_mem_read_addr;
   riscv_pkg::mem_size_e lq_mem_read_size;
+  logic lq_mem_read_is_amo;
+  riscv_pkg::instr_op_e lq_mem_amo_op;
+  logic [XLEN-1:0] lq_mem_amo_operand;
   logic [XLEN-1:0] lq_mem_read_data;
   logic lq_mem_read_valid;
   logic lq_mem_request_valid;
@@ -978,6 +1012,11 @@ module cpu_ooo #(
   logic [XLEN-1:0] csr_read_data;  // registered (1-cycle latency)
   logic [XLEN-1:0] csr_mtvec;
 
+  // Speculative counter read port: ALU shim address out, counter value back
+  // (combinational; see csr_file's counter read mux).
+  logic [11:0] csr_counter_read_addr;
+  logic [XLEN-1:0] csr_counter_read_data;
+
   tomasulo_wrapper #(
       .SPLIT_RS_DISPATCH(1'b1),
       .ENABLE_DISPATCH_DONE_REPAIR(1'b1),
@@ -1246,6 +1285,10 @@ module cpu_ooo #(
       // CSR read data
       .i_csr_read_data(csr_read_data),
 
+      // Speculative counter read port (CSRR_CNT)
+      .o_csr_counter_read_addr(csr_counter_read_addr),
+      .i_csr_counter_read_data(csr_counter_read_data),
+
       // Store queue memory interface
       .o_sq_mem_write_en(sq_mem_write_en),
       .o_sq_mem_write_addr(sq_mem_write_addr),
@@ -1260,6 +1303,9 @@ module cpu_ooo #(
       .o_lq_mem_addr_valid(lq_mem_addr_valid),
       .o_lq_mem_read_addr(lq_mem_read_addr),
       .o_lq_mem_read_size(lq_mem_read_size),
+      .o_lq_mem_read_is_amo(lq_mem_read_is_amo),
+      .o_lq_mem_amo_op(lq_mem_amo_op),
+      .o_lq_mem_amo_operand(lq_mem_amo_operand),
       .i_lq_mem_read_data(lq_mem_read_data),
       .i_lq_mem_read_valid(lq_mem_read_valid),
 
@@ -1764,6 +1810,9 @@ module cpu_ooo #(
       .i_lq_mem_read_en(lq_mem_read_en),
       .i_lq_mem_read_addr(lq_mem_read_addr),
       .i_lq_mem_addr_valid(lq_mem_addr_valid),
+      .i_lq_mem_read_is_amo(lq_mem_read_is_amo),
+      .i_lq_mem_amo_op(lq_mem_amo_op),
+      .i_lq_mem_amo_operand(lq_mem_amo_operand),
       .i_data_mem_rd_data(i_data_mem_rd_data),
       .i_cached_read_data(i_cached_read_data),
       .i_cached_read_valid(i_cached_read_valid),
@@ -1777,6 +1826,10 @@ module cpu_ooo #(
       .o_data_mem_cached_byte_wr_en(o_data_mem_cached_byte_wr_en),
       .o_data_mem_cached_wr_data(o_data_mem_cached_wr_data),
       .o_data_mem_cached_read_enable(o_data_mem_cached_read_enable),
+      .o_data_mem_cached_read_is_amo(o_data_mem_cached_read_is_amo),
+      .o_data_mem_cached_amo_op(o_data_mem_cached_amo_op),
+      .o_data_mem_cached_amo_operand(o_data_mem_cached_amo_operand),
+      .o_data_mem_cached_write_no_combine(o_data_mem_cached_write_no_combine),
       .o_mmio_read_pulse(o_mmio_read_pulse),
       .o_mmio_load_addr(o_mmio_load_addr),
       .o_mmio_load_valid(o_mmio_load_valid),
@@ -1799,6 +1852,7 @@ module cpu_ooo #(
 
   logic [XLEN-1:0] csr_mstatus, csr_mie, csr_mepc;
   logic csr_mstatus_mie_direct;
+  logic csr_fp_disabled;
 
   // CSR write data: for register ops (CSRRW/CSRRS/CSRRC), the ALU shim
   // stored rs1 in rob_commit.value. For immediate ops (CSRRWI/CSRRSI/CSRRCI),
@@ -1859,7 +1913,8 @@ module cpu_ooo #(
   end
 
   csr_file #(
-      .XLEN(XLEN)
+      .XLEN(XLEN),
+      .HART_ID(HART_ID)
   ) csr_file_inst (
       .i_clk,
       .i_rst,
@@ -1870,6 +1925,8 @@ module cpu_ooo #(
       .i_csr_write_enable(csr_commit_fire),
       .o_csr_read_data(csr_read_data),
       .o_csr_read_data_comb(),
+      .i_csr_counter_read_addr(csr_counter_read_addr),
+      .o_csr_counter_read_data(csr_counter_read_data),
       .i_instruction_retired_count(instruction_retired_count),
       .i_interrupts(i_interrupts),
       .i_mtime(i_mtime),
@@ -1883,6 +1940,7 @@ module cpu_ooo #(
       .o_mtvec(csr_mtvec),
       .o_mepc(csr_mepc),
       .o_mstatus_mie_direct(csr_mstatus_mie_direct),
+      .o_fp_disabled(csr_fp_disabled),
       // FP flags: accumulated from ROB commit
       .i_fp_flags(rob_commit_fp_flags_merged),
       .i_fp_flags_valid(rob_commit_any_fp_flags_valid),
@@ -1893,7 +1951,8 @@ module cpu_ooo #(
       .o_perf_counter_select(perf_counter_select),
       .o_perf_snapshot_capture(perf_snapshot_capture),
       .i_perf_counter_data(perf_counter_data_q),
-      .i_perf_counter_count(perf_counter_count)
+      .i_perf_counter_count(perf_counter_count),
+      .i_hpm_events(hpm_events)
   );
 
   // CSR done acknowledgment — 1-cycle delay to match CSR file read latency.
@@ -1998,7 +2057,8 @@ module cpu_ooo #(
       .i_wrapper_perf_counter_data(wrapper_perf_counter_data),
       .o_wrapper_perf_counter_select(wrapper_perf_counter_select),
       .o_perf_counter_data_q(perf_counter_data_q),
-      .o_perf_counter_count(perf_counter_count)
+      .o_perf_counter_count(perf_counter_count),
+      .o_hpm_events(hpm_events)
   );
 
   // ===========================================================================
@@ -23,26 +23,81 @@
  *     is on i_req_addr that cycle. Completion: o_read_valid pulse with
  *     o_read_data (the addressed word), any number of cycles later.
  *   - i_write_byte_en != 0: a cached-region store fired this cycle (addr/data
- *     on i_req_addr/i_write_data). Completion: o_write_done pulse.
- *     o_write_inflight stays high from the cycle AFTER the fire until the done
- *     pulse; the router folds it into write_port_busy so no load issues while
- *     a cached store is pending (the fire cycle itself is covered by
- *     sq_mem_write_en), preserving load-vs-store ordering on the port.
+ *     on i_req_addr/i_write_data). Completion: o_write_done pulse -- for
+ *     combinable writes the cycle after they merge into the combine buffer,
+ *     for no-combine writes when the hierarchy responds. o_write_inflight
+ *     holds only while a write is staged un-acked or a line write is on the
+ *     wire (the LQ folds it into bus-busy); a merely-dirty combine buffer
+ *     does not block loads -- the read-side line hazard below owns ordering.
+ *
+ * WRITE COMBINING: committed stores drain from the SQ one scalar access at a
+ * time, so a memset/memcpy loop used to cost one full cache write round trip
+ * per word. Scalar writes now merge into a line-wide combine buffer
+ * (wc_data/wc_strb) and are acknowledged the cycle after they land -- the
+ * store is committed, so the buffer is the point of global visibility and
+ * the SQ can free the entry and drain the next store immediately. The buffer
+ * flushes as a single wstrb line write when:
+ *   - it is completely covered (the memset/memcpy steady state: one cache
+ *     write per line instead of one per word),
+ *   - an incoming write targets a different line (staged in a one-entry slot,
+ *     un-acked, until the buffer frees),
+ *   - a pending read addresses the buffered line (see ORDERING below),
+ *   - i_flush_req is asserted (fence.i drain: the hierarchy's writeback-all
+ *     must observe every acknowledged store, so the ROB-held sync request is
+ *     gated on o_flush_idle upstream),
+ *   - no write has merged for WC_IDLE_CYCLES (bounds the visibility window
+ *     when the store stream stops).
+ * Writes flagged i_write_no_combine (two-phase cached AMO writes) never merge:
+ * the buffer drains first, then the write issues standalone and completes only
+ * when the hierarchy responds, keeping atomics globally visible before the
+ * LQ broadcasts their result.
+ *
+ * AMO READ-MODIFY-WRITE: a read flagged i_read_is_amo carries an AMO op and
+ * rs2 operand. The adapter completes it as a single round trip: the line read
+ * returns the old word on o_read_valid as usual, and the same cycle the new
+ * word (riscv_pkg::amo_compute) is staged in a dedicated one-entry AMO write
+ * slot that flushes as a line write with priority over the combine buffer.
+ * That write completes SILENTLY -- no o_write_done (nothing upstream waits on
+ * it) and no o_write_inflight (so it never stalls unrelated load launches
+ * through the LQ's bus-busy fold; that is the point of the single-trip path).
+ * The staged slot is the point of global visibility, exactly like the
+ * early-acked combine buffer, and the read-side hazards own the ordering: a
+ * pending read to the AMO's line -- and any subsequent AMO read -- is held
+ * until the staged write lands. AMO issue is serialized at the ROB head with
+ * the SQ committed-empty, so the response can never belong to a squashed
+ * instruction and the slot is always free when an AMO read completes.
+ *
+ * ORDERING: early acknowledgement means a store can leave the SQ while its
+ * bytes still sit in the combine buffer, so LQ/SQ same-address ordering no
+ * longer covers it. The adapter owns the residual hazard: a pending read
+ * whose line matches the combine buffer (or the in-flight flush write) is
+ * held back -- and triggers the flush -- until the write lands. Reads to
+ * other lines proceed under the dirty buffer and under the flush flight
+ * (the L1's hit-under-miss port, as before). The LQ's L0 is invalidated at
+ * SQ drain time, before the store reaches the buffer, so it never serves
+ * buffered-but-unflushed bytes.
  *
  * Word<->line conversion: a CPU read becomes a full-line read and the
- * addressed word is muxed out of the 256-bit response. A CPU write becomes a
- * line write with the word replicated across every lane and the 4 byte
- * strobes shifted to the addressed lane (the cache merges on a miss).
+ * addressed word is muxed out of the 256-bit response. A standalone CPU
+ * write becomes a line write with the word replicated across every lane and
+ * the 4 byte strobes shifted to the addressed lane (the cache merges on a
+ * miss); a combine-buffer flush carries the accumulated lanes and strobes.
  *
- * Serialization: at most one line request in flight. One pending-read slot +
- * one pending-write slot; when both are occupied the read is always the older
- * (the router blocks cached loads while a cached store is in flight, and the
- * LQ's slow_outstanding gate blocks every load while a cached load is in
- * flight), so reads are served first. Invariants are assertion-checked.
+ * Concurrency: one pending-read slot + one in-flight-write slot, and BOTH may
+ * be in flight at once -- the L1's hit-under-miss port accepts a second
+ * request while a miss is outstanding, so a load can hit under a store's
+ * miss (and vice versa). Responses may therefore retire out of order;
+ * i_line_resp_write says which slot each one completes. The LQ's
+ * slow_outstanding gate still allows only one cached load at a time.
+ * Invariants are assertion-checked.
  */
 module cached_tier_adapter #(
     parameter int unsigned XLEN = 32,
-    parameter int unsigned LINE_BYTES = 32
+    parameter int unsigned LINE_BYTES = 32,
+    // Idle cycles (no merge) before a dirty combine buffer self-flushes. Must
+    // exceed the SQ's fire->ack->next-fire drain cadence (3 cycles) or
+    // back-to-back store streams flush every word.
+    parameter int unsigned WC_IDLE_CYCLES = 4
 ) (
     input logic i_clk,
     input logic i_rst,
@@ -50,14 +105,25 @@ module cached_tier_adapter #(
     // Router-facing request side.
     input logic            i_read_req,
     input logic [XLEN-1:0] i_req_addr,
+    // AMO RMW sideband (valid with i_read_req): complete this read as an
+    // atomic read-modify-write at the cache. See AMO READ-MODIFY-WRITE above.
+    input logic                 i_read_is_amo,
+    input riscv_pkg::instr_op_e i_amo_op,
+    input logic [XLEN-1:0]      i_amo_operand,
     input logic [     3:0] i_write_byte_en,
     input logic [XLEN-1:0] i_write_data,
+    // Write must not merge into the combine buffer (cached AMO writes).
+    input logic            i_write_no_combine,
+    // Drain request (fence.i): flush the combine buffer and finish the flight.
+    input logic            i_flush_req,
 
     // Router-facing completion side.
     output logic [XLEN-1:0] o_read_data,
     output logic            o_read_valid,
     output logic            o_write_done,
     output logic            o_write_inflight,
+    // No buffered, staged, or in-flight write bytes remain.
+    output logic            o_flush_idle,
 
     // Line port master (to the cache hierarchy).
     output logic                    o_line_req_valid,
@@ -67,113 +133,294 @@ module cached_tier_adapter #(
     output logic [LINE_BYTES*8-1:0] o_line_req_wdata,
     output logic [  LINE_BYTES-1:0] o_line_req_wstrb,
     input  logic                    i_line_resp_valid,
-    input  logic [LINE_BYTES*8-1:0] i_line_resp_rdata
+    input  logic [LINE_BYTES*8-1:0] i_line_resp_rdata,
+    // Which kind of request the response completes (frost_cache sideband).
+    input  logic                    i_line_resp_write
 );
 
   localparam int unsigned LineBits = LINE_BYTES * 8;
   localparam int unsigned WordsPerLine = LINE_BYTES / (XLEN / 8);
   localparam int unsigned WordSelBits = $clog2(WordsPerLine);
   localparam int unsigned OffsetBits = $clog2(LINE_BYTES);
+  localparam int unsigned IdleCntBits = $clog2(WC_IDLE_CYCLES + 1);
+
+  function automatic logic line_match(input logic [XLEN-1:0] lhs, input logic [XLEN-1:0] rhs);
+    line_match = (lhs[XLEN-1:OffsetBits] == rhs[XLEN-1:OffsetBits]);
+  endfunction
 
-  // ---- Pending request slots -------------------------------------------------
+  // ---- Pending read slot -----------------------------------------------------
   logic            pending_read_valid;
   logic [XLEN-1:0] pending_read_addr;
-  logic            pending_write_valid;
-  logic [XLEN-1:0] pending_write_addr;
-  logic [XLEN-1:0] pending_write_data;
-  logic [     3:0] pending_write_byte_en;
+  // AMO RMW sideband captured with the pending read.
+  logic                 pending_amo;
+  riscv_pkg::instr_op_e pending_amo_op;
+  logic [XLEN-1:0]      pending_amo_operand;
+
+  // ---- Staged AMO write (new value, waiting for a free line-write slot) -------
+  // Dedicated slot: it must not occupy st_* (whose occupancy implies the SQ is
+  // stalled on an un-acked store) and it drains with priority over the combine
+  // buffer so a younger same-line store flushing from the buffer can never
+  // overtake the atomic's write.
+  logic            amo_wr_valid;
+  logic [XLEN-1:0] amo_wr_addr;
+  logic [XLEN-1:0] amo_wr_data;
+
+  // ---- Write-combine buffer --------------------------------------------------
+  logic                  wc_valid;
+  logic [XLEN-1:0]       wc_addr;  // Line-aligned
+  logic [LineBits-1:0]   wc_data;
+  logic [LINE_BYTES-1:0] wc_strb;
+  logic [IdleCntBits-1:0] wc_idle_cnt;
+
+  // ---- Staged write (un-acked: different line, or no-combine) -----------------
+  logic            st_valid;
+  logic [XLEN-1:0] st_addr;
+  logic [XLEN-1:0] st_data;
+  logic [     3:0] st_byte_en;
+  logic            st_no_combine;
 
-  logic            write_fire;
+  // ---- In-flight slots -------------------------------------------------------
+  logic            read_inflight_q;
+  logic            write_inflight_q;
+  logic [XLEN-1:0] write_inflight_addr;
+  // The in-flight write is a standalone no-combine write: its completion (not
+  // an early ack) is the o_write_done pulse.
+  logic            write_inflight_standalone;
+  // The in-flight write is a staged AMO write: it completes silently (no
+  // o_write_done, excluded from o_write_inflight).
+  logic            write_inflight_silent;
+
+  logic write_fire;
   assign write_fire = |i_write_byte_en;
 
-  // ---- Issue FSM: one line transaction in flight ------------------------------
-  logic busy_q;  // a line request has fired and its response is outstanding
-  logic serving_read_q;
+  // A new write merges unless it is no-combine, a staged write already waits,
+  // the buffer holds a different line, or the buffer is flushing this cycle
+  // (its lanes must stay stable while presented on the line port).
+  logic wc_issue_fire;
+  logic merge_ok;
+  assign merge_ok = write_fire && !i_write_no_combine && !st_valid && !wc_issue_fire &&
+      (!wc_valid || line_match(i_req_addr, wc_addr));
+
+  // A staged combinable write allocates a fresh buffer once the flush frees it
+  // (combining continues behind the in-flight flush write).
+  logic promote_staged;
+  assign promote_staged = st_valid && !st_no_combine && !wc_valid && !write_fire;
+
+  // ---- Flush decision --------------------------------------------------------
+  logic wc_full;
+  assign wc_full = &wc_strb;
 
-  logic issue_read, issue_write;
-  assign issue_read = !busy_q && pending_read_valid;
-  assign issue_write = !busy_q && !pending_read_valid && pending_write_valid;
+  logic read_hazard_wc;
+  assign read_hazard_wc = pending_read_valid && wc_valid &&
+      line_match(pending_read_addr, wc_addr);
 
-  assign o_line_req_valid = issue_read || issue_write;
-  assign o_line_req_write = issue_write;
-  assign o_line_req_addr = issue_write ?
-      {pending_write_addr[XLEN-1:OffsetBits], {OffsetBits{1'b0}}} :
+  logic wc_flush_request;
+  assign wc_flush_request = wc_valid &&
+      (wc_full || st_valid || read_hazard_wc || i_flush_req ||
+       (wc_idle_cnt == '0));
+
+  // ---- Issue logic: up to one read + one write in flight ----------------------
+  // One request is PRESENTED at a time; the cache accepts the second one
+  // whenever its hit-under-miss port is ready (or after the first retires).
+  // A pending read is held back while its line sits in the combine buffer
+  // (the flush it triggered must land first), the staged AMO write, or the
+  // in-flight write. An AMO read is additionally held while ANY prior write
+  // is staged or on the wire: it must observe the previous atomic's value,
+  // and holding it guarantees the AMO write slot is free at its response.
+  logic issue_read, issue_write_amo, issue_write_wc, issue_write_st;
+  assign issue_read = pending_read_valid && !read_inflight_q &&
+      !(wc_valid && line_match(pending_read_addr, wc_addr)) &&
+      !(amo_wr_valid && line_match(pending_read_addr, amo_wr_addr)) &&
+      !(write_inflight_q && line_match(pending_read_addr, write_inflight_addr)) &&
+      !(pending_amo && (amo_wr_valid || write_inflight_q));
+  // Write priority: staged AMO first (it is architecturally oldest -- the SQ
+  // was committed-empty when its AMO fired, so anything in the combine buffer
+  // behind it is a younger store).
+  assign issue_write_amo = amo_wr_valid && !write_inflight_q && !issue_read;
+  assign issue_write_wc = wc_flush_request && !amo_wr_valid && !write_inflight_q && !issue_read;
+  assign issue_write_st = st_valid && st_no_combine && !wc_valid && !amo_wr_valid &&
+      !write_inflight_q && !issue_read;
+
+  assign o_line_req_valid = issue_read || issue_write_amo || issue_write_wc || issue_write_st;
+  assign o_line_req_write = issue_write_amo || issue_write_wc || issue_write_st;
+  assign o_line_req_addr =
+      issue_write_amo ? {amo_wr_addr[XLEN-1:OffsetBits], {OffsetBits{1'b0}}} :
+      issue_write_wc ? wc_addr :
+      issue_write_st ? {st_addr[XLEN-1:OffsetBits], {OffsetBits{1'b0}}} :
       {pending_read_addr[XLEN-1:OffsetBits], {OffsetBits{1'b0}}};
-  // Word replicated across every lane; the strobes select the addressed lanes.
-  assign o_line_req_wdata = {WordsPerLine{pending_write_data}};
+  // Flush: accumulated lanes/strobes. Standalone / AMO: word replicated across
+  // every lane with the strobes shifted to the addressed lane.
+  assign o_line_req_wdata =
+      issue_write_wc ? wc_data :
+      issue_write_amo ? {WordsPerLine{amo_wr_data}} : {WordsPerLine{st_data}};
   always_comb begin
-    o_line_req_wstrb = '0;
-    o_line_req_wstrb[pending_write_addr[OffsetBits-1:2]*4+:4] = pending_write_byte_en;
+    if (issue_write_wc) begin
+      o_line_req_wstrb = wc_strb;
+    end else if (issue_write_amo) begin
+      o_line_req_wstrb = '0;
+      o_line_req_wstrb[amo_wr_addr[OffsetBits-1:2]*4+:4] = 4'hF;
+    end else begin
+      o_line_req_wstrb = '0;
+      o_line_req_wstrb[st_addr[OffsetBits-1:2]*4+:4] = st_byte_en;
+    end
   end
 
   logic line_req_fire;
   assign line_req_fire = o_line_req_valid && i_line_req_ready;
+  assign wc_issue_fire = line_req_fire && issue_write_wc;
 
   // Word select for the read response, captured from the pending read address.
   logic [WordSelBits-1:0] read_word_sel;
   assign read_word_sel = pending_read_addr[2+:WordSelBits];
 
+  // Incoming-write lane placement within the combine buffer.
+  logic [WordSelBits-1:0] write_word_sel;
+  assign write_word_sel = i_req_addr[2+:WordSelBits];
+  logic [WordSelBits-1:0] st_word_sel;
+  assign st_word_sel = st_addr[2+:WordSelBits];
+
   always_ff @(posedge i_clk) begin
     if (i_rst) begin
-      pending_read_valid  <= 1'b0;
-      pending_write_valid <= 1'b0;
-      busy_q              <= 1'b0;
-      serving_read_q      <= 1'b0;
-      o_read_valid        <= 1'b0;
-      o_write_done        <= 1'b0;
+      pending_read_valid <= 1'b0;
+      pending_amo        <= 1'b0;
+      wc_valid           <= 1'b0;
+      wc_strb            <= '0;
+      st_valid           <= 1'b0;
+      amo_wr_valid       <= 1'b0;
+      read_inflight_q    <= 1'b0;
+      write_inflight_q   <= 1'b0;
+      o_read_valid       <= 1'b0;
+      o_write_done       <= 1'b0;
     end else begin
       o_read_valid <= 1'b0;
       o_write_done <= 1'b0;
 
-      // Enqueue router requests.
+      // Enqueue router read requests (with the AMO RMW sideband).
       if (i_read_req) begin
-        pending_read_valid <= 1'b1;
-        pending_read_addr  <= i_req_addr;
+        pending_read_valid  <= 1'b1;
+        pending_read_addr   <= i_req_addr;
+        pending_amo         <= i_read_is_amo;
+        pending_amo_op      <= i_amo_op;
+        pending_amo_operand <= i_amo_operand;
       end
-      if (write_fire) begin
-        pending_write_valid   <= 1'b1;
-        pending_write_addr    <= i_req_addr;
-        pending_write_data    <= i_write_data;
-        pending_write_byte_en <= i_write_byte_en;
+
+      // Merge / stage router write requests. Merged (and promoted) writes are
+      // acknowledged immediately: the store is committed and the buffer is
+      // the point of global visibility.
+      if (merge_ok) begin
+        wc_valid <= 1'b1;
+        if (!wc_valid) begin
+          wc_addr <= {i_req_addr[XLEN-1:OffsetBits], {OffsetBits{1'b0}}};
+        end
+        for (int unsigned b = 0; b < 4; b++) begin
+          if (i_write_byte_en[b]) begin
+            wc_data[(32*write_word_sel)+(8*b)+:8] <= i_write_data[8*b+:8];
+            wc_strb[(4*write_word_sel)+b] <= 1'b1;
+          end
+        end
+        wc_idle_cnt  <= IdleCntBits'(WC_IDLE_CYCLES);
+        o_write_done <= 1'b1;
+      end else if (write_fire) begin
+        st_valid      <= 1'b1;
+        st_addr       <= i_req_addr;
+        st_data       <= i_write_data;
+        st_byte_en    <= i_write_byte_en;
+        st_no_combine <= i_write_no_combine;
+      end else if (promote_staged) begin
+        wc_valid <= 1'b1;
+        wc_addr  <= {st_addr[XLEN-1:OffsetBits], {OffsetBits{1'b0}}};
+        for (int unsigned b = 0; b < 4; b++) begin
+          if (st_byte_en[b]) begin
+            wc_data[(32*st_word_sel)+(8*b)+:8] <= st_data[8*b+:8];
+            wc_strb[(4*st_word_sel)+b] <= 1'b1;
+          end
+        end
+        wc_idle_cnt  <= IdleCntBits'(WC_IDLE_CYCLES);
+        st_valid     <= 1'b0;
+        o_write_done <= 1'b1;
+      end
+
+      // Idle countdown toward the self-flush (held at zero once expired).
+      if (wc_valid && !merge_ok && (wc_idle_cnt != '0)) begin
+        wc_idle_cnt <= wc_idle_cnt - 1'b1;
       end
 
       // Launch the next line transaction.
       if (line_req_fire) begin
-        busy_q         <= 1'b1;
-        serving_read_q <= issue_read;
+        if (issue_read) begin
+          read_inflight_q <= 1'b1;
+        end else begin
+          write_inflight_q          <= 1'b1;
+          write_inflight_standalone <= issue_write_st;
+          write_inflight_silent     <= issue_write_amo;
+          write_inflight_addr       <= issue_write_amo ? amo_wr_addr :
+                                       issue_write_wc ? wc_addr : st_addr;
+          if (issue_write_amo) begin
+            amo_wr_valid <= 1'b0;
+          end else if (issue_write_wc) begin
+            wc_valid <= 1'b0;
+            wc_strb  <= '0;
+          end else begin
+            st_valid <= 1'b0;
+          end
+        end
       end
 
-      // Retire on the line response.
-      if (busy_q && i_line_resp_valid) begin
-        busy_q <= 1'b0;
-        if (serving_read_q) begin
+      // Retire on the line response; the write sideband says which slot it
+      // completes (responses may arrive out of order under hit-under-miss).
+      // Flush completions are silent (their stores were acked at merge);
+      // a standalone no-combine write completes here.
+      if (i_line_resp_valid) begin
+        if (i_line_resp_write) begin
+          write_inflight_q <= 1'b0;
+          if (write_inflight_standalone) begin
+            o_write_done <= 1'b1;
+          end
+        end else begin
+          read_inflight_q    <= 1'b0;
           pending_read_valid <= 1'b0;
           o_read_valid       <= 1'b1;
           o_read_data        <= i_line_resp_rdata[read_word_sel*XLEN+:XLEN];
-        end else begin
-          pending_write_valid <= 1'b0;
-          o_write_done        <= 1'b1;
+          // AMO RMW: the old word goes back on o_read_valid above; the new
+          // word is staged here and drains as a (silent) line write. The slot
+          // is free by construction: issue_read holds an AMO read while any
+          // prior write is staged or in flight.
+          if (pending_amo) begin
+            amo_wr_valid <= 1'b1;
+            amo_wr_addr  <= pending_read_addr;
+            amo_wr_data  <= riscv_pkg::amo_compute(
+                pending_amo_op, i_line_resp_rdata[read_word_sel*XLEN+:XLEN], pending_amo_operand);
+          end
         end
       end
     end
   end
 
-  // The store is "in flight" from the cycle after its fire until the done
-  // pulse. The fire cycle itself is covered by sq_mem_write_en in the router's
-  // write_port_busy, so coverage is gapless.
-  assign o_write_inflight = pending_write_valid;
+  // A write is "in flight" while a staged (un-acked) write waits or a line
+  // write is on the wire. A merely-dirty combine buffer does NOT count: the
+  // ack already released the SQ, and loads may run under it (the read-side
+  // line hazard above owns the ordering) -- blocking them would stall every
+  // load of a memcpy loop behind the destination buffer. The staged AMO write
+  // (and its silent flight) does not count either, for the same reason: the
+  // read-side hazards own its ordering, and folding it into the LQ's bus-busy
+  // would re-serialize every younger load behind the atomic's write drain.
+  assign o_write_inflight = st_valid || (write_inflight_q && !write_inflight_silent);
+
+  assign o_flush_idle = !wc_valid && !st_valid && !amo_wr_valid && !write_inflight_q;
 
 `ifndef SYNTHESIS
   always_ff @(posedge i_clk) begin
     if (!i_rst) begin
       if (i_read_req && pending_read_valid)
         $error("cached_tier_adapter: read request while a read is already pending");
-      if (i_read_req && pending_write_valid)
-        $error("cached_tier_adapter: read request while a write is pending (router must block)");
-      if (write_fire && pending_write_valid)
-        $error("cached_tier_adapter: write request while a write is already pending");
-      if (i_line_resp_valid && !busy_q)
-        $error("cached_tier_adapter: line response with no transaction in flight");
+      if (write_fire && st_valid)
+        $error("cached_tier_adapter: write request while a write is already staged");
+      if (i_line_resp_valid && !i_line_resp_write && !read_inflight_q)
+        $error("cached_tier_adapter: read response with no read in flight");
+      if (i_line_resp_valid && i_line_resp_write && !write_inflight_q)
+        $error("cached_tier_adapter: write response with no write in flight");
+      if (i_line_resp_valid && !i_line_resp_write && pending_amo && amo_wr_valid)
+        $error("cached_tier_adapter: AMO read response with the AMO write slot occupied");
     end
   end
 `endif
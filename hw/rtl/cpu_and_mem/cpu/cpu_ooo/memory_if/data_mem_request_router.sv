@@ -29,15 +29,16 @@
  * i_cached_write_done any number of cycles after the request, and holds
  * i_cached_write_inflight while a cached store is pending. The LQ's
  * single-outstanding slow gate blocks every load launch while a cached load
- * is in flight, and write_port_busy (which folds in the write-inflight hold)
- * queues loads behind a pending cached store, so the fast and cached read
- * responses can never overlap -- per-tier mutual exclusion.
+ * is in flight, so the fast and cached read responses can never overlap --
+ * per-tier mutual exclusion. Loads are NOT queued behind an in-flight cached
+ * store: the cache's hit-under-miss port serves a load hit under the store's
+ * miss (same-address ordering is owned by the LQ/SQ).
  */
 
 module data_mem_request_router #(
     parameter int unsigned XLEN = riscv_pkg::XLEN,
     parameter int unsigned MMIO_ADDR = 32'h4000_0000,
-    parameter int unsigned MMIO_SIZE_BYTES = 32'h2C,
+    parameter int unsigned MMIO_SIZE_BYTES = 32'h98,
     // Cached memory tier (high-address region). Loads/stores to
     // [CACHED_BASE, CACHED_BASE+CACHED_SIZE_BYTES) are served by the cache
     // hierarchy with variable latency; the low BRAM range + MMIO stay 1-cycle.
@@ -65,6 +66,14 @@ module data_mem_request_router #(
     input logic            i_lq_mem_read_en,
     input logic [XLEN-1:0] i_lq_mem_read_addr,
     input logic            i_lq_mem_addr_valid,
+    // Cached-tier AMO RMW sideband riding the read request: the adapter
+    // computes and commits the new value at the cache when the old word
+    // returns, so a cached AMO costs one round trip and i_amo_mem_write_en
+    // never fires for it. Ignored for non-cached reads (the fast tier keeps
+    // the two-phase AMO write path).
+    input logic                 i_lq_mem_read_is_amo,
+    input riscv_pkg::instr_op_e i_lq_mem_amo_op,
+    input logic [XLEN-1:0]      i_lq_mem_amo_operand,
 
     // External data memory read data (BRAM, combinational the cycle after a read
     // is accepted; the cpu_and_mem mux folds in registered MMIO read data).
@@ -88,6 +97,15 @@ module data_mem_request_router #(
     // on the single cycle a cached AMO write is launched to the adapter.
     output logic [XLEN-1:0] o_data_mem_cached_wr_data,
     output logic            o_data_mem_cached_read_enable,
+    // Cached-tier AMO RMW sideband, forwarded with the cached read enable
+    // (held/queued alongside the read address when the port is busy).
+    output logic                 o_data_mem_cached_read_is_amo,
+    output riscv_pkg::instr_op_e o_data_mem_cached_amo_op,
+    output logic [XLEN-1:0]      o_data_mem_cached_amo_operand,
+    // The cached write fired this cycle must not merge into the adapter's
+    // write-combine buffer (cached AMO writes: they complete only when the
+    // hierarchy responds, keeping atomics globally visible at their done).
+    output logic            o_data_mem_cached_write_no_combine,
     output logic            o_mmio_read_pulse,
     output logic [XLEN-1:0] o_mmio_load_addr,
     output logic            o_mmio_load_valid,
@@ -114,6 +132,9 @@ module data_mem_request_router #(
   logic            lq_mem_read_en;
   logic [XLEN-1:0] lq_mem_read_addr;
   logic            lq_mem_addr_valid;
+  logic            lq_mem_read_is_amo;
+  riscv_pkg::instr_op_e lq_mem_amo_op;
+  logic [XLEN-1:0] lq_mem_amo_operand;
   assign sq_mem_write_en        = i_sq_mem_write_en;
   assign sq_mem_write_addr      = i_sq_mem_write_addr;
   assign sq_mem_write_data      = i_sq_mem_write_data;
@@ -126,6 +147,9 @@ module data_mem_request_router #(
   assign lq_mem_read_en         = i_lq_mem_read_en;
   assign lq_mem_read_addr       = i_lq_mem_read_addr;
   assign lq_mem_addr_valid      = i_lq_mem_addr_valid;
+  assign lq_mem_read_is_amo     = i_lq_mem_read_is_amo;
+  assign lq_mem_amo_op          = i_lq_mem_amo_op;
+  assign lq_mem_amo_operand     = i_lq_mem_amo_operand;
 
   // Router-internal state / nets.
   localparam logic [XLEN-1:0] UartRxDataMmioAddr = MMIO_ADDR[XLEN-1:0] + XLEN'(32'h4);
@@ -141,10 +165,23 @@ module data_mem_request_router #(
   logic [XLEN-1:0] lq_mem_read_data;
   logic            lq_mem_read_valid;
   logic            lq_mem_request_is_mmio;
+  // Queued copies of the AMO RMW sideband (held with the blocked address).
+  logic            lq_mem_request_is_amo;
+  riscv_pkg::instr_op_e lq_mem_request_amo_op;
+  logic [XLEN-1:0] lq_mem_request_amo_operand;
+  logic            lq_mem_request_is_amo_eff;
+  riscv_pkg::instr_op_e lq_mem_request_amo_op_eff;
+  logic [XLEN-1:0] lq_mem_request_amo_operand_eff;
 
   // Effective queued-load address: held copy if a request is pending, else the
-  // live LQ read address.
+  // live LQ read address. The AMO sideband follows the same held-or-live rule.
   assign lq_mem_request_addr_eff = lq_mem_request_valid ? lq_mem_request_addr : lq_mem_read_addr;
+  assign lq_mem_request_is_amo_eff =
+      lq_mem_request_valid ? lq_mem_request_is_amo : lq_mem_read_is_amo;
+  assign lq_mem_request_amo_op_eff =
+      lq_mem_request_valid ? lq_mem_request_amo_op : lq_mem_amo_op;
+  assign lq_mem_request_amo_operand_eff =
+      lq_mem_request_valid ? lq_mem_request_amo_operand : lq_mem_amo_operand;
   assign lq_mem_request_is_mmio =
       (lq_mem_request_addr_eff >= MMIO_ADDR[XLEN-1:0]) &&
       (lq_mem_request_addr_eff < (MMIO_ADDR[XLEN-1:0] + MMIO_SIZE_BYTES[XLEN-1:0]));
@@ -186,7 +223,10 @@ module data_mem_request_router #(
       (amo_mem_write_addr >= CACHED_BASE[XLEN-1:0]) &&
       (amo_mem_write_addr <  (CACHED_BASE[XLEN-1:0] + CACHED_SIZE_BYTES[XLEN-1:0]));
 
-  // Cached AMO write handshake. The LQ holds i_amo_mem_write_en high for the
+  // Cached AMO write handshake (two-phase fallback: with the LQ's RMW
+  // sideband enabled a cached AMO commits its write inside the adapter and
+  // i_amo_mem_write_en never fires with a cached address, leaving this path
+  // dormant). The LQ holds i_amo_mem_write_en high for the
   // whole AMO write phase (until it sees o_amo_mem_write_done), but the
   // cached_tier_adapter must see the byte-write-enable as a SINGLE-CYCLE pulse
   // (it re-enqueues on every cycle the strobe is non-zero). amo_cached_inflight
@@ -208,11 +248,15 @@ module data_mem_request_router #(
     end
   end
 
-  // A cached store owns the write port from its fire (sq_mem_write_en) until
-  // its done pulse (i_cached_write_inflight covers the cycles in between), so
-  // loads queue behind it and the 1-deep queued-load register can never be
-  // overwritten by launches during a long store flight.
-  assign write_port_busy = sq_mem_write_en || amo_mem_write_en || i_cached_write_inflight;
+  // The port is busy only on the fire cycle of a store/AMO (the SQ drain and
+  // AMO hold). A cached store's flight no longer blocks loads: the L1's
+  // hit-under-miss port lets a load hit complete under the store's miss, the
+  // adapter matches the two completions on the response-kind sideband, and
+  // same-address ordering is already owned by the LQ (a younger same-address
+  // load never issues while the older store sits in the SQ). A cached AMO
+  // write still holds amo_mem_write_en for its whole flight, so AMOs keep
+  // the old conservative blocking.
+  assign write_port_busy = sq_mem_write_en || amo_mem_write_en;
 
   always_comb begin
     // Load queue memory read. Bypass the one-entry request register when the
@@ -258,6 +302,11 @@ module data_mem_request_router #(
         (sq_mem_write_en && sq_mem_write_is_cached) ? sq_mem_write_byte_en :
         amo_cached_write_launch ? 4'b1111 : 4'b0000;
 
+    // Only AMO writes opt out of the adapter's write combining; SQ store
+    // drains are early-acked from the combine buffer.
+    o_data_mem_cached_write_no_combine =
+        !(sq_mem_write_en && sq_mem_write_is_cached) && amo_cached_write_launch;
+
     // Cached-tier write data: SQ-store drain data normally; the AMO new value
     // on the launch pulse. Off the BRAM WEA cone (separate cached-only port).
     o_data_mem_cached_wr_data = amo_cached_write_launch ? amo_mem_write_data : sq_mem_write_data;
@@ -269,6 +318,13 @@ module data_mem_request_router #(
     // (miss/fill/evict) and must not fire for low-BRAM loads.
     o_data_mem_cached_read_enable = o_data_mem_read_enable && lq_mem_request_is_cached;
 
+    // AMO RMW sideband alongside the cached read enable. The flag is
+    // qualified by the accepted-read pulse (the adapter captures it with the
+    // pending read); op/operand are plain payload and need no qualification.
+    o_data_mem_cached_read_is_amo = o_data_mem_cached_read_enable && lq_mem_request_is_amo_eff;
+    o_data_mem_cached_amo_op      = lq_mem_request_amo_op_eff;
+    o_data_mem_cached_amo_operand = lq_mem_request_amo_operand_eff;
+
     // AMO write completion. Fast tier (BRAM): the write lands the same cycle,
     // so done is combinational as before. Cached tier: the adapter completes
     // the line write with a variable-latency i_cached_write_done pulse, so the
@@ -317,7 +373,10 @@ module data_mem_request_router #(
   // conflict clears. Unblocked loads bypass this register entirely.
   always_ff @(posedge i_clk) begin
     if (lq_mem_read_en && write_port_busy) begin
-      lq_mem_request_addr <= lq_mem_read_addr;
+      lq_mem_request_addr        <= lq_mem_read_addr;
+      lq_mem_request_is_amo      <= lq_mem_read_is_amo;
+      lq_mem_request_amo_op      <= lq_mem_amo_op;
+      lq_mem_request_amo_operand <= lq_mem_amo_operand;
     end
   end
 
@@ -23,6 +23,8 @@
  * snapshots them on demand, and muxes the selected counter (top-level or
  * tomasulo_wrapper range) to the CSR read port. A registered selector and a
  * registered read result break the high-fanout selector -> counter -> CSR cone.
+ * Also exports the registered per-event increment bits as an event bus for the
+ * programmable hpmcounters in csr_file.
  *
  * Extracted verbatim from cpu_ooo (no functional change): the body below is the
  * former "Profiling Counter Aggregation" section together with its parameter and
@@ -57,7 +59,12 @@ module perf_counter_aggregator (
     input  logic [63:0] i_wrapper_perf_counter_data,
     output logic [ 7:0] o_wrapper_perf_counter_select,
     output logic [63:0] o_perf_counter_data_q,
-    output logic [31:0] o_perf_counter_count
+    output logic [31:0] o_perf_counter_count,
+
+    // One bit per top-level event (the registered increment LSBs), for the
+    // programmable hpmcounters in csr_file. Indexing matches the Perf* counter
+    // numbering above.
+    output logic [riscv_pkg::HpmEventCount-1:0] o_hpm_events
 );
 
   localparam int unsigned PerfTopCounterCount = 23;
@@ -92,6 +99,12 @@ module perf_counter_aggregator (
   localparam int unsigned PerfPredictionFenceIndirect = 22;
   localparam int unsigned PerfTopSnapshotBankSpan = (PerfTopCounterCount + 3) / 4;
 
+  initial begin
+    // The exported event bus must cover exactly the top-level counters.
+    if (riscv_pkg::HpmEventCount != PerfTopCounterCount)
+      $fatal(1, "perf_counter_aggregator: riscv_pkg::HpmEventCount must match PerfTopCounterCount");
+  end
+
   // --- Port aliases: keep the extracted body identical to the cpu_ooo original.
   riscv_pkg::reorder_buffer_alloc_req_t        rob_alloc_req;
   riscv_pkg::dispatch_status_t                 dispatch_status;
@@ -257,4 +270,13 @@ module perf_counter_aggregator (
   assign o_perf_counter_data_q         = perf_counter_data_q;
   assign o_perf_counter_count          = perf_counter_count;
 
+  // Event bus for the programmable hpmcounters: the registered increment LSBs,
+  // so the consumer sees the same per-cycle events these counters accumulate
+  // without adding load to the raw event cones.
+  always_comb begin
+    for (int i = 0; i < PerfTopCounterCount; i++) begin
+      o_hpm_events[i] = perf_top_inc_q[i][0];
+    end
+  end
+
 endmodule : perf_counter_aggregator
@@ -118,6 +118,18 @@ module ex_comb_synthesizer #(
         from_ex_comb_synth.btb_update_requires_pc_reg_handoff = 1'b1;
       end
 
+      if (mispredict_commit_q.is_jalr && !mispredict_commit_q.is_return) begin
+        // Indirect-target predictor training.  JALR stays excluded from the
+        // BTB update above (its target is register-dependent, and last-target
+        // caching there would evict trained branch entries); the dedicated
+        // history-indexed table learns the resolved target instead.  Returns
+        // belong to the RAS.  Train-on-mispredict only: a correctly-predicted
+        // site's entry is already right.
+        from_ex_comb_synth.ind_update        = 1'b1;
+        from_ex_comb_synth.ind_update_pc     = mispredict_commit_q.pc;
+        from_ex_comb_synth.ind_update_target = mispredict_commit_q.branch_target;
+      end
+
       if (mispredict_commit_q.has_checkpoint) begin
         from_ex_comb_synth.ras_misprediction       = 1'b1;
         from_ex_comb_synth.ras_restore_tos         = restored_ras_tos;
@@ -133,8 +145,14 @@ module ex_comb_synthesizer #(
     end else if (correct_branch_commit_pending) begin
       // Correctly-predicted branch commit: update BTB (no PC redirect).
       // Uses registered commit data to break rob_exception → BTB critical path.
-      if (correct_branch_commit_q.is_branch && !correct_branch_commit_q.is_jal &&
-          !correct_branch_commit_q.is_jalr) begin
+      // JAL is included: with the PD-stage unconditional-jump redirect, a
+      // BTB-cold JAL commits as correctly predicted (the PD target override
+      // matches the precomputed target), so this path is what promotes the
+      // site into the BTB. Excluding it would leave cold call sites paying
+      // the 2-bubble PD redirect forever instead of a zero-bubble IF hit.
+      // For BTB-hit JALs the write is a redundant refresh of an identical
+      // entry, same as every correctly-predicted conditional branch.
+      if (correct_branch_commit_q.is_branch && !correct_branch_commit_q.is_jalr) begin
         from_ex_comb_synth.btb_update = 1'b1;
         from_ex_comb_synth.btb_update_pc = correct_branch_commit_q.pc;
         from_ex_comb_synth.btb_update_target = correct_branch_commit_q.branch_target;
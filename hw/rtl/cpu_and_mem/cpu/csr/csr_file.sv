@@ -32,7 +32,7 @@
     - minstret/minstreth (0xB02/0xB82): Machine-mode alias for instret counter
 
   Machine-mode CSRs (for trap/interrupt handling):
-    - mstatus (0x300): Machine status (MIE, MPIE bits)
+    - mstatus (0x300): Machine status (MIE, MPIE, FS bits + SD summary)
     - misa (0x301): Machine ISA (read-only, reports RV32IMAFB)
     - mie (0x304): Machine interrupt enable (MEIE, MTIE, MSIE)
     - mtvec (0x305): Machine trap vector base address
@@ -42,13 +42,34 @@
     - mtval (0x343): Machine trap value
     - mip (0x344): Machine interrupt pending (read-only, directly wired to inputs)
 
+  Hardware performance monitor (programmable event counters):
+    - mhpmcounter3..6 / mhpmcounter3h..6h (0xB03../0xB83..): 64-bit event counters
+    - mhpmevent3..6 (0x323..): event selectors, choosing among the top-level
+      profiling event wires exported by perf_counter_aggregator:
+        [7:0]  EVENT: 0 = off, 1..HpmEventCount = event wire EVENT-1
+               (numbering matches the aggregator's counter indices + 1)
+        [8]    EDGE: 0 = count every qualified cycle (level),
+               1 = count only 0->1 transitions of the qualified event
+        [16:9] THRESH: count only once the event has been asserted for more
+               than THRESH consecutive cycles (0 = no qualification), which
+               separates sustained stall episodes from isolated blips
+      Unlike the fixed-function MPERF bank, these are programmed at run time,
+      so one bitstream answers open-ended cross-product questions.
+
   The module supports all six Zicsr instructions:
     - CSRRW/CSRRWI: Atomic read/write
     - CSRRS/CSRRSI: Atomic read and set bits
     - CSRRC/CSRRCI: Atomic read and clear bits
+
+  The read-only counter CSRs are additionally exposed on a dedicated
+  combinational read port so the OOO core's renamed CSRR_CNT reads can
+  execute speculatively without the commit-time serialization handshake.
 */
 module csr_file #(
-    parameter int unsigned XLEN = 32
+    parameter int unsigned XLEN = 32,
+    // Hart index reported by mhartid. Multi-core tops give each core a
+    // distinct value; boot code branches on it to split work across cores.
+    parameter int unsigned HART_ID = 0
 ) (
     input logic i_clk,
     input logic i_rst,
@@ -62,6 +83,13 @@ module csr_file #(
     output logic [XLEN-1:0] o_csr_read_data,      // CSR read value (registered, 1-cycle latency)
     output logic [XLEN-1:0] o_csr_read_data_comb, // CSR read value (combinational, same cycle)
 
+    // Speculative counter read port (for renamed CSRR_CNT reads). Reads of the
+    // read-only counter CSRs have no side effects, so the INT ALU shim reads
+    // them combinationally at issue time instead of serializing at commit.
+    // Addresses outside riscv_pkg::csr_addr_is_counter read as zero.
+    input  logic [    11:0] i_csr_counter_read_addr,
+    output logic [XLEN-1:0] o_csr_counter_read_data,
+
     // Instruction retire count: 0, 1, or 2 per cycle.  For widen-commit
     // the OOO core can retire two entries in a single cycle; the instret
     // counter must increment by the retire count.
@@ -91,6 +119,10 @@ module csr_file #(
     // Direct output of mstatus MIE bit for timing and simpler consumers.
     output logic o_mstatus_mie_direct,
 
+    // mstatus.FS == Off: id_stage turns FP instructions into illegal ops so
+    // an RTOS can lazily fault in FP context save/restore.
+    output logic o_fp_disabled,
+
     // F extension: FP exception flags from FPU (to accumulate in fflags)
     input riscv_pkg::fp_flags_t i_fp_flags,
     input logic i_fp_flags_valid,  // Valid when FP instruction retires (gated by o_vld)
@@ -113,7 +145,11 @@ module csr_file #(
     output logic [ 7:0] o_perf_counter_select,
     output logic        o_perf_snapshot_capture,
     input  logic [63:0] i_perf_counter_data,
-    input  logic [31:0] i_perf_counter_count
+    input  logic [31:0] i_perf_counter_count,
+
+    // Per-cycle event bits for the programmable hpmcounters (registered in
+    // perf_counter_aggregator, one bit per top-level profiling event)
+    input logic [riscv_pkg::HpmEventCount-1:0] i_hpm_events
 );
 
   // ==========================================================================
@@ -138,10 +174,20 @@ module csr_file #(
   // Machine-mode CSRs
   // mstatus: store MIE and MPIE as separate registers so hot-path bit updates
   // do not require read/modify/write of the full CSR word.
+  // FS (bits 14:13) gates the FPU for lazy FP context switching: while Off
+  // (2'b00) the decoder raises illegal-instruction on any FP instruction, so
+  // an RTOS can skip the FP file on context switches and fault the
+  // save/restore in on first use. Hardware does not walk FS to Dirty on FP
+  // writeback -- the fault-in handler sets Dirty when it grants the unit
+  // (sufficient for lazy switching on a machine-mode-only core). Resets to
+  // Dirty so bare-metal apps keep full FPU access with no setup.
   logic            mstatus_mie;  // Machine Interrupt Enable (bit 3)
   logic            mstatus_mpie;  // Machine Previous Interrupt Enable (bit 7)
-  logic [XLEN-1:0] mstatus;  // Constructed from mie and mpie
-  assign mstatus = {19'b0, 2'b11, 3'b0, mstatus_mpie, 3'b0, mstatus_mie, 3'b0};
+  logic [1:0]      mstatus_fs;  // FP unit status (bits 14:13); 2'b00 = Off
+  logic [XLEN-1:0] mstatus;  // Constructed from the individual fields
+  // Bit 31 is SD, the FS == Dirty summary bit.
+  assign mstatus = {&mstatus_fs, 16'b0, mstatus_fs, 2'b11, 3'b0,
+                    mstatus_mpie, 3'b0, mstatus_mie, 3'b0};
 
   // mie CSR: store each interrupt enable as separate register
   logic mie_msie;  // Machine Software Interrupt Enable (bit 3)
@@ -153,6 +199,7 @@ module csr_file #(
   // Next-state signals for mstatus bits (computed combinationally)
   logic next_mstatus_mie;
   logic next_mstatus_mpie;
+  logic [1:0] next_mstatus_fs;
   // Next-state signals for mie bits
   logic next_mie_msie;
   logic next_mie_mtie;
@@ -165,6 +212,16 @@ module csr_file #(
   logic [XLEN-1:0] mtval;  // Trap value
   logic [XLEN-1:0] perf_counter_select;
 
+  // Hardware performance monitor state. hpm_event holds the raw mhpmevent
+  // word; its EVENT/EDGE/THRESH fields are decoded in the generate block below.
+  logic [63:0] hpm_counter[riscv_pkg::HpmCounterCount];
+  logic [XLEN-1:0] hpm_event[riscv_pkg::HpmCounterCount];
+  logic [riscv_pkg::HpmCounterCount-1:0] hpm_event_raw;  // selected event bit this cycle
+  logic [riscv_pkg::HpmCounterCount-1:0] hpm_event_qualified;  // after threshold qualification
+  logic [riscv_pkg::HpmCounterCount-1:0] hpm_event_qualified_q;  // for edge detection
+  logic [riscv_pkg::HpmCounterCount-1:0] hpm_inc_q;  // registered counter increment
+  logic [7:0] hpm_run_len[riscv_pkg::HpmCounterCount];  // consecutive asserted cycles (saturating)
+
   // mip is read-only and directly reflects interrupt inputs
   logic [XLEN-1:0] mip;
   assign mip = {20'b0, i_interrupts.meip, 3'b0, i_interrupts.mtip, 3'b0, i_interrupts.msip, 3'b0};
@@ -183,6 +240,9 @@ module csr_file #(
   // Direct output of mstatus_mie register bypasses full-word CSR concatenation.
   assign o_mstatus_mie_direct = mstatus_mie;
 
+  // FS == Off: id_stage raises illegal-instruction on FP instructions.
+  assign o_fp_disabled = (mstatus_fs == 2'b00);
+
   // ==========================================================================
   // CSR Write Data Calculation
   // ==========================================================================
@@ -209,6 +269,18 @@ module csr_file #(
       riscv_pkg::CsrMperfSel: csr_current_value = perf_counter_select;
       default:                csr_current_value = '0;
     endcase
+
+    // Programmable hpmcounter CSRs decode by index; their addresses fall
+    // through to the default arm of the unique case above.
+    for (int i = 0; i < riscv_pkg::HpmCounterCount; i++) begin
+      if (i_csr_address == 12'(riscv_pkg::CsrMhpmcounter3 + i)) begin
+        csr_current_value = hpm_counter[i][31:0];
+      end else if (i_csr_address == 12'(riscv_pkg::CsrMhpmcounter3H + i)) begin
+        csr_current_value = hpm_counter[i][63:32];
+      end else if (i_csr_address == 12'(riscv_pkg::CsrMhpmevent3 + i)) begin
+        csr_current_value = hpm_event[i];
+      end
+    end
   end
 
   // Calculate new value based on CSR operation
@@ -246,6 +318,80 @@ module csr_file #(
     end
   end
 
+  // ==========================================================================
+  // Hardware Performance Monitor Counters (mhpmcounter3..n)
+  // ==========================================================================
+  // Event selection and qualification. EVENT=0 parks the counter. The run
+  // length register tracks how many consecutive cycles the raw event has been
+  // asserted (saturating at 255) so THRESH can gate on sustained assertion;
+  // EDGE mode then counts qualified rising edges instead of qualified cycles.
+  // The increment is registered before accumulation, mirroring
+  // perf_counter_aggregator, so the event-select mux never sits on the
+  // counter add path.
+
+  for (genvar g = 0; g < riscv_pkg::HpmCounterCount; g++) begin : gen_hpm_event
+    logic [7:0] event_sel;
+    logic       edge_mode;
+    logic [7:0] threshold;
+    assign event_sel = hpm_event[g][7:0];
+    assign edge_mode = hpm_event[g][8];
+    assign threshold = hpm_event[g][16:9];
+
+    assign hpm_event_raw[g] =
+        (event_sel != 8'd0 && event_sel <= 8'(riscv_pkg::HpmEventCount)) ?
+        i_hpm_events[event_sel-8'd1] : 1'b0;
+
+    // Run length holds the count of consecutive asserted cycles *before* the
+    // current one, so THRESH=N means "asserted for more than N cycles".
+    assign hpm_event_qualified[g] = hpm_event_raw[g] && (hpm_run_len[g] >= threshold);
+
+    always_ff @(posedge i_clk) begin
+      if (i_rst) begin
+        hpm_run_len[g] <= 8'd0;
+        hpm_event_qualified_q[g] <= 1'b0;
+        hpm_inc_q[g] <= 1'b0;
+      end else begin
+        if (!hpm_event_raw[g]) begin
+          hpm_run_len[g] <= 8'd0;
+        end else if (hpm_run_len[g] != 8'hFF) begin
+          hpm_run_len[g] <= hpm_run_len[g] + 8'd1;
+        end
+        hpm_event_qualified_q[g] <= hpm_event_qualified[g];
+        hpm_inc_q[g] <= edge_mode ?
+            (hpm_event_qualified[g] && !hpm_event_qualified_q[g]) :
+            hpm_event_qualified[g];
+      end
+    end
+  end
+
+  // Counter accumulation and CSR writes. A CSR write to a counter half or an
+  // event selector wins over that cycle's event increment (same priority rule
+  // as the fflags block below).
+  always_ff @(posedge i_clk) begin
+    if (i_rst) begin
+      for (int i = 0; i < riscv_pkg::HpmCounterCount; i++) begin
+        hpm_counter[i] <= 64'd0;
+        hpm_event[i]   <= '0;
+      end
+    end else begin
+      for (int i = 0; i < riscv_pkg::HpmCounterCount; i++) begin
+        if (i_csr_write_enable && i_csr_read_enable &&
+            i_csr_address == 12'(riscv_pkg::CsrMhpmcounter3 + i)) begin
+          hpm_counter[i] <= {hpm_counter[i][63:32], csr_new_value};
+        end else if (i_csr_write_enable && i_csr_read_enable &&
+                     i_csr_address == 12'(riscv_pkg::CsrMhpmcounter3H + i)) begin
+          hpm_counter[i] <= {csr_new_value, hpm_counter[i][31:0]};
+        end else begin
+          hpm_counter[i] <= hpm_counter[i] + {63'd0, hpm_inc_q[i]};
+        end
+        if (i_csr_write_enable && i_csr_read_enable &&
+            i_csr_address == 12'(riscv_pkg::CsrMhpmevent3 + i)) begin
+          hpm_event[i] <= csr_new_value;
+        end
+      end
+    end
+  end
+
   // ==========================================================================
   // F Extension CSR Updates (fflags, frm)
   // ==========================================================================
@@ -318,6 +464,7 @@ module csr_file #(
     // Default: keep current values
     next_mstatus_mie = mstatus_mie;
     next_mstatus_mpie = mstatus_mpie;
+    next_mstatus_fs = mstatus_fs;
     next_mie_msie = mie_msie;
     next_mie_mtie = mie_mtie;
     next_mie_meie = mie_meie;
@@ -334,6 +481,7 @@ module csr_file #(
       if (i_csr_address == riscv_pkg::CsrMstatus) begin
         next_mstatus_mie  = csr_new_value[3];
         next_mstatus_mpie = csr_new_value[7];
+        next_mstatus_fs   = csr_new_value[14:13];
       end else if (i_csr_address == riscv_pkg::CsrMie) begin
         next_mie_msie = csr_new_value[3];
         next_mie_mtie = csr_new_value[7];
@@ -348,12 +496,14 @@ module csr_file #(
     if (i_rst) begin
       mstatus_mie <= 1'b0;
       mstatus_mpie <= 1'b0;
+      mstatus_fs <= 2'b11;  // Dirty: FPU fully available out of reset
       mie_msie <= 1'b0;
       mie_mtie <= 1'b0;
       mie_meie <= 1'b0;
     end else begin
       mstatus_mie <= next_mstatus_mie;
       mstatus_mpie <= next_mstatus_mpie;
+      mstatus_fs <= next_mstatus_fs;
       mie_msie <= next_mie_msie;
       mie_mtie <= next_mie_mtie;
       mie_meie <= next_mie_meie;
@@ -461,9 +611,59 @@ module csr_file #(
         riscv_pkg::CsrMperfCount: csr_read_data_comb = i_perf_counter_count;
         // Machine information registers (read-only)
         riscv_pkg::CsrMhartid:
-        csr_read_data_comb = '0;  // Hardware thread ID (always 0 for single-core)
+        csr_read_data_comb = XLEN'(HART_ID);  // Hardware thread ID (per-core parameter)
         default: csr_read_data_comb = '0;
       endcase
+
+      // Programmable hpmcounter CSRs (indexed decode, see csr_current_value)
+      for (int i = 0; i < riscv_pkg::HpmCounterCount; i++) begin
+        if (i_csr_address == 12'(riscv_pkg::CsrMhpmcounter3 + i)) begin
+          csr_read_data_comb = hpm_counter[i][31:0];
+        end else if (i_csr_address == 12'(riscv_pkg::CsrMhpmcounter3H + i)) begin
+          csr_read_data_comb = hpm_counter[i][63:32];
+        end else if (i_csr_address == 12'(riscv_pkg::CsrMhpmevent3 + i)) begin
+          csr_read_data_comb = hpm_event[i];
+        end
+      end
+    end
+  end
+
+  // ==========================================================================
+  // Speculative Counter Read Port
+  // ==========================================================================
+  // Combinational read of the side-effect-free counter CSRs for renamed
+  // CSRR_CNT reads issued from the INT reservation station. The path is
+  // counter register -> address mux -> shim result (one CDB-adapter register
+  // away from the arbiter), comparable to the ALU's single-cycle paths.
+  // Non-counter addresses read as zero; dispatch only rewrites reads whose
+  // address passes riscv_pkg::csr_addr_is_counter, so that case is unreachable
+  // in practice.
+
+  always_comb begin
+    o_csr_counter_read_data = '0;
+
+    unique case (i_csr_counter_read_addr)
+      riscv_pkg::CsrCycle, riscv_pkg::CsrMcycle: o_csr_counter_read_data = cycle_counter[31:0];
+      riscv_pkg::CsrCycleH, riscv_pkg::CsrMcycleH: o_csr_counter_read_data = cycle_counter[63:32];
+      riscv_pkg::CsrTime: o_csr_counter_read_data = i_mtime[31:0];
+      riscv_pkg::CsrTimeH: o_csr_counter_read_data = i_mtime[63:32];
+      riscv_pkg::CsrInstret, riscv_pkg::CsrMinstret:
+      o_csr_counter_read_data = instret_counter[31:0];
+      riscv_pkg::CsrInstretH, riscv_pkg::CsrMinstretH:
+      o_csr_counter_read_data = instret_counter[63:32];
+      riscv_pkg::CsrMperfData: o_csr_counter_read_data = i_perf_counter_data[31:0];
+      riscv_pkg::CsrMperfDataH: o_csr_counter_read_data = i_perf_counter_data[63:32];
+      riscv_pkg::CsrMperfCount: o_csr_counter_read_data = i_perf_counter_count;
+      default: o_csr_counter_read_data = '0;
+    endcase
+
+    // Programmable hpmcounter CSRs (indexed decode, see csr_current_value)
+    for (int i = 0; i < riscv_pkg::HpmCounterCount; i++) begin
+      if (i_csr_counter_read_addr == 12'(riscv_pkg::CsrMhpmcounter3 + i)) begin
+        o_csr_counter_read_data = hpm_counter[i][31:0];
+      end else if (i_csr_counter_read_addr == 12'(riscv_pkg::CsrMhpmcounter3H + i)) begin
+        o_csr_counter_read_data = hpm_counter[i][63:32];
+      end
     end
   end
 
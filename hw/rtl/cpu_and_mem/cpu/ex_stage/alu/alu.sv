@@ -72,8 +72,13 @@ module alu #(
   logic [XLEN:0] difference;
   logic sltu;
 
-  // Multiplier unit - 4-cycle tiled DSP pipeline (33x33 signed -> 64-bit)
-  multiplier multiplier_inst (
+  // Multiplier unit - 4-cycle tiled DSP pipeline (33x33 signed -> 64-bit).
+  // Early termination enabled: this in-order core issues one multiply at a
+  // time (the pipe ahead is always empty), so 16x16-or-smaller operands
+  // complete in 2 cycles and shorten the stall.
+  multiplier #(
+      .EARLY_TERMINATE(1'b1)
+  ) multiplier_inst (
       .i_clk,
       .i_rst,
       .i_operand_a(multiplier_input_a),
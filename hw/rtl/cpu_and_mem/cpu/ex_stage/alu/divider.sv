@@ -17,7 +17,8 @@
 /*
  * Radix-2 Restoring Division Unit - RISC-V M-extension DIV/REM operations
  *
- * Implements pipelined radix-2 restoring division with 2x folding (2 bits per stage).
+ * Implements pipelined radix-2 restoring division with BITS_PER_STAGE-way
+ * folding (default 4 quotient bits per stage).
  * Supports both signed (DIV, REM) and unsigned (DIVU, REMU) operations.
  *
  * Algorithm Overview (Restoring Division):
@@ -37,15 +38,18 @@
  *     Iteration 4: R=0011, shift+subtract: 0011-0010 ≥ 0, Q[0]=1, R=0001
  *     Result: Quotient=0011 (3), Remainder=0001 (1) ✓
  *
- * Pipeline Structure (2x Folded):
- * ===============================
+ * Pipeline Structure (folded):
+ * ============================
  *   +---------+   +---------+   +---------+       +---------+   +---------+
- *   | Stage 0 | > | Stage 1 | > | Stage 2 | > ... |Stage 15 | > | Output  |
- *   | (init)  |   | 2 bits  |   | 2 bits  |       | 2 bits  |   | (sign)  |
+ *   | Stage 0 | > | Stage 1 | > | Stage 2 | > ... | Stage 8 | > | Output  |
+ *   | (init)  |   | 4 bits  |   | 4 bits  |       | 4 bits  |   | (sign)  |
  *   +---------+   +---------+   +---------+       +---------+   +---------+
  *
- *   Each stage computes 2 quotient bits (2x folding reduces pipeline depth).
- *   Stage 0 initializes with absolute values; output stage applies sign correction.
+ *   Each stage computes BITS_PER_STAGE quotient bits (chained
+ *   subtract-or-restore iterations between flops; the chain depth is the
+ *   frequency limiter, so drop the parameter to 2 if closure gets tight).
+ *   Stage 0 initializes with absolute values; output stage applies sign
+ *   correction.
  *
  * Signed Division Handling:
  * =========================
@@ -62,16 +66,24 @@
  *
  * Performance:
  * ============
- *   - Latency: 17 cycles (1 init + 16 division stages)
+ *   - Latency: WIDTH/BITS_PER_STAGE + 1 cycles (9 for the default 32/4)
  *   - Throughput: 1 division per cycle (fully pipelined)
  *   - Pipeline stall in hazard unit during wait
+ *   - Fixed latency on purpose: early termination on small operands would
+ *     make results complete out of order against int_muldiv_shim's in-flight
+ *     shift-register tracking, and the full pipelining already overlaps
+ *     back-to-back divides, so a variable-latency fast path buys little
  *
  * Related Modules:
  *   - alu.sv: Instantiates divider, selects quotient vs remainder
  *   - int_muldiv_shim.sv: Tracks in-flight divide results for the OOO CDB
  */
 module divider #(
-    parameter int unsigned WIDTH = 32  // Bit width (32 for RV32)
+    parameter int unsigned WIDTH = 32,  // Bit width (32 for RV32)
+    // Quotient bits retired per pipeline stage (must divide WIDTH).  Shared
+    // with int_muldiv_shim's in-flight tracker via riscv_pkg so the depths
+    // cannot drift apart.
+    parameter int unsigned BITS_PER_STAGE = riscv_pkg::DivBitsPerStage
 ) (
     input logic i_clk,
     input logic i_rst,
@@ -102,8 +114,9 @@ module divider #(
     remainder_should_be_negative = dividend_is_negative;
   end
 
-  // 2x-folded radix-2 division requires one pipeline stage per 2 bits (32 stages for 32-bit)
-  localparam int unsigned NumPipelineStages = WIDTH / 2;
+  // Folded radix-2 division: one pipeline stage per BITS_PER_STAGE bits
+  // (8 stages for the default 32-bit / 4-per-stage configuration)
+  localparam int unsigned NumPipelineStages = WIDTH / BITS_PER_STAGE;
 
   // Pipeline arrays for each stage - carry values through division process
   logic [WIDTH-1:0] remainder_pipeline     [NumPipelineStages+1];  // +1 bit for subtraction
@@ -127,48 +140,41 @@ module divider #(
     divide_by_zero_pipeline[0] <= (i_divisor == '0) & i_valid_input;
   end
 
-  // Main radix-2 restoring division pipeline (stages 1 through WIDTH)
-  // Each stage computes one bit of the quotient through shift-and-subtract
+  // Main radix-2 restoring division pipeline
+  // Each stage computes BITS_PER_STAGE quotient bits through chained
+  // shift-and-subtract iterations between flop stages
   generate
     for (
         genvar stage_index = 0; stage_index < NumPipelineStages; ++stage_index
     ) begin : gen_division_stages
       logic [WIDTH:0] remainder_shifted;
       logic [WIDTH:0] subtraction_result;
-      logic subtraction_is_negative;
       logic [WIDTH:0] next_remainder;
-      logic [1:0] quotient_bits;
+      logic [BITS_PER_STAGE-1:0] quotient_bits;
 
-      // perform two iterations prior to next flip-flop stage
+      // Perform BITS_PER_STAGE iterations prior to the next flip-flop stage.
+      // Each iteration: shift the partial remainder left bringing in the next
+      // dividend bit (from the quotient register's MSB side), try subtracting
+      // the divisor, keep the difference if non-negative (quotient bit 1),
+      // restore otherwise (quotient bit 0).
       always_comb begin
-        // first iteration:
-        // Shift remainder left and bring in next bit from quotient
-        remainder_shifted = {
-          remainder_pipeline[stage_index][WIDTH-1:0], quotient_pipeline[stage_index][WIDTH-1]
-        };
-        // Try subtracting divisor from shifted remainder
-        subtraction_result = remainder_shifted - divisor_pipeline[stage_index];
-        // Check if subtraction result is negative (MSB is sign bit)
-        subtraction_is_negative = subtraction_result[WIDTH];
-        // If negative, restore remainder; otherwise keep subtraction result
-        next_remainder = subtraction_is_negative ? remainder_shifted : subtraction_result;
-        // Quotient bit is 1 if subtraction succeeded (not negative)
-        quotient_bits[1] = ~subtraction_is_negative;
-
-        // second iteration:
-        remainder_shifted = {WIDTH'(next_remainder), quotient_pipeline[stage_index][WIDTH-2]};
-        subtraction_result = remainder_shifted - divisor_pipeline[stage_index];
-        subtraction_is_negative = subtraction_result[WIDTH];
-        next_remainder = subtraction_is_negative ? remainder_shifted : subtraction_result;
-        quotient_bits[0] = ~subtraction_is_negative;
+        next_remainder = {1'b0, remainder_pipeline[stage_index]};
+        for (int b = 0; b < BITS_PER_STAGE; b++) begin
+          remainder_shifted = {
+            next_remainder[WIDTH-1:0], quotient_pipeline[stage_index][WIDTH-1-b]
+          };
+          subtraction_result = remainder_shifted - divisor_pipeline[stage_index];
+          next_remainder = subtraction_result[WIDTH] ? remainder_shifted : subtraction_result;
+          quotient_bits[BITS_PER_STAGE-1-b] = ~subtraction_result[WIDTH];
+        end
       end
 
       // Sequential registers advance values to next stage
       always_ff @(posedge i_clk) begin
         remainder_pipeline[stage_index+1] <= WIDTH'(next_remainder);
-        // Shift quotient left and insert new quotient bit at LSB
+        // Shift quotient left and insert new quotient bits at LSB
         quotient_pipeline[stage_index+1] <= {
-          quotient_pipeline[stage_index][WIDTH-3:0], quotient_bits
+          quotient_pipeline[stage_index][WIDTH-BITS_PER_STAGE-1:0], quotient_bits
         };
         // Propagate control signals through pipeline
         divisor_pipeline[stage_index+1] <= divisor_pipeline[stage_index];
@@ -67,8 +67,21 @@
  *   MULH:   Both operands sign-extended ({rs[31], rs})
  *   MULHSU: rs1 sign-extended, rs2 zero-extended
  *   MULHU:  Both operands zero-extended
+ *
+ * Early termination (EARLY_TERMINATE = 1):
+ *   When both magnitudes fit in 16 bits — the overwhelmingly common case in
+ *   fixed-point code — the whole product is a single signed 17x17 DSP tile,
+ *   so the op skips S1-S3 and completes in 2 cycles instead of 4. The skip
+ *   is taken only when S1 and S2 are empty, which keeps completion strictly
+ *   in order and collision-free: back-to-back streams still run the full
+ *   4-stage path at 1 op/cycle, while dependent chains (where the pipe ahead
+ *   is empty) get the short latency. With EARLY_TERMINATE = 0 the latency is
+ *   exactly 4 cycles for every op; the out-of-order MUL shim's positional
+ *   tag tracker depends on that fixed depth, so it keeps the default.
  */
-module multiplier (
+module multiplier #(
+    parameter bit EARLY_TERMINATE = 1'b0
+) (
     input logic i_clk,
     input logic i_rst,
     input logic signed [32:0] i_operand_a,  // 33-bit signed input
@@ -104,6 +117,15 @@ module multiplier (
   logic neg_s0_reg;
   logic vld_s0_reg;
 
+  // Pre-negated low 16 bits of A for the early-termination tile (only
+  // meaningful when both magnitudes are small; a cheap 17-bit negate that
+  // fits S0's short combinational budget).
+  logic signed [16:0] a_small_signed_comb;
+  logic signed [16:0] a_small_signed_s0_reg;
+
+  assign a_small_signed_comb = neg_comb ? (~{1'b0, a_mag_comb[15:0]} + 17'd1)
+                                        : {1'b0, a_mag_comb[15:0]};
+
   always_ff @(posedge i_clk) begin
     if (i_rst) begin
       vld_s0_reg <= 1'b0;
@@ -115,9 +137,28 @@ module multiplier (
   always_ff @(posedge i_clk) begin
     a_mag_s0_reg <= a_mag_comb;
     b_mag_s0_reg <= b_mag_comb;
-    neg_s0_reg   <= neg_comb;
+    neg_s0_reg <= neg_comb;
+    a_small_signed_s0_reg <= a_small_signed_comb;
   end
 
+  // ---------------------------------------------------------------------------
+  // Early termination — 16x16-or-smaller operands with an empty pipe ahead
+  //
+  // The signed product is one 17x17 DSP tile (sign folded into the
+  // pre-negated A half), registered straight into the output stage: the op
+  // completes 2 cycles after i_valid_input. Requiring S1 and S2 empty rules
+  // out both an output-register collision (an op in S2 writes the product
+  // register this same edge) and out-of-order completion (an op in S1 would
+  // finish a cycle after us).
+  // ---------------------------------------------------------------------------
+  logic small_s0_comb;
+  logic early_take;
+  (* use_dsp = "yes" *)logic signed [33:0] p_early_comb;
+
+  assign small_s0_comb = (a_mag_s0_reg[32:16] == '0) && (b_mag_s0_reg[32:16] == '0);
+  assign early_take = EARLY_TERMINATE & vld_s0_reg & small_s0_comb & ~vld_s1_reg & ~vld_s2_reg;
+  assign p_early_comb = a_small_signed_s0_reg * $signed({1'b0, b_mag_s0_reg[15:0]});
+
   // ---------------------------------------------------------------------------
   // Stage S1 — DSP48E2-shaped 17x17 / 17x16 / 16x17 / 16x16 partial products
   // ---------------------------------------------------------------------------
@@ -150,7 +191,7 @@ module multiplier (
     if (i_rst) begin
       vld_s1_reg <= 1'b0;
     end else begin
-      vld_s1_reg <= vld_s0_reg;
+      vld_s1_reg <= vld_s0_reg & ~early_take;
     end
   end
 
@@ -233,16 +274,20 @@ module multiplier (
     if (i_rst) begin
       vld_s3_reg <= 1'b0;
     end else begin
-      vld_s3_reg <= vld_s2_reg;
+      vld_s3_reg <= vld_s2_reg | early_take;
     end
   end
 
   always_ff @(posedge i_clk) begin
-    prod_s3_reg <= signed_full_comb;
+    if (early_take) begin
+      prod_s3_reg <= {{32{p_early_comb[33]}}, p_early_comb};
+    end else begin
+      prod_s3_reg <= signed_full_comb;
+    end
   end
 
   assign o_product_result        = prod_s3_reg[63:0];
   assign o_valid_output          = vld_s3_reg;
-  assign o_completing_next_cycle = vld_s2_reg;
+  assign o_completing_next_cycle = vld_s2_reg | early_take;
 
 endmodule : multiplier
@@ -0,0 +1,159 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/*
+ * DSP-tiled unsigned multiplier, fully pipelined (initiation interval 1).
+ *
+ * Same {27x35} tile decomposition as dsp_tiled_multiplier_unsigned.sv so
+ * synthesis infers the same DSP48E2-friendly cascades, but instead of the
+ * iterative chunked reduction it spends one register rank per binary
+ * adder-tree level and accepts a new operand pair every cycle:
+ *
+ *   rank 0            : registered aligned tile products (the tile multiplies
+ *                       read the input ports directly; the caller's operand
+ *                       registers serve as the DSP input rank)
+ *   ranks 1..NumLevels: pairwise full-width adds, one tree level per rank
+ *   padding ranks     : plain registers up to the fixed LATENCY
+ *
+ * The tree adds are full product-width; at the term counts this core is
+ * instantiated with (<= 4 terms for FLEN mantissas) the carry chains close
+ * timing comfortably. Revisit with chunked adds if a wider instance appears.
+ *
+ * Interface contract:
+ *   - One operand pair may be presented every cycle via i_valid_input.
+ *   - o_valid_output / o_product_result follow exactly LATENCY cycles later.
+ *   - LATENCY must be >= 1 + NumLevels (elaboration-checked).
+ */
+module dsp_tiled_multiplier_pipelined #(
+    parameter int unsigned A_WIDTH = 33,
+    parameter int unsigned B_WIDTH = 33,
+    parameter int unsigned A_TILE_WIDTH = 27,
+    parameter int unsigned B_TILE_WIDTH = 35,
+    parameter int unsigned LATENCY = 3
+) (
+    input logic i_clk,
+    input logic i_rst,
+    input logic i_valid_input,
+    input logic [A_WIDTH-1:0] i_operand_a,
+    input logic [B_WIDTH-1:0] i_operand_b,
+    output logic [A_WIDTH+B_WIDTH-1:0] o_product_result,
+    output logic o_valid_output
+);
+
+  localparam int unsigned ProductWidth = A_WIDTH + B_WIDTH;
+  localparam int unsigned NumATiles = (A_WIDTH + A_TILE_WIDTH - 1) / A_TILE_WIDTH;
+  localparam int unsigned NumBTiles = (B_WIDTH + B_TILE_WIDTH - 1) / B_TILE_WIDTH;
+  localparam int unsigned NumTerms = NumATiles * NumBTiles;
+  localparam int unsigned NumLevels = (NumTerms <= 1) ? 0 : $clog2(NumTerms);
+  localparam int unsigned PartialWidth = A_TILE_WIDTH + B_TILE_WIDTH;
+
+  // Rank 0 (tile products) plus one rank per tree level is the minimum depth;
+  // anything beyond that becomes output-side padding registers.
+  localparam int unsigned MinLatency = 1 + NumLevels;
+
+  generate
+    if (LATENCY < MinLatency) begin : gen_latency_check
+      $error("LATENCY (%0d) below pipeline minimum (%0d)", LATENCY, MinLatency);
+    end
+  endgenerate
+
+  function automatic int unsigned terms_at_level(input int unsigned level);
+    terms_at_level = (NumTerms + (1 << level) - 1) >> level;
+  endfunction
+
+  logic [ProductWidth-1:0] aligned_term_comb[NumTerms];
+
+  // ---------------------------------------------------------------------------
+  // Combinational: slice wide operands into {27,35}-bit tiles and align terms.
+  // ---------------------------------------------------------------------------
+  generate
+    for (genvar a = 0; a < NumATiles; a++) begin : gen_a_tiles
+      localparam int unsigned AOffset = a * A_TILE_WIDTH;
+      localparam int unsigned AWidthThis =
+          ((AOffset + A_TILE_WIDTH) <= A_WIDTH) ? A_TILE_WIDTH : (A_WIDTH - AOffset);
+      logic [A_TILE_WIDTH-1:0] a_tile;
+      assign a_tile = {{(A_TILE_WIDTH - AWidthThis) {1'b0}}, i_operand_a[AOffset+:AWidthThis]};
+
+      for (genvar b = 0; b < NumBTiles; b++) begin : gen_b_tiles
+        localparam int unsigned BOffset = b * B_TILE_WIDTH;
+        localparam int unsigned BWidthThis =
+            ((BOffset + B_TILE_WIDTH) <= B_WIDTH) ? B_TILE_WIDTH : (B_WIDTH - BOffset);
+        localparam int unsigned TermIndex = (a * NumBTiles) + b;
+        logic [B_TILE_WIDTH-1:0] b_tile;
+        (* use_dsp = "yes" *)logic [PartialWidth-1:0] tiled_partial_product;
+
+        assign b_tile = {{(B_TILE_WIDTH - BWidthThis) {1'b0}}, i_operand_b[BOffset+:BWidthThis]};
+        assign tiled_partial_product = PartialWidth'(a_tile * b_tile);
+        assign aligned_term_comb[TermIndex] =
+            ProductWidth'(tiled_partial_product) << (AOffset + BOffset);
+      end
+    end
+  endgenerate
+
+  // ---------------------------------------------------------------------------
+  // Pipelined binary reduction tree: rank 0 registers the aligned tile
+  // products, each following rank registers the pairwise sums of the rank
+  // above it.  Data registers carry no reset.
+  // ---------------------------------------------------------------------------
+  logic [ProductWidth-1:0] term_regs[MinLatency][NumTerms];
+
+  always_ff @(posedge i_clk) begin
+    for (int t = 0; t < NumTerms; t++) begin
+      term_regs[0][t] <= aligned_term_comb[t];
+    end
+    for (int lvl = 1; lvl < MinLatency; lvl++) begin
+      for (int t = 0; t < NumTerms; t++) begin
+        if (t < terms_at_level(lvl)) begin
+          term_regs[lvl][t] <= term_regs[lvl-1][2*t] +
+              (((2 * t) + 1 < terms_at_level(lvl - 1)) ? term_regs[lvl-1][(2*t)+1] : '0);
+        end else begin
+          term_regs[lvl][t] <= '0;
+        end
+      end
+    end
+  end
+
+  // ---------------------------------------------------------------------------
+  // Output-side padding to the fixed LATENCY, plus the valid shift register
+  // (the only resettable state in the module).
+  // ---------------------------------------------------------------------------
+  logic valid_pipe[LATENCY];
+
+  always_ff @(posedge i_clk) begin
+    if (i_rst) begin
+      for (int i = 0; i < LATENCY; i++) valid_pipe[i] <= 1'b0;
+    end else begin
+      valid_pipe[0] <= i_valid_input;
+      for (int i = 1; i < LATENCY; i++) valid_pipe[i] <= valid_pipe[i-1];
+    end
+  end
+
+  generate
+    if (LATENCY > MinLatency) begin : gen_pad_regs
+      logic [ProductWidth-1:0] pad_regs[LATENCY-MinLatency];
+      always_ff @(posedge i_clk) begin
+        pad_regs[0] <= term_regs[MinLatency-1][0];
+        for (int i = 1; i < LATENCY - MinLatency; i++) pad_regs[i] <= pad_regs[i-1];
+      end
+      assign o_product_result = pad_regs[LATENCY-MinLatency-1];
+    end else begin : gen_no_pad
+      assign o_product_result = term_regs[MinLatency-1][0];
+    end
+  endgenerate
+
+  assign o_valid_output = valid_pipe[LATENCY-1];
+
+endmodule : dsp_tiled_multiplier_pipelined
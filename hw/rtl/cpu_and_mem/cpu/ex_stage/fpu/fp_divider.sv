@@ -17,29 +17,37 @@
 /*
   IEEE 754 floating-point divider — fully pipelined.
 
-  Accepts a new operation every cycle. Pipeline depth:
-    SP (FP_WIDTH=32): DivCycles + 10 = 26 + 10 = 36 stages
-    DP (FP_WIDTH=64): DivCycles + 10 = 55 + 10 = 65 stages
+  Accepts a new operation every cycle. The DIVIDE chain retires
+  BITS_PER_STAGE quotient bits per pipeline stage (radix-4 at the default 2),
+  mirroring the integer divider's folding. Pipeline depth:
+    SP (FP_WIDTH=32): ceil(26/BITS_PER_STAGE) + 10 = 13 + 10 = 23 stages
+    DP (FP_WIDTH=64): ceil(55/BITS_PER_STAGE) + 10 = 28 + 10 = 38 stages
+  fp_div_shim's tag queues derive the same depths from
+  riscv_pkg::FpDivPipeDepthS/D — keep them in sync with this math.
 
   Pipeline structure:
     Stage 0:  Input capture (operand regs, rounding mode)
     Stage 1:  UNPACK — fp_operand_unpacker + fp_lzc (combinational, outputs registered)
     Stage 2:  INIT — mantissa normalization, special case detection (registered)
     Stage 3:  SETUP — compute result_exp, initial quotient/remainder/divisor
-    Stages 4..4+DivCycles-1:  DIVIDE — one radix-2 step per stage (generate block)
-    Stage 4+DivCycles:    NORMALIZE_PREP — fp_lzc on quotient
-    Stage 4+DivCycles+1:  NORMALIZE — shift quotient, adjust exponent
-    Stage 4+DivCycles+2:  ROUND_SHIFT — fp_subnorm_shift
-    Stage 4+DivCycles+3:  ROUND_PREP — fp_compute_round_up
-    Stage 4+DivCycles+4:  ROUND_APPLY — fp_result_assembler
-    Stage 4+DivCycles+5:  OUTPUT — register final result
+    Stages 4..4+DivStages-1:  DIVIDE — BITS_PER_STAGE radix-2 steps per stage
+    Stage 4+DivStages:    NORMALIZE_PREP — fp_lzc on quotient
+    Stage 4+DivStages+1:  NORMALIZE — shift quotient, adjust exponent
+    Stage 4+DivStages+2:  ROUND_SHIFT — fp_subnorm_shift
+    Stage 4+DivStages+3:  ROUND_PREP — fp_compute_round_up
+    Stage 4+DivStages+4:  ROUND_APPLY — fp_result_assembler
+    Stage 4+DivStages+5:  OUTPUT — register final result
 
   Special cases (NaN, inf, zero, div-by-zero) detected at INIT. The DIVIDE
   stages still execute on don't-care data; the OUTPUT stage selects the
   special result when is_special is set.
 */
 module fp_divider #(
-    parameter int unsigned FP_WIDTH = 32
+    parameter int unsigned FP_WIDTH = 32,
+    // Quotient bits retired per DIVIDE stage.  The chained subtract-or-restore
+    // depth between flops is the frequency limiter — drop to 1 (pure radix-2)
+    // if closure gets tight.
+    parameter int unsigned BITS_PER_STAGE = riscv_pkg::FpDivBitsPerStage
 ) (
     input logic i_clk,
     input logic i_rst,
@@ -66,7 +74,12 @@ module fp_divider #(
   localparam int unsigned DivCycles = MantBits + 2;
   localparam logic signed [ExpExtBits-1:0] ExpBiasExt = ExpExtBits'(ExpBias);
 
-  localparam int unsigned TotalStages = DivCycles + 10;
+  // DIVIDE pipeline stages after folding.  When BITS_PER_STAGE does not
+  // divide DivCycles evenly, the first stage retires the remainder bits so
+  // every later stage does a full BITS_PER_STAGE.
+  localparam int unsigned DivStages = (DivCycles + BITS_PER_STAGE - 1) / BITS_PER_STAGE;
+
+  localparam int unsigned TotalStages = DivStages + 10;
 
   // Valid pipeline
   logic pipe_valid[TotalStages+1];
@@ -342,21 +355,21 @@ module fp_divider #(
   end
 
   // =========================================================================
-  // Stages 4..4+DivCycles-1: DIVIDE — one radix-2 step per stage
+  // Stages 4..4+DivStages-1: DIVIDE — BITS_PER_STAGE radix-2 steps per stage
   // =========================================================================
 
-  // Pipeline arrays for divide stages (DivCycles+1 entries: index 0 = input, index DivCycles = output)
-  logic        [   DivBits-1:0] div_quotient        [DivCycles+1];
-  logic        [   DivBits-1:0] div_remainder       [DivCycles+1];
-  logic        [   DivBits-1:0] div_divisor         [DivCycles+1];
+  // Pipeline arrays for divide stages (DivStages+1 entries: index 0 = input, index DivStages = output)
+  logic        [   DivBits-1:0] div_quotient        [DivStages+1];
+  logic        [   DivBits-1:0] div_remainder       [DivStages+1];
+  logic        [   DivBits-1:0] div_divisor         [DivStages+1];
   // Metadata arrays
-  logic signed [ExpExtBits-1:0] div_result_exp      [DivCycles+1];
-  logic                         div_result_sign     [DivCycles+1];
-  logic                         div_is_special      [DivCycles+1];
-  logic        [  FP_WIDTH-1:0] div_special_result  [DivCycles+1];
-  logic                         div_special_invalid [DivCycles+1];
-  logic                         div_special_div_zero[DivCycles+1];
-  logic        [           2:0] div_rm              [DivCycles+1];
+  logic signed [ExpExtBits-1:0] div_result_exp      [DivStages+1];
+  logic                         div_result_sign     [DivStages+1];
+  logic                         div_is_special      [DivStages+1];
+  logic        [  FP_WIDTH-1:0] div_special_result  [DivStages+1];
+  logic                         div_special_invalid [DivStages+1];
+  logic                         div_special_div_zero[DivStages+1];
+  logic        [           2:0] div_rm              [DivStages+1];
 
   // Connect stage 3 output to divide pipeline input.
   always_comb begin
@@ -372,26 +385,40 @@ module fp_divider #(
     div_rm[0]               = s3_rm;
   end
 
-  // Generate block: one radix-2 division step per stage
-  for (genvar g = 0; g < DivCycles; g++) begin : gen_div
-    // Combinational: trial subtract
+  // Generate block: BITS_PER_STAGE chained radix-2 division steps per stage.
+  // A leftover stage (when BITS_PER_STAGE does not divide DivCycles) retires
+  // the remainder bits first so the total step count is exactly DivCycles.
+  for (genvar g = 0; g < DivStages; g++) begin : gen_div
+    localparam int unsigned StageSteps =
+        (g == 0 && (DivCycles % BITS_PER_STAGE) != 0) ?
+        (DivCycles % BITS_PER_STAGE) : BITS_PER_STAGE;
+
+    // Combinational: chained trial subtracts between flop stages
     logic [DivBits-1:0] shifted_rem;
     logic [DivBits-1:0] diff;
-    logic               diff_neg;
-
-    assign shifted_rem = {div_remainder[g][DivBits-2:0], 1'b0};
-    assign diff = shifted_rem - div_divisor[g];
-    assign diff_neg = diff[DivBits-1];
+    logic [DivBits-1:0] next_remainder;
+    logic [DivBits-1:0] next_quotient;
+
+    always_comb begin
+      next_remainder = div_remainder[g];
+      next_quotient  = div_quotient[g];
+      for (int b = 0; b < int'(StageSteps); b++) begin
+        shifted_rem = {next_remainder[DivBits-2:0], 1'b0};
+        diff = shifted_rem - div_divisor[g];
+        if (diff[DivBits-1]) begin
+          next_remainder = shifted_rem;
+          next_quotient  = {next_quotient[DivBits-2:0], 1'b0};
+        end else begin
+          next_remainder = diff;
+          next_quotient  = {next_quotient[DivBits-2:0], 1'b1};
+        end
+      end
+    end
 
     // Registered output
     always_ff @(posedge i_clk) begin
-      if (diff_neg) begin
-        div_remainder[g+1] <= shifted_rem;
-        div_quotient[g+1]  <= {div_quotient[g][DivBits-2:0], 1'b0};
-      end else begin
-        div_remainder[g+1] <= diff;
-        div_quotient[g+1]  <= {div_quotient[g][DivBits-2:0], 1'b1};
-      end
+      div_remainder[g+1]        <= next_remainder;
+      div_quotient[g+1]         <= next_quotient;
       div_divisor[g+1]          <= div_divisor[g];
       div_result_exp[g+1]       <= div_result_exp[g];
       div_result_sign[g+1]      <= div_result_sign[g];
@@ -404,7 +431,7 @@ module fp_divider #(
   end
 
   // =========================================================================
-  // Stage 4+DivCycles: NORMALIZE_PREP — LZC on quotient
+  // Stage 4+DivStages: NORMALIZE_PREP — LZC on quotient
   // =========================================================================
   logic [QuotLzcBits-1:0] norm_prep_lzc;
   logic                   norm_prep_is_zero;
@@ -412,7 +439,7 @@ module fp_divider #(
   fp_lzc #(
       .WIDTH(DivBits)
   ) u_quot_lzc (
-      .i_value(div_quotient[DivCycles]),
+      .i_value(div_quotient[DivStages]),
       .o_lzc(norm_prep_lzc),
       .o_is_zero(norm_prep_is_zero)
   );
@@ -431,21 +458,21 @@ module fp_divider #(
   logic [2:0] s_nprep_rm;
 
   always_ff @(posedge i_clk) begin
-    s_nprep_quotient <= div_quotient[DivCycles];
-    s_nprep_remainder <= div_remainder[DivCycles];
-    s_nprep_result_exp <= div_result_exp[DivCycles];
+    s_nprep_quotient <= div_quotient[DivStages];
+    s_nprep_remainder <= div_remainder[DivStages];
+    s_nprep_result_exp <= div_result_exp[DivStages];
     s_nprep_lzc <= norm_prep_lzc;
     s_nprep_is_zero <= norm_prep_is_zero;
-    s_nprep_result_sign <= div_result_sign[DivCycles];
-    s_nprep_is_special <= div_is_special[DivCycles];
-    s_nprep_special_result <= div_special_result[DivCycles];
-    s_nprep_special_invalid <= div_special_invalid[DivCycles];
-    s_nprep_special_div_zero <= div_special_div_zero[DivCycles];
-    s_nprep_rm <= div_rm[DivCycles];
+    s_nprep_result_sign <= div_result_sign[DivStages];
+    s_nprep_is_special <= div_is_special[DivStages];
+    s_nprep_special_result <= div_special_result[DivStages];
+    s_nprep_special_invalid <= div_special_invalid[DivStages];
+    s_nprep_special_div_zero <= div_special_div_zero[DivStages];
+    s_nprep_rm <= div_rm[DivStages];
   end
 
   // =========================================================================
-  // Stage 4+DivCycles+1: NORMALIZE — shift quotient, adjust exponent
+  // Stage 4+DivStages+1: NORMALIZE — shift quotient, adjust exponent
   // =========================================================================
   logic [DivBits-1:0] norm_quotient;
   logic signed [ExpExtBits-1:0] norm_result_exp;
@@ -484,7 +511,7 @@ module fp_divider #(
   end
 
   // =========================================================================
-  // Stage 4+DivCycles+2: ROUND_SHIFT — fp_subnorm_shift
+  // Stage 4+DivStages+2: ROUND_SHIFT — fp_subnorm_shift
   // =========================================================================
 
   // Extract rounding bits from normalized quotient
@@ -551,7 +578,7 @@ module fp_divider #(
   end
 
   // =========================================================================
-  // Stage 4+DivCycles+3: ROUND_PREP — compute round-up decision
+  // Stage 4+DivStages+3: ROUND_PREP — compute round-up decision
   // =========================================================================
   logic rprep_round_up;
   logic rprep_lsb;
@@ -591,7 +618,7 @@ module fp_divider #(
   end
 
   // =========================================================================
-  // Stage 4+DivCycles+4: ROUND_APPLY — fp_result_assembler
+  // Stage 4+DivStages+4: ROUND_APPLY — fp_result_assembler
   // =========================================================================
   logic [FP_WIDTH-1:0] rapply_result;
   riscv_pkg::fp_flags_t rapply_flags;
@@ -629,7 +656,7 @@ module fp_divider #(
   end
 
   // =========================================================================
-  // Stage 4+DivCycles+5: OUTPUT — register final result
+  // Stage 4+DivStages+5: OUTPUT — register final result
   // =========================================================================
   logic [FP_WIDTH-1:0] s_output_result;
   riscv_pkg::fp_flags_t s_output_flags;
@@ -15,7 +15,7 @@
  */
 
 /*
-  IEEE 754 single-precision fused multiply-add.
+  IEEE 754 fused multiply-add, fully pipelined.
 
   This implementation computes (a * b) + c with a single rounding step.
   It handles NaNs, infinities, zeros, and subnormal operands.
@@ -26,22 +26,25 @@
     FNMADD.S: fd = -(fs1 * fs2) - fs3
     FNMSUB.S: fd = -(fs1 * fs2) + fs3
 
-  Multi-cycle implementation (non-pipelined):
-    Cycle 0: Capture operands
-    Cycle 1: Unpack operands, detect special cases
-    Cycle 2: Multiply mantissas (24x24 -> 48 bits)
-    Cycle 2B: TIMING: 3-cycle DSP-tiled multiplier pipeline
-    Cycle 3A: Product LZC computation
-    Cycle 3B: Normalize product (apply shift)
-    Cycle 4: Align exponent/shift amount prep
-    Cycle 5: Align product and addend (barrel shift)
-    Cycle 6A: Add/subtract
-    Cycle 6B: LZC
-    Cycle 7: Normalize based on LZC
-    Cycle 8A: Subnormal handling, compute rounding inputs
-    Cycle 8B: Compute round-up decision
-    Cycle 9: Apply rounding increment, format result
-    Cycle 10: Output registered result
+  The pipeline accepts a new operation every cycle (initiation interval 1)
+  and produces its result exactly riscv_pkg::FpFmaLatency cycles after
+  i_valid.  There is no back-pressure: every data rank advances every cycle
+  and a valid shift register qualifies the output.  Rank map:
+
+    Rank 0      : Capture operands
+    Rank 1      : Unpack operands, detect special cases
+    Ranks 2-4   : DSP-tiled mantissa multiply (pipelined; metadata rides a
+                  matching side pipe)
+    Rank 5      : Product LZC computation
+    Rank 6      : Normalize product (apply shift)
+    Rank 7      : Align exponent/shift amount prep
+    Rank 8      : Align product and addend (barrel shift)
+    Rank 9      : Add/subtract
+    Rank 10     : Sum LZC
+    Rank 11     : Normalize based on LZC
+    Rank 12     : Subnormal handling, compute rounding inputs
+    Rank 13     : Compute round-up decision
+    Rank 14     : Apply rounding increment, format result (registered output)
 */
 module fp_fma #(
     parameter int unsigned FP_WIDTH = 32
@@ -55,32 +58,11 @@ module fp_fma #(
     input  logic                                i_negate_product,
     input  logic                                i_negate_c,
     input  logic                 [         2:0] i_rounding_mode,
-    input  logic                                i_stall,
     output logic                 [FP_WIDTH-1:0] o_result,
     output logic                                o_valid,
     output riscv_pkg::fp_flags_t                o_flags
 );
 
-  typedef enum logic [4:0] {
-    IDLE    = 5'b00000,
-    STAGE1  = 5'b00001,
-    STAGE2  = 5'b00010,
-    STAGE2B = 5'b10000,  // TIMING: Wait for DSP-tiled multiplier result
-    STAGE3A = 5'b00011,
-    STAGE3B = 5'b00100,
-    STAGE4  = 5'b00101,
-    STAGE4B = 5'b00110,
-    STAGE5A = 5'b00111,
-    STAGE5B = 5'b01000,
-    STAGE6  = 5'b01001,
-    STAGE7A = 5'b01010,
-    STAGE7B = 5'b01011,
-    STAGE8  = 5'b01100,
-    STAGE9  = 5'b01101
-  } state_e;
-
-  state_e state, next_state;
-
   localparam int unsigned ExpBits = (FP_WIDTH == 32) ? 8 : 11;
   localparam int unsigned FracBits = (FP_WIDTH == 32) ? 23 : 52;
   localparam int unsigned MantBits = FracBits + 1;
@@ -93,6 +75,15 @@ module fp_fma #(
   localparam int unsigned ShiftBits = $clog2(ProdBits + 1);
   localparam logic [ExpBits-1:0] ExpMax = {ExpBits{1'b1}};
   localparam logic [FP_WIDTH-1:0] CanonicalNan = {1'b0, ExpMax, 1'b1, {FracBits - 1{1'b0}}};
+
+  // The datapath outside the multiplier is 12 fixed ranks; the multiplier
+  // pads to whatever remains so S and D share one overall latency.
+  localparam int unsigned MulLatency = riscv_pkg::FpFmaLatency - 12;
+
+  // Valid shift register: one bit per rank, the only resettable state.
+  // TIMING: Limit fanout to force register replication and improve timing
+  (* max_fanout = 30 *) logic valid_pipe[riscv_pkg::FpFmaLatency];
+
   // Input registers
   logic [FP_WIDTH-1:0] operand_a_reg;
   logic [FP_WIDTH-1:0] operand_b_reg;
@@ -102,7 +93,7 @@ module fp_fma #(
   logic [         2:0] rm_reg;
 
   // =========================================================================
-  // Stage 1: Unpack operands (combinational from registered inputs)
+  // Rank 1: Unpack operands (combinational from registered inputs)
   // =========================================================================
 
   logic sign_a, sign_b, sign_c;
@@ -210,7 +201,7 @@ module fp_fma #(
   ) - ExpExtBits'(ExpBias);
 
   // =========================================================================
-  // Stage 1 -> Stage 2 Pipeline Registers (after unpack, before multiply)
+  // Rank 1 -> multiplier pipeline registers (after unpack, before multiply)
   // =========================================================================
 
   logic [MantBits-1:0] mant_a_s2, mant_b_s2;
@@ -225,49 +216,91 @@ module fp_fma #(
   logic                         special_invalid_s2;
 
   // =========================================================================
-  // Stage 2: Start mantissa multiply
-  // Uses DSP-tiled {27x35} unsigned multiplier (18+17 cascade-friendly).
+  // Ranks 2-4: Mantissa multiply
+  // Uses pipelined DSP-tiled {27x35} unsigned multiplier (18+17 cascade
+  // friendly).  Everything except the mantissas rides a side pipe of the
+  // same depth so the product and its metadata re-converge at rank 4.
   // =========================================================================
 
-  logic        [  ProdBits-1:0] prod_mant_s2_tiled;
-  logic                         prod_mant_s2_tiled_valid;
+  logic [ProdBits-1:0] prod_mant_s3;
+  logic                prod_mant_s3_valid;
 
-  dsp_tiled_multiplier_unsigned #(
+  dsp_tiled_multiplier_pipelined #(
       .A_WIDTH(MantBits),
-      .B_WIDTH(MantBits)
+      .B_WIDTH(MantBits),
+      .LATENCY(MulLatency)
   ) u_mantissa_multiplier (
       .i_clk(i_clk),
       .i_rst(i_rst),
-      .i_valid_input(state == STAGE2),
+      .i_valid_input(valid_pipe[1]),
       .i_operand_a(mant_a_s2),
       .i_operand_b(mant_b_s2),
-      .o_product_result(prod_mant_s2_tiled),
-      .o_valid_output(prod_mant_s2_tiled_valid),
-      .o_completing_next_cycle(  /*unused*/)
+      .o_product_result(prod_mant_s3),
+      .o_valid_output(prod_mant_s3_valid)
   );
 
-  // =========================================================================
-  // Stage 2B -> Stage 3 Pipeline Registers (after DSP pipeline, before LZC)
-  // =========================================================================
+  // Metadata side pipe alongside the multiplier (no reset; valid_pipe
+  // qualifies the data).
+  logic signed [ExpExtBits-1:0] prod_exp_mul[MulLatency];
+  logic                         prod_sign_mul[MulLatency];
+  logic signed [ExpExtBits-1:0] c_exp_mul[MulLatency];
+  logic        [  MantBits-1:0] mant_c_mul[MulLatency];
+  logic                         c_sign_mul[MulLatency];
+  logic        [           2:0] rm_mul[MulLatency];
+  logic                         is_special_mul[MulLatency];
+  logic        [  FP_WIDTH-1:0] special_result_mul[MulLatency];
+  logic                         special_invalid_mul[MulLatency];
+
+  always_ff @(posedge i_clk) begin
+    prod_exp_mul[0] <= prod_exp_s2;
+    prod_sign_mul[0] <= prod_sign_s2;
+    c_exp_mul[0] <= c_exp_s2;
+    mant_c_mul[0] <= mant_c_s2;
+    c_sign_mul[0] <= c_sign_s2;
+    rm_mul[0] <= rm_s2;
+    is_special_mul[0] <= is_special_s2;
+    special_result_mul[0] <= special_result_s2;
+    special_invalid_mul[0] <= special_invalid_s2;
+    for (int i = 1; i < MulLatency; i++) begin
+      prod_exp_mul[i] <= prod_exp_mul[i-1];
+      prod_sign_mul[i] <= prod_sign_mul[i-1];
+      c_exp_mul[i] <= c_exp_mul[i-1];
+      mant_c_mul[i] <= mant_c_mul[i-1];
+      c_sign_mul[i] <= c_sign_mul[i-1];
+      rm_mul[i] <= rm_mul[i-1];
+      is_special_mul[i] <= is_special_mul[i-1];
+      special_result_mul[i] <= special_result_mul[i-1];
+      special_invalid_mul[i] <= special_invalid_mul[i-1];
+    end
+  end
+
+  logic signed [ExpExtBits-1:0] prod_exp_s3;
+  logic                         prod_sign_s3;
+  logic signed [ExpExtBits-1:0] c_exp_s3;
+  logic        [  MantBits-1:0] mant_c_s3;
+  logic                         c_sign_s3;
+  logic        [           2:0] rm_s3;
+  logic                         is_special_s3;
+  logic        [  FP_WIDTH-1:0] special_result_s3;
+  logic                         special_invalid_s3;
 
-  logic        [   ProdBits-1:0] prod_mant_s3;
-  logic signed [ ExpExtBits-1:0] prod_exp_s3;
-  logic                          prod_sign_s3;
-  logic signed [ ExpExtBits-1:0] c_exp_s3;
-  logic        [   MantBits-1:0] mant_c_s3;
-  logic                          c_sign_s3;
-  logic        [            2:0] rm_s3;
-  logic                          is_special_s3;
-  logic        [   FP_WIDTH-1:0] special_result_s3;
-  logic                          special_invalid_s3;
+  assign prod_exp_s3 = prod_exp_mul[MulLatency-1];
+  assign prod_sign_s3 = prod_sign_mul[MulLatency-1];
+  assign c_exp_s3 = c_exp_mul[MulLatency-1];
+  assign mant_c_s3 = mant_c_mul[MulLatency-1];
+  assign c_sign_s3 = c_sign_mul[MulLatency-1];
+  assign rm_s3 = rm_mul[MulLatency-1];
+  assign is_special_s3 = is_special_mul[MulLatency-1];
+  assign special_result_s3 = special_result_mul[MulLatency-1];
+  assign special_invalid_s3 = special_invalid_mul[MulLatency-1];
 
   // =========================================================================
-  // Stage 3A: Product LZC (combinational from stage 3 regs)
+  // Rank 5 input: Product LZC (combinational from multiplier/side-pipe tail)
   // =========================================================================
 
-  logic        [LzcProdBits-1:0] prod_lzc;
-  logic                          prod_is_zero;
-  logic                          prod_msb_set;
+  logic [LzcProdBits-1:0] prod_lzc;
+  logic                   prod_is_zero;
+  logic                   prod_msb_set;
 
   assign prod_is_zero = (prod_mant_s3 == '0);
   assign prod_msb_set = prod_mant_s3[ProdBits-1];
@@ -283,7 +316,7 @@ module fp_fma #(
   );
 
   // =========================================================================
-  // Stage 3A -> Stage 3B Pipeline Registers (after LZC, before shift)
+  // Rank 5 registers (after LZC, before shift)
   // =========================================================================
 
   logic        [   ProdBits-1:0] prod_mant_s3b;
@@ -301,7 +334,7 @@ module fp_fma #(
   logic                          special_invalid_s3b;
 
   // =========================================================================
-  // Stage 3B: Apply Normalization Shift (combinational from stage 3B regs)
+  // Rank 6 input: Apply Normalization Shift (combinational from rank 5 regs)
   // =========================================================================
 
   logic signed [ ExpExtBits-1:0] prod_exp_norm;
@@ -321,7 +354,7 @@ module fp_fma #(
   end
 
   // =========================================================================
-  // Stage 3B -> Stage 4 Pipeline Registers (after prod norm, before align)
+  // Rank 6 registers (after prod norm, before align)
   // =========================================================================
 
   logic signed [ExpExtBits-1:0] prod_exp_s4;
@@ -336,7 +369,7 @@ module fp_fma #(
   logic                         special_invalid_s4;
 
   // =========================================================================
-  // Stage 4: Align prep (exponent compare + shift amount)
+  // Rank 7 input: Align prep (exponent compare + shift amount)
   // =========================================================================
 
   logic signed [ExpExtBits-1:0] exp_large;
@@ -364,52 +397,62 @@ module fp_fma #(
   end
 
   // =========================================================================
-  // Stage 4 -> Stage 4b Pipeline Registers (after shift amount calc)
+  // Rank 7 registers (after shift amount calc); the mantissas and metadata
+  // advance alongside the shift amounts so the barrel shift below reads
+  // operands from its own rank.
   // =========================================================================
 
   logic signed [ExpExtBits-1:0] exp_large_s4b;
   logic        [ ShiftBits-1:0] shift_prod_amt_s4b;
   logic        [ ShiftBits-1:0] shift_c_amt_s4b;
+  logic        [  ProdBits-1:0] prod_mant_s4b;
+  logic        [  ProdBits-1:0] c_mant_s4b;
+  logic                         prod_sign_s4b;
+  logic                         c_sign_s4b;
+  logic        [           2:0] rm_s4b;
+  logic                         is_special_s4b;
+  logic        [  FP_WIDTH-1:0] special_result_s4b;
+  logic                         special_invalid_s4b;
 
   // =========================================================================
-  // Stage 4b: Align (barrel shift - combinational from stage 4 regs)
+  // Rank 8 input: Align (barrel shift - combinational from rank 7 regs)
   // =========================================================================
 
-  logic        [  ProdBits-1:0] prod_aligned;
-  logic        [  ProdBits-1:0] c_aligned;
-  logic                         sticky_prod;
-  logic                         sticky_c;
+  logic [ProdBits-1:0] prod_aligned;
+  logic [ProdBits-1:0] c_aligned;
+  logic                sticky_prod;
+  logic                sticky_c;
 
   always_comb begin
-    prod_aligned = prod_mant_s4;
+    prod_aligned = prod_mant_s4b;
     sticky_prod  = 1'b0;
     if (shift_prod_amt_s4b >= ShiftBits'(ProdBits)) begin
       prod_aligned = '0;
-      sticky_prod  = |prod_mant_s4;
+      sticky_prod  = |prod_mant_s4b;
     end else if (shift_prod_amt_s4b != 0) begin
-      prod_aligned = prod_mant_s4 >> shift_prod_amt_s4b;
+      prod_aligned = prod_mant_s4b >> shift_prod_amt_s4b;
       sticky_prod  = 1'b0;
       for (int i = 0; i < ProdBits; i++) begin
-        if (i < shift_prod_amt_s4b) sticky_prod = sticky_prod | prod_mant_s4[i];
+        if (i < shift_prod_amt_s4b) sticky_prod = sticky_prod | prod_mant_s4b[i];
       end
     end
 
-    c_aligned = c_mant_s4;
+    c_aligned = c_mant_s4b;
     sticky_c  = 1'b0;
     if (shift_c_amt_s4b >= ShiftBits'(ProdBits)) begin
       c_aligned = '0;
-      sticky_c  = |c_mant_s4;
+      sticky_c  = |c_mant_s4b;
     end else if (shift_c_amt_s4b != 0) begin
-      c_aligned = c_mant_s4 >> shift_c_amt_s4b;
+      c_aligned = c_mant_s4b >> shift_c_amt_s4b;
       sticky_c  = 1'b0;
       for (int i = 0; i < ProdBits; i++) begin
-        if (i < shift_c_amt_s4b) sticky_c = sticky_c | c_mant_s4[i];
+        if (i < shift_c_amt_s4b) sticky_c = sticky_c | c_mant_s4b[i];
       end
     end
   end
 
   // =========================================================================
-  // Stage 4b -> Stage 5 Pipeline Registers (after align, before add)
+  // Rank 8 registers (after align, before add)
   // =========================================================================
 
   logic signed [ExpExtBits-1:0] exp_large_s5;
@@ -425,7 +468,7 @@ module fp_fma #(
   logic special_invalid_s5;
 
   // =========================================================================
-  // Stage 5A: Add/Subtract (combinational from stage 5 regs)
+  // Rank 9 input: Add/Subtract (combinational from rank 8 regs)
   // =========================================================================
 
   logic [SumBits-1:0] sum_s5a_comb;
@@ -465,7 +508,7 @@ module fp_fma #(
   end
 
   // =========================================================================
-  // Stage 5A -> Stage 5B Pipeline Register (after add/sub)
+  // Rank 9 registers (after add/sub); exp/sticky/rm/special advance too.
   // =========================================================================
 
   logic [SumBits-1:0] sum_s5a;
@@ -473,9 +516,15 @@ module fp_fma #(
   logic sign_large_s5a;
   logic sign_small_s5a;
   logic sum_is_zero_s5a;
+  logic signed [ExpExtBits-1:0] exp_large_s5a;
+  logic sticky_s5a;
+  logic [2:0] rm_s5a;
+  logic is_special_s5a;
+  logic [FP_WIDTH-1:0] special_result_s5a;
+  logic special_invalid_s5a;
 
   // =========================================================================
-  // Stage 5B: LZC (combinational from stage 5A regs)
+  // Rank 10 input: Sum LZC (combinational from rank 9 regs)
   // =========================================================================
 
   logic [LzcSumBits-1:0] lzc_s5b_comb;
@@ -491,7 +540,7 @@ module fp_fma #(
   );
 
   // =========================================================================
-  // Stage 5B -> Stage 6 Pipeline Registers (after add/LZC, before normalize)
+  // Rank 10 registers (after add/LZC, before normalize)
   // =========================================================================
 
   logic signed [ExpExtBits-1:0] exp_large_s6;
@@ -508,7 +557,7 @@ module fp_fma #(
   logic special_invalid_s6;
 
   // =========================================================================
-  // Stage 6: Normalize (combinational from stage 6 regs)
+  // Rank 11 input: Normalize (combinational from rank 10 regs)
   // =========================================================================
 
   logic [LzcSumBits-1:0] norm_shift;
@@ -539,7 +588,7 @@ module fp_fma #(
   end
 
   // =========================================================================
-  // Stage 6 -> Stage 7 Pipeline Registers (after normalize, before round)
+  // Rank 11 registers (after normalize, before round)
   // =========================================================================
 
   logic [SumBits-1:0] normalized_sum_s7;
@@ -556,7 +605,7 @@ module fp_fma #(
   logic special_invalid_s7;
 
   // =========================================================================
-  // Stage 7A: Prepare rounding inputs (subnormal handling)
+  // Rank 12 input: Prepare rounding inputs (subnormal handling)
   // =========================================================================
 
   logic [MantBits:0] pre_round_mant_s7;
@@ -614,7 +663,7 @@ module fp_fma #(
   );
 
   // =========================================================================
-  // Stage 7A -> Stage 7B Pipeline Register (after subnormal handling)
+  // Rank 12 registers (after subnormal handling); rm/special advance too.
   // =========================================================================
 
   logic [MantBits-1:0] mantissa_work_s7b;
@@ -622,15 +671,19 @@ module fp_fma #(
   logic signed [ExpExtBits-1:0] exp_work_s7b;
   logic fp_round_sign_s7b;
   logic is_zero_result_s7b;
+  logic [2:0] rm_s7b;
+  logic is_special_s7b;
+  logic [FP_WIDTH-1:0] special_result_s7b;
+  logic special_invalid_s7b;
 
-  // Stage 7B: Compute round-up decision
+  // Rank 13 input: Compute round-up decision
   logic round_up_s7b_comb;
   logic lsb_s7b;
 
   assign lsb_s7b = mantissa_work_s7b[0];
 
   assign round_up_s7b_comb = riscv_pkg::fp_compute_round_up(
-      rm_s7, guard_work_s7b, round_work_s7b, sticky_work_s7b, lsb_s7b, fp_round_sign_s7b
+      rm_s7b, guard_work_s7b, round_work_s7b, sticky_work_s7b, lsb_s7b, fp_round_sign_s7b
   );
 
   // Compute is_inexact for flags
@@ -638,7 +691,7 @@ module fp_fma #(
   assign is_inexact_s7b = guard_work_s7b | round_work_s7b | sticky_work_s7b;
 
   // =========================================================================
-  // Stage 7B -> Stage 8 Pipeline Register (after round-up decision)
+  // Rank 13 registers (after round-up decision)
   // =========================================================================
 
   logic                                  result_sign_s8;
@@ -653,7 +706,7 @@ module fp_fma #(
   logic                                  special_invalid_s8;
 
   // =========================================================================
-  // Stage 8: Apply rounding and format result (combinational from s8 regs)
+  // Rank 14 input: Apply rounding and format result (combinational from s8)
   // =========================================================================
 
   // Compute final result using shared result assembler
@@ -684,238 +737,196 @@ module fp_fma #(
   );
 
   // =========================================================================
-  // Stage 8 -> Stage 9 Pipeline Register (final output)
+  // Rank 14 registers (final output)
   // =========================================================================
 
   logic [FP_WIDTH-1:0] result_s9;
   riscv_pkg::fp_flags_t flags_s9;
 
   // =========================================================================
-  // State Machine and Sequential Logic
+  // Valid shift register and pipeline data registers
   // =========================================================================
 
-  // TIMING: Limit fanout to force register replication and improve timing
-  (* max_fanout = 30 *) logic valid_reg;
-
-  // Control: state machine and valid_reg
+  // Control: the valid shift register is the only resettable state; data
+  // ranks advance every cycle and the output is qualified by its tail.
   always_ff @(posedge i_clk) begin
     if (i_rst) begin
-      state <= IDLE;
-      valid_reg <= 1'b0;
+      for (int i = 0; i < riscv_pkg::FpFmaLatency; i++) valid_pipe[i] <= 1'b0;
     end else begin
-      state <= next_state;
-      valid_reg <= (state == STAGE9);
+      valid_pipe[0] <= i_valid;
+      for (int i = 1; i < riscv_pkg::FpFmaLatency; i++) valid_pipe[i] <= valid_pipe[i-1];
     end
   end
 
-  // Data: pipeline registers (no reset needed)
+  // Data: pipeline registers (no reset needed).  The input rank holds when
+  // i_valid is low; every later rank advances unconditionally.
   always_ff @(posedge i_clk) begin
-    case (state)
-      IDLE: begin
-        if (i_valid) begin
-          operand_a_reg <= i_operand_a;
-          operand_b_reg <= i_operand_b;
-          operand_c_reg <= i_operand_c;
-          negate_product_reg <= i_negate_product;
-          negate_c_reg <= i_negate_c;
-          rm_reg <= i_rounding_mode;
-        end
-      end
-
-      STAGE1: begin
-        mant_a_s2 <= mant_a_int;
-        mant_b_s2 <= mant_b_int;
-        prod_exp_s2 <= prod_exp_tentative;
-        prod_sign_s2 <= sign_prod;
-        c_exp_s2 <= $signed({{(ExpExtBits - ExpBits) {1'b0}}, exp_c_adj});
-        mant_c_s2 <= mant_c_int;
-        c_sign_s2 <= sign_c_adj;
-        rm_s2 <= rm_reg;
-        is_special_s2 <= is_special;
-        special_result_s2 <= special_result;
-        special_invalid_s2 <= special_invalid;
-      end
-
-      STAGE2: begin
-        // Multiply pipeline runs continuously; no action needed here.
-      end
-
-      STAGE2B: begin
-        // TIMING: Wait for DSP-tiled product to emerge, then load stage 3 regs
-        if (prod_mant_s2_tiled_valid) begin
-          prod_mant_s3 <= prod_mant_s2_tiled;
-          prod_exp_s3 <= prod_exp_s2;
-          prod_sign_s3 <= prod_sign_s2;
-          c_exp_s3 <= c_exp_s2;
-          mant_c_s3 <= mant_c_s2;
-          c_sign_s3 <= c_sign_s2;
-          rm_s3 <= rm_s2;
-          is_special_s3 <= is_special_s2;
-          special_result_s3 <= special_result_s2;
-          special_invalid_s3 <= special_invalid_s2;
-        end
-      end
-
-      STAGE3A: begin
-        // Capture LZC results into stage 3B registers
-        prod_mant_s3b <= prod_mant_s3;
-        prod_exp_s3b <= prod_exp_s3;
-        prod_sign_s3b <= prod_sign_s3;
-        prod_is_zero_s3b <= prod_is_zero;
-        prod_msb_set_s3b <= prod_msb_set;
-        prod_lzc_s3b <= prod_lzc;
-        c_exp_s3b <= c_exp_s3;
-        mant_c_s3b <= mant_c_s3;
-        c_sign_s3b <= c_sign_s3;
-        rm_s3b <= rm_s3;
-        is_special_s3b <= is_special_s3;
-        special_result_s3b <= special_result_s3;
-        special_invalid_s3b <= special_invalid_s3;
-      end
-
-      STAGE3B: begin
-        // Capture normalized product into stage 4 registers
-        prod_exp_s4 <= prod_exp_norm;
-        prod_mant_s4 <= prod_mant_norm;
-        prod_sign_s4 <= prod_sign_s3b;
-        c_exp_s4 <= c_exp_s3b;
-        c_mant_s4 <= {mant_c_s3b, {MantBits{1'b0}}};
-        c_sign_s4 <= c_sign_s3b;
-        rm_s4 <= rm_s3b;
-        is_special_s4 <= is_special_s3b;
-        special_result_s4 <= special_result_s3b;
-        special_invalid_s4 <= special_invalid_s3b;
-      end
-
-      STAGE4: begin
-        exp_large_s4b <= exp_large;
-        shift_prod_amt_s4b <= shift_prod_amt;
-        shift_c_amt_s4b <= shift_c_amt;
-      end
-
-      STAGE4B: begin
-        exp_large_s5 <= exp_large_s4b;
-        prod_aligned_s5 <= prod_aligned;
-        c_aligned_s5 <= c_aligned;
-        prod_sign_s5 <= prod_sign_s4;
-        c_sign_s5 <= c_sign_s4;
-        sticky_s5 <= sticky_prod | sticky_c;
-        // Track when the smaller operand was shifted out during subtraction.
-        // This affects the guard bit calculation for FMA precision.
-        sticky_c_sub_s5 <= (prod_sign_s4 != c_sign_s4) ? (
-            (prod_aligned > c_aligned) ? sticky_c :
-            (c_aligned > prod_aligned) ? sticky_prod :
-            1'b0
-        ) : 1'b0;
-        rm_s5 <= rm_s4;
-        is_special_s5 <= is_special_s4;
-        special_result_s5 <= special_result_s4;
-        special_invalid_s5 <= special_invalid_s4;
-      end
-
-      STAGE5A: begin
-        sum_s5a <= sum_s5a_comb;
-        result_sign_s5a <= result_sign_s5a_comb;
-        sign_large_s5a <= sign_large_s5a_comb;
-        sign_small_s5a <= sign_small_s5a_comb;
-        sum_is_zero_s5a <= sum_is_zero_s5a_comb;
-      end
-
-      STAGE5B: begin
-        exp_large_s6 <= exp_large_s5;
-        sum_s6 <= sum_s5a;
-        sum_is_zero_s6 <= sum_is_zero_s5a;
-        lzc_s6 <= lzc_s5b_comb;
-        sum_sticky_s6 <= sticky_s5;
-        result_sign_s6 <= result_sign_s5a;
-        sign_large_s6 <= sign_large_s5a;
-        sign_small_s6 <= sign_small_s5a;
-        rm_s6 <= rm_s5;
-        is_special_s6 <= is_special_s5;
-        special_result_s6 <= special_result_s5;
-        special_invalid_s6 <= special_invalid_s5;
-      end
-
-      STAGE6: begin
-        normalized_sum_s7 <= normalized_sum_s6_comb;
-        normalized_exp_s7 <= normalized_exp_s6_comb;
-        sum_is_zero_s7 <= sum_is_zero_s6;
-        sum_sticky_s7 <= sum_sticky_s6;
-        norm_sticky_s7 <= norm_sticky_s6_comb;
-        result_sign_s7 <= result_sign_s6;
-        sign_large_s7 <= sign_large_s6;
-        sign_small_s7 <= sign_small_s6;
-        rm_s7 <= rm_s6;
-        is_special_s7 <= is_special_s6;
-        special_result_s7 <= special_result_s6;
-        special_invalid_s7 <= special_invalid_s6;
-      end
-
-      STAGE7A: begin
-        // Capture subnormal handling outputs into stage 7B registers
-        mantissa_work_s7b <= mantissa_work_s7a_comb;
-        guard_work_s7b <= guard_work_s7a_comb;
-        round_work_s7b <= round_work_s7a_comb;
-        sticky_work_s7b <= sticky_work_s7a_comb;
-        exp_work_s7b <= exp_work_s7a_comb;
-        fp_round_sign_s7b <= fp_round_sign_s7a_comb;
-        is_zero_result_s7b <= sum_is_zero_s7 && !sum_sticky_s7;
-      end
-
-      STAGE7B: begin
-        // Capture round-up decision into s8 registers
-        result_sign_s8 <= fp_round_sign_s7b;
-        exp_work_s8 <= exp_work_s7b;
-        mantissa_work_s8 <= mantissa_work_s7b;
-        round_up_s8 <= round_up_s7b_comb;
-        is_inexact_s8 <= is_inexact_s7b;
-        is_zero_result_s8 <= is_zero_result_s7b;
-        rm_s8 <= rm_s7;
-        is_special_s8 <= is_special_s7;
-        special_result_s8 <= special_result_s7;
-        special_invalid_s8 <= special_invalid_s7;
-      end
-
-      STAGE8: begin
-        // Capture final result into s9 registers
-        result_s9 <= final_result_s8_comb;
-        flags_s9  <= final_flags_s8_comb;
-      end
-
-      STAGE9: begin
-        // Output already captured in s9
-      end
+    // Rank 0: capture operands
+    if (i_valid) begin
+      operand_a_reg <= i_operand_a;
+      operand_b_reg <= i_operand_b;
+      operand_c_reg <= i_operand_c;
+      negate_product_reg <= i_negate_product;
+      negate_c_reg <= i_negate_c;
+      rm_reg <= i_rounding_mode;
+    end
 
-      default: ;
-    endcase
+    // Rank 1: unpack results -> multiplier inputs
+    mant_a_s2 <= mant_a_int;
+    mant_b_s2 <= mant_b_int;
+    prod_exp_s2 <= prod_exp_tentative;
+    prod_sign_s2 <= sign_prod;
+    c_exp_s2 <= $signed({{(ExpExtBits - ExpBits) {1'b0}}, exp_c_adj});
+    mant_c_s2 <= mant_c_int;
+    c_sign_s2 <= sign_c_adj;
+    rm_s2 <= rm_reg;
+    is_special_s2 <= is_special;
+    special_result_s2 <= special_result;
+    special_invalid_s2 <= special_invalid;
+
+    // Rank 5: capture LZC results
+    prod_mant_s3b <= prod_mant_s3;
+    prod_exp_s3b <= prod_exp_s3;
+    prod_sign_s3b <= prod_sign_s3;
+    prod_is_zero_s3b <= prod_is_zero;
+    prod_msb_set_s3b <= prod_msb_set;
+    prod_lzc_s3b <= prod_lzc;
+    c_exp_s3b <= c_exp_s3;
+    mant_c_s3b <= mant_c_s3;
+    c_sign_s3b <= c_sign_s3;
+    rm_s3b <= rm_s3;
+    is_special_s3b <= is_special_s3;
+    special_result_s3b <= special_result_s3;
+    special_invalid_s3b <= special_invalid_s3;
+
+    // Rank 6: capture normalized product
+    prod_exp_s4 <= prod_exp_norm;
+    prod_mant_s4 <= prod_mant_norm;
+    prod_sign_s4 <= prod_sign_s3b;
+    c_exp_s4 <= c_exp_s3b;
+    c_mant_s4 <= {mant_c_s3b, {MantBits{1'b0}}};
+    c_sign_s4 <= c_sign_s3b;
+    rm_s4 <= rm_s3b;
+    is_special_s4 <= is_special_s3b;
+    special_result_s4 <= special_result_s3b;
+    special_invalid_s4 <= special_invalid_s3b;
+
+    // Rank 7: shift amounts plus the operands they apply to
+    exp_large_s4b <= exp_large;
+    shift_prod_amt_s4b <= shift_prod_amt;
+    shift_c_amt_s4b <= shift_c_amt;
+    prod_mant_s4b <= prod_mant_s4;
+    c_mant_s4b <= c_mant_s4;
+    prod_sign_s4b <= prod_sign_s4;
+    c_sign_s4b <= c_sign_s4;
+    rm_s4b <= rm_s4;
+    is_special_s4b <= is_special_s4;
+    special_result_s4b <= special_result_s4;
+    special_invalid_s4b <= special_invalid_s4;
+
+    // Rank 8: aligned operands
+    exp_large_s5 <= exp_large_s4b;
+    prod_aligned_s5 <= prod_aligned;
+    c_aligned_s5 <= c_aligned;
+    prod_sign_s5 <= prod_sign_s4b;
+    c_sign_s5 <= c_sign_s4b;
+    sticky_s5 <= sticky_prod | sticky_c;
+    // Track when the smaller operand was shifted out during subtraction.
+    // This affects the guard bit calculation for FMA precision.
+    sticky_c_sub_s5 <= (prod_sign_s4b != c_sign_s4b) ? (
+        (prod_aligned > c_aligned) ? sticky_c :
+        (c_aligned > prod_aligned) ? sticky_prod :
+        1'b0
+    ) : 1'b0;
+    rm_s5 <= rm_s4b;
+    is_special_s5 <= is_special_s4b;
+    special_result_s5 <= special_result_s4b;
+    special_invalid_s5 <= special_invalid_s4b;
+
+    // Rank 9: sum and its metadata
+    sum_s5a <= sum_s5a_comb;
+    result_sign_s5a <= result_sign_s5a_comb;
+    sign_large_s5a <= sign_large_s5a_comb;
+    sign_small_s5a <= sign_small_s5a_comb;
+    sum_is_zero_s5a <= sum_is_zero_s5a_comb;
+    exp_large_s5a <= exp_large_s5;
+    sticky_s5a <= sticky_s5;
+    rm_s5a <= rm_s5;
+    is_special_s5a <= is_special_s5;
+    special_result_s5a <= special_result_s5;
+    special_invalid_s5a <= special_invalid_s5;
+
+    // Rank 10: sum LZC
+    exp_large_s6 <= exp_large_s5a;
+    sum_s6 <= sum_s5a;
+    sum_is_zero_s6 <= sum_is_zero_s5a;
+    lzc_s6 <= lzc_s5b_comb;
+    sum_sticky_s6 <= sticky_s5a;
+    result_sign_s6 <= result_sign_s5a;
+    sign_large_s6 <= sign_large_s5a;
+    sign_small_s6 <= sign_small_s5a;
+    rm_s6 <= rm_s5a;
+    is_special_s6 <= is_special_s5a;
+    special_result_s6 <= special_result_s5a;
+    special_invalid_s6 <= special_invalid_s5a;
+
+    // Rank 11: normalized sum
+    normalized_sum_s7 <= normalized_sum_s6_comb;
+    normalized_exp_s7 <= normalized_exp_s6_comb;
+    sum_is_zero_s7 <= sum_is_zero_s6;
+    sum_sticky_s7 <= sum_sticky_s6;
+    norm_sticky_s7 <= norm_sticky_s6_comb;
+    result_sign_s7 <= result_sign_s6;
+    sign_large_s7 <= sign_large_s6;
+    sign_small_s7 <= sign_small_s6;
+    rm_s7 <= rm_s6;
+    is_special_s7 <= is_special_s6;
+    special_result_s7 <= special_result_s6;
+    special_invalid_s7 <= special_invalid_s6;
+
+    // Rank 12: subnormal handling outputs
+    mantissa_work_s7b <= mantissa_work_s7a_comb;
+    guard_work_s7b <= guard_work_s7a_comb;
+    round_work_s7b <= round_work_s7a_comb;
+    sticky_work_s7b <= sticky_work_s7a_comb;
+    exp_work_s7b <= exp_work_s7a_comb;
+    fp_round_sign_s7b <= fp_round_sign_s7a_comb;
+    is_zero_result_s7b <= sum_is_zero_s7 && !sum_sticky_s7;
+    rm_s7b <= rm_s7;
+    is_special_s7b <= is_special_s7;
+    special_result_s7b <= special_result_s7;
+    special_invalid_s7b <= special_invalid_s7;
+
+    // Rank 13: round-up decision
+    result_sign_s8 <= fp_round_sign_s7b;
+    exp_work_s8 <= exp_work_s7b;
+    mantissa_work_s8 <= mantissa_work_s7b;
+    round_up_s8 <= round_up_s7b_comb;
+    is_inexact_s8 <= is_inexact_s7b;
+    is_zero_result_s8 <= is_zero_result_s7b;
+    rm_s8 <= rm_s7b;
+    is_special_s8 <= is_special_s7b;
+    special_result_s8 <= special_result_s7b;
+    special_invalid_s8 <= special_invalid_s7b;
+
+    // Rank 14: final result
+    result_s9 <= final_result_s8_comb;
+    flags_s9  <= final_flags_s8_comb;
   end
 
-  // Next state logic
-  always_comb begin
-    next_state = state;
-    case (state)
-      IDLE:    if (i_valid) next_state = STAGE1;
-      STAGE1:  next_state = STAGE2;
-      STAGE2:  next_state = STAGE2B;
-      STAGE2B: next_state = state_e'(prod_mant_s2_tiled_valid ? STAGE3A : STAGE2B);
-      STAGE3A: next_state = STAGE3B;
-      STAGE3B: next_state = STAGE4;
-      STAGE4:  next_state = STAGE4B;
-      STAGE4B: next_state = STAGE5A;
-      STAGE5A: next_state = STAGE5B;
-      STAGE5B: next_state = STAGE6;
-      STAGE6:  next_state = STAGE7A;
-      STAGE7A: next_state = STAGE7B;
-      STAGE7B: next_state = STAGE8;
-      STAGE8:  next_state = STAGE9;
-      STAGE9:  next_state = IDLE;
-      default: next_state = IDLE;
-    endcase
+`ifndef SYNTHESIS
+  // The multiplier's internal depth must line up with the side pipe.
+  always_ff @(posedge i_clk) begin
+    if (!i_rst) begin
+      assert (prod_mant_s3_valid == valid_pipe[1+MulLatency])
+      else $error("fp_fma: multiplier valid misaligned with metadata side pipe");
+    end
   end
+`endif
 
   // Output logic (from registered s9)
   assign o_result = result_s9;
   assign o_flags  = flags_s9;
-  assign o_valid  = valid_reg;
+  assign o_valid  = valid_pipe[riscv_pkg::FpFmaLatency-1];
 
 endmodule : fp_fma
@@ -17,28 +17,31 @@
 /*
   IEEE 754 floating-point square root — fully pipelined.
 
-  Accepts a new operation every cycle. Pipeline depth:
-    SP (FP_WIDTH=32): RootBits + 9 = 27 + 9 = 36 stages (padded +1 to match divider)
-    DP (FP_WIDTH=64): RootBits + 9 = 56 + 9 = 65 stages (padded +1 to match divider)
+  Accepts a new operation every cycle. The COMPUTE chain retires
+  BITS_PER_STAGE root bits per pipeline stage (radix-4 at the default 2),
+  mirroring fp_divider's folding, and pads itself to the matching divider
+  depth so fp_div_shim can use one tag-queue depth per precision
+  (riscv_pkg::FpDivPipeDepthS/D). Pipeline depth:
+    SP (FP_WIDTH=32): 23 stages (= fp_divider SP depth)
+    DP (FP_WIDTH=64): 38 stages (= fp_divider DP depth)
 
   Pipeline structure:
     Stage 0:  Input capture
     Stage 1:  SETUP — unpack, classify, LZC, special case detect, exp/mantissa adjustment
     Stage 2:  PREP — initialize sqrt state (root=0, remainder=0, radicand shifted)
-    Stages 3..3+RootBits-1:  COMPUTE — one digit-recurrence step per stage
-    Stage 3+RootBits:    PAD — extra register stage (aligns depth with divider)
-    Stage 3+RootBits+1:  NORMALIZE
-    Stage 3+RootBits+2:  ROUND_SHIFT
-    Stage 3+RootBits+3:  ROUND_PREP
-    Stage 3+RootBits+4:  ROUND_APPLY
-    Stage 3+RootBits+5:  OUTPUT
+    Stages 3..3+SqrtStages-1:  COMPUTE — BITS_PER_STAGE digit-recurrence steps per stage
+    Stages 3+SqrtStages..+PadStages-1:  PAD — register stages (align depth with divider)
+    then:  NORMALIZE, ROUND_SHIFT, ROUND_PREP, ROUND_APPLY, OUTPUT
 
   Special cases (NaN, negative, inf, zero) detected at SETUP. The COMPUTE
   stages still execute on don't-care data; the OUTPUT stage selects the
   special result when is_special is set.
 */
 module fp_sqrt #(
-    parameter int unsigned FP_WIDTH = 32
+    parameter int unsigned FP_WIDTH = 32,
+    // Root bits retired per COMPUTE stage.  Must match fp_divider's
+    // BITS_PER_STAGE or the pad-stage depth alignment below breaks.
+    parameter int unsigned BITS_PER_STAGE = riscv_pkg::FpDivBitsPerStage
 ) (
     input  logic                                i_clk,
     input  logic                                i_rst,
@@ -66,8 +69,20 @@ module fp_sqrt #(
   localparam logic signed [ExpExtBits-1:0] ExpBiasExt = ExpExtBits'(ExpBias);
   localparam logic signed [ExpExtBits-1:0] ExpBiasMinus1Ext = ExpExtBits'(ExpBias - 1);
 
-  // Total stages: 3 (input+setup+prep) + RootBits (compute) + 1 (pad) + 5 (norm..output) = RootBits + 9
-  localparam int unsigned TotalStages = RootBits + 9;
+  // COMPUTE pipeline stages after folding.  When BITS_PER_STAGE does not
+  // divide RootBits evenly, the first stage retires the remainder bits so
+  // every later stage does a full BITS_PER_STAGE.
+  localparam int unsigned SqrtStages = (RootBits + BITS_PER_STAGE - 1) / BITS_PER_STAGE;
+
+  // Pad the pipeline out to fp_divider's depth for the same precision.  The
+  // divider retires MantBits + 2 quotient bits across its DIVIDE stages and
+  // has one extra bookkeeping stage (NORMALIZE_PREP), so:
+  //   divider total = ceil((MantBits+2)/BITS_PER_STAGE) + 10
+  //   sqrt total    = 3 (input+setup+prep) + SqrtStages + PadStages + 5
+  localparam int unsigned DivStagesMatch = (MantBits + 2 + BITS_PER_STAGE - 1) / BITS_PER_STAGE;
+  localparam int unsigned PadStages = DivStagesMatch + 2 - SqrtStages;
+
+  localparam int unsigned TotalStages = DivStagesMatch + 10;
 
   // Valid pipeline
   logic pipe_valid[TotalStages+1];
@@ -250,19 +265,19 @@ module fp_sqrt #(
   end
 
   // =========================================================================
-  // Stages 3..3+RootBits-1: COMPUTE — one digit-recurrence step per stage
+  // Stages 3..3+SqrtStages-1: COMPUTE — BITS_PER_STAGE digit-recurrence steps per stage
   // =========================================================================
 
-  // Pipeline arrays (RootBits+1 entries: index 0 = input, index RootBits = output)
-  logic        [    RootBits-1:0] comp_root           [RootBits+1];
-  logic        [     RemBits-1:0] comp_remainder      [RootBits+1];
-  logic        [RadicandBits-1:0] comp_radicand       [RootBits+1];
+  // Pipeline arrays (SqrtStages+1 entries: index 0 = input, index SqrtStages = output)
+  logic        [    RootBits-1:0] comp_root           [SqrtStages+1];
+  logic        [     RemBits-1:0] comp_remainder      [SqrtStages+1];
+  logic        [RadicandBits-1:0] comp_radicand       [SqrtStages+1];
   // Metadata arrays
-  logic signed [  ExpExtBits-1:0] comp_result_exp     [RootBits+1];
-  logic                           comp_is_special     [RootBits+1];
-  logic        [    FP_WIDTH-1:0] comp_special_result [RootBits+1];
-  logic                           comp_special_invalid[RootBits+1];
-  logic        [             2:0] comp_rm             [RootBits+1];
+  logic signed [  ExpExtBits-1:0] comp_result_exp     [SqrtStages+1];
+  logic                           comp_is_special     [SqrtStages+1];
+  logic        [    FP_WIDTH-1:0] comp_special_result [SqrtStages+1];
+  logic                           comp_special_invalid[SqrtStages+1];
+  logic        [             2:0] comp_rm             [SqrtStages+1];
 
   // Connect stage 2 output to compute pipeline input.
   always_comb begin
@@ -276,27 +291,45 @@ module fp_sqrt #(
     comp_rm[0]              = s2_rm;
   end
 
-  // Generate block: one digit-recurrence step per stage
-  for (genvar g = 0; g < RootBits; g++) begin : gen_sqrt
-    // Combinational: bring down 2 radicand bits, trial subtract, set root bit
-    logic [RemBits-1:0] rem_candidate;
-    logic [RemBits-1:0] trial_divisor;
-    logic               rem_ge;
-
-    assign rem_candidate = {comp_remainder[g][RemBits-3:0], comp_radicand[g][RadicandBits-1-:2]};
-    assign trial_divisor = {{RootBits{1'b0}}, comp_root[g], 2'b01};
-    assign rem_ge = rem_candidate >= trial_divisor;
+  // Generate block: BITS_PER_STAGE chained digit-recurrence steps per stage.
+  // A leftover stage (when BITS_PER_STAGE does not divide RootBits) retires
+  // the remainder bits first so the total step count is exactly RootBits.
+  for (genvar g = 0; g < SqrtStages; g++) begin : gen_sqrt
+    localparam int unsigned StageSteps =
+        (g == 0 && (RootBits % BITS_PER_STAGE) != 0) ?
+        (RootBits % BITS_PER_STAGE) : BITS_PER_STAGE;
+
+    // Combinational: per step, bring down 2 radicand bits, trial subtract,
+    // set one root bit; steps chain between flop stages
+    logic [     RemBits-1:0] rem_candidate;
+    logic [     RemBits-1:0] trial_divisor;
+    logic [    RootBits-1:0] next_root;
+    logic [     RemBits-1:0] next_remainder;
+    logic [RadicandBits-1:0] next_radicand;
+
+    always_comb begin
+      next_root      = comp_root[g];
+      next_remainder = comp_remainder[g];
+      next_radicand  = comp_radicand[g];
+      for (int b = 0; b < int'(StageSteps); b++) begin
+        rem_candidate = {next_remainder[RemBits-3:0], next_radicand[RadicandBits-1-:2]};
+        trial_divisor = {{RootBits{1'b0}}, next_root, 2'b01};
+        next_radicand = {next_radicand[RadicandBits-3:0], 2'b00};
+        if (rem_candidate >= trial_divisor) begin
+          next_remainder = rem_candidate - trial_divisor;
+          next_root      = {next_root[RootBits-2:0], 1'b1};
+        end else begin
+          next_remainder = rem_candidate;
+          next_root      = {next_root[RootBits-2:0], 1'b0};
+        end
+      end
+    end
 
     // Registered output
     always_ff @(posedge i_clk) begin
-      comp_radicand[g+1] <= {comp_radicand[g][RadicandBits-3:0], 2'b00};
-      if (rem_ge) begin
-        comp_remainder[g+1] <= rem_candidate - trial_divisor;
-        comp_root[g+1]      <= {comp_root[g][RootBits-2:0], 1'b1};
-      end else begin
-        comp_remainder[g+1] <= rem_candidate;
-        comp_root[g+1]      <= {comp_root[g][RootBits-2:0], 1'b0};
-      end
+      comp_radicand[g+1]        <= next_radicand;
+      comp_remainder[g+1]       <= next_remainder;
+      comp_root[g+1]            <= next_root;
       comp_result_exp[g+1]      <= comp_result_exp[g];
       comp_is_special[g+1]      <= comp_is_special[g];
       comp_special_result[g+1]  <= comp_special_result[g];
@@ -306,38 +339,50 @@ module fp_sqrt #(
   end
 
   // =========================================================================
-  // Stage 3+RootBits: PAD — extra register stage to align with divider depth
+  // Stages 3+SqrtStages..: PAD — register stages to align with divider depth
   // =========================================================================
-  logic [RootBits-1:0] s_pad_root;
-  logic [RemBits-1:0] s_pad_remainder;
-  logic signed [ExpExtBits-1:0] s_pad_result_exp;
-  logic s_pad_is_special;
-  logic [FP_WIDTH-1:0] s_pad_special_result;
-  logic s_pad_special_invalid;
-  logic [2:0] s_pad_rm;
+  logic [RootBits-1:0] pad_root[PadStages+1];
+  logic [RemBits-1:0] pad_remainder[PadStages+1];
+  logic signed [ExpExtBits-1:0] pad_result_exp[PadStages+1];
+  logic pad_is_special[PadStages+1];
+  logic [FP_WIDTH-1:0] pad_special_result[PadStages+1];
+  logic pad_special_invalid[PadStages+1];
+  logic [2:0] pad_rm[PadStages+1];
 
-  always_ff @(posedge i_clk) begin
-    s_pad_root <= comp_root[RootBits];
-    s_pad_remainder <= comp_remainder[RootBits];
-    s_pad_result_exp <= comp_result_exp[RootBits];
-    s_pad_is_special <= comp_is_special[RootBits];
-    s_pad_special_result <= comp_special_result[RootBits];
-    s_pad_special_invalid <= comp_special_invalid[RootBits];
-    s_pad_rm <= comp_rm[RootBits];
+  always_comb begin
+    pad_root[0]            = comp_root[SqrtStages];
+    pad_remainder[0]       = comp_remainder[SqrtStages];
+    pad_result_exp[0]      = comp_result_exp[SqrtStages];
+    pad_is_special[0]      = comp_is_special[SqrtStages];
+    pad_special_result[0]  = comp_special_result[SqrtStages];
+    pad_special_invalid[0] = comp_special_invalid[SqrtStages];
+    pad_rm[0]              = comp_rm[SqrtStages];
+  end
+
+  for (genvar g = 0; g < PadStages; g++) begin : gen_pad
+    always_ff @(posedge i_clk) begin
+      pad_root[g+1]            <= pad_root[g];
+      pad_remainder[g+1]       <= pad_remainder[g];
+      pad_result_exp[g+1]      <= pad_result_exp[g];
+      pad_is_special[g+1]      <= pad_is_special[g];
+      pad_special_result[g+1]  <= pad_special_result[g];
+      pad_special_invalid[g+1] <= pad_special_invalid[g];
+      pad_rm[g+1]              <= pad_rm[g];
+    end
   end
 
   // =========================================================================
-  // Stage 3+RootBits+1: NORMALIZE
+  // NORMALIZE
   // =========================================================================
   logic [RootBits-1:0] norm_root;
   logic signed [ExpExtBits-1:0] norm_result_exp;
 
   always_comb begin
-    norm_root = s_pad_root;
-    norm_result_exp = s_pad_result_exp;
-    if (!s_pad_root[RootBits-1]) begin
-      norm_root = s_pad_root << 1;
-      norm_result_exp = s_pad_result_exp - 1;
+    norm_root = pad_root[PadStages];
+    norm_result_exp = pad_result_exp[PadStages];
+    if (!pad_root[PadStages][RootBits-1]) begin
+      norm_root = pad_root[PadStages] << 1;
+      norm_result_exp = pad_result_exp[PadStages] - 1;
     end
   end
 
@@ -352,16 +397,16 @@ module fp_sqrt #(
 
   always_ff @(posedge i_clk) begin
     s_norm_root <= norm_root;
-    s_norm_remainder <= s_pad_remainder;
+    s_norm_remainder <= pad_remainder[PadStages];
     s_norm_result_exp <= norm_result_exp;
-    s_norm_is_special <= s_pad_is_special;
-    s_norm_special_result <= s_pad_special_result;
-    s_norm_special_invalid <= s_pad_special_invalid;
-    s_norm_rm <= s_pad_rm;
+    s_norm_is_special <= pad_is_special[PadStages];
+    s_norm_special_result <= pad_special_result[PadStages];
+    s_norm_special_invalid <= pad_special_invalid[PadStages];
+    s_norm_rm <= pad_rm[PadStages];
   end
 
   // =========================================================================
-  // Stage 3+RootBits+2: ROUND_SHIFT — fp_subnorm_shift
+  // ROUND_SHIFT — fp_subnorm_shift
   // =========================================================================
   logic [MantBits:0] rsh_pre_round_mant;
   logic              rsh_guard_bit;
@@ -422,7 +467,7 @@ module fp_sqrt #(
   end
 
   // =========================================================================
-  // Stage 3+RootBits+3: ROUND_PREP — compute round-up decision
+  // ROUND_PREP — compute round-up decision
   // =========================================================================
   logic rprep_round_up;
   logic rprep_lsb;
@@ -459,7 +504,7 @@ module fp_sqrt #(
   end
 
   // =========================================================================
-  // Stage 3+RootBits+4: ROUND_APPLY — fp_result_assembler
+  // ROUND_APPLY — fp_result_assembler
   // =========================================================================
   logic [FP_WIDTH-1:0] rapply_result;
   riscv_pkg::fp_flags_t rapply_flags;
@@ -497,7 +542,7 @@ module fp_sqrt #(
   end
 
   // =========================================================================
-  // Stage 3+RootBits+5: OUTPUT — register final result
+  // OUTPUT — register final result
   // =========================================================================
   logic [FP_WIDTH-1:0] s_output_result;
   riscv_pkg::fp_flags_t s_output_flags;
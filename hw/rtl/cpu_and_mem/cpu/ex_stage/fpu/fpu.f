@@ -23,7 +23,7 @@ $(ROOT)/hw/rtl/cpu_and_mem/cpu/ex_stage/fpu/fp_multiplier.sv
 $(ROOT)/hw/rtl/cpu_and_mem/cpu/ex_stage/fpu/fp_divider.sv
 $(ROOT)/hw/rtl/cpu_and_mem/cpu/ex_stage/fpu/fp_sqrt.sv
 
-# Fused multiply-add (4-cycle pipelined)
+# Fused multiply-add (fully pipelined, riscv_pkg::FpFmaLatency cycles)
 $(ROOT)/hw/rtl/cpu_and_mem/cpu/ex_stage/fpu/fp_fma.sv
 
 # FPU sub-unit wrappers (S+D with tracking FSM, NaN-boxing, dest reg)
@@ -27,7 +27,8 @@
     ├── fp_multiplier.sv     Multi-cycle multiply (8-cycle, FMUL.S)
     ├── fp_divider.sv        Sequential divide (~15 cycles, FDIV.S)
     ├── fp_sqrt.sv           Sequential square root (~15 cycles, FSQRT.S)
-    ├── fp_fma.sv            Multi-cycle FMA (12-cycle, FMADD/FMSUB/FNMADD/FNMSUB)
+    ├── fp_fma.sv            Pipelined FMA (riscv_pkg::FpFmaLatency cycles,
+    │                        FMADD/FMSUB/FNMADD/FNMSUB)
     ├── fp_compare.sv        Comparisons and min/max (3-cycle)
     ├── fp_convert.sv        Integer/FP conversions (3-cycle)
     ├── fp_classify.sv       FCLASS.S (1-cycle)
@@ -40,15 +41,19 @@
     5-cycle:  FCVT, FMV (multi-cycle, stalls pipeline)
     10-cycle: FADD, FSUB (multi-cycle, stalls pipeline)
     9-cycle:  FMUL (multi-cycle, stalls pipeline)
-    14-cycle: FMADD, FMSUB, FNMADD, FNMSUB (multi-cycle, stalls pipeline)
+    15-cycle: FMADD, FMSUB, FNMADD, FNMSUB (pipelined internally, but this
+              in-order front end still issues one at a time and stalls)
     ~32-cycle: FDIV, FSQRT (sequential, stalls pipeline)
 
   Design Note:
   ============
-    Multi-cycle operations (adder, multiplier, FMA, convert) use internal state
+    Multi-cycle operations (adder, multiplier, convert) use internal state
     machines and capture operands at the start of each operation. This non-pipelined
     design simplifies timing by ensuring operand stability without complex
     capture bypass mechanisms. The pipeline stalls until each operation completes.
+    The FMA datapath itself is fully pipelined (the out-of-order backend issues
+    into it every cycle), but this in-order wrapper keeps the one-at-a-time
+    issue discipline and simply waits for completion.
 
   Interface:
   ==========
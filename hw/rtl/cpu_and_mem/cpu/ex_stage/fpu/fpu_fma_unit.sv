@@ -15,7 +15,15 @@
  */
 
 // FPU FMA Unit Wrapper
-// Wraps S and D fp_fma instances with tracking FSM, NaN-boxing, and dest reg capture.
+// Wraps S and D fp_fma instances with NaN-boxing and dest reg capture.
+//
+// Both fp_fma instances are fully pipelined at the same fixed latency
+// (riscv_pkg::FpFmaLatency), so the wrapper accepts a new operation every
+// cycle.  At most one precision starts per cycle, so valid_s and valid_d
+// can never collide on the output.  o_busy/o_dest_reg keep the legacy
+// single-op contract the in-order FPU relies on (it issues one FMA at a
+// time and reads o_dest_reg while o_busy for RAW-hazard reporting); the
+// out-of-order shim tracks tags itself and ignores them.
 module fpu_fma_unit #(
     parameter int unsigned FP_WIDTH_D = 64
 ) (
@@ -47,20 +55,28 @@ module fpu_fma_unit #(
     box32 = {{FpPad{1'b1}}, value};
   endfunction
 
-  // Tracking FSM
-  logic started, can_start;
   logic start_s, start_d;
-  assign can_start = ~started;
-  assign start_s   = i_valid & i_use_unit & ~i_op_is_double & can_start;
-  assign start_d   = i_valid & i_use_unit & i_op_is_double & can_start;
-  assign o_start   = start_s | start_d;
+  assign start_s = i_valid & i_use_unit & ~i_op_is_double;
+  assign start_d = i_valid & i_use_unit & i_op_is_double;
+  assign o_start = start_s | start_d;
+
+  // In-flight count for the legacy busy contract (up to FpFmaLatency ops
+  // can be in the pipeline at once).
+  logic [$clog2(riscv_pkg::FpFmaLatency+1)-1:0] inflight_count;
 
   always_ff @(posedge i_clk) begin
-    if (i_rst) started <= 1'b0;
-    else if (o_valid) started <= 1'b0;
-    else if (o_start) started <= 1'b1;
+    if (i_rst) inflight_count <= '0;
+    else begin
+      case ({
+        o_start, o_valid
+      })
+        2'b10:   inflight_count <= inflight_count + 1'b1;
+        2'b01:   inflight_count <= inflight_count - 1'b1;
+        default: ;  // both or neither: no net change
+      endcase
+    end
   end
-  assign o_busy = started & ~o_valid;
+  assign o_busy = (inflight_count != '0) & ~o_valid;
 
   // S/D results
   logic                 [          31:0] result_s;
@@ -74,9 +90,9 @@ module fpu_fma_unit #(
   assign o_result = valid_s ? box32(result_s) : valid_d ? result_d : '0;
   assign o_flags  = valid_s ? flags_s : valid_d ? flags_d : '0;
 
-  // Dest reg capture
+  // Dest reg capture (meaningful only while a single op is in flight)
   always_ff @(posedge i_clk) begin
-    if (i_valid && i_use_unit && can_start) o_dest_reg <= i_dest_reg;
+    if (i_valid && i_use_unit) o_dest_reg <= i_dest_reg;
   end
 
   fp_fma #(
@@ -91,7 +107,6 @@ module fpu_fma_unit #(
       .i_negate_product(i_negate_product),
       .i_negate_c(i_negate_c),
       .i_rounding_mode(i_rounding_mode),
-      .i_stall(1'b0),
       .o_result(result_s),
       .o_valid(valid_s),
       .o_flags(flags_s)
@@ -109,7 +124,6 @@ module fpu_fma_unit #(
       .i_negate_product(i_negate_product),
       .i_negate_c(i_negate_c),
       .i_rounding_mode(i_rounding_mode),
-      .i_stall(1'b0),
       .o_result(result_d),
       .o_valid(valid_d),
       .o_flags(flags_d)
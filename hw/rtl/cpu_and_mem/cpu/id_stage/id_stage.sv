@@ -38,7 +38,8 @@ module id_stage #(
     input logic i_clk,
     input riscv_pkg::pipeline_ctrl_t i_pipeline_ctrl,
     input riscv_pkg::from_pd_to_id_t i_from_pd_to_id,
-    // Cold-backward-branch override from pd_stage. Both signals are FF outputs
+    // PD redirect override from pd_stage (cold predicted-taken conditional
+    // branches and BTB-missed unconditional jumps). Both signals are FF outputs
     // of pd_stage (the same registers that drive the IF redirect). Applying the
     // override here instead of inside pd_stage's o_from_pd_to_id register keeps
     // the long pd_backward_target combinational chain off the worst path.
@@ -47,6 +48,9 @@ module id_stage #(
     input riscv_pkg::rf_to_fwd_t i_rf_to_id,  // Regfile read data (combinational from PD src regs)
     input riscv_pkg::fp_rf_to_fwd_t i_fp_rf_to_id,  // FP regfile read data (F extension)
     input riscv_pkg::from_ma_to_wb_t i_from_ma_to_wb,  // WB bypass (WB writes same cycle ID reads)
+    // mstatus.FS == Off (from csr_file): FP instructions decode as illegal so
+    // lazy FP context switching can fault the save/restore in on first use.
+    input logic i_fp_disabled,
     output riscv_pkg::from_id_to_ex_t o_from_id_to_ex,
     // Slot-2 instruction (2-wide dispatch).  Mirror of the slot-1 inputs above.
     // Slot-2 does NOT receive the backward-branch heuristic override (slot-1
@@ -60,10 +64,12 @@ module id_stage #(
     output riscv_pkg::from_id_to_ex_t o_from_id_to_ex_2
 );
 
-  // Effective BTB metadata after applying the cold-backward-branch override.
-  // i_pd_redirect is high in the cycle the just-detected backward branch reaches
-  // id_stage (it tracks pd_backward_branch through the same stall/flush gates as
-  // o_from_pd_to_id), so the override naturally aligns with the branch instruction.
+  // Effective BTB metadata after applying the PD redirect override.
+  // i_pd_redirect is high in the cycle the just-detected branch or jump reaches
+  // id_stage (it tracks the PD fire signals through the same stall/flush gates
+  // as o_from_pd_to_id), so the override naturally aligns with the redirecting
+  // instruction. For a BTB-missed JAL the override target equals the precomputed
+  // jal_target, so the ROB allocates it as correctly predicted.
   logic [XLEN-1:0] effective_btb_predicted_target;
   logic            effective_btb_hit;
   logic            effective_btb_predicted_taken;
@@ -136,8 +142,21 @@ module id_stage #(
       .o_illegal(decoder_illegal)
   );
 
+  // FP instruction detection by major opcode alone (compressed FP forms
+  // arrive from PD already expanded), for the mstatus.FS == Off trap.
+  logic fp_instruction_disabled;
+  assign fp_instruction_disabled = i_fp_disabled &&
+      (instruction.opcode == riscv_pkg::OPC_LOAD_FP ||
+       instruction.opcode == riscv_pkg::OPC_STORE_FP ||
+       instruction.opcode == riscv_pkg::OPC_FMADD ||
+       instruction.opcode == riscv_pkg::OPC_FMSUB ||
+       instruction.opcode == riscv_pkg::OPC_FNMSUB ||
+       instruction.opcode == riscv_pkg::OPC_FNMADD ||
+       instruction.opcode == riscv_pkg::OPC_OP_FP);
+
   logic is_illegal_instruction;
-  assign is_illegal_instruction = decoder_illegal | i_from_pd_to_id.illegal_instruction;
+  assign is_illegal_instruction = decoder_illegal | i_from_pd_to_id.illegal_instruction |
+      fp_instruction_disabled;
 
   // Instantiate immediate decoder for all immediate formats
   immediate_decoder #(
@@ -909,8 +928,20 @@ module id_stage #(
       .o_illegal(decoder_illegal_2)
   );
 
+  // Slot-2 mirror of the mstatus.FS == Off FP gate.
+  logic fp_instruction_disabled_2;
+  assign fp_instruction_disabled_2 = i_fp_disabled &&
+      (instruction_2.opcode == riscv_pkg::OPC_LOAD_FP ||
+       instruction_2.opcode == riscv_pkg::OPC_STORE_FP ||
+       instruction_2.opcode == riscv_pkg::OPC_FMADD ||
+       instruction_2.opcode == riscv_pkg::OPC_FMSUB ||
+       instruction_2.opcode == riscv_pkg::OPC_FNMSUB ||
+       instruction_2.opcode == riscv_pkg::OPC_FNMADD ||
+       instruction_2.opcode == riscv_pkg::OPC_OP_FP);
+
   logic is_illegal_instruction_2;
-  assign is_illegal_instruction_2 = decoder_illegal_2 | i_from_pd_to_id_2.illegal_instruction;
+  assign is_illegal_instruction_2 = decoder_illegal_2 | i_from_pd_to_id_2.illegal_instruction |
+      fp_instruction_disabled_2;
 
   immediate_decoder #(
       .XLEN(XLEN)
@@ -24,7 +24,8 @@
   branch unit, and memory interface. The decoder supports the base integer instruction
   set (RV32I), M-extension for integer multiply and divide, A-extension for atomics
   (LR.W, SC.W, AMO), F-extension for single-precision floating-point, B-extension
-  (Zba, Zbb, Zbs), plus Zicond, Zbkb, Zicsr for CSR access, and privileged instructions
+  (Zba, Zbb, Zbs), plus Zicond, Zbkb, Zicsr for CSR access, a Zpn packed-SIMD subset
+  (ADD8/SUB8/ADD16/SUB16 and a quad-int8 dot product), and privileged instructions
   (MRET, WFI, ECALL, EBREAK) for trap/interrupt handling.
   Output signals indicate the operation type, branch condition, and store size for
   proper execution in later pipeline stages.
@@ -99,6 +100,24 @@ module instr_decoder (
         default: o_illegal = 1'b1;
       endcase
 
+      // =========================================================================
+      // P-extension packed SIMD subset (R-type format, OP-P major opcode)
+      // Standard Zpn encodings; PDOT8 sits at SMAQA's slot but computes only
+      // the quad-int8 dot product -- the rd accumulation is a separate add in
+      // software because the reservation stations carry two sources.
+      // =========================================================================
+      riscv_pkg::OPC_OP_P:
+      unique case ({
+        i_instr.funct7, i_instr.funct3
+      })
+        10'b0100000_000: o_instr_op = riscv_pkg::PADD16;  // ADD16
+        10'b0100001_000: o_instr_op = riscv_pkg::PSUB16;  // SUB16
+        10'b0100100_000: o_instr_op = riscv_pkg::PADD8;  // ADD8
+        10'b0100101_000: o_instr_op = riscv_pkg::PSUB8;  // SUB8
+        10'b1100100_000: o_instr_op = riscv_pkg::PDOT8;  // SMAQA (sans accumulate)
+        default: o_illegal = 1'b1;
+      endcase
+
       // =========================================================================
       // Register-immediate operations (I-type format)
       // Decoding: opcode -> funct3 -> funct7 -> rs2 (for some Zbb/Zbkb)
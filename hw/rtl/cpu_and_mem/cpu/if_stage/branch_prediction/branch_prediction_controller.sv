@@ -32,7 +32,9 @@
  * Architecture:
  *   - BTB provides combinational lookup (o_btb_* signals)
  *   - RAS provides return address prediction for JALR returns
- *   - RAS prediction takes priority over BTB for detected returns
+ *   - Indirect-target predictor provides targets for non-return JALRs
+ *   - RAS prediction takes priority over BTB for detected returns; the
+ *     indirect-target predictor slots between them
  *   - sel_prediction gates when prediction actually redirects PC
  *   - Registered outputs (o_prediction_*_r) align with instruction timing
  *   - prediction_holdoff signals c_ext_state to clear stale buffers
@@ -111,12 +113,19 @@ module branch_prediction_controller (
     input logic                             i_ras_push_after_restore,
     input logic [      riscv_pkg::XLEN-1:0] i_ras_push_address_after_restore,
 
-    // Bimodal direction-predictor training (from commit, CONDITIONAL branches
-    // only).  Trains at the committing branch PC; no carried GHR / predict-PC.
+    // Direction-predictor training (from commit, CONDITIONAL branches only).
+    // Trains at the carried predict-time index; in the gshare configuration
+    // this same strobe also shifts the predictor's commit-order GHR.
     input logic                               i_dir_update_valid,
     input logic [riscv_pkg::BpDirIdxBits-1:0] i_dir_update_idx,
     input logic                               i_dir_update_taken,
 
+    // Indirect-target predictor training (commit-time misprediction of a
+    // non-return JALR; from ex_comb_synthesizer).
+    input logic                       i_ind_update,
+    input logic [riscv_pkg::XLEN-1:0] i_ind_update_pc,
+    input logic [riscv_pkg::XLEN-1:0] i_ind_update_target,
+
     // Combinational prediction outputs (for pc_controller next_pc selection)
     output logic                       o_predicted_taken,
     output logic [riscv_pkg::XLEN-1:0] o_predicted_target,
@@ -189,7 +198,8 @@ module branch_prediction_controller (
   assign o_prediction_requires_pc_reg_handoff = dir_predicted_taken;
 
   branch_predictor #(
-      .XLEN(XLEN)
+      .XLEN(XLEN),
+      .BTB_INDEX_BITS(riscv_pkg::BtbIndexBits)
   ) branch_predictor_inst (
       .i_clk,
       .i_rst(i_reset),
@@ -226,13 +236,19 @@ module branch_prediction_controller (
   // branch that MISSES the BTB still has a trained direction for the PD-stage
   // computed-target redirect (lever A).  The BTB still supplies the target and
   // the direction for branches that HIT it.  Trained at commit on conditional
-  // branches only, indexed by the committing branch PC.
+  // branches only, at the carried predict-time index.  USE_GSHARE selects the
+  // global-history (gshare) indexing variant for correlated-branch workloads;
+  // the GHR is commit-order and lives inside the predictor, so no history
+  // checkpoint/restore is wired into the recovery paths (see
+  // direction_predictor.sv).
   logic dir_taken;
   logic [riscv_pkg::BpDirIdxBits-1:0] dir_pred_idx;  // slot-1 predict-time index
+  logic [riscv_pkg::BpDirIdxBits-1:0] dir_pred_idx_2;  // slot-2 predict-time index
 
   direction_predictor #(
       .XLEN(XLEN),
-      .BIM_BITS(riscv_pkg::BpDirIdxBits)
+      .BIM_BITS(riscv_pkg::BpDirIdxBits),
+      .USE_GSHARE(riscv_pkg::BpUseGshare)
   ) direction_predictor_inst (
       .i_clk,
       .i_rst(i_reset),
@@ -242,6 +258,10 @@ module branch_prediction_controller (
       .o_taken(dir_taken),
       .o_pred_idx(dir_pred_idx),
 
+      // Slot-2 index lookup (training-only; slot-2 has no decoupled direction)
+      .i_pc_2(i_pc_2),
+      .o_pred_idx_2(dir_pred_idx_2),
+
       // Commit-time training (conditional branches only).  Trained at the carried
       // predict-time index so it updates the exact entry the prediction read.
       .i_update_valid(i_dir_update_valid),
@@ -260,10 +280,10 @@ module branch_prediction_controller (
   // Lever A: carry the predict-time bimodal index.  Slot-1 is registered in the
   // SAME stage as dir_taken_snapshot_r (aligns with the prediction metadata
   // reaching from_if_to_pd); slot-2's prediction is combinational, so its index
-  // is combinational off i_pc_2.
+  // is combinational off the predictor's i_pc_2 lookup.
   logic [riscv_pkg::BpDirIdxBits-1:0] pred_idx_snapshot_r;
   assign o_dir_idx   = pred_idx_snapshot_r;
-  assign o_dir_idx_2 = i_pc_2[riscv_pkg::BpDirIdxBits:1];
+  assign o_dir_idx_2 = dir_pred_idx_2;
 
   // BTB-hit direction comes from the BTB's own 2-bit counter (btb_predicted_taken).
   // The decoupled bimodal (dir_taken) is used ONLY for lever A's BTB-miss redirect
@@ -284,6 +304,8 @@ module branch_prediction_controller (
   logic ras_is_return;
   logic ras_is_coroutine;
 
+  logic ras_is_indirect_jump;
+
   ras_detector ras_detector_inst (
       .i_instruction(i_instruction),
       .i_raw_parcel(i_raw_parcel),
@@ -291,7 +313,42 @@ module branch_prediction_controller (
       .i_instruction_valid(i_instruction_valid),
       .o_is_call(ras_is_call),
       .o_is_return(ras_is_return),
-      .o_is_coroutine(ras_is_coroutine)
+      .o_is_coroutine(ras_is_coroutine),
+      .o_is_indirect_jump(ras_is_indirect_jump)
+  );
+
+  // ===========================================================================
+  // Indirect-Target Predictor (non-return JALR targets)
+  // ===========================================================================
+  // BTB training excludes JALR and the RAS only covers returns, so indirect
+  // calls and jumps (virtual dispatch, switch tables) otherwise always pay the
+  // slow commit-time misprediction.  Indexed by PC XOR commit-order branch
+  // history; trained from commit-time JALR mispredictions.  The hit is gated
+  // below with the live instruction's non-return-jalr detection, giving it the
+  // same instruction-arrival timing as a RAS prediction.
+  logic            ind_hit;
+  logic [XLEN-1:0] ind_target;
+
+  indirect_target_predictor #(
+      .XLEN(XLEN),
+      .INDEX_BITS(riscv_pkg::IndPredIndexBits),
+      .TAG_BITS(riscv_pkg::IndPredTagBits)
+  ) indirect_target_predictor_inst (
+      .i_clk,
+      .i_rst(i_reset),
+
+      .i_pc(i_pc),
+      .o_hit(ind_hit),
+      .o_target(ind_target),
+
+      // History shifts on the direction-training strobe (committed
+      // conditional branches, in order).
+      .i_ghr_shift(i_dir_update_valid),
+      .i_ghr_taken(i_dir_update_taken),
+
+      .i_update(i_ind_update),
+      .i_update_pc(i_ind_update_pc),
+      .i_update_target(i_ind_update_target)
   );
 
   // RAS stack signals
@@ -440,9 +497,18 @@ module branch_prediction_controller (
   logic sel_ras_prediction;
   assign sel_ras_prediction = ras_prediction_allowed && ras_valid;
 
-  // Combined prediction selection: RAS takes priority for returns
+  // sel_prediction for the indirect-target predictor: a non-return JALR with a
+  // table hit.  Shares ras_prediction_allowed (same instruction-arrival
+  // timing); RAS outranks it so a coroutine with live RAS state still uses
+  // the stack.
+  logic sel_ind_prediction;
+  assign sel_ind_prediction = ras_prediction_allowed && !sel_ras_prediction &&
+                              ras_is_indirect_jump && !ras_is_return && ind_hit;
+
+  // Combined prediction selection: RAS takes priority for returns, then the
+  // indirect-target predictor, then the BTB.
   logic sel_prediction;
-  assign sel_prediction = sel_ras_prediction || sel_btb_prediction;
+  assign sel_prediction = sel_ras_prediction || sel_ind_prediction || sel_btb_prediction;
 
   // Actual prediction use must still be blocked when branch resolution or spanning
   // is taking priority this cycle. Keep branch_taken and is_32bit_spanning as final
@@ -457,22 +523,31 @@ module branch_prediction_controller (
   assign prediction_used_effective = prediction_used_for_pc && !i_stall;
 
   // Export combinational prediction for pc_controller
-  // RAS prediction takes priority over BTB for returns
-  assign o_predicted_taken = sel_ras_prediction || dir_predicted_taken;
-  assign o_predicted_target = sel_ras_prediction ? ras_target : btb_predicted_target;
+  // RAS prediction takes priority over BTB for returns; the indirect-target
+  // predictor slots between them for non-return JALRs.
+  assign o_predicted_taken = sel_ras_prediction || sel_ind_prediction || dir_predicted_taken;
+  assign o_predicted_target = sel_ras_prediction ? ras_target :
+                              sel_ind_prediction ? ind_target : btb_predicted_target;
   assign o_prediction_used = prediction_used_effective;
   assign o_prediction_used_for_pc = prediction_used_for_pc;
 
   // Detect prediction to halfword-aligned address
   logic predicted_target_is_halfword;
-  assign predicted_target_is_halfword = sel_ras_prediction ?
-                                        ras_target[1] : btb_predicted_target[1];
+  assign predicted_target_is_halfword = sel_ras_prediction ? ras_target[1] :
+                                        sel_ind_prediction ? ind_target[1] :
+                                        btb_predicted_target[1];
   assign o_control_flow_to_halfword_pred = prediction_used_effective &&
                                            predicted_target_is_halfword;
 
-  // RAS prediction outputs (for pipeline passthrough)
-  assign o_ras_predicted = sel_ras_prediction;
-  assign o_ras_predicted_target = ras_target;
+  // RAS prediction outputs (for pipeline passthrough).  Indirect-target
+  // predictions deliberately ride the same metadata channel: downstream the
+  // flag means "instruction-based front-end JALR target prediction" — PD must
+  // not re-redirect, dispatch carries the target for branch-resolution
+  // validation, pc_controller skips the PC-based handoff — and all of that
+  // applies identically to both predictors.  The RAS stack itself keys off
+  // call/return detection, not this flag.
+  assign o_ras_predicted = sel_ras_prediction || sel_ind_prediction;
+  assign o_ras_predicted_target = sel_ind_prediction ? ind_target : ras_target;
   assign o_ras_checkpoint_tos = ras_checkpoint_tos;
   assign o_ras_checkpoint_valid_count = ras_checkpoint_valid_count;
 
@@ -600,9 +675,11 @@ module branch_prediction_controller (
   //   - If RAS predicted: the next sequential instruction arrives (STALE)
   //     RAS detection should be blocked to prevent spurious pushes
   //
-  // btb_only_prediction = BTB predicted AND RAS did NOT predict
+  // btb_only_prediction = BTB predicted AND neither instruction-based
+  // predictor (RAS / indirect-target) did
   logic btb_only_prediction;
-  assign btb_only_prediction = sel_btb_prediction && !sel_ras_prediction;
+  assign btb_only_prediction = sel_btb_prediction && !sel_ras_prediction &&
+                               !sel_ind_prediction;
   logic btb_only_prediction_effective;
   assign btb_only_prediction_effective = btb_only_prediction && !i_stall &&
                                          !i_branch_taken && !i_is_32bit_spanning;
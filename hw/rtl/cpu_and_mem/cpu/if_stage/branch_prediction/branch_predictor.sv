@@ -26,6 +26,9 @@
  *     CoreMark's branch working set overflows 128 entries, so the extra
  *     capacity raises BTB hit rate and cuts front-end redirect bubbles (the
  *     dominant measured branch cost) with no change to the prediction policy.
+ *     Capacity is build-time configurable via FROST_BTB_INDEX_BITS
+ *     (riscv_pkg::BtbIndexBits); entries are fully tagged, so growing the
+ *     index just trades tag bits for entries.
  *   - Each entry: valid (1) + tag (23 bits) + target (32) + counter (2)
  *   - Tag includes PC[1] to distinguish halfword-aligned addresses (C extension)
  *   - 2-bit saturating counter (bimodal predictor):
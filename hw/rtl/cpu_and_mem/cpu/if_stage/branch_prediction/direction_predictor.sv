@@ -25,11 +25,28 @@
  * stalling to an EX-stage misprediction.  The BTB still supplies both the target
  * and the direction for branches that HIT it.
  *
- * Why bimodal (not gshare/tournament): a correlating gshare + chooser variant was
- * implemented and measured on CoreMark.  Decoupling direction from the BTB is what
- * matters here; gshare added only ~1% over plain bimodal for this redirect use,
- * not worth its global-history register, extra RAM, and fetch->commit carry
- * plumbing.  See BRANCH_PREDICTION_FINDINGS.md.
+ * Why bimodal by default (not gshare/tournament): a correlating gshare + chooser
+ * variant was implemented and measured on CoreMark.  Decoupling direction from the
+ * BTB is what matters there; gshare added only ~1% over plain bimodal for this
+ * redirect use.  See BRANCH_PREDICTION_FINDINGS.md.
+ *
+ * USE_GSHARE (build: `FROST_GSHARE` via riscv_pkg::BpUseGshare) reinstates the
+ * global-history variant for workloads with correlated branches (parser state
+ * machines show it in the TOMASULO_PERF flush counters), where bimodal's
+ * per-PC counters thrash.  The index becomes bim_idx(pc) ^ GHR.  Two properties
+ * keep this nearly free of the carry plumbing that sank the original variant:
+ *
+ *   - The predict-time index is ALREADY carried through the pipeline and handed
+ *     back at commit (i_update_idx), so training hits the exact entry the
+ *     prediction read — history-dependent indexing changes nothing downstream.
+ *   - The GHR is COMMIT-ORDER: it shifts on the training strobe, which is the
+ *     in-order committed conditional-branch stream (widen-commit never retires
+ *     a branch at head+1, so lane-0 training sees every one).  An architectural
+ *     GHR never observes wrong-path fetches, so misprediction recovery needs no
+ *     history checkpoint/restore at all.  The cost is that predict-time history
+ *     lags by the branches still in flight; for the loop-carried correlation
+ *     this variant targets, the stale bits are the distant iterations that
+ *     matter, not the in-flight ones.
  *
  * Indexing: the prediction reads bim_idx(i_pc) = i_pc[BIM_BITS:1] at fetch.
  * Training must update the SAME entry the prediction read, so the predict-time
@@ -44,8 +61,9 @@
  * (counters start weakly-NT).
  */
 module direction_predictor #(
-    parameter int unsigned XLEN     = 32,
-    parameter int unsigned BIM_BITS = 10   // bimodal index bits (1024 entries)
+    parameter int unsigned XLEN       = 32,
+    parameter int unsigned BIM_BITS   = 10,    // bimodal index bits (1024 entries)
+    parameter bit          USE_GSHARE = 1'b0   // XOR a commit-order GHR into the index
 ) (
     input logic i_clk,
     input logic i_rst,
@@ -55,6 +73,13 @@ module direction_predictor #(
     output logic                o_taken,
     output logic [BIM_BITS-1:0] o_pred_idx, // predict-time index (carry for training)
 
+    // Slot-2 index lookup (no direction output: slot-2 predictions are BTB-hit
+    // only, but its committed branches still train, so the carried index must
+    // come from the same pred_idx() as slot-1 — under gshare that includes the
+    // GHR, which only this module holds).
+    input  logic [    XLEN-1:0] i_pc_2,
+    output logic [BIM_BITS-1:0] o_pred_idx_2,
+
     // Commit-time training (one committed CONDITIONAL branch per assert).
     // i_update_idx is the predict-time index this branch carried from fetch, so
     // the entry trained is exactly the entry the prediction read.
@@ -72,8 +97,29 @@ module direction_predictor #(
     else sat_update = (c == 2'b00) ? 2'b00 : c - 2'b01;
   endfunction
 
-  wire [BIM_BITS-1:0] bim_i1 = bim_idx(i_pc);
-  assign o_pred_idx = bim_i1;
+  // Commit-order global history (gshare variant only).  Shifts on the training
+  // strobe — the in-order committed conditional-branch stream — so it is
+  // architectural state and needs no checkpoint/restore on misprediction
+  // recovery.  Tied off (and pruned) in the bimodal configuration.
+  logic [BIM_BITS-1:0] ghr_q;
+  generate
+    if (USE_GSHARE) begin : g_ghr
+      always_ff @(posedge i_clk) begin
+        if (i_rst) ghr_q <= '0;
+        else if (i_update_valid) ghr_q <= {ghr_q[BIM_BITS-2:0], i_update_taken};
+      end
+    end else begin : g_no_ghr
+      assign ghr_q = '0;
+    end
+  endgenerate
+
+  function automatic logic [BIM_BITS-1:0] pred_idx(input logic [XLEN-1:0] pc);
+    pred_idx = USE_GSHARE ? (bim_idx(pc) ^ ghr_q) : bim_idx(pc);
+  endfunction
+
+  wire [BIM_BITS-1:0] bim_i1 = pred_idx(i_pc);
+  assign o_pred_idx   = bim_i1;
+  assign o_pred_idx_2 = pred_idx(i_pc_2);
 
   // Update (read-modify-write) at the carried predict-time index.
   wire [BIM_BITS-1:0] bim_iu = i_update_idx;
@@ -110,8 +156,9 @@ module direction_predictor #(
 
   assign o_taken = bim_rd1[1];
 
-  // i_rst retained for interface uniformity; the distributed-RAM counters
-  // zero-initialize, so no explicit reset is needed.
+  // The distributed-RAM counters zero-initialize, so i_rst only resets the
+  // gshare GHR; in the bimodal configuration it is unused (kept for interface
+  // uniformity).
   wire _unused = &{1'b0, i_rst};
 
 endmodule : direction_predictor
@@ -0,0 +1,139 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/*
+ * Indirect-Target Predictor — non-return JALR target table.
+ *
+ * The BTB deliberately never trains on JALR (ex_comb_synthesizer excludes it),
+ * and the RAS only covers returns, so plain indirect jumps and indirect calls
+ * (virtual dispatch, switch jump tables, "la t0, x; jalr t0") always
+ * mispredict and serialize the front-end through the slow commit-time
+ * recovery.  This table gives those sites a predicted target.
+ *
+ * Indexing: pc XOR a commit-order global history of conditional-branch
+ * outcomes, so the same jalr site can hold different targets on different
+ * control-flow paths (switch dispatch correlates with the preceding
+ * comparisons).  The history shifts on the direction-predictor training
+ * strobe — the in-order committed conditional-branch stream — so like the
+ * gshare GHR it is architectural state needing no checkpoint/restore; the
+ * predict-time history lags by the branches still in flight.
+ *
+ * Entries carry a PARTIAL tag (TAG_BITS of PC above the index).  Aliasing or
+ * history skew can only produce a wrong predicted target, which branch
+ * resolution validates against the carried prediction exactly as it does for
+ * RAS predictions — never a correctness issue.
+ *
+ * Training: on commit-time misprediction of a non-return JALR, write the
+ * resolved target at the CURRENT history's index.  Correctly-predicted sites
+ * are left alone (the entry that predicted them is already right).  Writes
+ * overwrite unconditionally — no read-modify-write port is needed.
+ *
+ * Lookup is combinational; the consumer gates the hit with its own
+ * "instruction is a non-return JALR" detection (same instruction-arrival
+ * timing as the RAS).  Update is synchronous.  Valid bits in FFs for reset;
+ * tag/target in LUTRAM (sdp_dist_ram, 1R1W).
+ */
+module indirect_target_predictor #(
+    parameter int unsigned XLEN       = 32,
+    parameter int unsigned INDEX_BITS = 6,  // 64 entries
+    parameter int unsigned TAG_BITS   = 8   // partial tag
+) (
+    input logic i_clk,
+    input logic i_rst,
+
+    // Lookup (live fetch PC; consumer gates with its jalr detection)
+    input  logic [XLEN-1:0] i_pc,
+    output logic            o_hit,
+    output logic [XLEN-1:0] o_target,
+
+    // Commit-order conditional-branch history (same strobe as direction-
+    // predictor training; see branch_prediction_controller).
+    input logic i_ghr_shift,
+    input logic i_ghr_taken,
+
+    // Training (commit-time misprediction of a non-return JALR)
+    input logic            i_update,
+    input logic [XLEN-1:0] i_update_pc,
+    input logic [XLEN-1:0] i_update_target
+);
+
+  localparam int unsigned NumEntries = 1 << INDEX_BITS;
+
+  // Commit-order conditional-branch outcome history.
+  logic [INDEX_BITS-1:0] ghr_q;
+  always_ff @(posedge i_clk) begin
+    if (i_rst) ghr_q <= '0;
+    else if (i_ghr_shift) ghr_q <= {ghr_q[INDEX_BITS-2:0], i_ghr_taken};
+  end
+
+  // PC[0] dropped (>=2-byte aligned); PC[1] kept so halfword (compressed)
+  // jalr sites get distinct entries — same convention as the BTB tag.
+  function automatic logic [INDEX_BITS-1:0] ind_idx(input logic [XLEN-1:0] pc);
+    ind_idx = pc[INDEX_BITS:1] ^ ghr_q;
+  endfunction
+
+  function automatic logic [TAG_BITS-1:0] ind_tag(input logic [XLEN-1:0] pc);
+    ind_tag = pc[TAG_BITS+INDEX_BITS:INDEX_BITS+1];
+  endfunction
+
+  wire [INDEX_BITS-1:0] lookup_index = ind_idx(i_pc);
+  wire [TAG_BITS-1:0] lookup_tag = ind_tag(i_pc);
+  wire [INDEX_BITS-1:0] update_index = ind_idx(i_update_pc);
+  wire [TAG_BITS-1:0] update_tag = ind_tag(i_update_pc);
+
+  // Valid bits in FFs for explicit reset; tag/target in LUTRAM.
+  logic ind_valid[NumEntries];
+  logic [TAG_BITS-1:0] ind_tag_lookup;
+  logic [XLEN-1:0] ind_target_lookup;
+
+  sdp_dist_ram #(
+      .ADDR_WIDTH(INDEX_BITS),
+      .DATA_WIDTH(TAG_BITS)
+  ) ind_tag_ram (
+      .i_clk,
+      .i_write_enable(i_update),
+      .i_write_address(update_index),
+      .i_write_data(update_tag),
+      .i_read_address(lookup_index),
+      .o_read_data(ind_tag_lookup)
+  );
+
+  sdp_dist_ram #(
+      .ADDR_WIDTH(INDEX_BITS),
+      .DATA_WIDTH(XLEN)
+  ) ind_target_ram (
+      .i_clk,
+      .i_write_enable(i_update),
+      .i_write_address(update_index),
+      .i_write_data(i_update_target),
+      .i_read_address(lookup_index),
+      .o_read_data(ind_target_lookup)
+  );
+
+  assign o_hit    = ind_valid[lookup_index] && (ind_tag_lookup == lookup_tag);
+  assign o_target = ind_target_lookup;
+
+  always_ff @(posedge i_clk) begin
+    if (i_rst) begin
+      for (int i = 0; i < NumEntries; i++) begin
+        ind_valid[i] <= 1'b0;
+      end
+    end else if (i_update) begin
+      ind_valid[update_index] <= 1'b1;
+    end
+  end
+
+endmodule : indirect_target_predictor
@@ -63,9 +63,10 @@ module ras_detector (
     input logic i_instruction_valid,
 
     // Detection outputs
-    output logic o_is_call,      // Push to RAS
-    output logic o_is_return,    // Pop from RAS (predict target)
-    output logic o_is_coroutine  // Pop then push (swap)
+    output logic o_is_call,          // Push to RAS
+    output logic o_is_return,        // Pop from RAS (predict target)
+    output logic o_is_coroutine,     // Pop then push (swap)
+    output logic o_is_indirect_jump  // Any register-target jump (JALR / C.JR / C.JALR)
 );
 
   // ===========================================================================
@@ -202,4 +203,9 @@ module ras_detector (
   assign o_is_coroutine = i_instruction_valid &&
                           (i_is_compressed ? is_coroutine_c : is_coroutine_32);
 
+  // Any register-target jump.  The indirect-target predictor combines this
+  // with !o_is_return (returns belong to the RAS).
+  assign o_is_indirect_jump = i_instruction_valid &&
+                              (i_is_compressed ? (is_c_jr || is_c_jalr) : is_jalr);
+
 endmodule : ras_detector
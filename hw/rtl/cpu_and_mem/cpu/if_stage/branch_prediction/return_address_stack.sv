@@ -17,12 +17,14 @@
 /*
  * Return Address Stack (RAS) - Function Call/Return Prediction
  *
- * An 8-entry circular buffer for predicting function return addresses.
- * Improves branch prediction for JALR instructions used for function returns.
+ * A circular buffer for predicting function return addresses. Improves branch
+ * prediction for JALR instructions used for function returns.
  *
  * Design:
  * =======
- *   - 8 entries (configurable via RAS_DEPTH parameter)
+ *   - Depth set by the RAS_DEPTH parameter (must be a power of two); the
+ *     controller instantiates riscv_pkg::RasDepth (32 by default, overridable
+ *     with FROST_RAS_DEPTH)
  *   - Circular buffer with TOS (top-of-stack) pointer
  *   - Checkpointing for speculative execution recovery
  *   - Call detection: JAL/JALR with rd in {x1, x5}
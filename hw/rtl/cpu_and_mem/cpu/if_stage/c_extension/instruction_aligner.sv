@@ -392,8 +392,9 @@ module instruction_aligner #(
 
   // Slot-2 is invalid when:
   //   - slot-1 itself is a NOP/bubble (sel_nop), OR
-  //   - slot-1 is not compressed, OR
-  //   - slot-1 is a compressed control-flow op (bundle terminates), OR
+  //   - slot-1 does not allow a slot-2 behind it (control flow terminates the
+  //     bundle; native serialize/FP-compute slot-1s also terminate — see the
+  //     AllowsSlot2After definition in riscv_pkg), OR
   //   - slot-2 does not fit in the 64-bit fetch (NEXT_HI 32-bit), OR
   //   - slot-2 needs bram_next_word but the BRAM is in the !buf+swap state
   //     (transient — see Session J gate below), OR
@@ -403,11 +404,10 @@ module instruction_aligner #(
   // bram_current_word and the two halves of bram_next_word.  The CURRENT_HI
   // case (slot-1 RVC at lo of W) reads slot-2 entirely from
   // bram_current_word's high half — no bram_next_word dependency.  The
-  // NEXT_LO case (slot-1 RVC at hi, no buffer; or slot-1 RVC at hi via
-  // buffer) needs bram_next_word to hold word(W+1).  See the Session J gate
-  // comment below for when that's reliable and when it isn't.  RVC+32 and
-  // 32+RVC and 32+32 bundles need PC advances > 4; those are still gated by
-  // the !o_is_compressed / !o_is_compressed_2 arms below pending follow-up.
+  // NEXT_LO cases (slot-1 RVC at hi, with or without buffer; slot-1 32b
+  // aligned at lo) and the NEXT_HI case (slot-1 32b spanning from hi) need
+  // bram_next_word to hold word(W+1).  See the Session J gate comment below
+  // for when that's reliable and when it isn't.
   //
   // Slot-2 BRAM-bandwidth gate (Session J): allow slot-2 firing whenever
   // bram_next_word reliably holds word(pc_reg's word + 1).  CURRENT_HI never
@@ -525,8 +525,6 @@ module instruction_aligner #(
   // bram_current_word[31:16] into bram_next_word[15:0]) requires
   // !slot2_bram_unsafe to fire.  Mirrors Session J's analysis but extends
   // the bram-reliability requirement to CURRENT_HI 32-bit slot-2.
-  // NEXT_HI is still unreachable here (gated by !o_is_compressed = slot-1 RVC
-  // requirement; NEXT_HI only arises when slot-1 is 32-bit).
   // Session L: dropped slot2_is_store_op from the OR chain (see detector
   // comment above).
   // Session M: 6-channel done-repair (added) covers slot-2 source-tag
@@ -545,12 +543,17 @@ module instruction_aligner #(
   // size mismatch (BTB compressed but live is 32-bit, or vice versa)
   // suppresses prediction in BPC, retaining the original safety property
   // that drove Session Q's strict guard.
-  // PC-critical slot-2 valid path.  Slot-2 can only dispatch behind a
-  // compressed slot-1, so the only valid positions are CURRENT_HI and NEXT_LO.
-  // The per-halfword sideband predecodes the compressed-and-not-control slot-1
-  // predicate and the slot-2 start-valid predicate.  That keeps the PC advance
-  // path from rebuilding those conditions from several raw sideband bits.
+  // PC-critical slot-2 valid path.  Session S: slot-2 can dispatch behind ANY
+  // non-control, non-serializing, non-FP slot-1, so all three start positions
+  // are reachable (CURRENT_HI behind an aligned RVC; NEXT_LO behind an RVC at
+  // hi or an aligned 32b; NEXT_HI behind a 32b spanning from hi).  The
+  // per-halfword sideband predecodes the slot-1 allows-slot-2 predicate (now
+  // size-aware, see riscv_pkg) and the slot-2 start-valid predicate.  That
+  // keeps the PC advance path from rebuilding those conditions from several
+  // raw sideband bits; the slot-1 size needed to pick the position is itself
+  // a single predecoded sideband bit per source.
   logic slot1_allows_slot2_for_pc;
+  logic slot1_compressed_for_pc;
   always_comb begin
     unique case ({
       o_use_instr_buffer, i_pc_reg[1]
@@ -564,41 +567,68 @@ module instruction_aligner #(
       default: slot1_allows_slot2_for_pc = 1'b0;
     endcase
   end
-
+  // Same source mux as o_is_compressed; kept as a separate name so the PC
+  // path's cone stays visibly sideband-only.
+  assign slot1_compressed_for_pc = o_is_compressed;
+
+  // One candidate per slot-2 start position, qualified by slot-1's size so
+  // the position is unambiguous (AllowsSlot2After no longer implies a
+  // compressed slot-1).  The (buf, !hi) shapes still punt, matching the
+  // position table above.
   logic slot2_current_hi_candidate;
   logic slot2_next_lo_candidate;
+  logic slot2_next_hi_candidate;
   assign slot2_current_hi_candidate = !o_sel_nop && !o_use_instr_buffer && !i_pc_reg[1] &&
+                                      is_comp_instr_lo &&
                                       aligned_current_sb[riscv_pkg::ImemSbAllowsSlot2AfterLo];
-  assign slot2_next_lo_candidate = !o_sel_nop && i_pc_reg[1] && slot1_allows_slot2_for_pc;
+  assign slot2_next_lo_candidate =
+      !o_sel_nop &&
+      ((i_pc_reg[1] && slot1_compressed_for_pc && slot1_allows_slot2_for_pc) ||
+       (!o_use_instr_buffer && !i_pc_reg[1] && !is_comp_instr_lo &&
+        aligned_current_sb[riscv_pkg::ImemSbAllowsSlot2AfterLo]));
+  assign slot2_next_hi_candidate = !o_sel_nop && i_pc_reg[1] && !slot1_compressed_for_pc &&
+                                   slot1_allows_slot2_for_pc;
 
   logic slot2_current_hi_compressed;
   logic slot2_next_lo_compressed;
+  logic slot2_next_hi_compressed;
   logic slot2_current_hi_start_valid;
   logic slot2_next_lo_start_valid;
   assign slot2_current_hi_compressed = aligned_current_sb[riscv_pkg::ImemSbIsCompressedHi];
   assign slot2_next_lo_compressed = aligned_next_sb[riscv_pkg::ImemSbIsCompressedLo];
+  assign slot2_next_hi_compressed = aligned_next_sb[riscv_pkg::ImemSbIsCompressedHi];
   assign slot2_current_hi_start_valid = aligned_current_sb[riscv_pkg::ImemSbSlot2StartValidHi];
   assign slot2_next_lo_start_valid = aligned_next_sb[riscv_pkg::ImemSbSlot2StartValidLo];
 
   logic slot2_current_hi_invalid;
   logic slot2_next_lo_invalid;
+  logic slot2_next_hi_invalid;
   assign slot2_current_hi_invalid =
       !slot2_current_hi_start_valid || (slot2_bram_unsafe && !slot2_current_hi_compressed);
   assign slot2_next_lo_invalid = slot2_bram_unsafe || !slot2_next_lo_start_valid;
+  // NEXT_HI: a 32-bit slot-2 would span past the 64-bit fetch, so only RVC
+  // fires here.  RVC implies start-valid (see the Slot2StartValid sideband
+  // definition), so the compressed bit is the only data predicate.
+  assign slot2_next_hi_invalid = slot2_bram_unsafe || !slot2_next_hi_compressed;
 
   logic slot2_current_hi_valid_for_pc;
   logic slot2_next_lo_valid_for_pc;
+  logic slot2_next_hi_valid_for_pc;
   assign slot2_current_hi_valid_for_pc = slot2_current_hi_candidate && !slot2_current_hi_invalid;
   assign slot2_next_lo_valid_for_pc = slot2_next_lo_candidate && !slot2_next_lo_invalid;
+  assign slot2_next_hi_valid_for_pc = slot2_next_hi_candidate && !slot2_next_hi_invalid;
 
   logic slot2_valid_when_enabled;
-  assign slot2_valid_when_enabled = slot2_current_hi_valid_for_pc || slot2_next_lo_valid_for_pc;
+  assign slot2_valid_when_enabled = slot2_current_hi_valid_for_pc ||
+      slot2_next_lo_valid_for_pc || slot2_next_hi_valid_for_pc;
   assign o_slot2_valid_for_pc = slot2_valid_when_enabled;
   // Consumers only inspect the compression bit when slot-2 is valid.  Keep the
   // valid predicate out of this high-fanout select so the sideband "allows
   // slot-2" bit does not also drive the slot-2-size mux cone.
   assign o_slot2_is_compressed_for_pc =
-      slot2_current_hi_candidate ? slot2_current_hi_compressed : slot2_next_lo_compressed;
+      slot2_current_hi_candidate ? slot2_current_hi_compressed :
+      slot2_next_hi_candidate    ? slot2_next_hi_compressed :
+                                   slot2_next_lo_compressed;
 
   logic slot2_sel_nop_when_enabled;
   assign slot2_sel_nop_when_enabled = !slot2_valid_when_enabled;
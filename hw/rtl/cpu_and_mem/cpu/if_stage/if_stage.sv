@@ -372,14 +372,21 @@ module if_stage #(
     end
   end
 
-  // Slot-2 PC for BTB lookup (Session Q).  The aligner only allows slot-2
-  // to fire when slot-1 is compressed, so a valid slot-2 always starts at
-  // pc_reg + 2.  Keep that invariant out of the live sideband path; otherwise
-  // is_compressed feeds the slot-2 BTB address and then the PC redirect mux.
+  // Slot-2 PC for BTB lookup (Session Q; generalized in Session S).  A valid
+  // slot-2 starts at pc_reg + slot-1's size.  Both sums are precomputed from
+  // the registered pc_reg so only the final 2:1 mux sees the slot-1 size;
+  // is_compressed_fast is the flattened registered-select sideband flavor, so
+  // the BTB address cone picks up one sideband-data mux level and no adders.
   logic [XLEN-1:0] slot2_pc_for_btb;
+  logic [XLEN-1:0] slot2_pc_for_btb_if_compressed;
+  logic [XLEN-1:0] slot2_pc_for_btb_if_32bit;
   logic            slot2_pc_for_btb_is_halfword;
-  assign slot2_pc_for_btb = pc_reg + riscv_pkg::PcIncrementCompressed;
-  assign slot2_pc_for_btb_is_halfword = !pc_reg[1];
+  assign slot2_pc_for_btb_if_compressed = pc_reg + riscv_pkg::PcIncrementCompressed;
+  assign slot2_pc_for_btb_if_32bit = pc_reg + riscv_pkg::PcIncrement32bit;
+  assign slot2_pc_for_btb = is_compressed_fast ? slot2_pc_for_btb_if_compressed :
+                                                 slot2_pc_for_btb_if_32bit;
+  // +2 flips pc_reg[1], +4 preserves it.
+  assign slot2_pc_for_btb_is_halfword = pc_reg[1] ^ is_compressed_fast;
 
   branch_prediction_controller branch_prediction_controller_inst (
       .i_clk,
@@ -449,6 +456,11 @@ module if_stage #(
       .i_dir_update_idx  (i_dir_update_idx),
       .i_dir_update_taken(i_dir_update_taken),
 
+      // Indirect-target predictor training (mispredicted non-return JALRs)
+      .i_ind_update(i_from_ex_comb.ind_update),
+      .i_ind_update_pc(i_from_ex_comb.ind_update_pc),
+      .i_ind_update_target(i_from_ex_comb.ind_update_target),
+
       // Combinational prediction outputs (for pc_controller)
       .o_predicted_taken (btb_predicted_taken),
       .o_predicted_target(btb_predicted_target),
@@ -1215,13 +1227,27 @@ module if_stage #(
     end
   end
 
+  // Bundle advance = slot-1 size + slot-2 size (Session S: slot-1 may be
+  // 32-bit, so both sizes feed the encoding):
+  //   RVC+RVC = +4, RVC+32b / 32b+RVC = +6, 32b+32b = +8.
+  logic [riscv_pkg::PcAdvanceSelWidth-1:0] bundle_advance_sel_live;
+  always_comb begin
+    unique case ({
+      is_compressed_fast, slot2_is_compressed_for_pc_live
+    })
+      2'b11:   bundle_advance_sel_live = riscv_pkg::PcAdvancePlus4;
+      2'b10:   bundle_advance_sel_live = riscv_pkg::PcAdvancePlus6;
+      2'b01:   bundle_advance_sel_live = riscv_pkg::PcAdvancePlus6;
+      2'b00:   bundle_advance_sel_live = riscv_pkg::PcAdvancePlus8;
+      default: bundle_advance_sel_live = riscv_pkg::PcAdvancePlus4;
+    endcase
+  end
+
   always_comb begin
     pc_fetch_advance_sel_live = is_compressed_fast ? riscv_pkg::PcAdvancePlus2 :
                                                      riscv_pkg::PcAdvancePlus4;
     if (!sel_nop && slot2_valid_for_pc_live) begin
-      pc_fetch_advance_sel_live = slot2_is_compressed_for_pc_live ?
-                                  riscv_pkg::PcAdvancePlus4 :
-                                  riscv_pkg::PcAdvancePlus6;
+      pc_fetch_advance_sel_live = bundle_advance_sel_live;
     end
   end
 
@@ -1229,9 +1255,7 @@ module if_stage #(
     pc_reg_advance_sel_live = riscv_pkg::PcAdvancePlus2;
     if (!sel_nop) begin
       if (slot2_valid_for_pc_live) begin
-        pc_reg_advance_sel_live = slot2_is_compressed_for_pc_live ?
-                                  riscv_pkg::PcAdvancePlus4 :
-                                  riscv_pkg::PcAdvancePlus6;
+        pc_reg_advance_sel_live = bundle_advance_sel_live;
       end else begin
         pc_reg_advance_sel_live = is_compressed_fast ? riscv_pkg::PcAdvancePlus2 :
                                                        riscv_pkg::PcAdvancePlus4;
@@ -108,9 +108,9 @@ module pc_controller #(
     input logic i_is_compressed,  // Combinational (for spanning detection, etc.)
     input logic i_is_compressed_for_pc,  // Registered (TIMING OPTIMIZATION: for PC increment)
 
-    // 2-wide bundle metadata.  Slot-2 only fires behind a compressed slot-1,
-    // so valid bundles advance by +4 or +6.  When slot-2 is invalid, this
-    // falls back to the 1-wide +2/+4 advance.
+    // 2-wide bundle metadata.  Valid bundles advance by the sum of the slot
+    // sizes: +4 (RVC+RVC), +6 (mixed), or +8 (32b+32b).  When slot-2 is
+    // invalid, this falls back to the 1-wide +2/+4 advance.
     input logic i_slot2_valid,
     input logic i_slot2_is_compressed,
     input logic [riscv_pkg::PcAdvanceSelWidth-1:0] i_pc_fetch_advance_sel,
@@ -397,10 +397,12 @@ module pc_controller #(
   always_comb begin
     if (i_slot2_valid) begin
       // Slot-2 valid implies a two-instruction bundle. Same-size advances
-      // preserve bit 1; mixed-size +6 advances flip it.  Slot-1 is always
-      // compressed here, so keep the live slot-1 compressed sideband off this
-      // PC-control path.
-      pc_reg_next_bit1_for_prediction = o_pc_reg[1] ^ !i_slot2_is_compressed;
+      // (+4/+8) preserve bit 1; mixed-size +6 advances flip it, so the flip
+      // is the XOR of the two slot sizes.  Session S: slot-1 may now be
+      // 32-bit, so its live compressed bit joins this PC-control path (the
+      // 1-wide arm below already uses it).
+      pc_reg_next_bit1_for_prediction = o_pc_reg[1] ^
+          (i_is_compressed ^ i_slot2_is_compressed);
     end else begin
       // One-wide: compressed advances by +2 and flips bit 1; 32-bit advances
       // by +4 and preserves it.
@@ -62,8 +62,8 @@ module pc_increment_calculator #(
     input logic i_is_compressed_for_pc,
     input logic i_sel_nop,  // IF outputs NOP (stale BRAM data — is_compressed unreliable)
 
-    // Encoded instruction-bundle advance.  Slot-2 only fires behind a
-    // compressed slot-1, so valid two-wide bundles advance by +4 or +6.
+    // Encoded instruction-bundle advance.  Two-wide bundles advance by the
+    // sum of their slot sizes: +4 (RVC+RVC), +6 (mixed), or +8 (32b+32b).
     input logic [riscv_pkg::PcAdvanceSelWidth-1:0] i_pc_fetch_advance_sel,
     input logic [riscv_pkg::PcAdvanceSelWidth-1:0] i_pc_reg_advance_sel,
 
@@ -125,20 +125,25 @@ module pc_increment_calculator #(
   localparam int unsigned PcWordBits = XLEN - 2;
   localparam logic [PcWordBits-1:0] PcWordInc1 = {{(PcWordBits - 1) {1'b0}}, 1'b1};
   localparam logic [PcWordBits-1:0] PcWordInc2 = {{(PcWordBits - 2) {1'b0}}, 2'b10};
+  localparam logic [PcWordBits-1:0] PcWordInc3 = {{(PcWordBits - 2) {1'b0}}, 2'b11};
   logic [PcWordBits-1:0] pc_word;
   logic [PcWordBits-1:0] pc_word_plus_1;
   logic [PcWordBits-1:0] pc_word_plus_2;
+  logic [PcWordBits-1:0] pc_word_plus_3;
   logic                  pc_halfword;
   assign pc_word        = i_pc[XLEN-1:2];
   assign pc_halfword    = i_pc[1];
   assign pc_word_plus_1 = pc_word + PcWordInc1;
   assign pc_word_plus_2 = pc_word + PcWordInc2;
+  assign pc_word_plus_3 = pc_word + PcWordInc3;
 
   logic [XLEN-1:0] next_pc_plus_2, next_pc_plus_4, next_pc_plus_6, next_pc_plus_8;
+  logic [XLEN-1:0] next_pc_plus_10;
   assign next_pc_plus_2 = {pc_halfword ? pc_word_plus_1 : pc_word, ~pc_halfword, i_pc[0]};
   assign next_pc_plus_4 = {pc_word_plus_1, pc_halfword, i_pc[0]};
   assign next_pc_plus_6 = {pc_halfword ? pc_word_plus_2 : pc_word_plus_1, ~pc_halfword, i_pc[0]};
   assign next_pc_plus_8 = {pc_word_plus_2, pc_halfword, i_pc[0]};
+  assign next_pc_plus_10 = {pc_halfword ? pc_word_plus_3 : pc_word_plus_2, ~pc_halfword, i_pc[0]};
 
   // Default-case bundle advance.  The sideband-heavy work is already collapsed
   // into i_pc_reg_advance_sel in if_stage, so this module only has a narrow
@@ -152,6 +157,7 @@ module pc_increment_calculator #(
       .i_next_pc_plus_4(next_pc_plus_4),
       .i_next_pc_plus_6(next_pc_plus_6),
       .i_next_pc_plus_8(next_pc_plus_8),
+      .i_next_pc_plus_10(next_pc_plus_10),
       .i_advance_sel(i_pc_fetch_advance_sel),
       .o_fetch_seq_next_pc(fetch_seq_next_pc),
       .o_fetch_seq_next_pc_plus_2(fetch_seq_next_pc_plus_2)
@@ -213,6 +219,7 @@ module pc_increment_calculator #(
   (* keep = "true" *)logic [XLEN-1:0] pc_reg_if_compressed;
   (* keep = "true" *)logic [XLEN-1:0] pc_reg_if_32bit;
   (* keep = "true" *)logic [XLEN-1:0] pc_reg_plus_6;
+  (* keep = "true" *)logic [XLEN-1:0] pc_reg_plus_8;
 
   (* dont_touch = "yes" *) pc_reg_precompute #(
       .XLEN(XLEN)
@@ -225,7 +232,8 @@ module pc_increment_calculator #(
       .i_spanning_eligible              (i_spanning_eligible),
       .o_pc_reg_if_compressed           (pc_reg_if_compressed),
       .o_pc_reg_if_32bit                (pc_reg_if_32bit),
-      .o_pc_reg_plus_6                  (pc_reg_plus_6)
+      .o_pc_reg_plus_6                  (pc_reg_plus_6),
+      .o_pc_reg_plus_8                  (pc_reg_plus_8)
   );
 
   // Final: select based on live is_compressed and slot-2 metadata.  Only the
@@ -239,7 +247,8 @@ module pc_increment_calculator #(
   //
   // 2-wide: when slot-2 is valid this cycle, use the bundle advance:
   //   RVC + RVC = +4 (= pc_reg_if_32bit, semantically identical)
-  //   RVC + 32b = +6
+  //   RVC + 32b / 32b + RVC = +6
+  //   32b + 32b = +8
   logic [XLEN-1:0] pc_reg_normal;
   pc_reg_advance_mux #(
       .XLEN(XLEN)
@@ -247,6 +256,7 @@ module pc_increment_calculator #(
       .i_pc_reg_if_compressed(pc_reg_if_compressed),
       .i_pc_reg_if_32bit(pc_reg_if_32bit),
       .i_pc_reg_plus_6(pc_reg_plus_6),
+      .i_pc_reg_plus_8(pc_reg_plus_8),
       .i_advance_sel(i_pc_reg_advance_sel),
       .o_pc_reg_normal(pc_reg_normal)
   );
@@ -305,6 +315,7 @@ module pc_fetch_advance_mux #(
     input logic [XLEN-1:0] i_next_pc_plus_4,
     input logic [XLEN-1:0] i_next_pc_plus_6,
     input logic [XLEN-1:0] i_next_pc_plus_8,
+    input logic [XLEN-1:0] i_next_pc_plus_10,
     input logic [riscv_pkg::PcAdvanceSelWidth-1:0] i_advance_sel,
     output logic [XLEN-1:0] o_fetch_seq_next_pc,
     output logic [XLEN-1:0] o_fetch_seq_next_pc_plus_2
@@ -324,6 +335,10 @@ module pc_fetch_advance_mux #(
         o_fetch_seq_next_pc        = i_next_pc_plus_6;
         o_fetch_seq_next_pc_plus_2 = i_next_pc_plus_8;
       end
+      riscv_pkg::PcAdvancePlus8: begin
+        o_fetch_seq_next_pc        = i_next_pc_plus_8;
+        o_fetch_seq_next_pc_plus_2 = i_next_pc_plus_10;
+      end
       default: begin
         o_fetch_seq_next_pc        = i_next_pc_plus_2;
         o_fetch_seq_next_pc_plus_2 = i_next_pc_plus_4;
@@ -339,6 +354,7 @@ module pc_reg_advance_mux #(
     input logic [XLEN-1:0] i_pc_reg_if_compressed,
     input logic [XLEN-1:0] i_pc_reg_if_32bit,
     input logic [XLEN-1:0] i_pc_reg_plus_6,
+    input logic [XLEN-1:0] i_pc_reg_plus_8,
     input logic [riscv_pkg::PcAdvanceSelWidth-1:0] i_advance_sel,
     output logic [XLEN-1:0] o_pc_reg_normal
 );
@@ -348,6 +364,7 @@ module pc_reg_advance_mux #(
       riscv_pkg::PcAdvancePlus2: o_pc_reg_normal = i_pc_reg_if_compressed;
       riscv_pkg::PcAdvancePlus4: o_pc_reg_normal = i_pc_reg_if_32bit;
       riscv_pkg::PcAdvancePlus6: o_pc_reg_normal = i_pc_reg_plus_6;
+      riscv_pkg::PcAdvancePlus8: o_pc_reg_normal = i_pc_reg_plus_8;
       default:                   o_pc_reg_normal = i_pc_reg_if_compressed;
     endcase
   end
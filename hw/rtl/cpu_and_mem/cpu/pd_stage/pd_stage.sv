@@ -42,11 +42,14 @@ module pd_stage #(
     output riscv_pkg::from_pd_to_id_t o_from_pd_to_id,
     // Slot-2 instruction (2-wide dispatch).  IF supplies a real second
     // instruction when the bundle has one (sel_nop=1 only when it does not),
-    // and PD decompresses/extracts it the same as slot-1.  The backward-branch
-    // heuristic stays slot-1 only.
+    // and PD decompresses/extracts it the same as slot-1.  The redirect
+    // heuristics (conditional lever A and the unconditional-jump path) stay
+    // slot-1 only; the aligner already terminates the bundle at any slot-1
+    // control flow, so slot-2 is never the redirecting instruction's shadow.
     input riscv_pkg::from_if_to_pd_t i_from_if_to_pd_2,
     output riscv_pkg::from_pd_to_id_t o_from_pd_to_id_2,
-    // Backward-branch-taken static heuristic: PD redirect to IF
+    // PD redirect to IF: predicted-taken conditional branches (lever A) and
+    // unconditional direct jumps (JAL/C.J/C.JAL) that the BTB missed.
     output logic o_pd_redirect,
     output logic [XLEN-1:0] o_pd_redirect_target
 );
@@ -219,6 +222,74 @@ module pd_stage #(
   assign pd_backward_target = pd_compressed_branch ? pd_backward_target_compressed :
                               pd_backward_target_native;
 
+  // ===========================================================================
+  // Unconditional Direct-Jump Redirect on BTB Miss
+  // ===========================================================================
+  // JAL / C.J / C.JAL are always taken with a PC-relative target, so a BTB
+  // miss needs no direction predictor: redirect IF straight to PC + imm_j.
+  // Without this, a BTB-cold JAL dispatches with predicted_taken=0, the ROB
+  // marks it mispredicted at allocation, and the redirect waits for the
+  // commit-time recovery path (~15 cycles). Call-dense code pays that on
+  // every cold call site; with the redirect the cost is the same 2-bubble
+  // penalty as the conditional lever-A path, and the correct-commit BTB
+  // training then promotes the site to a zero-bubble IF prediction.
+  //
+  // Same structure as the conditional targets above: native and compressed
+  // adders run in parallel, with the class select applied after the carry
+  // chains.
+
+  logic [XLEN-1:0] pd_imm_j_native;
+  assign pd_imm_j_native = {
+    {12{i_from_if_to_pd.effective_instr[31]}},  // sign-extend bits [31:20]
+    i_from_if_to_pd.effective_instr[19:12],  // imm[19:12]
+    i_from_if_to_pd.effective_instr[20],  // imm[11]
+    i_from_if_to_pd.effective_instr[30:21],  // imm[10:1]
+    1'b0  // imm[0] always zero
+  };
+
+  logic [XLEN-1:0] pd_imm_cj_compressed;
+  assign pd_imm_cj_compressed = {
+    {20{i_from_if_to_pd.raw_parcel[12]}},  // sign-extend bits [31:12]
+    i_from_if_to_pd.raw_parcel[12],  // imm[11]
+    i_from_if_to_pd.raw_parcel[8],  // imm[10]
+    i_from_if_to_pd.raw_parcel[10:9],  // imm[9:8]
+    i_from_if_to_pd.raw_parcel[6],  // imm[7]
+    i_from_if_to_pd.raw_parcel[7],  // imm[6]
+    i_from_if_to_pd.raw_parcel[2],  // imm[5]
+    i_from_if_to_pd.raw_parcel[11],  // imm[4]
+    i_from_if_to_pd.raw_parcel[5:3],  // imm[3:1]
+    1'b0  // imm[0] always zero
+  };
+
+  logic pd_native_jal;
+  logic pd_compressed_jump;
+  assign pd_native_jal = !pd_sel_compressed &&
+                         (i_from_if_to_pd.effective_instr[6:0] == riscv_pkg::OPC_JAL);
+  assign pd_compressed_jump =
+      (i_from_if_to_pd.raw_parcel[1:0] == 2'b01) &&
+      ((i_from_if_to_pd.raw_parcel[15:13] == 3'b101) ||  // C.J
+       (i_from_if_to_pd.raw_parcel[15:13] == 3'b001));  // C.JAL (RV32)
+
+  logic [XLEN-1:0] pd_jump_target_native;
+  logic [XLEN-1:0] pd_jump_target_compressed;
+  logic [XLEN-1:0] pd_jump_target;
+  assign pd_jump_target_native = i_from_if_to_pd.program_counter + pd_imm_j_native;
+  assign pd_jump_target_compressed = i_from_if_to_pd.program_counter + pd_imm_cj_compressed;
+  assign pd_jump_target = pd_compressed_jump ? pd_jump_target_compressed :
+                          pd_jump_target_native;
+
+  // Fire whenever the front-end did not already redirect. No bp_dir_taken
+  // term: the jump is architecturally always taken. RAS pushes for calls
+  // happen in IF from the raw instruction (independent of any prediction),
+  // so redirecting here leaves the RAS state exactly as a BTB-hit JAL would.
+  logic pd_uncond_jump;
+  assign pd_uncond_jump =
+      (pd_native_jal || pd_compressed_jump) &&  // unconditional direct jump
+      !i_from_if_to_pd.btb_predicted_taken &&  // front-end didn't already redirect
+      !i_from_if_to_pd.ras_predicted &&  // RAS didn't predict
+      !i_from_if_to_pd.sel_nop &&  // not a bubble
+      !pd_redirect_r;  // not already redirecting (see note below)
+
   // Lever A: fire the PD redirect for any conditional branch (native B-type or
   // compressed C.BEQZ/C.BNEZ) that the front-end did NOT already redirect and
   // that the decoupled bimodal (carried from IF as bp_dir_taken) predicts TAKEN.
@@ -234,10 +305,10 @@ module pd_stage #(
       !i_from_if_to_pd.ras_predicted &&  // RAS didn't predict
       !i_from_if_to_pd.sel_nop &&  // not a bubble
       !pd_redirect_r;  // not already redirecting
-  // pd_redirect_r suppression is critical: when the registered redirect fires,
-  // the wrong-path instruction in PD could look like a backward branch. Without
-  // this guard, a spurious second redirect fires and its holdoff cycle squashes
-  // the real target instruction arriving from BRAM.
+  // pd_redirect_r suppression is critical (both legs): when the registered
+  // redirect fires, the wrong-path instruction in PD could look like a branch
+  // or jump. Without this guard, a spurious second redirect fires and its
+  // holdoff cycle squashes the real target instruction arriving from BRAM.
 
   // Redirect output to IF — REGISTERED for timing.
   // Registering eliminates the cross-module combinational path (32-bit adder +
@@ -251,12 +322,16 @@ module pd_stage #(
 
   always_ff @(posedge i_clk) begin
     if (i_pipeline_ctrl.reset || i_pipeline_ctrl.flush) pd_redirect_r <= 1'b0;
-    else if (!i_pipeline_ctrl.stall) pd_redirect_r <= pd_backward_branch;
+    else if (!i_pipeline_ctrl.stall) pd_redirect_r <= pd_backward_branch || pd_uncond_jump;
     // Hold during stall (implicit)
   end
 
   always_ff @(posedge i_clk) begin
-    if (!i_pipeline_ctrl.stall) pd_redirect_target_r <= pd_backward_target;
+    if (!i_pipeline_ctrl.stall) begin
+      // A slot-1 instruction is at most one of the two classes, so this is a
+      // plain select between the already-computed targets.
+      pd_redirect_target_r <= pd_uncond_jump ? pd_jump_target : pd_backward_target;
+    end
   end
 
   assign o_pd_redirect = pd_redirect_r;
@@ -91,7 +91,8 @@ package riscv_pkg;
     OPC_FMSUB    = 7'b1000111,  // FMSUB.S
     OPC_FNMSUB   = 7'b1001011,  // FNMSUB.S
     OPC_FNMADD   = 7'b1001111,  // FNMADD.S
-    OPC_OP_FP    = 7'b1010011   // FADD.S, FSUB.S, FMUL.S, etc.
+    OPC_OP_FP    = 7'b1010011,  // FADD.S, FSUB.S, FMUL.S, etc.
+    OPC_OP_P     = 7'b1110111   // P-extension packed SIMD subset
   } opc_e;
 
   // Instruction-memory predecode sideband bits, stored per 32-bit word.
@@ -158,6 +159,19 @@ package riscv_pkg;
     end
   endfunction
 
+  // Native control flow: BRANCH/JAL/JALR.  Used by the AllowsSlot2After bits
+  // so a 32-bit slot-1 branch terminates the bundle in the PC advance path
+  // without rebuilding opcode compares from raw BRAM data (decision #1: the
+  // bundle never extends past a slot-1 branch, which also keeps the RAS
+  // snapshot mirroring in if_stage valid).
+  function automatic logic imem_native_control(input logic [6:0] opcode);
+    begin
+      imem_native_control = (opcode == 7'b1100011) ||  // OPC_BRANCH
+      (opcode == 7'b1101111) ||  // OPC_JAL
+      (opcode == 7'b1100111);  // OPC_JALR
+    end
+  endfunction
+
   // Native instructions that use an FP compute unit: OP-FP + the four FMAs.
   function automatic logic imem_native_fp_compute(input logic [6:0] opcode);
     begin
@@ -181,8 +195,21 @@ package riscv_pkg;
       sb[ImemSbNativeSerializeHi] = imem_native_serialize(word[22:16]);
       sb[ImemSbNativeFpComputeLo] = imem_native_fp_compute(word[6:0]);
       sb[ImemSbNativeFpComputeHi] = imem_native_fp_compute(word[22:16]);
-      sb[ImemSbAllowsSlot2AfterLo] = sb[ImemSbIsCompressedLo] && !sb[ImemSbCompressedControlLo];
-      sb[ImemSbAllowsSlot2AfterHi] = sb[ImemSbIsCompressedHi] && !sb[ImemSbCompressedControlHi];
+      // AllowsSlot2After: the instruction STARTING at this halfword permits a
+      // slot-2 behind it.  Compressed: anything but compressed control flow.
+      // 32-bit (halfword holds the opcode — at lo for an aligned instruction,
+      // at hi for one spanning into the next word): anything but control flow,
+      // serializing ops (slot-2 renamed to a slot-1 CSR tag would never wake
+      // — CSRs execute at commit and don't broadcast on the CDB), and FP
+      // compute (same RS-backpressure rationale as the slot-2 FP gate).
+      sb[ImemSbAllowsSlot2AfterLo] = sb[ImemSbIsCompressedLo] ?
+          !sb[ImemSbCompressedControlLo] :
+          !(imem_native_control(word[6:0]) ||
+            sb[ImemSbNativeSerializeLo] || sb[ImemSbNativeFpComputeLo]);
+      sb[ImemSbAllowsSlot2AfterHi] = sb[ImemSbIsCompressedHi] ?
+          !sb[ImemSbCompressedControlHi] :
+          !(imem_native_control(word[22:16]) ||
+            sb[ImemSbNativeSerializeHi] || sb[ImemSbNativeFpComputeHi]);
       sb[ImemSbSlot2StartValidLo] =
           sb[ImemSbIsCompressedLo] ||
           !(sb[ImemSbNativeSerializeLo] || sb[ImemSbNativeFpComputeLo]);
@@ -261,6 +288,11 @@ package riscv_pkg;
     CSRRWI,
     CSRRSI,
     CSRRCI,
+    CSRR_CNT,   // Pure read of a counter CSR (CSRRS/CSRRC with rs1 = x0 or the
+                // immediate forms with uimm = 0, address in the read-only
+                // counter set). Rewritten from the base Zicsr op at dispatch;
+                // executes speculatively in the INT pipeline instead of
+                // serializing at commit.
     // Zba extension (address generation)
     SH1ADD,
     SH2ADD,
@@ -303,6 +335,13 @@ package riscv_pkg;
     UNZIP,
     // Zihintpause extension
     PAUSE,
+    // P-extension subset (Zpn packed SIMD, executed on the MUL path)
+    PADD8,      // Packed 8-bit add (ADD8 encoding)
+    PSUB8,      // Packed 8-bit subtract (SUB8 encoding)
+    PADD16,     // Packed 16-bit add (ADD16 encoding)
+    PSUB16,     // Packed 16-bit subtract (SUB16 encoding)
+    PDOT8,      // Signed quad-int8 dot product (SMAQA encoding; the rd
+                // accumulation is left to software -- our RS are 2-source)
     // Privileged instructions (trap handling)
     MRET,       // Return from machine-mode trap
     WFI,        // Wait for interrupt
@@ -418,13 +457,41 @@ package riscv_pkg;
   localparam bit [11:0] CsrMtval = 12'h343;  // Machine trap value
   localparam bit [11:0] CsrMip = 12'h344;  // Machine interrupt pending
   // Machine information CSRs (read-only)
-  localparam bit [11:0] CsrMhartid = 12'hF14;  // Hardware thread ID (always 0 for single-core)
+  localparam bit [11:0] CsrMhartid = 12'hF14;  // Hardware thread ID (per-core HART_ID parameter)
   // Custom machine CSRs for Tomasulo performance profiling
   localparam bit [11:0] CsrMperfSel = 12'h7C0;  // Profiling counter selector
   localparam bit [11:0] CsrMperfCtl = 12'h7C1;  // Profiling control (bit 0 = snapshot)
   localparam bit [11:0] CsrMperfData = 12'hFC0;  // Selected counter low 32 bits
   localparam bit [11:0] CsrMperfDataH = 12'hFC1;  // Selected counter high 32 bits
   localparam bit [11:0] CsrMperfCount = 12'hFC2;  // Number of profiling counters
+  // Hardware performance monitor: programmable event counters. Base addresses
+  // for mhpmcounter3/mhpmcounter3h/mhpmevent3; counters 3..(3+HpmCounterCount-1)
+  // are implemented, higher indices read as zero per the privileged spec.
+  localparam bit [11:0] CsrMhpmcounter3 = 12'hB03;  // First programmable counter (low 32 bits)
+  localparam bit [11:0] CsrMhpmcounter3H = 12'hB83;  // First programmable counter (high 32 bits)
+  localparam bit [11:0] CsrMhpmevent3 = 12'h323;  // First event selector
+  localparam int unsigned HpmCounterCount = 4;  // mhpmcounter3..6
+  // Width of the event bus exported by perf_counter_aggregator (one bit per
+  // top-level profiling event; must match its PerfTopCounterCount).
+  localparam int unsigned HpmEventCount = 23;
+
+  // True for CSR addresses whose reads are side-effect-free counters: the
+  // Zicntr counters (and machine aliases), the programmable hpmcounters, and
+  // the read-only MPERF data/count registers. A pure read of one of these
+  // (CSRRS/CSRRC with rs1 = x0, or an immediate form with uimm = 0) never
+  // writes, so dispatch rewrites it to CSRR_CNT and lets it flow through the
+  // INT reservation station without the commit-time CSR serialization.
+  function automatic logic csr_addr_is_counter(input logic [11:0] addr);
+    csr_addr_is_counter =
+        addr == CsrCycle || addr == CsrCycleH ||
+        addr == CsrMcycle || addr == CsrMcycleH ||
+        addr == CsrTime || addr == CsrTimeH ||
+        addr == CsrInstret || addr == CsrInstretH ||
+        addr == CsrMinstret || addr == CsrMinstretH ||
+        addr == CsrMperfData || addr == CsrMperfDataH || addr == CsrMperfCount ||
+        (addr >= CsrMhpmcounter3 && addr < 12'(CsrMhpmcounter3 + HpmCounterCount)) ||
+        (addr >= CsrMhpmcounter3H && addr < 12'(CsrMhpmcounter3H + HpmCounterCount));
+  endfunction
 
   // F extension: Floating-point CSRs
   localparam bit [11:0] CsrFflags = 12'h001;  // FP exception flags (NV, DZ, OF, UF, NX)
@@ -551,6 +618,7 @@ package riscv_pkg;
   localparam logic [PcAdvanceSelWidth-1:0] PcAdvancePlus2 = 2'd0;
   localparam logic [PcAdvanceSelWidth-1:0] PcAdvancePlus4 = 2'd1;
   localparam logic [PcAdvanceSelWidth-1:0] PcAdvancePlus6 = 2'd2;
+  localparam logic [PcAdvanceSelWidth-1:0] PcAdvancePlus8 = 2'd3;
 
   // Magic number constants for RISC-V 32-bit operations
   // Used in ALU for special case handling (e.g., division overflow)
@@ -584,8 +652,15 @@ package riscv_pkg;
   // Named as from_<source>_to_<dest>_t (e.g., from_if_to_pd_t).
   // These are registered at stage boundaries (pipeline registers).
 
-  // RAS (Return Address Stack) constants
-  localparam int unsigned RasDepth = 8;
+  // RAS (Return Address Stack) constants.  Depth must be a power of two (the
+  // circular TOS pointer relies on natural wrap).  8 entries overflowed on real
+  // call depths (FreeRTOS tasks, call_stress), turning every return beyond the
+  // stack depth into a mispredict; 32 covers the depths we observe.
+`ifdef FROST_RAS_DEPTH
+  localparam int unsigned RasDepth = `FROST_RAS_DEPTH;
+`else
+  localparam int unsigned RasDepth = 32;
+`endif
   localparam int unsigned RasPtrBits = $clog2(RasDepth);
 
   // Branch direction predictor (bimodal) index width.  Must match
@@ -593,6 +668,34 @@ package riscv_pkg;
   // carried with each branch (bp_dir_idx) for commit-time training.
   localparam int unsigned BpDirIdxBits = 10;
 
+  // BTB index width (2^N entries).  The BTB is fully tagged, so growing the
+  // index only trades tag bits for entries — no aliasing policy change.
+  // Override at build time for firmware whose branch working set overflows
+  // the default 256 entries.
+`ifdef FROST_BTB_INDEX_BITS
+  localparam int unsigned BtbIndexBits = `FROST_BTB_INDEX_BITS;
+`else
+  localparam int unsigned BtbIndexBits = 8;  // 256 entries
+`endif
+
+  // Indirect-target predictor (non-return JALR targets): 2^N entries indexed
+  // by PC XOR commit-order conditional-branch history, with partial tags.
+  // Partial-tag aliasing can only cost a misprediction (the carried target is
+  // validated at branch resolution), never correctness.
+  localparam int unsigned IndPredIndexBits = 6;  // 64 entries
+  localparam int unsigned IndPredTagBits = 8;
+
+  // Global-history (gshare) direction predictor variant.  Off by default
+  // (plain bimodal); define FROST_GSHARE at build time to XOR a commit-order
+  // global history register into the direction index for workloads with
+  // correlated branches.  The predict-time index carried with each branch
+  // (bp_dir_idx) absorbs the change — no other pipeline state is affected.
+`ifdef FROST_GSHARE
+  localparam bit BpUseGshare = 1'b1;
+`else
+  localparam bit BpUseGshare = 1'b0;
+`endif
+
   // Clocked signals passed from Instruction Fetch (IF) stage to Pre-Decode (PD) stage
   // IF outputs raw/partially processed data; PD performs decompression for better timing.
   // With 64-bit fetch, spanning instructions are assembled immediately in IF — no
@@ -800,6 +903,10 @@ package riscv_pkg;
     logic ras_pop_after_restore;  // Pop RAS after restoring (for returns that triggered restore)
     logic ras_push_after_restore;  // Push after restoring (for mispredicted calls)
     logic [XLEN-1:0] ras_push_address_after_restore;  // Link address to push after restore
+    // Indirect-target predictor training (mispredicted non-return JALRs)
+    logic ind_update;  // Train indirect-target predictor entry
+    logic [XLEN-1:0] ind_update_pc;  // PC of the mispredicted indirect jump
+    logic [XLEN-1:0] ind_update_target;  // Resolved (actual) target
   } from_ex_comb_t;
 
   // Writeback result bundle.
@@ -1044,11 +1151,18 @@ package riscv_pkg;
   // Configurable depths for all major structures. Power-of-2 sizes simplify
   // circular buffer pointer arithmetic.
 
-  // Reorder Buffer parameters
+  // Reorder Buffer parameters.  Depth is build-time overridable (power of 2):
+  // +define+FROST_ROB_DEPTH=64 selects the large configuration.  Everything
+  // downstream (tags, structs, pointer arithmetic, checkpoint owner tags)
+  // derives from these two constants, so no other edit is needed.
+`ifdef FROST_ROB_DEPTH
+  localparam int unsigned ReorderBufferDepth = `FROST_ROB_DEPTH;
+`else
   localparam int unsigned ReorderBufferDepth = 32;  // Number of Reorder Buffer entries (power of 2)
+`endif
   localparam int unsigned ReorderBufferTagWidth = $clog2(
       ReorderBufferDepth
-  );  // 5 bits for 32-entry Reorder Buffer
+  );  // 5 bits for the default 32-entry Reorder Buffer
 
   // Reservation Station depths (per RS type)
   localparam int unsigned IntRsDepth = 16;  // Integer ALU operations
@@ -1062,9 +1176,38 @@ package riscv_pkg;
   localparam int unsigned LqDepth = 8;  // Load queue entries
   localparam int unsigned SqDepth = 8;  // Store queue entries
 
-  // Checkpoint parameters
+  // Integer divider folding: quotient bits retired per pipeline stage (must
+  // divide XLEN).  4 gives a 9-cycle fully pipelined divide (1 init +
+  // XLEN/4 stages); the divider and int_muldiv_shim's in-flight tracker both
+  // derive their depth from this so they cannot drift apart.
+  localparam int unsigned DivBitsPerStage = 4;
+
+  // FP divide/sqrt folding: result bits retired per pipeline stage in
+  // fp_divider / fp_sqrt (radix-4 at the default 2).  The derived end-to-end
+  // depths below (quotient bits = MantBits + 2: 26 for SP, 55 for DP, plus
+  // 10 unpack/normalize/round stages) are shared with fp_div_shim's tag
+  // queues so the shim's in-flight tracking cannot drift from the datapath.
+  // fp_sqrt pads itself to the matching divider depth.
+  localparam int unsigned FpDivBitsPerStage = 2;
+  localparam int unsigned FpDivPipeDepthS = (26 + FpDivBitsPerStage - 1) / FpDivBitsPerStage + 10;
+  localparam int unsigned FpDivPipeDepthD = (55 + FpDivBitsPerStage - 1) / FpDivBitsPerStage + 10;
+
+  // FMA pipeline depth: cycles from fp_fma accepting an operation to o_valid.
+  // The datapath has 12 fixed register ranks; the remainder is the DSP-tiled
+  // mantissa multiplier's pipeline, which fp_fma derives from this constant
+  // (both precisions pad to the same depth).  fp_mul_shim's in-flight tag
+  // queue is sized from this too, so it cannot drift from the datapath.
+  localparam int unsigned FpFmaLatency = 15;
+
+  // Checkpoint parameters.  Count is build-time overridable (power of 2):
+  // +define+FROST_NUM_CHECKPOINTS=16 pairs with the 64-entry ROB so more
+  // branches can be in flight before dispatch stalls on the checkpoint pool.
+`ifdef FROST_NUM_CHECKPOINTS
+  localparam int unsigned NumCheckpoints = `FROST_NUM_CHECKPOINTS;
+`else
   localparam int unsigned NumCheckpoints = 8;  // For branch speculation recovery
-  localparam int unsigned CheckpointIdWidth = $clog2(NumCheckpoints);  // 3 bits
+`endif
+  localparam int unsigned CheckpointIdWidth = $clog2(NumCheckpoints);  // 3 bits at the default 8
 
   // Register file sizes
   localparam int unsigned NumIntRegs = 32;  // x0-x31
@@ -1475,8 +1618,16 @@ package riscv_pkg;
   // Store-to-load forwarding check result
   typedef struct packed {
     logic            match;        // Address match found
-    logic            can_forward;  // Size compatible, can forward
-    logic [FLEN-1:0] data;         // Forwarded data
+    logic            can_forward;  // Every byte the load needs is SQ-forwardable
+    // Per-byte-lane view of the load's addressed word (partial-overlap
+    // forwarding): fwd_bytes are lanes whose newest older-store writer has
+    // forwardable data (already assembled into .data); blocked_bytes are
+    // lanes covered by an older store that cannot forward yet (data not
+    // ready, MMIO, or an FSD source), so they must not be taken from the L0
+    // cache either. Lanes in neither mask are untouched by older stores.
+    logic [3:0]      fwd_bytes;
+    logic [3:0]      blocked_bytes;
+    logic [FLEN-1:0] data;         // Forwarded data (lane-assembled for partial)
   } sq_forward_result_t;
 
   // ---------------------------------------------------------------------------
@@ -1548,14 +1699,16 @@ package riscv_pkg;
       SEXT_B, SEXT_H, ROL, ROR, RORI, ORC_B, REV8,
       CZERO_EQZ, CZERO_NEZ,
       PACK, PACKH, BREV8, ZIP, UNZIP,
-      // CSR instructions -> INT_RS (execute at Reorder Buffer head)
-      CSRRW, CSRRS, CSRRC, CSRRWI, CSRRSI, CSRRCI,
+      // CSR instructions -> INT_RS (execute at Reorder Buffer head;
+      // CSRR_CNT counter reads execute speculatively in the shim)
+      CSRRW, CSRRS, CSRRC, CSRRWI, CSRRSI, CSRRCI, CSRR_CNT,
       // Privileged (exceptions) -> INT_RS
       ECALL, EBREAK:
       get_rs_type = RS_INT;
 
-      // Multiply/divide -> MUL_RS
-      MUL, MULH, MULHSU, MULHU, DIV, DIVU, REM, REMU: get_rs_type = RS_MUL;
+      // Multiply/divide and packed SIMD -> MUL_RS
+      MUL, MULH, MULHSU, MULHU, DIV, DIVU, REM, REMU,
+      PADD8, PSUB8, PADD16, PSUB16, PDOT8: get_rs_type = RS_MUL;
 
       // Memory operations -> MEM_RS (both INT and FP)
       LB, LH, LW, LBU, LHU, SB, SH, SW,
@@ -1608,6 +1761,8 @@ package riscv_pkg;
       CZERO_EQZ, CZERO_NEZ, PACK, PACKH, BREV8, ZIP, UNZIP,
       // M-extension
       MUL, MULH, MULHSU, MULHU, DIV, DIVU, REM, REMU,
+      // P-extension subset
+      PADD8, PSUB8, PADD16, PSUB16, PDOT8,
       // Integer loads
       LB, LH, LW, LBU, LHU,
       // Atomics (return old value to rd)
@@ -1615,7 +1770,7 @@ package riscv_pkg;
       AMOSWAP_W, AMOADD_W, AMOXOR_W, AMOAND_W, AMOOR_W,
       AMOMIN_W, AMOMAX_W, AMOMINU_W, AMOMAXU_W,
       // CSR (return old CSR value to rd)
-      CSRRW, CSRRS, CSRRC, CSRRWI, CSRRSI, CSRRCI,
+      CSRRW, CSRRS, CSRRC, CSRRWI, CSRRSI, CSRRCI, CSRR_CNT,
       // FP compare -> INT rd
       FEQ_S, FLT_S, FLE_S, FEQ_D, FLT_D, FLE_D,
       // FP classify -> INT rd
@@ -1727,6 +1882,7 @@ package riscv_pkg;
         FENCE, FENCE_I,
         WFI, MRET, PAUSE,
         CSRRWI, CSRRSI, CSRRCI,
+        CSRR_CNT,
         ILLEGAL:
         uses_int_rs1 = 1'b0;
         default: uses_int_rs1 = 1'b1;
@@ -1748,6 +1904,8 @@ package riscv_pkg;
         ADD, SUB, AND, OR, XOR, SLL, SRL, SRA, SLT, SLTU,
         // M-extension
         MUL, MULH, MULHSU, MULHU, DIV, DIVU, REM, REMU,
+        // P-extension subset
+        PADD8, PSUB8, PADD16, PSUB16, PDOT8,
         // B-extension with rs2
         SH1ADD, SH2ADD, SH3ADD,
         BSET, BCLR, BINV, BEXT,
@@ -1769,6 +1927,26 @@ package riscv_pkg;
     end
   endfunction
 
+  // AMO ALU: new memory value for a word-width A-extension atomic, from the
+  // old memory word and the rs2 operand. Shared by the load queue's two-phase
+  // read-modify-write path (BRAM/MMIO tiers) and the cached_tier_adapter's
+  // single-trip RMW at the cache, so the two ALUs can never drift.
+  function automatic logic [31:0] amo_compute(input instr_op_e op, input logic [31:0] old_val,
+                                              input logic [31:0] rs2);
+    case (op)
+      AMOSWAP_W: amo_compute = rs2;
+      AMOADD_W:  amo_compute = old_val + rs2;
+      AMOXOR_W:  amo_compute = old_val ^ rs2;
+      AMOAND_W:  amo_compute = old_val & rs2;
+      AMOOR_W:   amo_compute = old_val | rs2;
+      AMOMIN_W:  amo_compute = ($signed(old_val) < $signed(rs2)) ? old_val : rs2;
+      AMOMAX_W:  amo_compute = ($signed(old_val) > $signed(rs2)) ? old_val : rs2;
+      AMOMINU_W: amo_compute = (old_val < rs2) ? old_val : rs2;
+      AMOMAXU_W: amo_compute = (old_val > rs2) ? old_val : rs2;
+      default:   amo_compute = old_val;
+    endcase
+  endfunction
+
   // ---------------------------------------------------------------------------
   // Control Flow Classification Helpers
   // ---------------------------------------------------------------------------
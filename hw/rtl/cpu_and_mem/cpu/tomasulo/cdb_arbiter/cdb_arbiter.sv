@@ -17,20 +17,27 @@
 /*
  * CDB Arbiter
  *
- * Priority-based multiplexer that selects one functional unit result per cycle
- * for broadcast on the Common Data Bus (CDB). Ties FU completions back to:
+ * Age-ordered multiplexer that selects up to two functional unit results per
+ * cycle for broadcast on the Common Data Bus (CDB). Ties FU completions back
+ * to:
  *   - ROB (mark done + store value)
  *   - All RS instances (operand wakeup)
  *
- * Priority order favors integer traffic without putting FP/div valid cones
- * ahead of the CoreMark-critical grants:
- *   1. MUL   (1) — integer multiply
- *   2. MEM   (3) — load/SC results
- *   3. ALU   (0) — common integer path
- *   4. DIV   (2) — integer divide
- *   5. FP_DIV (6)
- *   6. FP_MUL (5)
- *   7. FP_ADD (4)
+ * Arbitration is oldest-ROB-first: each requester's age is its ROB tag minus
+ * the head pointer (the same relative-age arithmetic the flush logic uses),
+ * and the two CDB lanes go to the two oldest valid requesters. The previous
+ * fixed-priority order let a sustained INT burst (MUL/MEM/ALU all completing)
+ * starve FP results, holding ROB entries done-but-unbroadcast at the head and
+ * stalling in-order commit in FP-heavy phases. Age ordering drains results in
+ * exactly the order commit consumes them, so no completion can be starved by
+ * younger work. The selection is a matrix arbiter — all pairwise age compares
+ * evaluate in parallel, then each FU counts how many valid requesters precede
+ * it — rather than a serial chain of comparators.
+ *
+ * The old INT-favoring priority rank (MUL > MEM > ALU > DIV > FP_DIV >
+ * FP_MUL > FP_ADD) survives only as the tie-break for equal tags. Two live
+ * ROB entries can never share a tag, but the benches and formal harness drive
+ * unconstrained tags, so ties must still resolve deterministically.
  *
  * Purely combinational — no output register. Matches how i_cdb currently
  * feeds RS/ROB on the same cycle edge.
@@ -51,6 +58,10 @@ module cdb_arbiter (
     input riscv_pkg::fu_complete_t i_fu_complete_5,  // FP_MUL
     input riscv_pkg::fu_complete_t i_fu_complete_6,  // FP_DIV
 
+    // ROB head tag for relative-age computation (tag - head, modulo depth,
+    // is the requester's age in program order — see header).
+    input logic [riscv_pkg::ReorderBufferTagWidth-1:0] i_rob_head_tag,
+
     // Suppress CDB broadcast/grants during speculative full-flush recovery.
     input logic i_kill,
 
@@ -76,131 +87,108 @@ module cdb_arbiter (
     output logic [riscv_pkg::NumFus-1:0] o_grant_raw
 );
 
+  localparam int unsigned TagWidth = riscv_pkg::ReorderBufferTagWidth;
+
+  // Tie-break rank for equal-tag requesters (lower rank wins): the legacy
+  // fixed-priority order MUL > MEM > ALU > DIV > FP_DIV > FP_MUL > FP_ADD,
+  // indexed by fu_type_e value.
+  localparam int unsigned FuPriorityRank[riscv_pkg::NumFus] = '{
+      2,  // FU_ALU
+      0,  // FU_MUL
+      3,  // FU_DIV
+      1,  // FU_MEM
+      6,  // FU_FP_ADD
+      5,  // FU_FP_MUL
+      4   // FU_FP_DIV
+  };
+
   // Valid vector for convenience (used by formal assertions)
-  logic                    [riscv_pkg::NumFus-1:0] valid_vec;
+  logic [riscv_pkg::NumFus-1:0] valid_vec;
 
-  // Fixed-priority encoder, lane 0 (primary).
-  // Priority: MUL > MEM > ALU > DIV > FP_DIV > FP_MUL > FP_ADD
-  logic                                            found;
-  logic                    [                  2:0] winner_idx;
-  riscv_pkg::fu_complete_t                         winner_data;
-  logic                    [riscv_pkg::NumFus-1:0] g0_raw;
+  // FU completions gathered into an internal array (ports stay flattened
+  // individual structs for Yosys — no array port references).
+  riscv_pkg::fu_complete_t fu_comp[riscv_pkg::NumFus];
+  // Relative age of each requester: tag - head, modulo the ROB depth.  The
+  // same wrap-safe subtraction the flush-age helpers use; smaller is older.
+  logic [TagWidth-1:0] fu_age[riscv_pkg::NumFus];
 
-  // Lane 1 (secondary): highest-priority requester lane 0 did not take.
-  logic                                            found2;
-  logic                    [                  2:0] winner2_idx;
-  riscv_pkg::fu_complete_t                         winner2_data;
-  logic                    [riscv_pkg::NumFus-1:0] g1_raw;
-  // Per-FU "valid and not granted by lane 0", input to the lane-1 encoder.
-  logic                    [riscv_pkg::NumFus-1:0] avail1;
+  always_comb begin
+    fu_comp[riscv_pkg::FU_ALU]    = i_fu_complete_0;
+    fu_comp[riscv_pkg::FU_MUL]    = i_fu_complete_1;
+    fu_comp[riscv_pkg::FU_DIV]    = i_fu_complete_2;
+    fu_comp[riscv_pkg::FU_MEM]    = i_fu_complete_3;
+    fu_comp[riscv_pkg::FU_FP_ADD] = i_fu_complete_4;
+    fu_comp[riscv_pkg::FU_FP_MUL] = i_fu_complete_5;
+    fu_comp[riscv_pkg::FU_FP_DIV] = i_fu_complete_6;
+  end
 
   always_comb begin
-    valid_vec[riscv_pkg::FU_ALU]    = i_fu_complete_0.valid;
-    valid_vec[riscv_pkg::FU_MUL]    = i_fu_complete_1.valid;
-    valid_vec[riscv_pkg::FU_DIV]    = i_fu_complete_2.valid;
-    valid_vec[riscv_pkg::FU_MEM]    = i_fu_complete_3.valid;
-    valid_vec[riscv_pkg::FU_FP_ADD] = i_fu_complete_4.valid;
-    valid_vec[riscv_pkg::FU_FP_MUL] = i_fu_complete_5.valid;
-    valid_vec[riscv_pkg::FU_FP_DIV] = i_fu_complete_6.valid;
+    for (int unsigned i = 0; i < riscv_pkg::NumFus; i++) begin
+      valid_vec[i] = fu_comp[i].valid;
+      fu_age[i]    = fu_comp[i].tag - i_rob_head_tag;
+    end
   end
 
+  // Oldest-first matrix arbiter.  beats[i][j] defines a strict total order:
+  // FU i precedes FU j when i's entry is older relative to the ROB head,
+  // with the legacy priority rank breaking equal-tag ties.  older_cnt[i] is
+  // the number of valid requesters that precede i.  All comparators evaluate
+  // in parallel, so selection depth is compare -> count -> mux rather than a
+  // serial priority chain.
+  logic beats[riscv_pkg::NumFus][riscv_pkg::NumFus];
+  logic [2:0] older_cnt[riscv_pkg::NumFus];
+
   always_comb begin
-    found       = 1'b0;
-    winner_idx  = 3'd0;
-    winner_data = '0;
-    g0_raw      = '0;
-
-    if (i_fu_complete_1.valid) begin
-      found                     = 1'b1;
-      winner_idx                = riscv_pkg::FU_MUL;
-      winner_data               = i_fu_complete_1;
-      g0_raw[riscv_pkg::FU_MUL] = 1'b1;
-    end else if (i_fu_complete_3.valid) begin
-      found                     = 1'b1;
-      winner_idx                = riscv_pkg::FU_MEM;
-      winner_data               = i_fu_complete_3;
-      g0_raw[riscv_pkg::FU_MEM] = 1'b1;
-    end else if (i_fu_complete_0.valid) begin
-      found                     = 1'b1;
-      winner_idx                = riscv_pkg::FU_ALU;
-      winner_data               = i_fu_complete_0;
-      g0_raw[riscv_pkg::FU_ALU] = 1'b1;
-    end else if (i_fu_complete_2.valid) begin
-      found                     = 1'b1;
-      winner_idx                = riscv_pkg::FU_DIV;
-      winner_data               = i_fu_complete_2;
-      g0_raw[riscv_pkg::FU_DIV] = 1'b1;
-    end else if (i_fu_complete_6.valid) begin
-      found                        = 1'b1;
-      winner_idx                   = riscv_pkg::FU_FP_DIV;
-      winner_data                  = i_fu_complete_6;
-      g0_raw[riscv_pkg::FU_FP_DIV] = 1'b1;
-    end else if (i_fu_complete_5.valid) begin
-      found                        = 1'b1;
-      winner_idx                   = riscv_pkg::FU_FP_MUL;
-      winner_data                  = i_fu_complete_5;
-      g0_raw[riscv_pkg::FU_FP_MUL] = 1'b1;
-    end else if (i_fu_complete_4.valid) begin
-      found                        = 1'b1;
-      winner_idx                   = riscv_pkg::FU_FP_ADD;
-      winner_data                  = i_fu_complete_4;
-      g0_raw[riscv_pkg::FU_FP_ADD] = 1'b1;
+    for (int unsigned i = 0; i < riscv_pkg::NumFus; i++) begin
+      for (int unsigned j = 0; j < riscv_pkg::NumFus; j++) begin
+        beats[i][j] = (fu_age[i] < fu_age[j]) ||
+                      ((fu_age[i] == fu_age[j]) && (FuPriorityRank[i] < FuPriorityRank[j]));
+      end
     end
   end
 
-  // Lane-1 candidates: each FU's valid minus whatever lane 0 granted.
   always_comb begin
-    avail1[riscv_pkg::FU_ALU]    = i_fu_complete_0.valid && !g0_raw[riscv_pkg::FU_ALU];
-    avail1[riscv_pkg::FU_MUL]    = i_fu_complete_1.valid && !g0_raw[riscv_pkg::FU_MUL];
-    avail1[riscv_pkg::FU_DIV]    = i_fu_complete_2.valid && !g0_raw[riscv_pkg::FU_DIV];
-    avail1[riscv_pkg::FU_MEM]    = i_fu_complete_3.valid && !g0_raw[riscv_pkg::FU_MEM];
-    avail1[riscv_pkg::FU_FP_ADD] = i_fu_complete_4.valid && !g0_raw[riscv_pkg::FU_FP_ADD];
-    avail1[riscv_pkg::FU_FP_MUL] = i_fu_complete_5.valid && !g0_raw[riscv_pkg::FU_FP_MUL];
-    avail1[riscv_pkg::FU_FP_DIV] = i_fu_complete_6.valid && !g0_raw[riscv_pkg::FU_FP_DIV];
+    for (int unsigned i = 0; i < riscv_pkg::NumFus; i++) begin
+      older_cnt[i] = '0;
+      for (int unsigned j = 0; j < riscv_pkg::NumFus; j++) begin
+        if ((j != i) && valid_vec[j] && beats[j][i]) older_cnt[i] = older_cnt[i] + 3'd1;
+      end
+    end
   end
 
-  // Lane-1 priority encoder (same priority order as lane 0, over avail1).
+  // Lane assignment: the valid requester nobody precedes takes lane 0, the
+  // requester exactly one valid requester precedes takes lane 1.
+  logic                                            found;
+  logic                    [                  2:0] winner_idx;
+  riscv_pkg::fu_complete_t                         winner_data;
+  logic                    [riscv_pkg::NumFus-1:0] g0_raw;
+  logic                                            found2;
+  logic                    [                  2:0] winner2_idx;
+  riscv_pkg::fu_complete_t                         winner2_data;
+  logic                    [riscv_pkg::NumFus-1:0] g1_raw;
+
   always_comb begin
+    found        = 1'b0;
+    winner_idx   = 3'd0;
+    winner_data  = '0;
+    g0_raw       = '0;
     found2       = 1'b0;
     winner2_idx  = 3'd0;
     winner2_data = '0;
     g1_raw       = '0;
 
-    if (avail1[riscv_pkg::FU_MUL]) begin
-      found2                    = 1'b1;
-      winner2_idx               = riscv_pkg::FU_MUL;
-      winner2_data              = i_fu_complete_1;
-      g1_raw[riscv_pkg::FU_MUL] = 1'b1;
-    end else if (avail1[riscv_pkg::FU_MEM]) begin
-      found2                    = 1'b1;
-      winner2_idx               = riscv_pkg::FU_MEM;
-      winner2_data              = i_fu_complete_3;
-      g1_raw[riscv_pkg::FU_MEM] = 1'b1;
-    end else if (avail1[riscv_pkg::FU_ALU]) begin
-      found2                    = 1'b1;
-      winner2_idx               = riscv_pkg::FU_ALU;
-      winner2_data              = i_fu_complete_0;
-      g1_raw[riscv_pkg::FU_ALU] = 1'b1;
-    end else if (avail1[riscv_pkg::FU_DIV]) begin
-      found2                    = 1'b1;
-      winner2_idx               = riscv_pkg::FU_DIV;
-      winner2_data              = i_fu_complete_2;
-      g1_raw[riscv_pkg::FU_DIV] = 1'b1;
-    end else if (avail1[riscv_pkg::FU_FP_DIV]) begin
-      found2                       = 1'b1;
-      winner2_idx                  = riscv_pkg::FU_FP_DIV;
-      winner2_data                 = i_fu_complete_6;
-      g1_raw[riscv_pkg::FU_FP_DIV] = 1'b1;
-    end else if (avail1[riscv_pkg::FU_FP_MUL]) begin
-      found2                       = 1'b1;
-      winner2_idx                  = riscv_pkg::FU_FP_MUL;
-      winner2_data                 = i_fu_complete_5;
-      g1_raw[riscv_pkg::FU_FP_MUL] = 1'b1;
-    end else if (avail1[riscv_pkg::FU_FP_ADD]) begin
-      found2                       = 1'b1;
-      winner2_idx                  = riscv_pkg::FU_FP_ADD;
-      winner2_data                 = i_fu_complete_4;
-      g1_raw[riscv_pkg::FU_FP_ADD] = 1'b1;
+    for (int unsigned i = 0; i < riscv_pkg::NumFus; i++) begin
+      if (valid_vec[i] && older_cnt[i] == 3'd0) begin
+        found       = 1'b1;
+        winner_idx  = 3'(i);
+        winner_data = fu_comp[i];
+        g0_raw[i]   = 1'b1;
+      end else if (valid_vec[i] && older_cnt[i] == 3'd1) begin
+        found2       = 1'b1;
+        winner2_idx  = 3'(i);
+        winner2_data = fu_comp[i];
+        g1_raw[i]    = 1'b1;
+      end
     end
   end
 
@@ -410,75 +398,42 @@ module cdb_arbiter (
   end
 
   // -------------------------------------------------------------------------
-  // Priority assertions (uses valid_vec, no array port access)
+  // Age-order assertions (uses valid_vec/beats, no array port access)
   // -------------------------------------------------------------------------
 
-  // MUL (highest) always wins when valid
-  always_comb begin
-    if (valid_vec[riscv_pkg::FU_MUL]) begin
-      p_priority_mul_wins : assert (o_grant_raw[riscv_pkg::FU_MUL]);
-    end
-  end
-
-  // MEM wins when valid and MUL not valid
-  always_comb begin
-    if (valid_vec[riscv_pkg::FU_MEM] && !valid_vec[riscv_pkg::FU_MUL]) begin
-      p_priority_mem_over_lower : assert (o_grant_raw[riscv_pkg::FU_MEM]);
-    end
-  end
-
-  // ALU wins when valid and MUL/MEM are not valid
-  always_comb begin
-    if (valid_vec[riscv_pkg::FU_ALU] &&
-        !valid_vec[riscv_pkg::FU_MUL] &&
-        !valid_vec[riscv_pkg::FU_MEM]) begin
-      p_priority_alu_over_lower : assert (o_grant_raw[riscv_pkg::FU_ALU]);
-    end
-  end
-
-  // DIV wins when valid and CoreMark-priority FUs are not valid
-  always_comb begin
-    if (valid_vec[riscv_pkg::FU_DIV] &&
-        !valid_vec[riscv_pkg::FU_MUL] &&
-        !valid_vec[riscv_pkg::FU_MEM] &&
-        !valid_vec[riscv_pkg::FU_ALU]) begin
-      p_priority_div_over_lower : assert (o_grant_raw[riscv_pkg::FU_DIV]);
+  // Lane 0 carries the oldest valid requester: no other valid requester
+  // precedes it in the beats[][] order.
+  function automatic logic lane0_is_oldest();
+    lane0_is_oldest = 1'b1;
+    for (int i = 0; i < riscv_pkg::NumFus; i++) begin
+      for (int j = 0; j < riscv_pkg::NumFus; j++) begin
+        if ((i != j) && g0_raw[i] && valid_vec[j] && !beats[i][j]) lane0_is_oldest = 1'b0;
+      end
     end
-  end
+  endfunction
 
-  // FP_DIV wins when valid and higher-priority FUs are not valid
-  always_comb begin
-    if (valid_vec[riscv_pkg::FU_FP_DIV] &&
-        !valid_vec[riscv_pkg::FU_MUL] &&
-        !valid_vec[riscv_pkg::FU_MEM] &&
-        !valid_vec[riscv_pkg::FU_ALU] &&
-        !valid_vec[riscv_pkg::FU_DIV]) begin
-      p_priority_fp_div_over_lower : assert (o_grant_raw[riscv_pkg::FU_FP_DIV]);
+  // Lane 1 carries the second-oldest: the only valid requester preceding it
+  // is the lane-0 winner.
+  function automatic logic lane1_is_second_oldest();
+    lane1_is_second_oldest = 1'b1;
+    for (int i = 0; i < riscv_pkg::NumFus; i++) begin
+      for (int j = 0; j < riscv_pkg::NumFus; j++) begin
+        if ((i != j) && g1_raw[i] && valid_vec[j] && beats[j][i] && !g0_raw[j])
+          lane1_is_second_oldest = 1'b0;
+      end
     end
-  end
+  endfunction
 
-  // FP_MUL wins when valid and higher-priority FUs are not valid
   always_comb begin
-    if (valid_vec[riscv_pkg::FU_FP_MUL] &&
-        !valid_vec[riscv_pkg::FU_MUL] &&
-        !valid_vec[riscv_pkg::FU_MEM] &&
-        !valid_vec[riscv_pkg::FU_ALU] &&
-        !valid_vec[riscv_pkg::FU_DIV] &&
-        !valid_vec[riscv_pkg::FU_FP_DIV]) begin
-      p_priority_fp_mul_over_lower : assert (o_grant_raw[riscv_pkg::FU_FP_MUL]);
-    end
+    p_lane0_oldest : assert (lane0_is_oldest());
+    p_lane1_second_oldest : assert (lane1_is_second_oldest());
   end
 
-  // FP_ADD wins only when it is the highest remaining valid FU
+  // An unaccompanied valid requester is always granted (no starvation when
+  // the bus is free): any valid FU with no older valid requester wins lane 0.
   always_comb begin
-    if (valid_vec[riscv_pkg::FU_FP_ADD] &&
-        !valid_vec[riscv_pkg::FU_MUL] &&
-        !valid_vec[riscv_pkg::FU_MEM] &&
-        !valid_vec[riscv_pkg::FU_ALU] &&
-        !valid_vec[riscv_pkg::FU_DIV] &&
-        !valid_vec[riscv_pkg::FU_FP_DIV] &&
-        !valid_vec[riscv_pkg::FU_FP_MUL]) begin
-      p_priority_fp_add_lowest : assert (o_grant_raw[riscv_pkg::FU_FP_ADD]);
+    if ($countones(valid_vec) == 1) begin
+      p_sole_requester_granted : assert ((o_grant_raw & valid_vec) == valid_vec);
     end
   end
 
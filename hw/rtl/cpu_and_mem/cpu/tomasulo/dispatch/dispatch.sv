@@ -264,6 +264,21 @@ module dispatch (
   assign op = i_from_id_to_ex.is_illegal_instruction ? riscv_pkg::ILLEGAL :
                                                     i_from_id_to_ex.instruction_operation;
 
+  // Non-serializing counter read: a pure read (CSRRS/CSRRC with rs1 = x0, or
+  // an immediate form with uimm = 0 — the rs1 field either way) of a
+  // side-effect-free counter CSR never writes, so it needs neither the
+  // commit-time CSR handshake nor the post-CSR dispatch fence. Such reads are
+  // rewritten to CSRR_CNT below and execute speculatively in the ALU shim.
+  logic csr_counter_read;
+  assign csr_counter_read =
+      i_from_id_to_ex.is_csr_instruction && !i_from_id_to_ex.is_illegal_instruction &&
+      (i_from_id_to_ex.instruction.funct3 == riscv_pkg::CSR_RS ||
+       i_from_id_to_ex.instruction.funct3 == riscv_pkg::CSR_RC ||
+       i_from_id_to_ex.instruction.funct3 == riscv_pkg::CSR_RSI ||
+       i_from_id_to_ex.instruction.funct3 == riscv_pkg::CSR_RCI) &&
+      (i_from_id_to_ex.instruction.source_reg_1 == 5'd0) &&
+      riscv_pkg::csr_addr_is_counter(i_from_id_to_ex.csr_address);
+
   // RS routing is pre-decoded in ID and registered into from_id_to_ex_t so
   // the dispatch fire signals do not start with a large instruction_operation
   // case tree.
@@ -452,6 +467,17 @@ module dispatch (
   assign op_2 = i_from_id_to_ex_2.is_illegal_instruction ? riscv_pkg::ILLEGAL :
                                                       i_from_id_to_ex_2.instruction_operation;
 
+  // Slot-2 non-serializing counter read (see slot-1 csr_counter_read).
+  logic csr_counter_read_2;
+  assign csr_counter_read_2 =
+      i_from_id_to_ex_2.is_csr_instruction && !i_from_id_to_ex_2.is_illegal_instruction &&
+      (i_from_id_to_ex_2.instruction.funct3 == riscv_pkg::CSR_RS ||
+       i_from_id_to_ex_2.instruction.funct3 == riscv_pkg::CSR_RC ||
+       i_from_id_to_ex_2.instruction.funct3 == riscv_pkg::CSR_RSI ||
+       i_from_id_to_ex_2.instruction.funct3 == riscv_pkg::CSR_RCI) &&
+      (i_from_id_to_ex_2.instruction.source_reg_1 == 5'd0) &&
+      riscv_pkg::csr_addr_is_counter(i_from_id_to_ex_2.csr_address);
+
   riscv_pkg::rs_type_e rs_type_2;
   assign rs_type_2 = riscv_pkg::rs_type_e'(i_from_id_to_ex_2.rs_type);
 
@@ -1043,6 +1069,25 @@ module dispatch (
   assign intra_bundle_fp_src2_2 = slot1_dest_fp && (dest_reg == i_rs2_addr_2);
   assign intra_bundle_fp_src3_2 = slot1_dest_fp && (dest_reg == i_fp_rs3_addr_2);
 
+  // Intra-bundle constant folding (macro-op fusion for LUI/AUIPC producers).
+  // GCC materializes constants and addresses as lui+addi / auipc+addi pairs,
+  // and the consumer half frequently lands in slot-2 of the same bundle.
+  // When slot-1 is LUI or AUIPC its result is already known at dispatch (the
+  // U immediate, or PC + U immediate), so instead of renaming the slot-2
+  // source to slot-1's ROB tag -- serializing the pair through issue and the
+  // CDB -- dispatch supplies the value directly and the consumer leaves
+  // dispatch ready.  Slot-1 still executes and commits normally (two ROB
+  // entries; architectural state, instret, and trap points are untouched):
+  // only the RAW edge inside the bundle dissolves, which is what fusing the
+  // pair buys without inventing a second instruction format in the RS.
+  // The fold keys off `op`, so an illegal-instruction override never folds.
+  logic slot1_const_foldable;
+  logic [riscv_pkg::XLEN-1:0] slot1_const_value;
+  assign slot1_const_foldable = (op == riscv_pkg::LUI) || (op == riscv_pkg::AUIPC);
+  assign slot1_const_value = (op == riscv_pkg::LUI) ?
+      i_from_id_to_ex.immediate_u_type :
+      (i_from_id_to_ex.program_counter + i_from_id_to_ex.immediate_u_type);
+
   // Effective slot-2 lookup results after intra-bundle RAW override.
   riscv_pkg::rat_lookup_t int_src1_2_eff;
   riscv_pkg::rat_lookup_t int_src2_2_eff;
@@ -1052,16 +1097,28 @@ module dispatch (
 
   always_comb begin
     if (intra_bundle_int_src1_2) begin
-      int_src1_2_eff.renamed = 1'b1;
-      int_src1_2_eff.tag     = i_rob_alloc_resp.alloc_tag;
-      int_src1_2_eff.value   = '0;
+      if (slot1_const_foldable) begin
+        int_src1_2_eff.renamed = 1'b0;
+        int_src1_2_eff.tag     = '0;
+        int_src1_2_eff.value   = {{(riscv_pkg::FLEN - riscv_pkg::XLEN) {1'b0}}, slot1_const_value};
+      end else begin
+        int_src1_2_eff.renamed = 1'b1;
+        int_src1_2_eff.tag     = i_rob_alloc_resp.alloc_tag;
+        int_src1_2_eff.value   = '0;
+      end
     end else begin
       int_src1_2_eff = i_int_src1_2;
     end
     if (intra_bundle_int_src2_2) begin
-      int_src2_2_eff.renamed = 1'b1;
-      int_src2_2_eff.tag     = i_rob_alloc_resp.alloc_tag;
-      int_src2_2_eff.value   = '0;
+      if (slot1_const_foldable) begin
+        int_src2_2_eff.renamed = 1'b0;
+        int_src2_2_eff.tag     = '0;
+        int_src2_2_eff.value   = {{(riscv_pkg::FLEN - riscv_pkg::XLEN) {1'b0}}, slot1_const_value};
+      end else begin
+        int_src2_2_eff.renamed = 1'b1;
+        int_src2_2_eff.tag     = i_rob_alloc_resp.alloc_tag;
+        int_src2_2_eff.value   = '0;
+      end
     end else begin
       int_src2_2_eff = i_int_src2_2;
     end
@@ -1148,7 +1205,8 @@ module dispatch (
     o_rob_alloc_req.link_addr = i_from_id_to_ex.link_address;
     o_rob_alloc_req.is_jal = is_jal_flag;
     o_rob_alloc_req.is_jalr = is_jalr_flag;
-    o_rob_alloc_req.is_csr = i_from_id_to_ex.is_csr_instruction;
+    // CSRR_CNT counter reads retire like normal ALU ops (no serialization).
+    o_rob_alloc_req.is_csr = i_from_id_to_ex.is_csr_instruction && !csr_counter_read;
     o_rob_alloc_req.is_fence = i_from_id_to_ex.is_fence;
     o_rob_alloc_req.is_fence_i = i_from_id_to_ex.is_fence_i;
     o_rob_alloc_req.is_wfi = i_from_id_to_ex.is_wfi;
@@ -1199,7 +1257,8 @@ module dispatch (
     o_rob_alloc_req_2.link_addr = i_from_id_to_ex_2.link_address;
     o_rob_alloc_req_2.is_jal = is_jal_flag_2;
     o_rob_alloc_req_2.is_jalr = is_jalr_flag_2;
-    o_rob_alloc_req_2.is_csr = i_from_id_to_ex_2.is_csr_instruction;
+    // CSRR_CNT counter reads retire like normal ALU ops (no serialization).
+    o_rob_alloc_req_2.is_csr = i_from_id_to_ex_2.is_csr_instruction && !csr_counter_read_2;
     o_rob_alloc_req_2.is_fence = i_from_id_to_ex_2.is_fence;
     o_rob_alloc_req_2.is_fence_i = i_from_id_to_ex_2.is_fence_i;
     o_rob_alloc_req_2.is_wfi = i_from_id_to_ex_2.is_wfi;
@@ -1251,7 +1310,9 @@ module dispatch (
 
     rs_dispatch_base.rs_type          = rs_type;
     rs_dispatch_base.rob_tag          = i_rob_alloc_resp.alloc_tag;
-    rs_dispatch_base.op               = op;
+    // Pure counter reads are rewritten to CSRR_CNT so the ALU shim returns
+    // the counter value on the CDB instead of the rs1 pass-through.
+    rs_dispatch_base.op               = csr_counter_read ? riscv_pkg::CSRR_CNT : op;
 
     // Unused operands are ready constants.  Per-RS builders below overwrite
     // only the source slots that can be consumed by that RS family.
@@ -1433,7 +1494,7 @@ module dispatch (
 
     rs_dispatch_base_2.rs_type          = rs_type_2;
     rs_dispatch_base_2.rob_tag          = i_rob_alloc_resp_2.alloc_tag;
-    rs_dispatch_base_2.op               = op_2;
+    rs_dispatch_base_2.op               = csr_counter_read_2 ? riscv_pkg::CSRR_CNT : op_2;
 
     rs_dispatch_base_2.src1_ready       = 1'b1;
     rs_dispatch_base_2.src2_ready       = 1'b1;
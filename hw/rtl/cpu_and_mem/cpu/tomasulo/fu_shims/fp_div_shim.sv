@@ -23,7 +23,9 @@
  * holding registers into a result FIFO. Credit-based back-pressure prevents
  * FIFO overflow.
  *
- * Pipeline depths: SP = 36 stages, DP = 65 stages.
+ * Pipeline depths come from riscv_pkg::FpDivPipeDepthS/D (23/38 at the
+ * default radix-4 folding); fp_sqrt pads itself to the divider depth so one
+ * depth per precision covers all four sub-units.
  */
 module fp_div_shim (
     input logic i_clk,
@@ -69,11 +71,13 @@ module fp_div_shim (
   localparam int unsigned QueueDepth = 4;
   localparam int unsigned FifoDepth = 4;
 
-  // Pipeline depths per sub-unit (for tag queue shift registers)
-  localparam int unsigned DivSDepth = 36;
-  localparam int unsigned DivDDepth = 65;
-  localparam int unsigned SqrtSDepth = 36;
-  localparam int unsigned SqrtDDepth = 65;
+  // Pipeline depths per sub-unit (for tag queue shift registers).  Shared
+  // with the fp_divider/fp_sqrt datapaths via riscv_pkg so the tag queues
+  // cannot drift from the actual latencies.
+  localparam int unsigned DivSDepth = riscv_pkg::FpDivPipeDepthS;
+  localparam int unsigned DivDDepth = riscv_pkg::FpDivPipeDepthD;
+  localparam int unsigned SqrtSDepth = riscv_pkg::FpDivPipeDepthS;
+  localparam int unsigned SqrtDDepth = riscv_pkg::FpDivPipeDepthD;
 
   // ===========================================================================
   // Age comparison for partial flush
@@ -289,7 +293,7 @@ module fp_div_shim (
   // Each sub-unit has its own depth matching the pipeline latency.
   // We use a unified max-depth array and per-unit depth parameters.
   // ===========================================================================
-  localparam int unsigned MaxPipeDepth = 65;  // max(36, 65)
+  localparam int unsigned MaxPipeDepth = riscv_pkg::FpDivPipeDepthD;  // max(SP, DP)
 
   // Tag queue arrays stay flat for simple storage and waveform visibility.
   logic            tq_valid  [NumUnits] [MaxPipeDepth];
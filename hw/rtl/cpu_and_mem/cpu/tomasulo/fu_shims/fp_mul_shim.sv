@@ -17,13 +17,22 @@
 /*
  * FP Multiply Shim (CDB Slot 5, FMUL_RS)
  *
- * Translates rs_issue_t from FMUL_RS into FPU subunit native ports.
+ * Translates rs_issue_t from FMUL_RS into the pipelined FMA unit's native
+ * ports.  fpu_fma_unit accepts a new operation every cycle at a fixed
+ * latency of riscv_pkg::FpFmaLatency, so a single tag shift register sized
+ * from that constant tracks every in-flight op and a credit-based result
+ * FIFO absorbs completions the adapter has not consumed yet.
  *
- * Subunits:
- *   - fpu_mult_unit: FMUL_S/D (~9 cycles)
- *   - fpu_fma_unit:  FMADD/FMSUB/FNMADD/FNMSUB S/D (~10 cycles)
+ * FMUL_S/D ride the same pipeline as a fused multiply-add with a zero
+ * addend whose sign matches the product's: x + (+/-0 of x's sign) is x in
+ * every rounding mode (a plain +0 addend would turn an exact -0 product
+ * into +0 outside RDN), and the single FMA rounding of an exact-zero
+ * addition is the multiply's own rounding, so results and flags are
+ * bit-identical to a standalone correctly-rounded multiply.  One pipeline
+ * means one tracker and no completion collisions.
  *
  * FMA operand mapping: a=src1, b=src2, c=src3
+ *   FMUL:   negate_product=0, negate_c=0  → a*b + (sign(a*b) ? -0 : +0)
  *   FMADD:  negate_product=0, negate_c=0  → a*b + c
  *   FMSUB:  negate_product=0, negate_c=1  → a*b - c
  *   FNMSUB: negate_product=1, negate_c=0  → -(a*b) + c = c - a*b
@@ -48,12 +57,20 @@ module fp_mul_shim (
     // Pipeline flush (partial)
     input logic                                        i_flush_en,
     input logic [riscv_pkg::ReorderBufferTagWidth-1:0] i_flush_tag,
-    input logic [riscv_pkg::ReorderBufferTagWidth-1:0] i_rob_head_tag
+    input logic [riscv_pkg::ReorderBufferTagWidth-1:0] i_rob_head_tag,
+
+    // Result consumed by downstream adapter
+    input logic i_fmul_accepted
 );
 
   localparam int unsigned TagW = riscv_pkg::ReorderBufferTagWidth;
-  localparam int unsigned XLEN = riscv_pkg::XLEN;
   localparam int unsigned FLEN = riscv_pkg::FLEN;
+  localparam int unsigned FlagsW = 5;  // fp_flags_t width
+
+  // Pipeline depth of the FMA unit (shared with fp_fma via riscv_pkg so the
+  // tag queue cannot drift from the actual latency) and result FIFO depth.
+  localparam int unsigned PipeDepth = riscv_pkg::FpFmaLatency;
+  localparam int unsigned FifoDepth = 4;
 
   function automatic logic [31:0] unbox32(input logic [FLEN-1:0] value);
     unbox32 = (&value[FLEN-1:32]) ? value[31:0] : riscv_pkg::FpCanonicalNan;
@@ -75,23 +92,27 @@ module fp_mul_shim (
   endfunction
 
   // ===========================================================================
-  // Op decode
+  // Op decode — every op routes down the FMA pipeline
   // ===========================================================================
-  logic use_mult, use_fma;
+  logic use_fma, is_fmul;
   logic op_is_double;
   logic negate_product, negate_c;
 
   always_comb begin
-    use_mult       = 1'b0;
     use_fma        = 1'b0;
+    is_fmul        = 1'b0;
     op_is_double   = 1'b0;
     negate_product = 1'b0;
     negate_c       = 1'b0;
 
     case (i_rs_issue.op)
-      riscv_pkg::FMUL_S: use_mult = 1'b1;
+      riscv_pkg::FMUL_S: begin
+        use_fma = 1'b1;
+        is_fmul = 1'b1;
+      end
       riscv_pkg::FMUL_D: begin
-        use_mult = 1'b1;
+        use_fma = 1'b1;
+        is_fmul = 1'b1;
         op_is_double = 1'b1;
       end
 
@@ -145,97 +166,52 @@ module fp_mul_shim (
   wire [63:0] src2_d = i_rs_issue.src2_value;
   wire [63:0] src3_d = i_rs_issue.src3_value;
 
-  // ===========================================================================
-  // In-flight + flush tracking
-  // ===========================================================================
-  logic in_flight, flushed;
-  logic fire, completing;
-
-  logic mult_valid_out, fma_valid_out;
-  assign completing = mult_valid_out | fma_valid_out;
-  assign fire = i_rs_issue.valid & ~in_flight & (use_mult | use_fma);
-
-  logic flush_inflight, flush_launching;
-  assign flush_inflight = in_flight & (i_flush | (i_flush_en & is_younger(
-      tag_reg, i_flush_tag, i_rob_head_tag
-  )));
-  assign flush_launching = fire & (i_flush | (i_flush_en & is_younger(
-      i_rs_issue.rob_tag, i_flush_tag, i_rob_head_tag
-  )));
-
-  always_ff @(posedge i_clk) begin
-    if (!i_rst_n) begin
-      in_flight <= 1'b0;
-      flushed   <= 1'b0;
-    end else if (completing) begin
-      in_flight <= 1'b0;
-      flushed   <= 1'b0;
-    end else begin
-      if (fire) in_flight <= 1'b1;
-      if (flush_inflight || flush_launching) flushed <= 1'b1;
-    end
-  end
-
-  assign o_fu_busy = in_flight;
-
-  // Latch ROB tag + op on fire
-  logic [TagW-1:0] tag_reg;
-  logic use_mult_reg, op_double_reg;
-
-  always_ff @(posedge i_clk) begin
-    if (fire) begin
-      tag_reg       <= i_rs_issue.rob_tag;
-      use_mult_reg  <= use_mult;
-      op_double_reg <= op_is_double;
-    end
-  end
+  // FMUL addend: signed zero matching the product sign (see header).
+  wire [31:0] fma_c_s = is_fmul ? {src1_s[31] ^ src2_s[31], 31'b0} : src3_s;
+  wire [63:0] fma_c_d = is_fmul ? {src1_d[63] ^ src2_d[63], 63'b0} : src3_d;
 
   // ===========================================================================
-  // Subunit: Multiplier (FMUL S/D)
+  // Credit-based busy (forward declaration, computed below)
   // ===========================================================================
-  logic [FLEN-1:0] mult_result;
-  riscv_pkg::fp_flags_t mult_flags;
-  logic mult_busy;
-
-  fpu_mult_unit u_mult (
-      .i_clk          (i_clk),
-      .i_rst          (~i_rst_n),
-      .i_valid        (fire & use_mult),
-      .i_use_unit     (use_mult),
-      .i_op_is_double (op_is_double),
-      .i_operand_a_s  (src1_s),
-      .i_operand_b_s  (src2_s),
-      .i_operand_a_d  (src1_d),
-      .i_operand_b_d  (src2_d),
-      .i_rounding_mode(i_rs_issue.rm),
-      .i_dest_reg     (5'b0),
-      .o_result       (mult_result),
-      .o_valid        (mult_valid_out),
-      .o_flags        (mult_flags),
-      .o_busy         (mult_busy),
-      .o_dest_reg     (),
-      .o_start        ()
-  );
+  logic fmul_busy;
+
+  logic fire;
+  assign fire = i_rs_issue.valid & use_fma & ~fmul_busy;
 
   // ===========================================================================
-  // Subunit: FMA (FMADD/FMSUB/FNMADD/FNMSUB S/D)
+  // FMA unit (pipelined, fixed latency PipeDepth, II=1)
   // ===========================================================================
   logic [FLEN-1:0] fma_result;
   riscv_pkg::fp_flags_t fma_flags;
-  logic fma_busy;
+  logic fma_valid_out;
 
+`ifdef FORMAL
+  // The shim proof covers tag/flush/FIFO control. Model the FMA unit as a
+  // latency-matched valid pipeline so formal does not spend most of its time
+  // bit-blasting the FP datapath.
+  logic [PipeDepth-1:0] f_fma_valid_pipe;
+
+  always_ff @(posedge i_clk) begin
+    if (!i_rst_n) f_fma_valid_pipe <= '0;
+    else f_fma_valid_pipe <= {f_fma_valid_pipe[PipeDepth-2:0], fire};
+  end
+
+  assign fma_valid_out = f_fma_valid_pipe[PipeDepth-1];
+  assign fma_result = '0;
+  assign fma_flags = '0;
+`else
   fpu_fma_unit u_fma (
       .i_clk           (i_clk),
       .i_rst           (~i_rst_n),
-      .i_valid         (fire & use_fma),
+      .i_valid         (fire),
       .i_use_unit      (use_fma),
       .i_op_is_double  (op_is_double),
       .i_operand_a_s   (src1_s),
       .i_operand_b_s   (src2_s),
-      .i_operand_c_s   (src3_s),
+      .i_operand_c_s   (fma_c_s),
       .i_operand_a_d   (src1_d),
       .i_operand_b_d   (src2_d),
-      .i_operand_c_d   (src3_d),
+      .i_operand_c_d   (fma_c_d),
       .i_negate_product(negate_product),
       .i_negate_c      (negate_c),
       .i_rounding_mode (i_rs_issue.rm),
@@ -243,35 +219,225 @@ module fp_mul_shim (
       .o_result        (fma_result),
       .o_valid         (fma_valid_out),
       .o_flags         (fma_flags),
-      .o_busy          (fma_busy),
+      .o_busy          (),
       .o_dest_reg      (),
       .o_start         ()
   );
+`endif
 
   // ===========================================================================
-  // Result mux + NaN-boxing
+  // Tag queue (shift register matching the FMA pipeline depth)
   // ===========================================================================
-  always_comb begin
-    o_fu_complete.valid     = completing & ~flushed;
-    o_fu_complete.tag       = tag_reg;
-    o_fu_complete.value     = '0;
-    o_fu_complete.exception = 1'b0;
-    o_fu_complete.exc_cause = riscv_pkg::exc_cause_t'('0);
-    o_fu_complete.fp_flags  = riscv_pkg::fp_flags_t'('0);
-
-    if (completing) begin
-      if (use_mult_reg) begin
-        if (op_double_reg) o_fu_complete.value = mult_result;
-        else o_fu_complete.value = {32'hFFFF_FFFF, mult_result[31:0]};
-        o_fu_complete.fp_flags = mult_flags;
+  logic            tq_valid  [PipeDepth];
+  logic [TagW-1:0] tq_tag    [PipeDepth];
+  logic            tq_flushed[PipeDepth];
+
+  // Control: valid + flushed (with reset)
+  always_ff @(posedge i_clk) begin
+    if (!i_rst_n) begin
+      for (int i = 0; i < PipeDepth; i++) begin
+        tq_valid[i]   <= 1'b0;
+        tq_flushed[i] <= 1'b0;
+      end
+    end else if (i_flush) begin
+      for (int i = 0; i < PipeDepth; i++) begin
+        tq_valid[i] <= 1'b0;
+      end
+    end else begin
+      for (int i = PipeDepth - 1; i >= 1; i--) begin
+        tq_valid[i] <= tq_valid[i-1];
+        if (tq_valid[i-1] && i_flush_en && is_younger(tq_tag[i-1], i_flush_tag, i_rob_head_tag))
+          tq_flushed[i] <= 1'b1;
+        else tq_flushed[i] <= tq_flushed[i-1];
+      end
+      if (fire) begin
+        tq_valid[0] <= 1'b1;
+        if (i_flush_en && is_younger(i_rs_issue.rob_tag, i_flush_tag, i_rob_head_tag))
+          tq_flushed[0] <= 1'b1;
+        else tq_flushed[0] <= 1'b0;
       end else begin
-        if (op_double_reg) o_fu_complete.value = fma_result;
-        else o_fu_complete.value = {32'hFFFF_FFFF, fma_result[31:0]};
-        o_fu_complete.fp_flags = fma_flags;
+        tq_valid[0]   <= 1'b0;
+        tq_flushed[0] <= 1'b0;
       end
     end
   end
 
+  // Data: tag shift register (no reset)
+  always_ff @(posedge i_clk) begin
+    for (int i = PipeDepth - 1; i >= 1; i--) begin
+      tq_tag[i] <= tq_tag[i-1];
+    end
+    if (fire) tq_tag[0] <= i_rs_issue.rob_tag;
+  end
+
+  // ===========================================================================
+  // Tail completion pushes straight into the result FIFO (single sub-unit,
+  // so no hold buffers or arbitration are needed)
+  // ===========================================================================
+  logic            tail_valid;
+  logic [TagW-1:0] tail_tag;
+  logic            tail_flushed;
+  logic            tail_partial_flushing;
+  logic            fifo_push;
+
+  assign tail_valid = tq_valid[PipeDepth-1];
+  assign tail_tag = tq_tag[PipeDepth-1];
+  assign tail_flushed = tq_flushed[PipeDepth-1];
+  assign tail_partial_flushing = tail_valid && i_flush_en && is_younger(
+      tail_tag, i_flush_tag, i_rob_head_tag
+  );
+  assign fifo_push = tail_valid && !tail_flushed && !tail_partial_flushing;
+
+  // ===========================================================================
+  // Result FIFO (depth 4, FF control with LUTRAM payload)
+  // ===========================================================================
+  logic [               TagW-1:0] fifo_tag     [FifoDepth];
+  logic [               FLEN-1:0] fifo_value_rd;
+  logic [             FlagsW-1:0] fifo_flags_rd;
+  logic [          FifoDepth-1:0] fifo_valid;
+  logic [          FifoDepth-1:0] fifo_flushed;
+  logic [$clog2(FifoDepth+1)-1:0] fifo_count;
+  logic [  $clog2(FifoDepth)-1:0] fifo_wr_ptr;
+  logic [  $clog2(FifoDepth)-1:0] fifo_rd_ptr;
+
+  // The FMA unit NaN-boxes single-precision results itself, so the payload
+  // goes in as-is.
+  sdp_dist_ram #(
+      .ADDR_WIDTH($clog2(FifoDepth)),
+      .DATA_WIDTH(FLEN)
+  ) u_fifo_value (
+      .i_clk,
+      .i_write_enable (fifo_push),
+      .i_write_address(fifo_wr_ptr),
+      .i_write_data   (fma_result),
+      .i_read_address (fifo_rd_ptr),
+      .o_read_data    (fifo_value_rd)
+  );
+
+  sdp_dist_ram #(
+      .ADDR_WIDTH($clog2(FifoDepth)),
+      .DATA_WIDTH(FlagsW)
+  ) u_fifo_flags (
+      .i_clk,
+      .i_write_enable (fifo_push),
+      .i_write_address(fifo_wr_ptr),
+      .i_write_data   (fma_flags),
+      .i_read_address (fifo_rd_ptr),
+      .o_read_data    (fifo_flags_rd)
+  );
+
+  // Same-cycle partial flush of FIFO head
+  logic fifo_head_partial_flushing;
+  assign fifo_head_partial_flushing = (fifo_count != '0) &&
+      !fifo_flushed[fifo_rd_ptr] && i_flush_en &&
+      is_younger(
+      fifo_tag[fifo_rd_ptr], i_flush_tag, i_rob_head_tag
+  );
+
+  // FIFO pop: adapter consumed, or head is flushed (auto-drain)
+  logic fifo_pop;
+  logic fifo_head_flushed;
+  assign fifo_head_flushed = fifo_valid[fifo_rd_ptr] &&
+      (fifo_flushed[fifo_rd_ptr] || fifo_head_partial_flushing);
+  assign fifo_pop = (fifo_count != '0) && (i_fmul_accepted || fifo_head_flushed);
+
+  always_ff @(posedge i_clk) begin
+    if (!i_rst_n) begin
+      for (int i = 0; i < FifoDepth; i++) begin
+        fifo_valid[i]   <= 1'b0;
+        fifo_flushed[i] <= 1'b0;
+      end
+      fifo_wr_ptr <= '0;
+      fifo_rd_ptr <= '0;
+      fifo_count  <= '0;
+    end else if (i_flush) begin
+      for (int i = 0; i < FifoDepth; i++) begin
+        fifo_valid[i]   <= 1'b0;
+        fifo_flushed[i] <= 1'b0;
+      end
+      fifo_wr_ptr <= '0;
+      fifo_rd_ptr <= '0;
+      fifo_count  <= '0;
+    end else begin
+      // Partial flush: mark younger FIFO entries as flushed
+      if (i_flush_en) begin
+        for (int i = 0; i < FifoDepth; i++) begin
+          if (fifo_valid[i] && !fifo_flushed[i] && is_younger(
+                  fifo_tag[i], i_flush_tag, i_rob_head_tag
+              )) begin
+            fifo_flushed[i] <= 1'b1;
+          end
+        end
+      end
+
+      // Push from the tag queue tail
+      if (fifo_push) begin
+        fifo_tag[fifo_wr_ptr]     <= tail_tag;
+        fifo_valid[fifo_wr_ptr]   <= 1'b1;
+        fifo_flushed[fifo_wr_ptr] <= 1'b0;
+        fifo_wr_ptr               <= fifo_wr_ptr + 1;
+      end
+
+      // Pop — advance rd_ptr only. fifo_valid / fifo_flushed stay set; they
+      // are only consulted gated by fifo_count (authoritative occupancy) and
+      // get overwritten on the next push to this slot, so clearing them here
+      // would only drag i_fmul_accepted (which depends on the arbiter grant
+      // through mispredict_recovery_pending → flush cone) into the fifo
+      // register cone.
+      if (fifo_pop) begin
+        fifo_rd_ptr <= fifo_rd_ptr + 1;
+      end
+
+      // Update count
+      case ({
+        fifo_push, fifo_pop
+      })
+        2'b10:   fifo_count <= fifo_count + 1;
+        2'b01:   fifo_count <= fifo_count - 1;
+        default: fifo_count <= fifo_count;
+      endcase
+    end
+  end
+
+  // ===========================================================================
+  // FIFO head output drives o_fu_complete
+  // ===========================================================================
+  always_comb begin
+    if (fifo_count != '0 && !fifo_flushed[fifo_rd_ptr] && !fifo_head_partial_flushing) begin
+      o_fu_complete.valid     = 1'b1;
+      o_fu_complete.tag       = fifo_tag[fifo_rd_ptr];
+      o_fu_complete.value     = fifo_value_rd;
+      o_fu_complete.exception = 1'b0;
+      o_fu_complete.exc_cause = riscv_pkg::exc_cause_t'('0);
+      o_fu_complete.fp_flags  = riscv_pkg::fp_flags_t'(fifo_flags_rd);
+    end else begin
+      o_fu_complete.valid     = 1'b0;
+      o_fu_complete.tag       = '0;
+      o_fu_complete.value     = '0;
+      o_fu_complete.exception = 1'b0;
+      o_fu_complete.exc_cause = riscv_pkg::exc_cause_t'('0);
+      o_fu_complete.fp_flags  = riscv_pkg::fp_flags_t'('0);
+    end
+  end
+
+  // ===========================================================================
+  // Busy signal: credit-based to prevent FIFO overflow
+  // ===========================================================================
+  // Count valid && !flushed tag queue entries (flushed ones never reach the
+  // FIFO, so they hold no credit)
+  logic [7:0] total_inflight;
+  always_comb begin
+    total_inflight = '0;
+    for (int i = 0; i < PipeDepth; i++) begin
+      if (tq_valid[i] && !tq_flushed[i]) total_inflight = total_inflight + 1;
+    end
+  end
+
+  logic [7:0] total_occupancy;
+  assign total_occupancy = total_inflight + 8'(fifo_count);
+  assign fmul_busy = total_occupancy >= 8'(FifoDepth);
+  assign o_fu_busy = fmul_busy;
+
   // ===========================================================================
   // Formal Verification
   // ===========================================================================
@@ -287,30 +453,28 @@ module fp_mul_shim (
     if (f_past_valid) assume (i_rst_n);
   end
 
-  always_comb begin
-    if (i_rst_n) begin
-      p_busy_implies_inflight : assert (!o_fu_busy || in_flight);
-    end
-  end
-
   always_comb begin
     if (i_rst_n && o_fu_complete.valid) begin
-      p_valid_has_tag : assert (o_fu_complete.tag == tag_reg);
+      p_valid_has_tag : assert (o_fu_complete.tag == fifo_tag[fifo_rd_ptr]);
     end
   end
 
-  always_comb begin
-    if (i_rst_n && flushed) begin
-      p_no_output_when_flushed : assert (!o_fu_complete.valid);
+  // Guard: the credit system must keep the FIFO from overflowing.
+  always @(posedge i_clk) begin
+    if (i_rst_n) begin
+      assert (fifo_count <= ($clog2(FifoDepth + 1))'(FifoDepth));
+      assert (!(fifo_push && fifo_count == ($clog2(FifoDepth + 1))'(FifoDepth)));
     end
   end
 
+  // Two-in-flight occupancy witness (the point of pipelining the unit)
   always @(posedge i_clk) begin
     if (i_rst_n) begin
-      cover_fire_mult : cover (fire && use_mult);
-      cover_fire_fma : cover (fire && use_fma);
+      cover_fire : cover (fire);
+      cover_fire_fmul : cover (fire && is_fmul);
+      cover_two_inflight : cover (total_inflight >= 8'd2);
       cover_complete : cover (o_fu_complete.valid);
-      cover_flush_inflight : cover (flush_inflight);
+      cover_flush_inflight : cover (i_flush_en && (total_inflight != '0));
     end
   end
 
@@ -5,6 +5,9 @@
 # DSP tiled multiplier (shared by ALU multiplier and FPU multiplier)
 $(ROOT)/hw/rtl/cpu_and_mem/cpu/ex_stage/dsp_tiled_multiplier_unsigned.sv
 
+# Pipelined DSP tiled multiplier (FMA mantissa multiply)
+$(ROOT)/hw/rtl/cpu_and_mem/cpu/ex_stage/dsp_tiled_multiplier_pipelined.sv
+
 # Small LUTRAM primitive used by shim result FIFOs
 $(ROOT)/hw/rtl/lib/ram/sdp_dist_ram.sv
 
@@ -23,7 +26,7 @@ $(ROOT)/hw/rtl/cpu_and_mem/cpu/tomasulo/fu_shims/int_muldiv_shim.sv
 # FP add/compare/classify/sgnj/convert shim (FP_RS -> subunits -> fu_complete_t)
 $(ROOT)/hw/rtl/cpu_and_mem/cpu/tomasulo/fu_shims/fp_add_shim.sv
 
-# FP multiply/FMA shim (FMUL_RS -> fpu_mult_unit/fpu_fma_unit -> fu_complete_t)
+# FP multiply/FMA shim (FMUL_RS -> fpu_fma_unit -> fu_complete_t)
 $(ROOT)/hw/rtl/cpu_and_mem/cpu/tomasulo/fu_shims/fp_mul_shim.sv
 
 # FP divide/sqrt shim (FDIV_RS -> fpu_div_sqrt_unit -> fu_complete_t)
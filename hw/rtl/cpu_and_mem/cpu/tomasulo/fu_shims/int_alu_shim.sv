@@ -49,6 +49,11 @@ module int_alu_shim (
     // CSR read data from external CSR file
     input logic [riscv_pkg::XLEN-1:0] i_csr_read_data,
 
+    // Speculative counter read port (CSRR_CNT): address of the issuing read
+    // and the combinational counter value back from the CSR file.
+    output logic [11:0] o_csr_counter_read_addr,
+    input logic [riscv_pkg::XLEN-1:0] i_csr_counter_read_data,
+
     // FU completion to CDB adapter
     output riscv_pkg::fu_complete_t o_fu_complete,
 
@@ -120,6 +125,13 @@ module int_alu_shim (
   logic is_any_csr_op;
   assign is_any_csr_op = is_csr_imm_op || is_csr_reg_op;
 
+  // CSRR_CNT: renamed pure read of a counter CSR (rewritten at dispatch).
+  // The counter value is read combinationally from the CSR file and completes
+  // on the CDB like any single-cycle ALU result — no commit-time CSR handshake.
+  logic is_csr_counter_read;
+  assign is_csr_counter_read = (i_rs_issue.op == riscv_pkg::CSRR_CNT);
+  assign o_csr_counter_read_addr = i_rs_issue.csr_addr;
+
   // ECALL/EBREAK: privileged instructions that should raise exceptions.
   // They flow through INT_RS like other ops, but the ALU doesn't produce
   // write_enable for them. Handle explicitly to produce CDB exception result.
@@ -148,6 +160,11 @@ module int_alu_shim (
           is_illegal_op ? riscv_pkg::ExcIllegalInstr[riscv_pkg::ExcCauseWidth-1:0] :
           is_ecall_op ? riscv_pkg::ExcEcallMmode[riscv_pkg::ExcCauseWidth-1:0] :
           riscv_pkg::ExcBreakpoint[riscv_pkg::ExcCauseWidth-1:0]);
+    end else if (is_csr_counter_read) begin
+      // Speculative counter read: the CDB value IS the architectural result.
+      o_fu_complete.value = {
+        {(riscv_pkg::FLEN - riscv_pkg::XLEN) {1'b0}}, i_csr_counter_read_data
+      };
     end else if (is_any_csr_op) begin
       // CSR: pass through the write operand (rs1 or zero-extended imm).
       // Actual CSR read/write is serialized at ROB commit time.
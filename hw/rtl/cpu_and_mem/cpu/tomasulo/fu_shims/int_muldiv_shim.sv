@@ -26,16 +26,27 @@
  *
  * Op decode:
  *   MUL, MULH, MULHSU, MULHU -> multiplier path (4-cycle latency, pipelined)
- *   DIV, DIVU, REM, REMU     -> divider path    (17-cycle latency, pipelined)
+ *   DIV, DIVU, REM, REMU     -> divider path    (9-cycle latency, pipelined)
+ *   PADD8/PSUB8/PADD16/PSUB16/PDOT8 (Zpn subset) -> multiplier path
+ *
+ * The packed SIMD ops share the MUL path's tracking, credits and result
+ * FIFO: their result is computed combinationally at issue and carried down
+ * a side shift register matching the multiplier's depth, then muxed in at
+ * completion. That wastes the multiplier for those cycles but keeps the
+ * packed ops fully pipelined with zero new control -- the lane adds and the
+ * quad-int8 dot product are far cheaper than the 4-cycle multiply array
+ * they displace.
  *
  * MUL path is fully pipelined: a 4-entry shift register tracks in-flight
  * multiplies (matching the multiplier's pipeline depth), and a 4-entry
  * result FIFO buffers completed results waiting for the CDB adapter.
  * Credit-based back-pressure prevents FIFO overflow.
  *
- * DIV path is fully pipelined: a 17-entry shift register tracks in-flight
- * divides, and a 4-entry result FIFO buffers completed results waiting for
- * the CDB adapter. Credit-based back-pressure prevents FIFO overflow.
+ * DIV path is fully pipelined: a shift register sized to the divider's
+ * pipeline depth (riscv_pkg::DivBitsPerStage derived, 9 entries by default)
+ * tracks in-flight divides, and a 4-entry result FIFO buffers completed
+ * results waiting for the CDB adapter. Credit-based back-pressure prevents
+ * FIFO overflow.
  */
 module int_muldiv_shim (
     input logic i_clk,
@@ -70,10 +81,13 @@ module int_muldiv_shim (
   logic is_mul;
   logic is_div;
   logic is_mul_low;  // 1 for MUL (low 32 bits), 0 for MULH/MULHSU/MULHU (high 32)
+  logic is_packed;  // Zpn subset: result comes from the packed lane unit
 
   always_comb begin
     case (i_rs_issue.op)
-      riscv_pkg::MUL, riscv_pkg::MULH, riscv_pkg::MULHSU, riscv_pkg::MULHU: begin
+      riscv_pkg::MUL, riscv_pkg::MULH, riscv_pkg::MULHSU, riscv_pkg::MULHU,
+      riscv_pkg::PADD8, riscv_pkg::PSUB8, riscv_pkg::PADD16, riscv_pkg::PSUB16,
+      riscv_pkg::PDOT8: begin
         is_mul = 1'b1;
         is_div = 1'b0;
       end
@@ -89,6 +103,63 @@ module int_muldiv_shim (
   end
   assign is_mul_low = (i_rs_issue.op == riscv_pkg::MUL);
 
+  always_comb begin
+    case (i_rs_issue.op)
+      riscv_pkg::PADD8, riscv_pkg::PSUB8, riscv_pkg::PADD16, riscv_pkg::PSUB16,
+      riscv_pkg::PDOT8:
+      is_packed = 1'b1;
+      default: is_packed = 1'b0;
+    endcase
+  end
+
+  // ---------------------------------------------------------------------------
+  // Packed SIMD lane unit (combinational at issue)
+  // ---------------------------------------------------------------------------
+  // Lane adds/subs are modular per lane (Zpn ADD8/SUB8/ADD16/SUB16). PDOT8 is
+  // the SMAQA dot product without the rd accumulation: four int8 products
+  // summed into 18 bits (4 x 16384 needs the extra bit), sign-extended to 32.
+  logic [31:0] packed_result;
+
+  always_comb begin
+    packed_result = '0;
+    unique case (i_rs_issue.op)
+      riscv_pkg::PADD8: begin
+        for (int lane = 0; lane < 4; lane++) begin
+          packed_result[8*lane+:8] = i_rs_issue.src1_value[8*lane+:8] +
+                                     i_rs_issue.src2_value[8*lane+:8];
+        end
+      end
+      riscv_pkg::PSUB8: begin
+        for (int lane = 0; lane < 4; lane++) begin
+          packed_result[8*lane+:8] = i_rs_issue.src1_value[8*lane+:8] -
+                                     i_rs_issue.src2_value[8*lane+:8];
+        end
+      end
+      riscv_pkg::PADD16: begin
+        for (int lane = 0; lane < 2; lane++) begin
+          packed_result[16*lane+:16] = i_rs_issue.src1_value[16*lane+:16] +
+                                       i_rs_issue.src2_value[16*lane+:16];
+        end
+      end
+      riscv_pkg::PSUB16: begin
+        for (int lane = 0; lane < 2; lane++) begin
+          packed_result[16*lane+:16] = i_rs_issue.src1_value[16*lane+:16] -
+                                       i_rs_issue.src2_value[16*lane+:16];
+        end
+      end
+      riscv_pkg::PDOT8: begin
+        logic signed [17:0] dot_sum;
+        dot_sum = '0;
+        for (int lane = 0; lane < 4; lane++) begin
+          dot_sum = dot_sum + (signed'(i_rs_issue.src1_value[8*lane+:8]) *
+                               signed'(i_rs_issue.src2_value[8*lane+:8]));
+        end
+        packed_result = {{14{dot_sum[17]}}, dot_sum};
+      end
+      default: ;
+    endcase
+  end
+
   // ---------------------------------------------------------------------------
   // Age comparison for partial flush
   // ---------------------------------------------------------------------------
@@ -145,7 +216,11 @@ module int_muldiv_shim (
   logic [63:0] mul_product;
   logic        mul_completing_next_cycle;  // unused
 
-  multiplier u_multiplier (
+  // EARLY_TERMINATE stays off: the positional mul_trk_* shift register below
+  // assumes every op takes exactly MulPipeDepth cycles.
+  multiplier #(
+      .EARLY_TERMINATE(1'b0)
+  ) u_multiplier (
       .i_clk                  (i_clk),
       .i_rst                  (~i_rst_n),
       .i_operand_a            (mul_operand_a),
@@ -162,10 +237,12 @@ module int_muldiv_shim (
   localparam int unsigned MulPipeDepth = 4;
 
   // Individual flat arrays avoid less portable unpacked-array-of-packed-struct storage.
-  logic            mul_trk_valid  [MulPipeDepth];
-  logic [TagW-1:0] mul_trk_tag    [MulPipeDepth];
-  logic            mul_trk_is_low [MulPipeDepth];  // 1 = MUL (low 32 bits), 0 = high
-  logic            mul_trk_flushed[MulPipeDepth];
+  logic            mul_trk_valid        [MulPipeDepth];
+  logic [TagW-1:0] mul_trk_tag          [MulPipeDepth];
+  logic            mul_trk_is_low       [MulPipeDepth];  // 1 = MUL (low 32 bits), 0 = high
+  logic            mul_trk_is_packed    [MulPipeDepth];  // 1 = take packed_result, not product
+  logic [    31:0] mul_trk_packed_result[MulPipeDepth];
+  logic            mul_trk_flushed      [MulPipeDepth];
 
   always_ff @(posedge i_clk) begin
     // --- Control: valid + flushed (with reset) ---
@@ -201,15 +278,19 @@ module int_muldiv_shim (
     end
   end
 
-  // --- Data: tag + is_low shift register (no reset) ---
+  // --- Data: tag + is_low + packed result shift register (no reset) ---
   always_ff @(posedge i_clk) begin
     for (int i = MulPipeDepth - 1; i >= 1; i--) begin
-      mul_trk_tag[i]    <= mul_trk_tag[i-1];
-      mul_trk_is_low[i] <= mul_trk_is_low[i-1];
+      mul_trk_tag[i]           <= mul_trk_tag[i-1];
+      mul_trk_is_low[i]        <= mul_trk_is_low[i-1];
+      mul_trk_is_packed[i]     <= mul_trk_is_packed[i-1];
+      mul_trk_packed_result[i] <= mul_trk_packed_result[i-1];
     end
     if (multiplier_valid_input) begin
-      mul_trk_tag[0]    <= i_rs_issue.rob_tag;
-      mul_trk_is_low[0] <= is_mul_low;
+      mul_trk_tag[0]           <= i_rs_issue.rob_tag;
+      mul_trk_is_low[0]        <= is_mul_low;
+      mul_trk_is_packed[0]     <= is_packed;
+      mul_trk_packed_result[0] <= packed_result;
     end
   end
 
@@ -261,9 +342,12 @@ module int_muldiv_shim (
   logic mul_completing;
   assign mul_completing = mul_trk_valid[MulPipeDepth-1] && !mul_trk_flushed[MulPipeDepth-1];
 
-  // Result selection from tracker tail (MUL low vs MULH/MULHSU/MULHU high)
+  // Result selection from tracker tail (packed lane result, MUL low, or
+  // MULH/MULHSU/MULHU high)
   logic [31:0] mul_result_32;
-  assign mul_result_32 = mul_trk_is_low[MulPipeDepth-1] ? mul_product[31:0] : mul_product[63:32];
+  assign mul_result_32 = mul_trk_is_packed[MulPipeDepth-1] ?
+      mul_trk_packed_result[MulPipeDepth-1] :
+      (mul_trk_is_low[MulPipeDepth-1] ? mul_product[31:0] : mul_product[63:32]);
   assign mul_fifo_value_wr_data = {{(riscv_pkg::FLEN - riscv_pkg::XLEN) {1'b0}}, mul_result_32};
 
   // Same-cycle flush of a young entry being pushed — compute once and reuse
@@ -409,9 +493,9 @@ module int_muldiv_shim (
   );
 
   // ---------------------------------------------------------------------------
-  // DIV inflight shift register (17 entries, matching divider pipeline depth)
+  // DIV inflight shift register (matching divider pipeline depth)
   // ---------------------------------------------------------------------------
-  localparam int unsigned DivPipeDepth = riscv_pkg::XLEN / 2 + 1;  // 17
+  localparam int unsigned DivPipeDepth = riscv_pkg::XLEN / riscv_pkg::DivBitsPerStage + 1;  // 9
 
   // Individual flat arrays avoid less portable unpacked-array-of-packed-struct storage.
   logic            div_trk_valid  [DivPipeDepth];
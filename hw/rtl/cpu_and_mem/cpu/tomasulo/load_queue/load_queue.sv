@@ -26,6 +26,9 @@
  *   - Oldest-first priority scan for issue selection
  *   - Two-phase FLD support (64-bit double on 32-bit bus)
  *   - Store-to-load forwarding via SQ disambiguation interface
+ *   - Memory dependence speculation: predicted-independent loads start their
+ *     cached-tier access as an L0 prefetch while older store addresses are
+ *     still unresolved (value-safe -- see spec_prefetch_fire)
  *   - MMIO loads execute only at ROB head (non-speculative)
  *   - Partial flush (age-based) and full flush support
  *   - CDB back-pressure via i_adapter_result_pending
@@ -48,7 +51,29 @@
 module load_queue #(
     parameter int unsigned DEPTH = riscv_pkg::LqDepth,  // 8
     parameter bit ENABLE_L0_FAST_PATH = 1'b1,
-    parameter bit ENABLE_SQ_FORWARD_FAST_PATH = 1'b0,
+    // Store-to-load forwarding consumption. Covers exact-match forwards,
+    // multi-entry byte-lane assembly (byte/halfword stores feeding a word
+    // load), and partial store coverage merged with L0 cache data. Forwarding
+    // waits for all older store addresses to resolve (i_sq_all_older_addrs_
+    // known) so a still-unknown older store can never be the true newest
+    // writer of a forwarded byte.
+    parameter bit ENABLE_SQ_FORWARD_FAST_PATH = 1'b1,
+    // Memory dependence speculation: a load whose only blocker is older stores
+    // with unresolved addresses may start its cached-tier access early as an
+    // L0 prefetch, throttled by a global alias-confidence counter. The
+    // architectural read still happens on the normal disambiguated path
+    // (usually as an L0 hit on the prefetched line), so no misspeculated value
+    // ever reaches the CDB and a wrong prediction costs only cached-tier
+    // bandwidth. See the Memory Dependence Speculation section.
+    parameter bit ENABLE_MEM_DEP_SPECULATION = 1'b1,
+    // Cached-tier AMO read-modify-write: a cached-region AMO launches its read
+    // with the op/rs2 operand riding alongside, and the cached_tier_adapter
+    // applies the new value at the cache the cycle the old word returns -- one
+    // cache round trip instead of read + separate no-combine write. The LQ then
+    // completes the AMO like a plain load off its own response (no
+    // AMO_WRITE_ACTIVE phase); BRAM/MMIO AMOs keep the two-phase path, whose
+    // done is combinational anyway. See the AMO sections below and the adapter.
+    parameter bit ENABLE_AMO_CACHE_RMW = 1'b1,
     // Cached memory tier (high-address region). A load whose address falls in
     // [CACHED_BASE, CACHED_BASE+CACHED_SIZE_BYTES) is served by the multi-cycle
     // cached tier. Only while such a load is in flight (slow_outstanding) does
@@ -121,6 +146,14 @@ module load_queue #(
     output logic                                       o_mem_addr_valid,
     output logic                 [riscv_pkg::XLEN-1:0] o_mem_read_addr,
     output riscv_pkg::mem_size_e                       o_mem_read_size,
+    // Cached-tier AMO RMW sideband: qualifies o_mem_read_en on the launch cycle
+    // of a cached AMO's read. The router forwards op/operand to the
+    // cached_tier_adapter, which applies the new value at the cache when the
+    // old word comes back. Never asserted for BRAM/MMIO AMOs (two-phase path)
+    // or when ENABLE_AMO_CACHE_RMW is off.
+    output logic                                       o_mem_read_is_amo,
+    output riscv_pkg::instr_op_e                       o_mem_amo_op,
+    output logic                 [riscv_pkg::XLEN-1:0] o_mem_amo_operand,
     input  logic                 [riscv_pkg::XLEN-1:0] i_mem_read_data,
     input  logic                                       i_mem_read_valid,
     input  logic                                       i_mem_bus_busy,
@@ -311,6 +344,7 @@ module load_queue #(
   logic [                 XLEN-1:0] lq_address_amo_rd;
   logic [                 XLEN-1:0] lq_amo_rs2_rd;
   logic [             IdxWidth-1:0] amo_entry_idx;
+  logic [             IdxWidth-1:0] amo_payload_rd_idx;
   logic                             full;
   logic                             full_for_2;
 
@@ -328,6 +362,12 @@ module load_queue #(
   // AMO op is written once at allocation and only read back for AMO execution.
   // 2 write ports: slot-1 alloc (port 0) + slot-2 alloc (port 1).  Port 1
   // writes when a slot-2 load allocates in the same cycle as slot-1.
+  // Read address: the response-captured amo_entry_idx during the two-phase
+  // write window, otherwise the staged sq_check candidate so a cached AMO's
+  // op/rs2 ride out with its read launch (RMW sideband). The mux select is a
+  // registered 1-bit state compare and the read feeds only the sideband
+  // output ports (which land on the adapter's capture flops) and the
+  // registered AMO write drive -- never the BRAM address cone.
   mwp_dist_ram #(
       .ADDR_WIDTH     (IdxWidth),
       .DATA_WIDTH     (InstrOpWidth),
@@ -337,7 +377,7 @@ module load_queue #(
       .i_write_enable ({slot2_alloc_en, slot1_alloc_en}),
       .i_write_address({slot2_alloc_idx, alloc_target[IdxWidth-1:0]}),
       .i_write_data   ({i_alloc_2.amo_op, i_alloc.amo_op}),
-      .i_read_address (amo_entry_idx),
+      .i_read_address (amo_payload_rd_idx),
       .o_read_data    (lq_amo_op_rd)
   );
 
@@ -420,6 +460,17 @@ module load_queue #(
   logic issue_mem_found;  // Phase B: entry ready for memory
   logic [IdxWidth-1:0] issue_mem_idx;
   logic [IdxWidth-1:0] issue_mem_stored_idx;
+
+  // Secondary L0-lookup candidates (from lq_issue_selector) and the resolved
+  // second-port pick — see the dual load resolve section below.
+  logic l0_cand_found;
+  logic [IdxWidth-1:0] l0_cand_idx;
+  logic l0_cand2_found;
+  logic [IdxWidth-1:0] l0_cand2_idx;
+  logic l0b_cand_valid;
+  logic [IdxWidth-1:0] l0b_cand_idx;
+  logic [XLEN-1:0] lq_address_l0b_rd;
+  logic l0_dual_fire;
   logic issue_mem_from_update;
   logic [XLEN-1:0] issue_mem_addr;
   logic block_younger_mem;
@@ -500,6 +551,10 @@ module load_queue #(
   logic issued_is_fp;
   logic issued_is_lr;
   logic issued_is_amo;
+  // The outstanding AMO read carried the RMW sideband (cached tier + RMW
+  // enabled): the adapter applies the write at the cache, so the response
+  // completes the AMO directly and AMO_WRITE_ACTIVE is skipped.
+  logic issued_amo_rmw;
   logic issued_is_mmio;
   // Snapshot of "the outstanding load targets the cached tier", captured at launch
   // alongside issued_addr. Used to clear slow_outstanding when the cached response
@@ -518,6 +573,9 @@ module load_queue #(
   logic slow_outstanding;
   logic issued_cached_line_invalidated;
   logic issued_cached_line_invalidate_now;
+  // The outstanding memory access is a dependence-speculative L0 prefetch:
+  // its only architectural effect is the cache fill. See spec_prefetch_fire.
+  logic spec_issued_q;
 
   // Load unit wires
   logic [XLEN-1:0] lu_data_out;
@@ -557,6 +615,18 @@ module load_queue #(
       .o_read_data    (lq_address_issue_mem_rd)
   );
 
+  sdp_dist_ram #(
+      .ADDR_WIDTH(IdxWidth),
+      .DATA_WIDTH(XLEN)
+  ) u_lq_address_l0b (
+      .i_clk,
+      .i_write_enable (lq_addr_update_we),
+      .i_write_address(lq_addr_update_idx),
+      .i_write_data   (i_addr_update.address),
+      .i_read_address (l0b_cand_idx),
+      .o_read_data    (lq_address_l0b_rd)
+  );
+
   sdp_dist_ram #(
       .ADDR_WIDTH(IdxWidth),
       .DATA_WIDTH(XLEN)
@@ -577,36 +647,30 @@ module load_queue #(
       .i_write_enable (lq_addr_update_we),
       .i_write_address(lq_addr_update_idx),
       .i_write_data   (i_addr_update.amo_rs2),
-      .i_read_address (amo_entry_idx),
+      .i_read_address (amo_payload_rd_idx),
       .o_read_data    (lq_amo_rs2_rd)
   );
 
-  // ===========================================================================
-  // AMO ALU (combinational)
-  // ===========================================================================
-  function automatic logic [XLEN-1:0] amo_compute(
-      input riscv_pkg::instr_op_e op, input logic [XLEN-1:0] old_val, input logic [XLEN-1:0] rs2);
-    case (op)
-      riscv_pkg::AMOSWAP_W: amo_compute = rs2;
-      riscv_pkg::AMOADD_W:  amo_compute = old_val + rs2;
-      riscv_pkg::AMOXOR_W:  amo_compute = old_val ^ rs2;
-      riscv_pkg::AMOAND_W:  amo_compute = old_val & rs2;
-      riscv_pkg::AMOOR_W:   amo_compute = old_val | rs2;
-      riscv_pkg::AMOMIN_W:  amo_compute = ($signed(old_val) < $signed(rs2)) ? old_val : rs2;
-      riscv_pkg::AMOMAX_W:  amo_compute = ($signed(old_val) > $signed(rs2)) ? old_val : rs2;
-      riscv_pkg::AMOMINU_W: amo_compute = (old_val < rs2) ? old_val : rs2;
-      riscv_pkg::AMOMAXU_W: amo_compute = (old_val > rs2) ? old_val : rs2;
-      default:              amo_compute = old_val;
-    endcase
-  endfunction
+  // AMO payload (op / rs2) LUTRAM read index: the response-captured entry
+  // during the two-phase write window, the staged candidate otherwise (so a
+  // launching cached AMO exports its op/operand on the RMW sideband). The AMO
+  // ALU itself (riscv_pkg::amo_compute) is shared with the cached_tier_adapter,
+  // which applies the new value at the cache for the RMW path.
+  assign amo_payload_rd_idx = (amo_state == AMO_WRITE_ACTIVE) ? amo_entry_idx : sq_check_idx;
 
   // AMO write interface signals
   logic amo_write_pending;
   logic [XLEN-1:0] amo_new_value;
 
-  // AMO cache invalidation: invalidate L0 cache when AMO write completes
+  // AMO cache invalidation: invalidate L0 on write completion (two-phase
+  // path), or on the response of a cached RMW AMO -- the adapter commits the
+  // modified word at the cache that cycle, so the L0's copy of the line goes
+  // stale at the same edge.
+  logic amo_rmw_resp;
+  assign amo_rmw_resp = accept_mem_response && issued_is_amo && issued_amo_rmw;
   logic amo_cache_inv;
-  assign amo_cache_inv = (amo_state == AMO_WRITE_ACTIVE) && i_amo_mem_write_done;
+  assign amo_cache_inv = ((amo_state == AMO_WRITE_ACTIVE) && i_amo_mem_write_done) ||
+      amo_rmw_resp;
   assign issued_cached_line_invalidate_now =
       mem_outstanding && issued_is_cached && i_cache_invalidate_valid &&
       (i_cache_invalidate_addr[XLEN-1:2] == issued_addr[XLEN-1:2]);
@@ -787,7 +851,11 @@ module load_queue #(
       .o_head_mem_stored_rob_tag(head_mem_stored_rob_tag),
       .o_head_mem_update_found(head_mem_update_found),
       .o_head_mem_update_idx(head_mem_update_idx),
-      .o_head_mem_update_rob_tag(head_mem_update_rob_tag)
+      .o_head_mem_update_rob_tag(head_mem_update_rob_tag),
+      .o_l0_cand_found(l0_cand_found),
+      .o_l0_cand_idx(l0_cand_idx),
+      .o_l0_cand2_found(l0_cand2_found),
+      .o_l0_cand2_idx(l0_cand2_idx)
   );
 
   // scan_idx recomputed locally for the head-load diagnostics below; the
@@ -1070,6 +1138,22 @@ module load_queue #(
       sq_check_rob_tag_q, issue_mem_rob_tag, i_rob_head_tag
   ));
 
+  // Secondary L0 candidate pick: skip whichever candidate the primary path
+  // has selected for sq_check this cycle (equal index means the same physical
+  // entry).  Keyed off issue_mem_found rather than the actual
+  // capture/replace gates — when the capture is blocked (bus busy, flush)
+  // this conservatively completes the second-oldest candidate instead of the
+  // oldest, which is harmless, and it keeps the capture-control cone
+  // (i_mem_bus_busy, flush, drop_mem_response_pending) off the
+  // u_lq_address_l0b LUTRAM read address.  From the RAM the cone runs through
+  // the L0 second lookup port into the lq_data write ports, never into the
+  // data-memory address pins.
+  logic l0b_pick_second;
+  assign l0b_pick_second = issue_mem_found && l0_cand_found &&
+      (l0_cand_idx == issue_mem_idx);
+  assign l0b_cand_valid = l0b_pick_second ? l0_cand2_found : l0_cand_found;
+  assign l0b_cand_idx = l0b_pick_second ? l0_cand2_idx : l0_cand_idx;
+
   // Always output registered check parameters regardless of valid.  The SQ
   // gates on i_sq_check_valid at its output register (o_sq_forward.match <=
   // i_sq_check_valid ? fwd_found_match : 1'b0), so stale values are harmless.
@@ -1112,6 +1196,8 @@ module load_queue #(
   logic [XLEN-1:0] launch_mem_issue_addr;
   riscv_pkg::mem_size_e launch_mem_issue_size;
   logic cache_hit_fast_path;
+  logic sq_partial_forward_ok;
+  logic spec_prefetch_fire;
   logic [XLEN-1:0] stage_mem_issue_addr;
   riscv_pkg::mem_size_e stage_mem_issue_size;
   logic sq_no_older_store;
@@ -1122,11 +1208,17 @@ module load_queue #(
       !sq_check_misaligned &&
       !sq_commit_interlock &&
       (sq_no_older_store || (i_sq_all_older_addrs_known && !i_sq_forward.match));
+  // Forwarding requires all older store addresses known: the per-lane winner
+  // select (and the exact-match pick) only sees resolved addresses, so an
+  // unresolved older store could otherwise be the true newest writer of a
+  // forwarded byte. sq_partial_forward_ok adds the store+L0 merge case for
+  // loads the stores only partially cover.
   assign sq_do_forward = ENABLE_SQ_FORWARD_FAST_PATH
       && sq_check_phase2 && sq_check_entry_issueable && !sq_no_older_store &&
       !sq_check_misaligned &&
       !sq_commit_interlock &&
-      i_sq_forward.can_forward
+      i_sq_all_older_addrs_known &&
+      (i_sq_forward.can_forward || sq_partial_forward_ok)
       && !sq_check_is_mmio_q && !sq_check_is_lr_q && !sq_check_is_amo_q;
   assign flush_all_entries = i_flush_en && !i_early_recovery_flush &&
       (i_rob_head_tag == (i_flush_tag + ReorderBufferTagWidth'(1)));
@@ -1170,12 +1262,19 @@ module load_queue #(
   // ===========================================================================
   logic            cache_lookup_hit;
   logic [XLEN-1:0] cache_lookup_data;
+  logic            cache_lookup2_hit;
+  logic [XLEN-1:0] cache_lookup2_data;
   logic            cache_fill_valid;
   logic [XLEN-1:0] cache_fill_addr;
   logic [XLEN-1:0] cache_fill_data;
 
+  // 128 sets x 2 ways = 256 words (1 KiB): enough for the common FreeRTOS
+  // stack-frame + working-array footprint to stay resident, and the second
+  // way absorbs the stack-vs-array index conflicts that thrashed the
+  // direct-mapped 128-entry configuration.
   lq_l0_cache #(
-      .DEPTH    (128),
+      .NUM_SETS (128),
+      .NUM_WAYS (2),
       .XLEN     (XLEN),
       .MMIO_ADDR(32'h4000_0000)
   ) u_l0_cache (
@@ -1189,14 +1288,23 @@ module load_queue #(
       .o_lookup_hit (cache_lookup_hit),
       .o_lookup_data(cache_lookup_data),
 
+      // Second lookup: the selector's secondary plain-load candidate, for the
+      // dual load resolve path (see l0_dual_fire below).
+      .i_lookup2_addr(lq_address_l0b_rd),
+      .o_lookup2_hit (cache_lookup2_hit),
+      .o_lookup2_data(cache_lookup2_data),
+
       // Fill: on memory response
       .i_fill_valid(cache_fill_valid),
       .i_fill_addr (cache_fill_addr),
       .i_fill_data (cache_fill_data),
 
-      // Invalidation (from SQ or AMO write completion)
+      // Invalidation (from SQ, AMO write completion, or cached-RMW response).
+      // A cached RMW AMO invalidates off the issued-address snapshot (its
+      // write committed at the cache, not through the two-phase write port).
       .i_invalidate_valid(i_cache_invalidate_valid || amo_cache_inv),
-      .i_invalidate_addr (amo_cache_inv ? lq_address_amo_rd : i_cache_invalidate_addr),
+      .i_invalidate_addr (amo_rmw_resp ? issued_addr :
+                          amo_cache_inv ? lq_address_amo_rd : i_cache_invalidate_addr),
 
       // Only SQ/store invalidation must suppress same-cycle L0 lookup hits.
       // AMO write completion is serialized at ROB head and blocks younger
@@ -1306,10 +1414,22 @@ module load_queue #(
   assign launching_is_cached = is_cached_addr(launch_mem_issue_addr);
 
   // Memory issue: bypass the staging register when the port is already free.
+  // A dependence-speculative prefetch drives the same cone: it is mutually
+  // exclusive with launch_mem_issue (it requires the disambiguation-blocked
+  // condition that makes sq_can_issue false) and reads the same staged
+  // address/size registers (it gates out the FLD phase-1 +4 case).
   always_comb begin
-    o_mem_read_en   = launch_mem_issue;
+    o_mem_read_en   = launch_mem_issue || spec_prefetch_fire;
     o_mem_read_addr = launch_mem_issue_addr;
     o_mem_read_size = launch_mem_issue_size;
+    // Cached-tier AMO RMW sideband. A speculative prefetch can never be an AMO
+    // (the spec-candidate mask excludes them), so launch_mem_issue alone
+    // qualifies. The op/rs2 LUTRAMs read the staged candidate this cycle
+    // (amo_payload_rd_idx) and the sideband lands on the adapter's capture
+    // flops, so nothing here touches the BRAM address cone.
+    o_mem_read_is_amo = ENABLE_AMO_CACHE_RMW && launch_mem_issue && sq_check_is_amo_q;
+    o_mem_amo_op      = riscv_pkg::instr_op_e'(lq_amo_op_rd);
+    o_mem_amo_operand = lq_amo_rs2_rd;
   end
 
   // Load unit for cache hit path: feed cache data through load unit
@@ -1334,6 +1454,126 @@ module load_queue #(
     lu_cache_is_unsigned = !sq_check_sign_ext_q;
   end
 
+  // ===========================================================================
+  // Partial-overlap forward merge (store bytes + L0 cache word)
+  // ===========================================================================
+  // When older stores cover only some of the load's bytes (fwd_bytes) and no
+  // covering store is unforwardable (blocked_bytes), the remaining bytes can
+  // come from an L0 hit: L0 reflects committed memory, which is exactly what
+  // a byte no older store writes must read. The bus-busy gate mirrors
+  // cache_hit_fast_path -- an SQ/AMO write can own the port one cycle before
+  // its L0 invalidation is visible. FLD stays on the exact-match path (the
+  // lane masks model a single word).
+  logic [3:0] fwd_needed_bytes;
+  logic [XLEN-1:0] fwd_merge_word;
+  logic [XLEN-1:0] lu_fwd_out;
+
+  always_comb begin
+    unique case (sq_check_size_q)
+      riscv_pkg::MEM_SIZE_BYTE: fwd_needed_bytes = 4'b0001 << sq_check_addr_q[1:0];
+      riscv_pkg::MEM_SIZE_HALF: fwd_needed_bytes = sq_check_addr_q[1] ? 4'b1100 : 4'b0011;
+      default:                  fwd_needed_bytes = 4'b1111;
+    endcase
+  end
+
+  assign sq_partial_forward_ok = i_sq_forward.match && !i_sq_forward.can_forward &&
+      cache_lookup_hit && !i_mem_bus_busy &&
+      (sq_check_size_q != riscv_pkg::MEM_SIZE_DOUBLE) &&
+      ((fwd_needed_bytes & i_sq_forward.blocked_bytes) == 4'b0000);
+
+  // Forwarded bytes win over the cache word; lanes in neither source are
+  // never extracted (fwd_needed_bytes is full-cover only via can_forward,
+  // where every lane is forwarded).
+  always_comb begin
+    for (int unsigned b = 0; b < 4; b++) begin
+      fwd_merge_word[8*b+:8] = i_sq_forward.fwd_bytes[b] ?
+          i_sq_forward.data[8*b+:8] : cache_lookup_data[8*b+:8];
+    end
+  end
+
+  // Forward-path byte/half extraction, mirroring u_cache_load_unit (the size
+  // decode is shared -- both paths serve the same staged candidate).
+  load_unit u_fwd_load_unit (
+      .i_is_load_byte           (lu_cache_is_byte),
+      .i_is_load_halfword       (lu_cache_is_half),
+      .i_is_load_unsigned       (lu_cache_is_unsigned),
+      .i_data_memory_address    (sq_check_addr_q),
+      .i_data_memory_read_data  (fwd_merge_word),
+      .o_data_loaded_from_memory(lu_fwd_out)
+  );
+
+  // ===========================================================================
+  // Secondary L0 completion (dual load resolve)
+  // ===========================================================================
+  // The sq_check staging register is a single load issue port: one load per
+  // cycle can disambiguate against the SQ and complete (L0 hit, forward, or
+  // launch). Unrolled FP loops (DAXPY-style) generate two loads per cycle
+  // from the 2-wide front end and are load-bandwidth-bound on that port.
+  // When the SQ is completely empty, disambiguation is trivially satisfied
+  // for every load — so a second plain candidate can complete straight from
+  // the L0's second lookup port without touching sq_check at all. Combined
+  // with the primary path (hit or launch) this resolves two loads per cycle
+  // in the store-free steady state.
+  //
+  // Safety argument for skipping SQ disambiguation: i_sq_empty means no
+  // dispatched store is older than any current LQ entry (stores allocate
+  // their SQ slot at dispatch, and a candidate needs a registered address,
+  // so any older store is visible in i_sq_empty at least a cycle before the
+  // candidate becomes eligible). Empty also implies no committed store is
+  // draining, so no invalidation race; the same-cycle lookup-invalidate
+  // suppression is wired to port 2 regardless. Pending AMOs are excluded by
+  // the selector's blocked_by_amo term — the candidate mask stays empty
+  // through the AMO write-completion cycle itself (data_valid is only set at
+  // that edge), so the completion-edge L0 invalidation can never race a
+  // second-port hit — and i_mem_bus_busy covers the bus-write cycle.
+  //
+  // FLD is excluded (two-phase on the 32-bit bus, same as the primary fast
+  // path); misaligned candidates stay on the primary path so the exception
+  // machinery (misalign_bypass_fire) sees them. No cdb_stage bypass: the
+  // completed entry takes the standard Phase A data_valid route, which is
+  // already capable of one CDB completion per cycle alongside this write.
+  // The write lands on whichever lq_data port is free this cycle: port 0
+  // when no memory response is arriving (the common case in the all-hits
+  // steady state, where nothing is in flight), otherwise port 1 when the
+  // primary completion sources leave it idle. Requiring a free port in the
+  // fire term keeps the if-else priorities in the write logic below exact.
+  logic lq_data_port1_busy;
+  assign lq_data_port1_busy = cache_hit_fast_path || sq_do_forward ||
+      (amo_state == AMO_WRITE_ACTIVE && i_amo_mem_write_done);
+
+  assign l0_dual_fire = ENABLE_L0_FAST_PATH
+      && !i_flush_all && !i_flush_en
+      && !i_mem_bus_busy
+      && i_sq_empty
+      && l0b_cand_valid
+      && cache_lookup2_hit
+      && (!accept_mem_response || !lq_data_port1_busy)
+      && (riscv_pkg::mem_size_e'(lq_size[l0b_cand_idx]) != riscv_pkg::MEM_SIZE_DOUBLE)
+      && !(i_trap_misaligned_accesses && is_load_misaligned(
+          riscv_pkg::mem_size_e'(lq_size[l0b_cand_idx]), lq_address_l0b_rd
+      ));
+
+  // Byte/half extraction for the second port, mirroring u_cache_load_unit.
+  logic [XLEN-1:0] lu_l0b_out;
+  logic lu_l0b_is_byte;
+  logic lu_l0b_is_half;
+  logic lu_l0b_is_unsigned;
+
+  always_comb begin
+    lu_l0b_is_byte = (riscv_pkg::mem_size_e'(lq_size[l0b_cand_idx]) == riscv_pkg::MEM_SIZE_BYTE);
+    lu_l0b_is_half = (riscv_pkg::mem_size_e'(lq_size[l0b_cand_idx]) == riscv_pkg::MEM_SIZE_HALF);
+    lu_l0b_is_unsigned = !lq_sign_ext[l0b_cand_idx];
+  end
+
+  load_unit u_l0b_load_unit (
+      .i_is_load_byte           (lu_l0b_is_byte),
+      .i_is_load_halfword       (lu_l0b_is_half),
+      .i_is_load_unsigned       (lu_l0b_is_unsigned),
+      .i_data_memory_address    (lq_address_l0b_rd),
+      .i_data_memory_read_data  (cache_lookup2_data),
+      .o_data_loaded_from_memory(lu_l0b_out)
+  );
+
   // ===========================================================================
   // lq_data LUTRAM Write Logic (combinational)
   // ===========================================================================
@@ -1348,39 +1588,55 @@ module load_queue #(
     lq_data_hi_wd   = '0;
 
     // ---------------------------------------------------------------
-    // Port 0: dedicated to memory response.
+    // Port 0: memory response first, secondary L0 completion otherwise.
     //         With back-to-back launches enabled, mem response can fire
     //         every cycle. It owns its own port so a same-cycle cache hit
     //         (or SQ forward) on a different entry cannot clobber the
-    //         response data via if-else priority.
+    //         response data via if-else priority. On response-free cycles
+    //         the port is lent to the secondary L0 completion, which is
+    //         what lets a second load resolve alongside a primary cache
+    //         hit in the store-free steady state.
     // ---------------------------------------------------------------
-    if (i_rst_n && !i_flush_all && accept_mem_response) begin
-      lq_data_wr_addr[0] = issued_idx;
-      if (issued_is_amo) begin
-        // AMO read: don't write data yet (port 1 handles after AMO write)
-      end else if (issued_is_fp
-                   && riscv_pkg::mem_size_e'(issued_size) == riscv_pkg::MEM_SIZE_DOUBLE
-                   && !issued_fp64_phase) begin
-        // FLD phase 0: write lo only
-        lq_data_lo_we[0] = 1'b1;
-        lq_data_lo_wd[0] = lu_data_out;
-      end else if (issued_is_fp
-                   && riscv_pkg::mem_size_e'(issued_size) == riscv_pkg::MEM_SIZE_DOUBLE
-                   && issued_fp64_phase) begin
-        // FLD phase 1: write hi only
-        lq_data_hi_we[0] = 1'b1;
-        lq_data_hi_wd[0] = i_mem_read_data;
-      end else begin
-        // LR / Non-FLD: write lo, clear hi
-        lq_data_lo_we[0] = 1'b1;
-        lq_data_hi_we[0] = 1'b1;
-        lq_data_lo_wd[0] = lu_data_out;
-        lq_data_hi_wd[0] = '0;
+    if (i_rst_n && !i_flush_all) begin
+      if (accept_mem_response) begin
+        lq_data_wr_addr[0] = issued_idx;
+        if (issued_is_amo && !issued_amo_rmw) begin
+          // Two-phase AMO read: don't write data yet (port 1 handles after
+          // AMO write). A cached RMW AMO's response IS its old value -- the
+          // adapter committed the write at the cache -- so it falls through
+          // to the standard word write below.
+        end else if (issued_is_fp
+                     && riscv_pkg::mem_size_e'(issued_size) == riscv_pkg::MEM_SIZE_DOUBLE
+                     && !issued_fp64_phase) begin
+          // FLD phase 0: write lo only
+          lq_data_lo_we[0] = 1'b1;
+          lq_data_lo_wd[0] = lu_data_out;
+        end else if (issued_is_fp
+                     && riscv_pkg::mem_size_e'(issued_size) == riscv_pkg::MEM_SIZE_DOUBLE
+                     && issued_fp64_phase) begin
+          // FLD phase 1: write hi only
+          lq_data_hi_we[0] = 1'b1;
+          lq_data_hi_wd[0] = i_mem_read_data;
+        end else begin
+          // LR / Non-FLD: write lo, clear hi
+          lq_data_lo_we[0] = 1'b1;
+          lq_data_hi_we[0] = 1'b1;
+          lq_data_lo_wd[0] = lu_data_out;
+          lq_data_hi_wd[0] = '0;
+        end
+      end else if (l0_dual_fire) begin
+        // Secondary L0 completion on the free response port. FLW keeps the
+        // raw word and NaN-boxes at CDB formatting, like the primary path.
+        lq_data_lo_we[0]   = 1'b1;
+        lq_data_hi_we[0]   = 1'b1;
+        lq_data_wr_addr[0] = l0b_cand_idx;
+        lq_data_lo_wd[0]   = lq_is_fp[l0b_cand_idx] ? cache_lookup2_data : lu_l0b_out;
+        lq_data_hi_wd[0]   = '0;
       end
     end
 
     // ---------------------------------------------------------------
-    // Port 1: cache hit / SQ forward / AMO write completion.
+    // Port 1: cache hit / SQ forward / AMO write completion / secondary L0.
     //         These three sources are mutually exclusive in time:
     //           - cache_hit and sq_forward each require sq_check_pending
     //             on a non-AMO entry. While amo_state == AMO_WRITE_ACTIVE
@@ -1401,14 +1657,33 @@ module load_queue #(
         lq_data_lo_we[1]   = 1'b1;
         lq_data_hi_we[1]   = 1'b1;
         lq_data_wr_addr[1] = sq_check_idx;
-        lq_data_lo_wd[1]   = i_sq_forward.data[XLEN-1:0];
-        lq_data_hi_wd[1]   = i_sq_forward.data[FLEN-1:XLEN];
+        if (sq_check_size_q == riscv_pkg::MEM_SIZE_DOUBLE) begin
+          // FLD exact-match forward: raw 64-bit store data.
+          lq_data_lo_wd[1] = i_sq_forward.data[XLEN-1:0];
+          lq_data_hi_wd[1] = i_sq_forward.data[FLEN-1:XLEN];
+        end else begin
+          // Word/sub-word: merged store+L0 word through the forward-path
+          // load_unit (byte/half extraction + sign extension); FLW keeps the
+          // raw word and NaN-boxes at CDB formatting like the cache path.
+          lq_data_lo_wd[1] = sq_check_is_fp_q ? fwd_merge_word : lu_fwd_out;
+          lq_data_hi_wd[1] = '0;
+        end
       end else if (amo_state == AMO_WRITE_ACTIVE && i_amo_mem_write_done) begin
         lq_data_lo_we[1]   = 1'b1;
         lq_data_hi_we[1]   = 1'b1;
         lq_data_wr_addr[1] = amo_entry_idx;
         lq_data_lo_wd[1]   = amo_old_value;
         lq_data_hi_wd[1]   = '0;
+      end else if (l0_dual_fire && accept_mem_response) begin
+        // Secondary L0 completion spilling onto port 1: only when a memory
+        // response holds port 0 AND the three sources above leave this port
+        // idle (the fire term requires one of the two ports free), so the
+        // if-else priorities on both ports stay exact.
+        lq_data_lo_we[1]   = 1'b1;
+        lq_data_hi_we[1]   = 1'b1;
+        lq_data_wr_addr[1] = l0b_cand_idx;
+        lq_data_lo_wd[1]   = lq_is_fp[l0b_cand_idx] ? cache_lookup2_data : lu_l0b_out;
+        lq_data_hi_wd[1]   = '0;
       end
     end
   end
@@ -1427,13 +1702,125 @@ module load_queue #(
   assign cache_fill_addr = issued_addr;
   assign cache_fill_data = i_mem_read_data;
 
-  // L0 cache profile pulses (one cycle when the event fires)
-  assign o_l0_hit = cache_hit_fast_path;
+  // L0 cache profile pulses (one cycle when the event fires).  A dual-resolve
+  // cycle (primary hit + secondary hit) counts as one pulse — the perf
+  // counter increment is single-bit, and widening it for the rare double is
+  // not worth the plumbing through the wrapper.
+  assign o_l0_hit = cache_hit_fast_path || l0_dual_fire;
   assign o_l0_fill = cache_fill_valid;
   // Diagnostic: expose mem_outstanding so the wrapper can partition head
   // wait cycles into "load in flight" vs "load stuck on something else".
   assign o_mem_outstanding = mem_outstanding;
 
+  // ===========================================================================
+  // Memory Dependence Speculation (L0 prefetch past unresolved stores)
+  // ===========================================================================
+  // A load whose only blocker is older stores with still-unknown addresses
+  // (!i_sq_all_older_addrs_known, no known match) sits in sq_check until the
+  // SQ resolves -- with the cached tier behind it, that serialises a
+  // multi-cycle (potentially DDR-miss) access behind store address
+  // generation. When the alias-confidence counter predicts independence,
+  // start the cached access NOW as a plain L0 prefetch:
+  //   - the access reuses the normal launch/response tracker (mem_outstanding,
+  //     issued_* snapshots, slow_outstanding), with spec_issued_q marking it;
+  //   - the response fills the L0 only (cache_fill_valid already suppresses
+  //     the fill when a committed store invalidated the line mid-flight) and
+  //     returns the entry to the un-issued pool;
+  //   - the entry stays staged in sq_check, and once disambiguation resolves
+  //     it completes through the ordinary paths: L0 hit (the common case --
+  //     the miss latency has been hidden), SQ forward, or a relaunch.
+  // Because the architectural read still happens only after disambiguation,
+  // no misspeculated value ever reaches the CDB: "replay" is the pre-existing
+  // re-issue path, and a wrong prediction costs only cached-tier bandwidth
+  // plus the slow_outstanding serialisation window. That cost is what the
+  // predictor throttles.
+  //
+  // Predictor: one 4-bit saturating alias-confidence counter, trained once
+  // per sq_check candidate at its consuming event -- an observed older-store
+  // match is strong evidence against speculating (-4); a load that waited
+  // behind unknown addresses and turned out independent is weak evidence for
+  // it (+1). Per-PC store-set tables would train faster, but load PCs are not
+  // carried this deep in the pipeline; a global counter captures the
+  // whole-program phase behaviour (alias-free hot loops speculate,
+  // store-heavy phases throttle) without new dispatch-side plumbing.
+
+  localparam int unsigned DepConfBits = 4;
+  localparam logic [DepConfBits-1:0] DepAliasPenalty = 4'd4;
+
+  logic [DepConfBits-1:0] dep_conf_q;
+  logic dep_predict_independent;
+  logic sq_check_saw_match_q;  // sticky: candidate saw an older-store match
+  logic sq_check_waited_q;  // sticky: candidate waited on unknown addresses
+  logic dep_alias_observed;
+
+  assign dep_predict_independent =
+      ENABLE_MEM_DEP_SPECULATION && dep_conf_q[DepConfBits-1];
+
+  // Same launch-window gates as launch_mem_issue, minus sq_can_issue (the
+  // point is that disambiguation has NOT resolved), plus the prefetch-safety
+  // gates: cached region only (the 1-cycle tiers have no latency to hide and
+  // MMIO reads have side effects), L0-servable consumer, not already in L0,
+  // and the entry's access not already in flight.
+  assign spec_prefetch_fire = dep_predict_independent &&
+      !i_flush_en && !i_flush_all && !i_mem_bus_busy && !slow_outstanding &&
+      sq_check_phase2 && sq_check_entry_issueable &&
+      !sq_check_misaligned && !sq_commit_interlock &&
+      !sq_no_older_store && !i_sq_all_older_addrs_known && !i_sq_forward.match &&
+      sq_check_is_cached_region && !cache_lookup_hit &&
+      !lq_issued[sq_check_idx] &&
+      !sq_check_is_mmio_q && !sq_check_is_lr_q && !sq_check_is_amo_q &&
+      (!sq_check_is_fp_q || (sq_check_size_q == riscv_pkg::MEM_SIZE_WORD));
+
+  // In-flight marker. Set wins over the same-cycle clear of a completing
+  // earlier fast (1-cycle) load's response; the prefetch itself cannot fire
+  // while its own access is outstanding (slow_outstanding gate).
+  always_ff @(posedge i_clk) begin
+    if (!i_rst_n) begin
+      spec_issued_q <= 1'b0;
+    end else if (spec_prefetch_fire) begin
+      spec_issued_q <= 1'b1;
+    end else if (accept_mem_response || drop_mem_response_now) begin
+      spec_issued_q <= 1'b0;
+    end
+  end
+
+  // Candidate-lifetime observation stickies. i_sq_forward / addrs_known are
+  // the SQ's registered answers to last cycle's check, so they are qualified
+  // with sq_check_phase2 (the SQ zeroes them when the check was not valid).
+  always_ff @(posedge i_clk) begin
+    if (!i_rst_n || i_flush_all) begin
+      sq_check_saw_match_q <= 1'b0;
+      sq_check_waited_q    <= 1'b0;
+    end else if (sq_check_mask_update_en) begin
+      // New candidate captured/replaced: restart its observation window (a
+      // same-cycle SQ answer still belongs to the outgoing candidate).
+      sq_check_saw_match_q <= 1'b0;
+      sq_check_waited_q    <= 1'b0;
+    end else begin
+      if (sq_check_phase2 && i_sq_forward.match) sq_check_saw_match_q <= 1'b1;
+      if (sq_check_phase2 && !i_sq_all_older_addrs_known) sq_check_waited_q <= 1'b1;
+    end
+  end
+
+  assign dep_alias_observed =
+      sq_check_saw_match_q || (sq_check_phase2 && i_sq_forward.match);
+
+  // Train at the candidate's consuming event only (hit / forward / launch),
+  // never per stall cycle, so a long match-without-forward wait counts once.
+  // Reset optimistic: aliases are rare in real code, and a handful of early
+  // misses costs only bandwidth.
+  always_ff @(posedge i_clk) begin
+    if (!i_rst_n) begin
+      dep_conf_q <= '1;
+    end else if (cache_hit_fast_path || sq_do_forward || launch_mem_issue) begin
+      if (dep_alias_observed) begin
+        dep_conf_q <= (dep_conf_q > DepAliasPenalty) ? dep_conf_q - DepAliasPenalty : '0;
+      end else if (sq_check_waited_q && dep_conf_q != '1) begin
+        dep_conf_q <= dep_conf_q + DepConfBits'(1);
+      end
+    end
+  end
+
   // AMO write interface: compute new value combinationally from outstanding AMO read
   // TIMING: Removed same-cycle AMO write fast path (accept_mem_response &&
   // lq_is_amo) that created a BRAM-read → amo_compute → BRAM-write
@@ -1452,7 +1839,8 @@ module load_queue #(
       o_amo_mem_write_en = 1'b1;
       o_amo_mem_write_addr = lq_address_amo_rd;
       o_amo_mem_write_data =
-          amo_compute(riscv_pkg::instr_op_e'(lq_amo_op_rd), amo_old_value, lq_amo_rs2_rd);
+          riscv_pkg::amo_compute(riscv_pkg::instr_op_e'(lq_amo_op_rd), amo_old_value,
+                                 lq_amo_rs2_rd);
     end
   end
 
@@ -1535,8 +1923,10 @@ module load_queue #(
   logic [FLEN-1:0] resp_bypass_value;
   logic [FLEN-1:0] cache_hit_bypass_value;
 
+  // Dependence-speculative prefetch responses produce no CDB result (the L0
+  // fill is their whole effect), so they never take the completion bypass.
   assign resp_bypass_ok =
-      accept_mem_response && !issued_is_amo &&
+      accept_mem_response && !issued_is_amo && !spec_issued_q &&
       !(issued_is_fp && (riscv_pkg::mem_size_e'(issued_size) == riscv_pkg::MEM_SIZE_DOUBLE));
 
   assign resp_bypass_fire = cdb_stage_slot_available && !issue_cdb_fire &&
@@ -1903,6 +2293,14 @@ module load_queue #(
         lq_data_valid[sq_check_idx] <= 1'b1;
       end
 
+      // Secondary L0 completion: always the standard data_valid route (no
+      // cdb_stage bypass). The candidate is never the sq_check entry or the
+      // in-flight issued entry, so this bit write cannot collide with the
+      // cache-hit or memory-response writes above/below.
+      if (l0_dual_fire) begin
+        lq_data_valid[l0b_cand_idx] <= 1'b1;
+      end
+
       // -----------------------------------------------------------------
       // Store forwarding: write data directly, skip memory
       // -----------------------------------------------------------------
@@ -1932,9 +2330,19 @@ module load_queue #(
         // Normal completion of the in-flight load. Only a cached load set
         // slow_outstanding, so clear it on the cached load's own response.
         if (issued_is_cached) slow_outstanding <= 1'b0;
-        if (issued_is_amo) begin
-          // AMO: start write phase (don't set data_valid yet);
-          // data signals (amo_old_value, amo_entry_idx) in no-reset block
+        if (spec_issued_q) begin
+          // Dependence-speculative prefetch: the L0 fill (cache_fill_valid,
+          // above) is the whole effect. Return the entry to the un-issued
+          // pool; it completes later through the normal disambiguated paths
+          // (L0 hit, SQ forward, or relaunch). A harmless no-op if the slot
+          // was meanwhile completed by a forward and reallocated.
+          lq_issued[issued_idx] <= 1'b0;
+        end else if (issued_is_amo && !issued_amo_rmw) begin
+          // Two-phase AMO (BRAM/MMIO tier): start write phase (don't set
+          // data_valid yet); data signals (amo_old_value, amo_entry_idx) in
+          // no-reset block. A cached RMW AMO takes the standard-completion
+          // else below instead: the adapter already committed the new value
+          // at the cache, the response word is the architectural old value.
           amo_state <= AMO_WRITE_ACTIVE;
         end else if (issued_is_fp &&
             riscv_pkg::mem_size_e'(issued_size) == riscv_pkg::MEM_SIZE_DOUBLE &&
@@ -2272,6 +2680,7 @@ module load_queue #(
       issued_is_fp      <= sq_check_is_fp_q;
       issued_is_lr      <= sq_check_is_lr_q;
       issued_is_amo     <= sq_check_is_amo_q;
+      issued_amo_rmw    <= ENABLE_AMO_CACHE_RMW && sq_check_is_amo_q && launching_is_cached;
       issued_is_mmio    <= sq_check_is_mmio_q;
       issued_is_cached  <= launching_is_cached;
       issued_sign_ext   <= sq_check_sign_ext_q;
@@ -2539,6 +2948,42 @@ module load_queue #(
     end
   end
 
+  // Secondary L0 completion only fires with an empty SQ (its disambiguation
+  // substitute) on a plain, un-issued, data-less candidate outside the
+  // sq_check staging slot.
+  always_comb begin
+    if (i_rst_n && l0_dual_fire) begin
+      p_dual_fire_sq_empty : assert (i_sq_empty);
+      p_dual_fire_plain : assert (lq_valid[l0b_cand_idx] && lq_addr_valid[l0b_cand_idx] &&
+                                  !lq_issued[l0b_cand_idx] && !lq_data_valid[l0b_cand_idx] &&
+                                  !lq_is_mmio[l0b_cand_idx] && !lq_is_lr[l0b_cand_idx] &&
+                                  !lq_is_amo[l0b_cand_idx]);
+      p_dual_fire_not_staged : assert (!sq_check_in_flight_mask[l0b_cand_idx]);
+      if (issue_mem_found) begin
+        p_dual_fire_not_captured : assert (l0b_cand_idx != issue_mem_idx);
+      end
+    end
+
+    // Selective-replay contract for memory-dependence speculation: the
+    // prefetch is value-safe, so its response may never take the completion
+    // bypass to the CDB -- the L0 fill is its only effect, and a wrong
+    // prediction costs a relaunch of the one entry (never a flush or RAT
+    // restore; the LQ has no flush-request output at all).
+    if (ENABLE_MEM_DEP_SPECULATION && accept_mem_response && spec_issued_q) begin
+      p_spec_resp_prefetch_only : assert (!resp_bypass_fire);
+    end
+
+    // Cached-RMW AMO contract: the RMW sideband only rides cached-tier reads
+    // (the adapter owns the write), its response never starts the two-phase
+    // write window, and it never takes the completion bypass (AMOs stay on
+    // the standard data_valid route).
+    if (amo_rmw_resp) begin
+      p_amo_rmw_cached_only : assert (issued_is_cached);
+      p_amo_rmw_no_write_phase : assert (amo_state == AMO_IDLE);
+      p_amo_rmw_no_bypass : assert (!resp_bypass_fire);
+    end
+  end
+
   // -------------------------------------------------------------------------
   // Sequential assertions
   // -------------------------------------------------------------------------
@@ -2601,6 +3046,16 @@ module load_queue #(
 
       // L0 cache fill on memory response
       cover_cache_fill : cover (cache_fill_valid);
+
+      if (ENABLE_MEM_DEP_SPECULATION) begin
+        // Dependence-speculative L0 prefetch launched past unresolved stores
+        cover_dep_spec_prefetch : cover (spec_prefetch_fire);
+      end
+
+      if (ENABLE_AMO_CACHE_RMW) begin
+        // Cached AMO completing in a single cache round trip
+        cover_amo_rmw_resp : cover (amo_rmw_resp);
+      end
     end
   end
 
@@ -52,7 +52,16 @@ module lq_issue_selector #(
     output logic [riscv_pkg::ReorderBufferTagWidth-1:0] o_head_mem_stored_rob_tag,
     output logic o_head_mem_update_found,
     output logic [$clog2(DEPTH)-1:0] o_head_mem_update_idx,
-    output logic [riscv_pkg::ReorderBufferTagWidth-1:0] o_head_mem_update_rob_tag
+    output logic [riscv_pkg::ReorderBufferTagWidth-1:0] o_head_mem_update_rob_tag,
+
+    // Secondary L0-lookup candidates: the two oldest plain (non-MMIO/LR/AMO)
+    // stored-address entries, for the parent's second load-completion port.
+    // Two candidates are exported so the parent can skip whichever one it is
+    // capturing into the sq_check staging register this cycle.
+    output logic o_l0_cand_found,
+    output logic [$clog2(DEPTH)-1:0] o_l0_cand_idx,
+    output logic o_l0_cand2_found,
+    output logic [$clog2(DEPTH)-1:0] o_l0_cand2_idx
 );
 
   localparam int unsigned ReorderBufferTagWidth = riscv_pkg::ReorderBufferTagWidth;
@@ -173,6 +182,49 @@ module lq_issue_selector #(
   assign mem_issue_stored_mask = mem_eligible_stored_mask & ~blocked_by_amo;
   assign mem_issue_update_mask = mem_eligible_update_mask & ~blocked_by_amo;
 
+  // Secondary L0-lookup candidates: plain loads only (no MMIO/LR/AMO — those
+  // are head-serialized and must take the primary path), same older-AMO
+  // blocking as the memory-issue masks.  A double-width tree encoder finds
+  // the two oldest candidates in scan order.
+  logic [DEPTH-1:0] l0_plain_phys;
+  logic [DEPTH-1:0] l0_plain_mask;
+  always_comb begin
+    for (int unsigned i = 0; i < DEPTH; i++) begin
+      l0_plain_phys[i] =
+          lq_valid[i] &&
+          lq_addr_valid[i] &&
+          !lq_issued[i] &&
+          !lq_data_valid[i] &&
+          !in_flight_mask[i] &&
+          !lq_is_mmio[i] &&
+          !lq_is_lr[i] &&
+          !lq_is_amo[i];
+    end
+  end
+  assign l0_plain_mask = rotate_mask_from_head(l0_plain_phys, head_idx) & ~blocked_by_amo;
+
+  logic l0_cand_found;
+  logic [IdxWidth-1:0] l0_cand_idx;
+  logic l0_cand2_found;
+  logic [IdxWidth-1:0] l0_cand2_idx;
+  always_comb begin
+    l0_cand_found  = 1'b0;
+    l0_cand_idx    = '0;
+    l0_cand2_found = 1'b0;
+    l0_cand2_idx   = '0;
+    for (int unsigned i = 0; i < DEPTH; i++) begin
+      if (l0_plain_mask[i]) begin
+        if (!l0_cand_found) begin
+          l0_cand_found = 1'b1;
+          l0_cand_idx   = scan_idx[i];
+        end else if (!l0_cand2_found) begin
+          l0_cand2_found = 1'b1;
+          l0_cand2_idx   = scan_idx[i];
+        end
+      end
+    end
+  end
+
   // The sparse queue can reuse reclaimed holes after flushes, so physical
   // queue order is not always identical to ROB age.  To avoid starving the
   // oldest architectural load behind a younger blocked entry, explicitly
@@ -232,5 +284,9 @@ module lq_issue_selector #(
   assign o_head_mem_update_found = head_mem_update_found;
   assign o_head_mem_update_idx = head_mem_update_idx;
   assign o_head_mem_update_rob_tag = head_mem_update_rob_tag;
+  assign o_l0_cand_found = l0_cand_found;
+  assign o_l0_cand_idx = l0_cand_idx;
+  assign o_l0_cand2_found = l0_cand2_found;
+  assign o_l0_cand2_idx = l0_cand2_idx;
 
 endmodule
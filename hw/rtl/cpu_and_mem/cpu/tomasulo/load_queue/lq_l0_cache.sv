@@ -18,21 +18,24 @@
  * LQ L0 Data Cache
  *
  * Simplified OoO-compatible L0 data cache for the Load Queue.
- * Direct-mapped, word-aligned entries with FF-based valid bits and
- * LUTRAM-backed tag/data arrays.
+ * Set-associative, word-aligned entries with FF-based valid bits and
+ * LUTRAM-backed tag/data arrays (one RAM replica per way per read port).
+ * NUM_WAYS = 1 degenerates to the original direct-mapped design.
  *
  * The module uses simple address/data ports suitable for the LQ's OoO issue path.
  *
  * Features:
  *   - Combinational lookup (hit in same cycle as address)
- *   - Fill on memory response
+ *   - Second independent lookup port (replicated LUTRAMs, shared valid bits)
+ *   - Fill on memory response, round-robin way replacement per set
  *   - MMIO addresses always miss (>= MMIO_ADDR)
  *   - Flush all valid bits on pipeline flush
- *   - Per-address invalidation port (for future SQ integration)
+ *   - Per-address invalidation port clears every matching way
  */
 
 module lq_l0_cache #(
-    parameter int unsigned DEPTH     = 128,
+    parameter int unsigned NUM_SETS  = 128,
+    parameter int unsigned NUM_WAYS  = 2,    // power of 2 (round-robin wrap)
     parameter int unsigned XLEN      = 32,
     parameter int unsigned MMIO_ADDR = 32'h4000_0000
 ) (
@@ -44,6 +47,16 @@ module lq_l0_cache #(
     output logic            o_lookup_hit,
     output logic [XLEN-1:0] o_lookup_data,  // raw word at word-aligned addr
 
+    // Second lookup port (combinational read).  Serves the LQ's secondary
+    // load-completion path so two independent loads can resolve in the same
+    // cycle.  LUTRAM-backed arrays are cheap to replicate per read port
+    // (same trick as the tag lookup/invalidate split below), so this costs
+    // one more tag RAM and one more data RAM per way, not a second write
+    // port.
+    input  logic [XLEN-1:0] i_lookup2_addr,
+    output logic            o_lookup2_hit,
+    output logic [XLEN-1:0] o_lookup2_data,
+
     // Fill (write on memory response)
     input logic            i_fill_valid,
     input logic [XLEN-1:0] i_fill_addr,
@@ -66,16 +79,29 @@ module lq_l0_cache #(
   // ===========================================================================
   // Local Parameters
   // ===========================================================================
-  localparam int unsigned IndexWidth = $clog2(DEPTH);
+  localparam int unsigned IndexWidth = $clog2(NUM_SETS);
   localparam int unsigned TagWidth = XLEN - 2 - IndexWidth;  // word-aligned: skip bit[1:0]
+  localparam int unsigned WayWidth = (NUM_WAYS > 1) ? $clog2(NUM_WAYS) : 1;
 
   // ===========================================================================
   // Storage
   // ===========================================================================
-  logic [     DEPTH-1:0] valid;
-  logic [  TagWidth-1:0] tag_lookup_rd;
-  logic [  TagWidth-1:0] tag_inv_rd;
-  logic [      XLEN-1:0] data_lookup_rd;
+  logic [NUM_WAYS-1:0][NUM_SETS-1:0] valid;
+  logic [NUM_WAYS-1:0][TagWidth-1:0] tag_lookup_rd;
+  logic [NUM_WAYS-1:0][TagWidth-1:0] tag_lookup2_rd;
+  logic [NUM_WAYS-1:0][TagWidth-1:0] tag_inv_rd;
+  logic [NUM_WAYS-1:0][    XLEN-1:0] data_lookup_rd;
+  logic [NUM_WAYS-1:0][    XLEN-1:0] data_lookup2_rd;
+
+  // Round-robin fill-way pointer per set.  A fresh fill always takes the
+  // pointed-at way and advances the pointer; there is no fill-time tag match
+  // against resident ways (that would need yet another tag read port per
+  // way).  A word can therefore transiently occupy two ways, but only with
+  // identical data: loads fill with memory's committed view, and any store
+  // ordered between two fills of the same word invalidates every matching
+  // way before (or the same edge as) the later fill lands.  The priority
+  // data mux below is thus always consistent.
+  logic [NUM_SETS-1:0][WayWidth-1:0] fill_way_ptr;
 
   // ===========================================================================
   // Address decomposition
@@ -89,73 +115,126 @@ module lq_l0_cache #(
   // cacheable here just like the low BRAM range (stores invalidate; reset clears).
   wire                   lookup_mmio = (i_lookup_addr[XLEN-1:XLEN-2] == 2'b01);
 
+  wire  [IndexWidth-1:0] lookup2_index = i_lookup2_addr[2+:IndexWidth];
+  wire  [  TagWidth-1:0] lookup2_tag = i_lookup2_addr[(2+IndexWidth)+:TagWidth];
+  wire                   lookup2_mmio = (i_lookup2_addr[XLEN-1:XLEN-2] == 2'b01);
+
   wire  [IndexWidth-1:0] fill_index = i_fill_addr[2+:IndexWidth];
   wire  [  TagWidth-1:0] fill_tag = i_fill_addr[(2+IndexWidth)+:TagWidth];
+  wire  [  WayWidth-1:0] fill_way = fill_way_ptr[fill_index];
 
   wire  [IndexWidth-1:0] inv_index = i_invalidate_addr[2+:IndexWidth];
   wire  [  TagWidth-1:0] inv_tag = i_invalidate_addr[(2+IndexWidth)+:TagWidth];
 
   wire  [IndexWidth-1:0] lookup_inv_index = i_lookup_invalidate_addr[2+:IndexWidth];
   wire  [  TagWidth-1:0] lookup_inv_tag = i_lookup_invalidate_addr[(2+IndexWidth)+:TagWidth];
-  logic                  invalidate_fill_entry;
-  logic                  invalidate_existing_entry;
+
+  logic [  NUM_WAYS-1:0] invalidate_fill_way;
+  logic [  NUM_WAYS-1:0] invalidate_existing_way;
+  logic [  NUM_WAYS-1:0] lookup_hit_way;
+  logic [  NUM_WAYS-1:0] lookup2_hit_way;
   logic                  lookup_hit_array;
   logic                  lookup_fill_bypass;
   logic                  lookup_invalidated;
-
-  // Tags are written only on fill and read at two independent addresses
-  // (lookup and invalidate), so duplicate the simple dual-port RAM once
-  // per read port instead of keeping the tag array in flip-flops.
-  sdp_dist_ram #(
-      .ADDR_WIDTH(IndexWidth),
-      .DATA_WIDTH(TagWidth)
-  ) u_tag_lookup_ram (
-      .i_clk,
-      .i_write_enable (i_fill_valid),
-      .i_write_address(fill_index),
-      .i_read_address (lookup_index),
-      .i_write_data   (fill_tag),
-      .o_read_data    (tag_lookup_rd)
-  );
-
-  sdp_dist_ram #(
-      .ADDR_WIDTH(IndexWidth),
-      .DATA_WIDTH(TagWidth)
-  ) u_tag_inv_ram (
-      .i_clk,
-      .i_write_enable (i_fill_valid),
-      .i_write_address(fill_index),
-      .i_read_address (inv_index),
-      .i_write_data   (fill_tag),
-      .o_read_data    (tag_inv_rd)
-  );
-
-  // Data has a single write port and a single lookup read port, making it
-  // an ideal fit for a small LUTRAM rather than a bank of FFs.
-  sdp_dist_ram #(
-      .ADDR_WIDTH(IndexWidth),
-      .DATA_WIDTH(XLEN)
-  ) u_data_ram (
-      .i_clk,
-      .i_write_enable (i_fill_valid),
-      .i_write_address(fill_index),
-      .i_read_address (lookup_index),
-      .i_write_data   (i_fill_data),
-      .o_read_data    (data_lookup_rd)
-  );
+  logic                  lookup2_hit_array;
+  logic                  lookup2_invalidated;
+
+  // Tags are written only on fill and read at three independent addresses
+  // (two lookups and the invalidate), so duplicate the simple dual-port RAM
+  // once per way per read port instead of keeping the tag array in
+  // flip-flops.  The data arrays follow the same pattern for the two lookup
+  // ports.
+  for (genvar w = 0; w < NUM_WAYS; w++) begin : gen_way_rams
+    wire way_fill = i_fill_valid && (fill_way == WayWidth'(w));
+
+    sdp_dist_ram #(
+        .ADDR_WIDTH(IndexWidth),
+        .DATA_WIDTH(TagWidth)
+    ) u_tag_lookup_ram (
+        .i_clk,
+        .i_write_enable (way_fill),
+        .i_write_address(fill_index),
+        .i_read_address (lookup_index),
+        .i_write_data   (fill_tag),
+        .o_read_data    (tag_lookup_rd[w])
+    );
+
+    sdp_dist_ram #(
+        .ADDR_WIDTH(IndexWidth),
+        .DATA_WIDTH(TagWidth)
+    ) u_tag_lookup2_ram (
+        .i_clk,
+        .i_write_enable (way_fill),
+        .i_write_address(fill_index),
+        .i_read_address (lookup2_index),
+        .i_write_data   (fill_tag),
+        .o_read_data    (tag_lookup2_rd[w])
+    );
+
+    sdp_dist_ram #(
+        .ADDR_WIDTH(IndexWidth),
+        .DATA_WIDTH(TagWidth)
+    ) u_tag_inv_ram (
+        .i_clk,
+        .i_write_enable (way_fill),
+        .i_write_address(fill_index),
+        .i_read_address (inv_index),
+        .i_write_data   (fill_tag),
+        .o_read_data    (tag_inv_rd[w])
+    );
+
+    sdp_dist_ram #(
+        .ADDR_WIDTH(IndexWidth),
+        .DATA_WIDTH(XLEN)
+    ) u_data_ram (
+        .i_clk,
+        .i_write_enable (way_fill),
+        .i_write_address(fill_index),
+        .i_read_address (lookup_index),
+        .i_write_data   (i_fill_data),
+        .o_read_data    (data_lookup_rd[w])
+    );
+
+    sdp_dist_ram #(
+        .ADDR_WIDTH(IndexWidth),
+        .DATA_WIDTH(XLEN)
+    ) u_data_lookup2_ram (
+        .i_clk,
+        .i_write_enable (way_fill),
+        .i_write_address(fill_index),
+        .i_read_address (lookup2_index),
+        .i_write_data   (i_fill_data),
+        .o_read_data    (data_lookup2_rd[w])
+    );
+  end
 
   // ===========================================================================
   // Combinational Lookup
   // ===========================================================================
-  assign invalidate_fill_entry =
-      i_invalidate_valid && i_fill_valid &&
-      (fill_index == inv_index) && (fill_tag == inv_tag);
-  assign invalidate_existing_entry =
-      i_invalidate_valid &&
-      valid[inv_index] &&
-      (tag_inv_rd == inv_tag) &&
-      !(i_fill_valid && (fill_index == inv_index) && (fill_tag != inv_tag));
-  assign lookup_hit_array = valid[lookup_index] && (tag_lookup_rd == lookup_tag);
+  always_comb begin
+    for (int unsigned w = 0; w < NUM_WAYS; w++) begin
+      // Invalidation clears every matching way.  A concurrent fill into a
+      // way at the same index is only allowed to win when it replaces a
+      // DIFFERENT tag in that way. If the fill and invalidate target the
+      // same tag, the invalidate must win; otherwise a load response can
+      // reinsert stale data into the cache in the same cycle that a
+      // committed store is trying to invalidate that word.
+      invalidate_fill_way[w] =
+          i_invalidate_valid && i_fill_valid && (fill_way == WayWidth'(w)) &&
+          (fill_index == inv_index) && (fill_tag == inv_tag);
+      invalidate_existing_way[w] =
+          i_invalidate_valid &&
+          valid[w][inv_index] &&
+          (tag_inv_rd[w] == inv_tag) &&
+          !(i_fill_valid && (fill_way == WayWidth'(w)) &&
+            (fill_index == inv_index) && (fill_tag != inv_tag));
+
+      lookup_hit_way[w]  = valid[w][lookup_index] && (tag_lookup_rd[w] == lookup_tag);
+      lookup2_hit_way[w] = valid[w][lookup2_index] && (tag_lookup2_rd[w] == lookup2_tag);
+    end
+  end
+
+  assign lookup_hit_array = |lookup_hit_way;
   // lookup_fill_bypass (same-cycle fill/lookup forwarding) used to be combined
   // into o_lookup_hit. That created a long combinational chain
   //   i_flush_en (← mispredict_recovery_pending) → accept_mem_response
@@ -176,7 +255,31 @@ module lq_l0_cache #(
       (lookup_inv_index == lookup_index) &&
       (lookup_inv_tag == lookup_tag);
   assign o_lookup_hit = !lookup_mmio && lookup_hit_array && !lookup_invalidated;
-  assign o_lookup_data = data_lookup_rd;
+
+  // Way mux: a tag can transiently live in two ways only with identical data
+  // (see fill_way_ptr note), so fixed priority is exact.
+  always_comb begin
+    o_lookup_data = data_lookup_rd[0];
+    for (int unsigned w = 0; w < NUM_WAYS; w++) begin
+      if (lookup_hit_way[w]) o_lookup_data = data_lookup_rd[w];
+    end
+  end
+
+  // Second lookup port: same hit rule as port 1 (no fill bypass, same-cycle
+  // store suppression applied identically).
+  assign lookup2_hit_array = |lookup2_hit_way;
+  assign lookup2_invalidated =
+      i_lookup_invalidate_valid &&
+      (lookup_inv_index == lookup2_index) &&
+      (lookup_inv_tag == lookup2_tag);
+  assign o_lookup2_hit = !lookup2_mmio && lookup2_hit_array && !lookup2_invalidated;
+
+  always_comb begin
+    o_lookup2_data = data_lookup2_rd[0];
+    for (int unsigned w = 0; w < NUM_WAYS; w++) begin
+      if (lookup2_hit_way[w]) o_lookup2_data = data_lookup2_rd[w];
+    end
+  end
 
   // ===========================================================================
   // Sequential: Fill, Invalidate, Flush
@@ -184,23 +287,21 @@ module lq_l0_cache #(
   always_ff @(posedge i_clk) begin
     if (!i_rst_n) begin
       valid <= '0;
+      fill_way_ptr <= '0;
     end else if (i_flush_all) begin
       valid <= '0;
     end else begin
-      // Fill
+      // Fill: round-robin way within the set
       if (i_fill_valid) begin
-        valid[fill_index] <= 1'b1;
+        valid[fill_way][fill_index] <= 1'b1;
+        fill_way_ptr[fill_index]    <= fill_way + WayWidth'(NUM_WAYS > 1 ? 1 : 0);
       end
 
-      // Invalidate (single address).
-      //
-      // A concurrent fill to the same index is only allowed to win when it
-      // replaces a DIFFERENT tag in that direct-mapped slot. If the fill and
-      // invalidate target the same tag, the invalidate must win; otherwise a
-      // load response can reinsert stale data into the cache in the same cycle
-      // that a committed store is trying to invalidate that word.
-      if (invalidate_fill_entry || invalidate_existing_entry) begin
-        valid[inv_index] <= 1'b0;
+      // Invalidate (single address, all matching ways)
+      for (int unsigned w = 0; w < NUM_WAYS; w++) begin
+        if (invalidate_fill_way[w] || invalidate_existing_way[w]) begin
+          valid[w][inv_index] <= 1'b0;
+        end
       end
     end
   end
@@ -231,11 +332,42 @@ module lq_l0_cache #(
     end
   end
 
-  // Hit implies valid and tag match
+  // MMIO addresses never hit on the second port either
+  always_comb begin
+    if (i_rst_n && (i_lookup2_addr[XLEN-1:XLEN-2] == 2'b01)) begin
+      p_mmio_never_hits2 : assert (!o_lookup2_hit);
+    end
+  end
+
+  // Hit implies some way is valid with a matching tag (way 0 spelled out;
+  // lookup_hit_way[w] is defined as exactly that conjunction per way)
   always_comb begin
     if (i_rst_n && o_lookup_hit) begin
-      p_hit_implies_valid : assert (valid[lookup_index]);
-      p_hit_implies_tag_match : assert (tag_lookup_rd == lookup_tag);
+      p_hit_implies_way : assert (|lookup_hit_way);
+      if (lookup_hit_way[0]) begin
+        p_hit_way0_valid : assert (valid[0][lookup_index]);
+        p_hit_way0_tag_match : assert (tag_lookup_rd[0] == lookup_tag);
+      end
+    end
+  end
+
+  always_comb begin
+    if (i_rst_n && o_lookup2_hit) begin
+      p_hit2_implies_way : assert (|lookup2_hit_way);
+    end
+  end
+
+  // The two ports are the same array: identical lookup addresses must agree.
+  always_comb begin
+    if (i_rst_n && (i_lookup2_addr == i_lookup_addr)) begin
+      p_ports_agree : assert (o_lookup2_hit == o_lookup_hit);
+    end
+  end
+
+  // The fill-way pointer always addresses a real way.
+  always_comb begin
+    if (i_rst_n) begin
+      p_fill_way_in_range : assert (int'(fill_way) < int'(NUM_WAYS));
     end
   end
 
@@ -248,6 +380,9 @@ module lq_l0_cache #(
 
   // Fill followed by lookup at same word-aligned address should hit.
   // Track a single fill address across one cycle for a cleaner assertion.
+  // A same-set fill in the following cycle goes to a different way under
+  // round-robin replacement (NUM_WAYS > 1), but the NUM_WAYS = 1 degenerate
+  // keeps the original conflicting-fill exclusion, so it stays in the guard.
   reg [XLEN-1:0] f_fill_addr_q;
   reg            f_fill_valid_q;
   always @(posedge i_clk) begin
@@ -255,7 +390,7 @@ module lq_l0_cache #(
       f_fill_valid_q <= 1'b0;
       f_fill_addr_q  <= '0;
     end else begin
-      f_fill_valid_q <= i_fill_valid & ~i_flush_all & !invalidate_fill_entry;
+      f_fill_valid_q <= i_fill_valid & ~i_flush_all & !(|invalidate_fill_way);
       f_fill_addr_q  <= i_fill_addr;
     end
   end
@@ -265,6 +400,7 @@ module lq_l0_cache #(
         && !i_flush_all
         && i_lookup_addr[XLEN-1:2] == f_fill_addr_q[XLEN-1:2]
         && !(i_lookup_addr[XLEN-1:XLEN-2] == 2'b01)
+        && !$past(i_invalidate_valid)
         && !(i_lookup_invalidate_valid
              && i_lookup_invalidate_addr[2+:IndexWidth]
                 == f_fill_addr_q[2+:IndexWidth])
@@ -283,9 +419,12 @@ module lq_l0_cache #(
   always @(posedge i_clk) begin
     if (i_rst_n) begin
       cover_hit : cover (o_lookup_hit);
-      cover_miss : cover (!o_lookup_hit && valid[lookup_index]);
+      cover_miss : cover (!o_lookup_hit && valid[0][lookup_index]);
       cover_fill : cover (i_fill_valid);
-      cover_invalidate : cover (i_invalidate_valid && valid[inv_index]);
+      cover_invalidate : cover (i_invalidate_valid && (|invalidate_existing_way));
+      if (NUM_WAYS > 1) begin
+        cover_both_ways_resident : cover (valid[0][lookup_index] && valid[1][lookup_index]);
+      end
     end
   end
 
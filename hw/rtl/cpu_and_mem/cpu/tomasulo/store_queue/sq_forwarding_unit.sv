@@ -28,6 +28,19 @@
 // functions are duplicated from store_queue (pure combinational, already
 // duplicated across modules by design).  Entry-array inputs keep the parent's
 // bare names so the block bodies below are byte-identical.
+//
+// Partial-overlap forwarding (Blocks 2b/2c): beyond the original exact-match
+// cases, each byte lane of the load's addressed word independently selects
+// the NEWEST older store writing that byte.  Lanes whose winners have
+// forwardable data are assembled into a word (each lane reads its winner's
+// data through its own lane read port in the parent), so a word load after
+// byte/halfword stores -- the serialization-code pattern -- forwards from
+// multiple SQ entries instead of stalling until they drain.  can_forward now
+// also covers "every byte the load needs is lane-forwardable"; the per-lane
+// fwd_bytes/blocked_bytes masks let the LQ merge a partially-covered load
+// with L0 cache data.  FSD (DOUBLE) stores block the lanes they cover (their
+// data would need the hi-word RAM read); the original exact/LO/HI cases still
+// handle the profitable FSD->FLW forwards and win priority when they apply.
 // =============================================================================
 module sq_forwarding_unit #(
     parameter int unsigned DEPTH = riscv_pkg::SqDepth
@@ -58,10 +71,14 @@ module sq_forwarding_unit #(
     input logic [(DEPTH*riscv_pkg::XLEN)-1:0] sq_address_flat,
     input logic [(DEPTH*2)-1:0] sq_size_flat,
     input logic [riscv_pkg::FLEN-1:0] sq_data_fwd_rd,
+    // Per-byte-lane data reads (low word of each lane winner's entry).
+    input logic [(4*riscv_pkg::XLEN)-1:0] sq_data_lane_rd_flat,
 
     output logic o_sq_all_older_addrs_known,
     output riscv_pkg::sq_forward_result_t o_sq_forward,
-    output logic [$clog2(DEPTH)-1:0] o_fwd_match_idx
+    output logic [$clog2(DEPTH)-1:0] o_fwd_match_idx,
+    // Per-byte-lane winner indices (the lane data-RAM read addresses).
+    output logic [(4*$clog2(DEPTH))-1:0] o_fwd_lane_idx
 );
 
   // Local pkg-param aliases (match store_queue) so the verbatim bodies below
@@ -184,6 +201,13 @@ module sq_forwarding_unit #(
   logic [ReorderBufferTagWidth:0] fwd_load_age;
   logic [ReorderBufferTagWidth:0] fwd_entry_age[DEPTH];
   logic [1:0] fwd_entry_extract_type[DEPTH];
+  // Per-entry byte-lane qualification for partial-overlap assembly: which
+  // lanes of the load's addressed word the entry writes, whether its lane
+  // bytes are extractable from the low-word lane RAM read, and its byte
+  // offset within the word (for the lane byte pick).
+  logic [3:0] fwd_entry_cover_mask[DEPTH];
+  logic fwd_entry_lane_fwd_ok[DEPTH];
+  logic [1:0] fwd_entry_off[DEPTH];
 
   assign fwd_load_byte_mask = gen_byte_en(i_sq_check_addr[1:0], i_sq_check_size);
   assign fwd_load_age = {1'b0, i_sq_check_rob_tag} - {1'b0, i_rob_head_tag};
@@ -235,6 +259,9 @@ module sq_forwarding_unit #(
       fwd_conflict_mask[i] = 1'b0;
       fwd_can_forward_mask[i] = 1'b0;
       fwd_entry_extract_type[i] = 2'd0;
+      fwd_entry_cover_mask[i] = 4'b0000;
+      fwd_entry_lane_fwd_ok[i] = 1'b0;
+      fwd_entry_off[i] = 2'b00;
 
       // Stores retire from the ROB before they drain from the SQ.  Keep a
       // store visible to younger-load disambiguation in the cycle its commit
@@ -269,6 +296,20 @@ module sq_forwarding_unit #(
           load_double_hi = (i_sq_check_size == riscv_pkg::MEM_SIZE_DOUBLE) &&
               word_addr_inc_eq(sq_check_word_for_entry, entry_address[XLEN-1:2]);
 
+          // Byte-lane coverage of the load's addressed word, independent of
+          // the load's own byte mask (non-needed lanes are simply unused by
+          // the winner select). DOUBLE stores cover every lane of both their
+          // words but are never lane-forwardable (their data needs the
+          // hi-word read); the exact/LO/HI cases below handle those.
+          if (entry_size == riscv_pkg::MEM_SIZE_DOUBLE) begin
+            if (same_word || double_hi_match) fwd_entry_cover_mask[i] = 4'b1111;
+          end else if (same_word) begin
+            fwd_entry_cover_mask[i] = store_byte_mask;
+          end
+          fwd_entry_lane_fwd_ok[i] = sq_data_valid[i] && !sq_is_mmio[i] &&
+              (entry_size != riscv_pkg::MEM_SIZE_DOUBLE);
+          fwd_entry_off[i] = entry_address[1:0];
+
           if (base_match || double_hi_match || load_double_hi) begin
             fwd_conflict_mask[i] = 1'b1;
 
@@ -325,6 +366,75 @@ module sq_forwarding_unit #(
     end
   end
 
+  // Block 2b: per-byte-lane newest-writer select. Same structure as Block 2,
+  // run once per lane over the per-entry coverage masks. The newest cover of
+  // a lane owns that byte whether or not it can forward -- an unforwardable
+  // winner (data not ready / MMIO / FSD) blocks the lane outright, since an
+  // older forwardable store or the L0 cache would both be stale for it.
+  logic [3:0] fwd_lane_covered;
+  logic [3:0] fwd_lane_fwd_ok;
+  logic [IdxWidth-1:0] fwd_lane_idx[4];
+  logic [1:0] fwd_lane_off[4];
+
+  always_comb begin
+    logic have_winner;
+    logic [ReorderBufferTagWidth:0] winner_age;
+
+    for (int unsigned k = 0; k < 4; k++) begin
+      have_winner         = 1'b0;
+      winner_age          = '0;
+      fwd_lane_covered[k] = 1'b0;
+      fwd_lane_fwd_ok[k]  = 1'b0;
+      fwd_lane_idx[k]     = '0;
+      fwd_lane_off[k]     = 2'b00;
+      for (int unsigned i = 0; i < DEPTH; i++) begin
+        if (fwd_entry_cover_mask[i][k] && (!have_winner || (fwd_entry_age[i] >= winner_age))) begin
+          have_winner         = 1'b1;
+          winner_age          = fwd_entry_age[i];
+          fwd_lane_covered[k] = 1'b1;
+          fwd_lane_fwd_ok[k]  = fwd_entry_lane_fwd_ok[i];
+          fwd_lane_idx[k]     = IdxWidth'(i);
+          fwd_lane_off[k]     = fwd_entry_off[i];
+        end
+      end
+    end
+  end
+
+  // Block 2c: assemble the forwarded word, one byte per lane from its
+  // winner's low-word data (read through the parent's lane RAM replicas).
+  // byte position within the winner's data = lane - store byte offset.
+  logic [XLEN-1:0] fwd_lane_data[4];
+  logic [XLEN-1:0] fwd_asm_word;
+
+  for (genvar g_lane = 0; g_lane < 4; g_lane++) begin : gen_lane_ports
+    assign o_fwd_lane_idx[g_lane*IdxWidth+:IdxWidth] = fwd_lane_idx[g_lane];
+    assign fwd_lane_data[g_lane] = sq_data_lane_rd_flat[g_lane*XLEN+:XLEN];
+  end
+
+  always_comb begin
+    logic [1:0] byte_pos;
+    logic [XLEN-1:0] shifted;
+    for (int unsigned k = 0; k < 4; k++) begin
+      byte_pos = 2'(k) - fwd_lane_off[k];
+      shifted = fwd_lane_data[k] >> {byte_pos, 3'b000};
+      fwd_asm_word[8*k+:8] = shifted[7:0];
+    end
+  end
+
+  // Lane results only model one word, so they never apply to DOUBLE loads
+  // (FLD keeps the exact-match path). Full lane coverage of every byte the
+  // load needs upgrades to can_forward even with no single exact-match entry.
+  logic fwd_lanes_apply;
+  logic [3:0] fwd_bytes_next;
+  logic [3:0] fwd_blocked_next;
+  logic fwd_lane_full_cover;
+
+  assign fwd_lanes_apply = (i_sq_check_size != riscv_pkg::MEM_SIZE_DOUBLE);
+  assign fwd_bytes_next = fwd_lanes_apply ? (fwd_lane_covered & fwd_lane_fwd_ok) : 4'b0000;
+  assign fwd_blocked_next = fwd_lanes_apply ? (fwd_lane_covered & ~fwd_lane_fwd_ok) : 4'b1111;
+  assign fwd_lane_full_cover =
+      fwd_lanes_apply && ((fwd_load_byte_mask & ~fwd_bytes_next) == 4'b0000);
+
   // Block 3: Registered forwarding outputs.
   // Keep the SQ compare/forwarding result behind a register so the LQ sees it
   // one cycle later; this breaks the MEM_RS -> SQ scan -> LQ -> BRAM path.
@@ -333,17 +443,32 @@ module sq_forwarding_unit #(
       o_sq_all_older_addrs_known <= 1'b0;
       o_sq_forward.match         <= 1'b0;
       o_sq_forward.can_forward   <= 1'b0;
+      o_sq_forward.fwd_bytes     <= 4'b0000;
+      o_sq_forward.blocked_bytes <= 4'b0000;
     end else begin
       o_sq_all_older_addrs_known <= i_sq_check_valid ? fwd_all_older_known : 1'b0;
       o_sq_forward.match         <= i_sq_check_valid ? fwd_found_match : 1'b0;
-      o_sq_forward.can_forward   <= i_sq_check_valid ? (fwd_found_match && fwd_can_fwd) : 1'b0;
+      o_sq_forward.can_forward   <= i_sq_check_valid ?
+          (fwd_found_match && (fwd_can_fwd || fwd_lane_full_cover)) : 1'b0;
+      // Exact-match forwards cover the whole value by construction. The
+      // per-lane masks describe the assembled word for everything else.
+      o_sq_forward.fwd_bytes <= (i_sq_check_valid && fwd_found_match) ?
+          (fwd_can_fwd ? 4'b1111 : fwd_bytes_next) : 4'b0000;
+      o_sq_forward.blocked_bytes <= (i_sq_check_valid && fwd_found_match && !fwd_can_fwd) ?
+          fwd_blocked_next : 4'b0000;
     end
 
-    case (fwd_extract_type)
-      2'd1:    o_sq_forward.data <= {{(FLEN - XLEN) {1'b0}}, sq_data_fwd_rd[31:0]};
-      2'd2:    o_sq_forward.data <= {{(FLEN - XLEN) {1'b0}}, sq_data_fwd_rd[63:32]};
-      default: o_sq_forward.data <= sq_data_fwd_rd;
-    endcase
+    if (fwd_can_fwd) begin
+      case (fwd_extract_type)
+        2'd1:    o_sq_forward.data <= {{(FLEN - XLEN) {1'b0}}, sq_data_fwd_rd[31:0]};
+        2'd2:    o_sq_forward.data <= {{(FLEN - XLEN) {1'b0}}, sq_data_fwd_rd[63:32]};
+        default: o_sq_forward.data <= sq_data_fwd_rd;
+      endcase
+    end else begin
+      // Multi-source path: lane-assembled word at the load's word address
+      // (bytes outside fwd_bytes are don't-care; the LQ merges/extracts).
+      o_sq_forward.data <= {{(FLEN - XLEN) {1'b0}}, fwd_asm_word};
+    end
   end
 
   assign o_fwd_match_idx = fwd_match_idx;
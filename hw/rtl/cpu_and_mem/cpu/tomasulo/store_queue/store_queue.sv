@@ -380,12 +380,14 @@ module store_queue #(
   riscv_pkg::mem_size_e                             sq_size                           [DEPTH];
 
   // ===========================================================================
-  // sq_data LUTRAM — duplicated for 2 read ports
+  // sq_data LUTRAM — duplicated per read port
   // ===========================================================================
-  // sq_data is written once (data_update CAM match) and read at two
-  // independent addresses: fwd_match_idx (forwarding scan result) and
-  // head_idx (memory write).  Duplicate sdp_dist_ram instances receive
-  // identical writes; each provides one async read port.
+  // sq_data is written once (data_update CAM match) and read at independent
+  // addresses: fwd_match_idx (forwarding scan result), head_idx (memory
+  // write), and one per byte lane for partial-overlap forwarding assembly
+  // (low word only — lane sources are never FSD entries).  Duplicate
+  // sdp_dist_ram instances receive identical writes; each provides one async
+  // read port.
   // Valid bits in FFs gate all reads; alloc-time zeroing is unnecessary.
 
   // Write port: resolved CAM match index from data_update
@@ -436,6 +438,24 @@ module store_queue #(
       .o_read_data    (sq_data_head_rd)
   );
 
+  // Byte-lane forwarding reads (set by the forwarding unit's lane selects)
+  logic [(4*IdxWidth)-1:0] fwd_lane_idx_flat;
+  logic [(4*XLEN)-1:0] sq_data_lane_rd_flat;
+
+  for (genvar g_lane = 0; g_lane < 4; g_lane++) begin : gen_sq_data_lane
+    sdp_dist_ram #(
+        .ADDR_WIDTH(IdxWidth),
+        .DATA_WIDTH(XLEN)
+    ) u_sq_data_lane (
+        .i_clk,
+        .i_write_enable (sq_data_we),
+        .i_write_address(sq_data_wr_idx),
+        .i_write_data   (i_data_update.data[XLEN-1:0]),
+        .i_read_address (fwd_lane_idx_flat[g_lane*IdxWidth+:IdxWidth]),
+        .o_read_data    (sq_data_lane_rd_flat[g_lane*XLEN+:XLEN])
+    );
+  end
+
   // ===========================================================================
   // Internal Signals
   // ===========================================================================
@@ -601,9 +621,11 @@ module store_queue #(
       .sq_address_flat           (sq_address_flat),
       .sq_size_flat              (sq_size_flat),
       .sq_data_fwd_rd            (sq_data_fwd_rd),
+      .sq_data_lane_rd_flat      (sq_data_lane_rd_flat),
       .o_sq_all_older_addrs_known(o_sq_all_older_addrs_known),
       .o_sq_forward              (o_sq_forward),
-      .o_fwd_match_idx           (fwd_match_idx)
+      .o_fwd_match_idx           (fwd_match_idx),
+      .o_fwd_lane_idx            (fwd_lane_idx_flat)
   );
 
   // ===========================================================================
@@ -399,6 +399,11 @@ module tomasulo_wrapper #(
     // =========================================================================
     input logic [riscv_pkg::XLEN-1:0] i_csr_read_data,
 
+    // Speculative counter read port (CSRR_CNT): combinational round trip from
+    // the ALU shim to the CSR file's counter read mux.
+    output logic [11:0] o_csr_counter_read_addr,
+    input logic [riscv_pkg::XLEN-1:0] i_csr_counter_read_data,
+
     // =========================================================================
     // Store Queue: Memory Write Interface
     // =========================================================================
@@ -417,6 +422,10 @@ module tomasulo_wrapper #(
     output logic                                       o_lq_mem_addr_valid,
     output logic                 [riscv_pkg::XLEN-1:0] o_lq_mem_read_addr,
     output riscv_pkg::mem_size_e                       o_lq_mem_read_size,
+    // Cached-tier AMO RMW sideband (see load_queue.sv / cached_tier_adapter.sv).
+    output logic                                       o_lq_mem_read_is_amo,
+    output riscv_pkg::instr_op_e                       o_lq_mem_amo_op,
+    output logic                 [riscv_pkg::XLEN-1:0] o_lq_mem_amo_operand,
     input  logic                 [riscv_pkg::XLEN-1:0] i_lq_mem_read_data,
     input  logic                                       i_lq_mem_read_valid,
 
@@ -675,6 +684,7 @@ module tomasulo_wrapper #(
       .i_fu_complete_4(cdb_arb_in_4),
       .i_fu_complete_5(cdb_arb_in_5),
       .i_fu_complete_6(cdb_arb_in_6),
+      .i_rob_head_tag (head_tag),
       .i_kill         (cdb_kill),
       .o_cdb          (cdb_bus_comb),
       .o_cdb_2        (cdb_bus_2_comb),
@@ -1283,8 +1293,12 @@ module tomasulo_wrapper #(
   logic                    fp_mul_busy;
   logic                    fmul_rs_fu_ready;
 
-  assign fmul_rs_fu_ready = i_fmul_rs_fu_ready & ~fp_mul_busy &
-                            ~fp_mul_adapter_result_pending & ~i_backend_recovery_hold;
+  // Pipelined FMA: back-pressure is governed by fp_mul_busy (credit-based
+  // FIFO occupancy in the shim), mirroring the integer MUL path above.
+  assign fmul_rs_fu_ready = i_fmul_rs_fu_ready & ~fp_mul_busy & ~i_backend_recovery_hold;
+
+  logic fp_mul_result_accepted;
+  assign fp_mul_result_accepted = !fp_mul_adapter_result_pending && fp_mul_shim_out.valid;
 
   // ===========================================================================
   // FP_DIV Pipeline: FDIV_RS issue → fp_div_shim → adapter → CDB arbiter slot 6
@@ -2301,6 +2315,8 @@ module tomasulo_wrapper #(
       .i_rs_issue             (int_rs_issue_w),
       .i_issue_writes_cdb_hint(int_rs_issue_writes_cdb_hint),
       .i_csr_read_data        (i_csr_read_data),
+      .o_csr_counter_read_addr(o_csr_counter_read_addr),
+      .i_csr_counter_read_data(i_csr_counter_read_data),
       .o_fu_complete          (alu_shim_out),
       .o_fu_busy              (alu_fu_busy)
   );
@@ -2479,6 +2495,9 @@ module tomasulo_wrapper #(
       .o_mem_addr_valid(o_lq_mem_addr_valid),
       .o_mem_read_addr(o_lq_mem_read_addr),
       .o_mem_read_size(o_lq_mem_read_size),
+      .o_mem_read_is_amo(o_lq_mem_read_is_amo),
+      .o_mem_amo_op(o_lq_mem_amo_op),
+      .o_mem_amo_operand(o_lq_mem_amo_operand),
       .i_mem_read_data(i_lq_mem_read_data),
       .i_mem_read_valid(i_lq_mem_read_valid),
       // AMO writes share the same external data-memory port as load reads.
@@ -2807,18 +2826,19 @@ module tomasulo_wrapper #(
   );
 
   // ===========================================================================
-  // FP Multiply Shim: translate rs_issue_t → FPU mult/FMA → fu_complete_t
+  // FP Multiply Shim: translate rs_issue_t → pipelined FMA → fu_complete_t
   // ===========================================================================
   fp_mul_shim u_fp_mul_shim (
-      .i_clk         (i_clk),
-      .i_rst_n       (i_rst_n),
-      .i_rs_issue    (fmul_rs_issue_w),
-      .o_fu_complete (fp_mul_shim_out),
-      .o_fu_busy     (fp_mul_busy),
-      .i_flush       (speculative_flush_all),
-      .i_flush_en    (speculative_flush_en),
-      .i_flush_tag   (i_flush_tag),
-      .i_rob_head_tag(head_tag)
+      .i_clk          (i_clk),
+      .i_rst_n        (i_rst_n),
+      .i_rs_issue     (fmul_rs_issue_w),
+      .o_fu_complete  (fp_mul_shim_out),
+      .o_fu_busy      (fp_mul_busy),
+      .i_flush        (speculative_flush_all),
+      .i_flush_en     (speculative_flush_en),
+      .i_flush_tag    (i_flush_tag),
+      .i_rob_head_tag (head_tag),
+      .i_fmul_accepted(fp_mul_result_accepted)
   );
 
   // ===========================================================================
@@ -30,7 +30,17 @@
   Software interrupts (msip) support inter-processor communication and kernel-to-kernel
   signaling. The UART interface provides console output, and two general-purpose FIFOs
   support peripheral communication. The memory architecture supports byte-level write
-  granularity.
+  granularity. Cached-tier builds also carry a descriptor-based DMA copy engine that
+  masters the cache hierarchy's DMA line port for full-line memory-to-memory
+  transfers, with MMIO descriptor registers and a completion interrupt on MEIP.
+
+  Multi-core builds (frost_dual) instantiate this module once per core with a distinct
+  HART_ID and EXPORT_LINE_PORT=1: the private cache hierarchy's downstream line port is
+  exported through o_cl_*/i_cl_* instead of terminating in a local DDR bridge, so the
+  top can arbitrate several cores into a shared L2. Inter-core signalling goes through
+  the IPI register (write pulses o_ipi_send; i_ipi_set raises the local msip), the
+  shared hardware mutex handshake (read-to-acquire, write-to-release), and the D-cache
+  flush register that publishes/refreshes shared lines at the level below the cores.
 */
 module cpu_and_mem #(
     parameter int unsigned MEM_SIZE_BYTES = 2 ** 17,
@@ -47,12 +57,18 @@ module cpu_and_mem #(
     parameter int unsigned ENABLE_CACHED_TIER = 1,
     parameter int unsigned CACHED_HAS_L2 = 1,
     parameter int unsigned L1_CACHE_BYTES = 128 * 1024,
+    parameter int unsigned L1_NUM_WAYS = 2,
     parameter int unsigned L1I_CACHE_BYTES = 16 * 1024,
+    parameter int unsigned L1I_NUM_WAYS = 2,
     parameter int unsigned L2_CACHE_BYTES = 2 * 1024 * 1024,
+    parameter int unsigned L2_NUM_WAYS = 1,
     // Behavioral main-memory model (simulation only; hardware integration
     // replaces it with the DDR controller behind the same AXI port).
     parameter int unsigned DDR_MODEL_BYTES = 64 * 1024 * 1024,
     parameter int unsigned DDR_MODEL_LATENCY = 30,
+    // 0 = fixed DDR_MODEL_LATENCY; 1/2 = Genesys2/X3 controller timing
+    // (row buffers, bandwidth cadence, refresh; see axi_behavioral_memory).
+    parameter int unsigned DDR_MODEL_PRESET = 0,
     // 1 = cached tier ends in the behavioral DDR model; 0 = it ends at the
     // o_ddr_axi_*/i_ddr_axi_* ports (hardware DDR controller).
     parameter int unsigned USE_BEHAVIORAL_DDR = 1,
@@ -60,7 +76,14 @@ module cpu_and_mem #(
     // provider over the 1-cycle instruction BRAM (LFSR-gated i_instr_valid +
     // owed-ask tracking).  Exercises the core's fetch-invalid machinery
     // before a real I-cache sits behind it; hardware keeps 0.
-    parameter int unsigned FETCH_VALID_FUZZ = 0
+    parameter int unsigned FETCH_VALID_FUZZ = 0,
+    // Hart index reported by mhartid (distinct per core in multi-core tops).
+    parameter int unsigned HART_ID = 0,
+    // 1 exports the cache hierarchy's downstream line port (o_cl_*/i_cl_*)
+    // instead of ending it in a local DDR bridge: multi-core tops arbitrate
+    // the exported ports into a shared L2 + single DDR bridge. The o_ddr_axi_*
+    // ports quiesce. Requires ENABLE_CACHED_TIER=1.
+    parameter int unsigned EXPORT_LINE_PORT = 0
 ) (
     input logic i_clk,
     input logic i_clk_div4,  // Divided clock for instruction memory programming
@@ -95,9 +118,40 @@ module cpu_and_mem #(
     input  logic        i_fifo1_empty,
     output logic        o_fifo1_rd_en,
 
+    // FIFO fill levels (zero-extended fill counters from the top-level FIFO
+    // instances; feed the FIFO_LEVEL readback and the threshold interrupt)
+    input logic [15:0] i_fifo0_level,
+    input logic [15:0] i_fifo1_level,
+
     // External interrupt input (directly triggers MEIP when high)
     input logic i_external_interrupt,
 
+    // Inter-core signalling (multi-core tops; single-core tops tie i_ipi_set
+    // low and i_hw_mutex_grant high so locks always succeed locally).
+    // o_ipi_send pulses when software writes 1 to the IPI register; the top
+    // routes it to the other core's i_ipi_set, which raises that core's msip.
+    output logic o_ipi_send,
+    input  logic i_ipi_set,
+    // Shared hardware mutex handshake: a read of the mutex register pulses
+    // o_hw_mutex_acquire and must see i_hw_mutex_grant answered in the same
+    // cycle (the top arbitrates concurrent acquires); a write pulses
+    // o_hw_mutex_release.
+    output logic o_hw_mutex_acquire,
+    output logic o_hw_mutex_release,
+    input  logic i_hw_mutex_grant,
+
+    // Exported cluster line port (EXPORT_LINE_PORT=1): the private cache
+    // hierarchy's downstream master, for the multi-core top to arbitrate
+    // into the shared level. Quiescent otherwise.
+    output logic         o_cl_req_valid,
+    input  logic         i_cl_req_ready,
+    output logic         o_cl_req_write,
+    output logic [ 31:0] o_cl_req_addr,
+    output logic [255:0] o_cl_req_wdata,
+    output logic [ 31:0] o_cl_req_wstrb,
+    input  logic         i_cl_resp_valid,
+    input  logic [255:0] i_cl_resp_rdata,
+
     // DDR AXI master (cache-hierarchy bridge). Quiescent when
     // USE_BEHAVIORAL_DDR=1 or the cached tier is disabled.
     output logic         o_ddr_axi_awvalid,
@@ -137,7 +191,7 @@ module cpu_and_mem #(
   // - sw/common/link.ld (MMIO memory region and PROVIDE statements)
   // - cpu module parameters
   localparam int unsigned MmioAddr = 32'h4000_0000;
-  localparam int unsigned MmioSizeBytes = 32'h2C;
+  localparam int unsigned MmioSizeBytes = 32'h98;
   localparam int unsigned UartMmioAddr = 32'h4000_0000;  // UART TX (write-only)
   localparam int unsigned UartRxDataMmioAddr = 32'h4000_0004;  // UART RX data (read consumes byte)
   localparam int unsigned UartRxStatusMmioAddr = 32'h4000_0024;  // RX status (bit0: data available)
@@ -151,6 +205,56 @@ module cpu_and_mem #(
   localparam int unsigned MtimecmpHighMmioAddr = 32'h4000_001C;  // mtimecmp[63:32]
   // Software interrupt register
   localparam int unsigned MsipMmioAddr = 32'h4000_0020;
+  // Inter-core signalling registers (active in multi-core tops; writing them
+  // in a single-core build is harmless and reads behave as documented)
+  localparam int unsigned IpiMmioAddr = 32'h4000_002C;  // write 1: IPI to the other core
+  localparam int unsigned DcacheFlushMmioAddr = 32'h4000_0030;  // write: flush L1D; read: busy
+  localparam int unsigned HwMutexMmioAddr = 32'h4000_0034;  // read 0: acquired; write: release
+  // DMA copy engine descriptor registers (line-granular memory-to-memory
+  // copies through the cache hierarchy's DMA port; see dma_engine.sv)
+  localparam int unsigned DmaSrcMmioAddr = 32'h4000_0038;  // source byte address (line-aligned)
+  localparam int unsigned DmaDstMmioAddr = 32'h4000_003C;  // destination byte address
+  localparam int unsigned DmaLenMmioAddr = 32'h4000_0040;  // length in bytes (rounded to lines)
+  localparam int unsigned DmaCtrlMmioAddr = 32'h4000_0044;  // write: start/irq-en; read: status
+  // UART TX drain interrupt enable (bit 0). While set, MEIP is asserted
+  // whenever the TX path can accept a byte, so software can refill from a
+  // ring buffer instead of spin-waiting on UART_TX_STATUS. Level-sensitive:
+  // the handler clears the enable once its ring is empty.
+  localparam int unsigned UartTxCtrlMmioAddr = 32'h4000_0048;
+  // Commit-trace buffer: branches-only {PC, cycle-delta} ring for on-hardware
+  // profiling (see peripherals/commit_trace_buffer.sv for the register
+  // contract and fpga/decode_commit_trace.py for the host-side decode)
+  localparam int unsigned TraceCtrlMmioAddr = 32'h4000_004C;  // bit 0 enable, bit 1 clear
+  localparam int unsigned TraceStatusMmioAddr = 32'h4000_0050;  // entry count (read-only)
+  localparam int unsigned TraceDataLoMmioAddr = 32'h4000_0054;  // oldest entry {pc[31:1], taken}
+  localparam int unsigned TraceDataHiMmioAddr = 32'h4000_0058;  // cycle delta; read pops entry
+  localparam int unsigned TraceFilterLoMmioAddr = 32'h4000_005C;  // inclusive lower PC bound
+  localparam int unsigned TraceFilterHiMmioAddr = 32'h4000_0060;  // exclusive upper bound (0=none)
+  localparam int unsigned TraceTriggerMmioAddr = 32'h4000_0064;  // start-trigger PC (0=immediate)
+
+  // CRC-32 accumulator (crc32_unit.sv): word/byte stores fold data into the
+  // running CRC, replacing bytewise software loops on the ingest path
+  localparam int unsigned CrcStateMmioAddr = 32'h4000_0068;  // write: seed; read: state
+  localparam int unsigned CrcDataWordMmioAddr = 32'h4000_006C;  // write folds 4 bytes (write-only)
+  localparam int unsigned CrcDataByteMmioAddr = 32'h4000_0070;  // write folds bits [7:0] (write-only)
+
+  // FIFO fill levels and programmable threshold interrupt: lets ingest
+  // firmware batch its drains (or sleep until data builds up) instead of
+  // polling the FIFO head word by word
+  localparam int unsigned FifoLevelMmioAddr = 32'h4000_0074;  // {fifo1 level, fifo0 level} (read-only)
+  localparam int unsigned FifoThreshMmioAddr = 32'h4000_0078;  // {fifo1 thresh, fifo0 thresh}; 0 = off
+  // DMA ring-ingest pointers (FIFO0 drained into a DDR ring so firmware
+  // parses arriving data in place; see dma_engine.sv)
+  localparam int unsigned DmaRingWptrMmioAddr = 32'h4000_007C;  // committed write pointer (read-only)
+  localparam int unsigned DmaRingRptrMmioAddr = 32'h4000_0080;  // firmware consume pointer
+  // FIFO arrival timestamps: mtime latched on each empty-to-non-empty
+  // transition of a data FIFO, one per burst, popped alongside the data
+  // (see peripherals/fifo_timestamp_latch.sv)
+  localparam int unsigned FifoTsStatusMmioAddr = 32'h4000_0084;  // {fifo1 pending, fifo0 pending}
+  localparam int unsigned Fifo0TsLoMmioAddr = 32'h4000_0088;  // oldest stamp mtime[31:0]
+  localparam int unsigned Fifo0TsHiMmioAddr = 32'h4000_008C;  // mtime[63:32]; read pops entry
+  localparam int unsigned Fifo1TsLoMmioAddr = 32'h4000_0090;  // oldest stamp mtime[31:0]
+  localparam int unsigned Fifo1TsHiMmioAddr = 32'h4000_0094;  // mtime[63:32]; read pops entry
 
   // Timer register defaults
   // Default mtimecmp to max value so no timer interrupt fires until software configures it
@@ -209,15 +313,83 @@ module cpu_and_mem #(
   // low range unchanged.
   logic [ 3:0] data_memory_cached_byte_write_enable;
   logic        data_memory_cached_read_enable;
+  // Cached-tier AMO RMW sideband riding the cached read enable: the adapter
+  // applies the new value at the cache when the old word returns.
+  logic        data_memory_cached_read_is_amo;
+  riscv_pkg::instr_op_e data_memory_cached_amo_op;
+  logic [31:0] data_memory_cached_amo_operand;
   logic [31:0] data_memory_cached_read_data;
   logic        data_memory_cached_read_valid;
   logic        data_memory_cached_write_done;
   logic        data_memory_cached_write_inflight;
+  logic        data_memory_cached_write_no_combine;
+  // Adapter write-combine buffer fully drained (gates the fence.i cache sync).
+  logic        data_memory_cached_flush_idle;
   // Cached-tier write data: SQ-store drain data, or the AMO new value on the
   // cycle a cached AMO read-modify-write launches (the router muxes the two).
   // Kept separate from data_memory_write_data so the cached write path stays
   // off the wide BRAM write-data cascade.
   logic [31:0] data_memory_cached_write_data;
+  // D-cache flush request (MMIO-triggered cache maintenance): held until the
+  // hierarchy's writeback+invalidate walk reports done. Software polls the
+  // register until it reads 0.
+  logic        dcache_flush_pending;
+  logic        dcache_flush_done;
+  // DMA copy engine register readback and status (engine lives in the cached
+  // tier generate; the no-tier branch completes starts immediately so stray
+  // software cannot hang on a done poll).
+  logic [31:0] dma_src;
+  logic [31:0] dma_dst;
+  logic [31:0] dma_len;
+  logic        dma_busy;
+  logic        dma_done;
+  logic        dma_irq_en;
+  logic        dma_irq;
+  logic        dma_src_wr_en;
+  logic        dma_dst_wr_en;
+  logic        dma_len_wr_en;
+  logic        dma_ctrl_wr_en;
+  // DMA ring-ingest mode: FIFO0 drain request from the engine, the committed
+  // write pointer, and the firmware consume pointer register
+  logic        dma_fifo0_rd_en;
+  logic [31:0] dma_ring_wptr;
+  logic [31:0] dma_ring_rptr;
+  logic        dma_ring_rptr_wr_en;
+  logic        dma_ring_active;
+  // FIFO threshold-interrupt register and its registered compare result
+  logic [31:0] fifo_thresh;
+  logic        fifo_thresh_irq;
+  // FIFO arrival-timestamp latches: head readbacks, pending counts and the
+  // destructive TS_HI read pops
+  logic [31:0] fifo0_ts_lo, fifo0_ts_hi;
+  logic [31:0] fifo1_ts_lo, fifo1_ts_hi;
+  logic [ 3:0] fifo0_ts_count, fifo1_ts_count;
+  logic        fifo0_ts_pop;
+  logic        fifo1_ts_pop;
+  // UART TX drain interrupt enable (software ring refill; see UartTxCtrlMmioAddr)
+  logic        uart_tx_irq_en;
+  // Commit-trace buffer: committed-branch stream from the core and the
+  // peripheral's register readback (see TraceCtrlMmioAddr block)
+  logic        commit_trace_valid;
+  logic [31:0] commit_trace_pc;
+  logic        commit_trace_taken;
+  logic [31:0] trace_ctrl;
+  logic [31:0] trace_status;
+  logic [31:0] trace_data_lo;
+  logic [31:0] trace_data_hi;
+  logic [31:0] trace_filter_lo;
+  logic [31:0] trace_filter_hi;
+  logic [31:0] trace_trigger;
+  logic        trace_ctrl_wr_en;
+  logic        trace_filter_lo_wr_en;
+  logic        trace_filter_hi_wr_en;
+  logic        trace_trigger_wr_en;
+  logic        trace_data_pop;
+  // CRC-32 accumulator readback and write strobes (see CrcStateMmioAddr block)
+  logic [31:0] crc_state;
+  logic        crc_state_wr_en;
+  logic        crc_data_word_wr_en;
+  logic        crc_data_byte_wr_en;
   logic        mmio_read_pulse;
   logic        mmio_fifo0_read_pulse;
   logic        mmio_fifo1_read_pulse;
@@ -237,7 +409,11 @@ module cpu_and_mem #(
   riscv_pkg::interrupt_t        interrupts;
   // Clamp unknown external interrupt values to 0 for simulation stability.
   // This avoids X-propagation into mip when the top-level input is left un-driven.
-  assign interrupts.meip = (i_external_interrupt === 1'b1);
+  // The DMA completion, UART TX drain and FIFO threshold interrupts share
+  // MEIP (there is no PLIC); the handler reads the DMA and UART TX control
+  // registers and the FIFO levels to identify and acknowledge them.
+  assign interrupts.meip = (i_external_interrupt === 1'b1) || dma_irq ||
+                           (uart_tx_irq_en && i_uart_tx_ready) || fifo_thresh_irq;
   assign interrupts.msip = msip;
 
   // Timer interrupt: register the 64-bit comparison result to break critical timing path.
@@ -256,6 +432,7 @@ module cpu_and_mem #(
       .MEM_BYTE_ADDR_WIDTH(MemByteAddrWidth),
       .MMIO_ADDR(MmioAddr),
       .MMIO_SIZE_BYTES(MmioSizeBytes),
+      .HART_ID(HART_ID),
       .CACHED_BASE(CACHED_BASE),
       .CACHED_SIZE_BYTES(CACHED_SIZE_BYTES)
   ) cpu_inst (
@@ -280,6 +457,10 @@ module cpu_and_mem #(
       .o_data_mem_cached_byte_wr_en(data_memory_cached_byte_write_enable),
       .o_data_mem_cached_wr_data(data_memory_cached_write_data),
       .o_data_mem_cached_read_enable(data_memory_cached_read_enable),
+      .o_data_mem_cached_read_is_amo(data_memory_cached_read_is_amo),
+      .o_data_mem_cached_amo_op(data_memory_cached_amo_op),
+      .o_data_mem_cached_amo_operand(data_memory_cached_amo_operand),
+      .o_data_mem_cached_write_no_combine(data_memory_cached_write_no_combine),
       .i_cached_read_data(data_memory_cached_read_data),
       .i_cached_read_valid(data_memory_cached_read_valid),
       .i_cached_write_done(data_memory_cached_write_done),
@@ -290,6 +471,9 @@ module cpu_and_mem #(
       .o_mmio_fifo0_read_pulse(mmio_fifo0_read_pulse),
       .o_mmio_fifo1_read_pulse(mmio_fifo1_read_pulse),
       .o_mmio_uart_rx_ready_pulse(mmio_uart_rx_ready_pulse),
+      .o_commit_trace_valid(commit_trace_valid),
+      .o_commit_trace_pc(commit_trace_pc),
+      .o_commit_trace_taken(commit_trace_taken),
       .i_data_mem_rd_data(data_memory_or_peripheral_read_data),
       .o_rst_done(/*not connected*/),
       .o_vld   (/*not connected*/),
@@ -435,11 +619,15 @@ module cpu_and_mem #(
     assign instruction_bank_sel_r = fetch_high_valid_q ? cached_fetch_bank_sel_r :
                                                          bram_fetch_bank_sel_cpu_r;
 
-    // High-address provider: two-line L1I fetch buffer for cached/DDR code.
-    // It no longer drives the low-BRAM address pins; that path stays direct
+    // High-address provider: direct-mapped L1I fetch buffer for cached/DDR
+    // code.  8 lines (256 B) acts as a loop buffer: hot loops spanning up to
+    // that many lines replay from the buffer with no line-port traffic.  It
+    // no longer drives the low-BRAM address pins; that path stays direct
     // above for timing and IPC.
     fetch_provider #(
-        .LINE_BYTES(32)
+        .LINE_BYTES(32),
+        .BUFFER_LINES(8),
+        .PREFETCH_LINES(3)
     ) u_fetch_provider (
         .i_clk(i_clk),
         .i_rst(i_rst),
@@ -565,6 +753,7 @@ module cpu_and_mem #(
     logic [31:0] line_req_wstrb;
     logic line_resp_valid;
     logic [255:0] line_resp_rdata;
+    logic line_resp_write;
 
     cached_tier_adapter #(
         .XLEN(32),
@@ -574,12 +763,18 @@ module cpu_and_mem #(
         .i_rst(i_rst),
         .i_read_req(data_memory_cached_read_enable),
         .i_req_addr(data_memory_address),
+        .i_read_is_amo(data_memory_cached_read_is_amo),
+        .i_amo_op(data_memory_cached_amo_op),
+        .i_amo_operand(data_memory_cached_amo_operand),
         .i_write_byte_en(data_memory_cached_byte_write_enable),
         .i_write_data(data_memory_cached_write_data),
+        .i_write_no_combine(data_memory_cached_write_no_combine),
+        .i_flush_req(fence_i_sync_req),
         .o_read_data(data_memory_cached_read_data),
         .o_read_valid(data_memory_cached_read_valid),
         .o_write_done(data_memory_cached_write_done),
         .o_write_inflight(data_memory_cached_write_inflight),
+        .o_flush_idle(data_memory_cached_flush_idle),
         .o_line_req_valid(line_req_valid),
         .i_line_req_ready(line_req_ready),
         .o_line_req_write(line_req_write),
@@ -587,7 +782,8 @@ module cpu_and_mem #(
         .o_line_req_wdata(line_req_wdata),
         .o_line_req_wstrb(line_req_wstrb),
         .i_line_resp_valid(line_resp_valid),
-        .i_line_resp_rdata(line_resp_rdata)
+        .i_line_resp_rdata(line_resp_rdata),
+        .i_line_resp_write(line_resp_write)
     );
 
     logic down_req_valid, down_req_ready, down_req_write;
@@ -597,13 +793,59 @@ module cpu_and_mem #(
     logic down_resp_valid;
     logic [255:0] down_resp_rdata;
 
+    logic dma_line_req_valid, dma_line_req_ready, dma_line_req_write;
+    logic [31:0] dma_line_req_addr;
+    logic [255:0] dma_line_req_wdata;
+    logic [31:0] dma_line_req_wstrb;
+    logic dma_line_resp_valid;
+    logic [255:0] dma_line_resp_rdata;
+
+    // DMA copy engine: full-line memory-to-memory transfers mastering the
+    // hierarchy's DMA line port (below the L1s, above the shared level).
+    dma_engine #(
+        .ADDR_WIDTH(32),
+        .LINE_BYTES(32)
+    ) dma_copy_engine (
+        .i_clk(i_clk),
+        .i_rst(i_rst),
+        .i_src_wr_en(dma_src_wr_en),
+        .i_dst_wr_en(dma_dst_wr_en),
+        .i_len_wr_en(dma_len_wr_en),
+        .i_ctrl_wr_en(dma_ctrl_wr_en),
+        .i_wr_data(data_memory_write_data_registered),
+        .o_src(dma_src),
+        .o_dst(dma_dst),
+        .o_len(dma_len),
+        .o_busy(dma_busy),
+        .o_done(dma_done),
+        .o_irq_en(dma_irq_en),
+        .o_irq(dma_irq),
+        .i_fifo_rd_data(i_fifo0_rd_data),
+        .i_fifo_empty(i_fifo0_empty),
+        .o_fifo_rd_en(dma_fifo0_rd_en),
+        .o_ring_wptr(dma_ring_wptr),
+        .i_ring_rptr(dma_ring_rptr),
+        .o_ring_active(dma_ring_active),
+        .o_line_req_valid(dma_line_req_valid),
+        .i_line_req_ready(dma_line_req_ready),
+        .o_line_req_write(dma_line_req_write),
+        .o_line_req_addr(dma_line_req_addr),
+        .o_line_req_wdata(dma_line_req_wdata),
+        .o_line_req_wstrb(dma_line_req_wstrb),
+        .i_line_resp_valid(dma_line_resp_valid),
+        .i_line_resp_rdata(dma_line_resp_rdata)
+    );
+
     frost_cache_hierarchy #(
         .ADDR_WIDTH(32),
         .LINE_BYTES(32),
         .HAS_L2(CACHED_HAS_L2),
         .L1_CACHE_BYTES(L1_CACHE_BYTES),
+        .L1_NUM_WAYS(L1_NUM_WAYS),
         .L1I_CACHE_BYTES(L1I_CACHE_BYTES),
-        .L2_CACHE_BYTES(L2_CACHE_BYTES)
+        .L1I_NUM_WAYS(L1I_NUM_WAYS),
+        .L2_CACHE_BYTES(L2_CACHE_BYTES),
+        .L2_NUM_WAYS(L2_NUM_WAYS)
     ) cache_hierarchy (
         .i_clk(i_clk),
         .i_rst(i_rst),
@@ -615,6 +857,7 @@ module cpu_and_mem #(
         .i_up_req_wstrb(line_req_wstrb),
         .o_up_resp_valid(line_resp_valid),
         .o_up_resp_rdata(line_resp_rdata),
+        .o_up_resp_write(line_resp_write),
         .i_iup_req_valid(iup_req_valid),
         .o_iup_req_ready(iup_req_ready),
         .i_iup_req_write(iup_req_write),
@@ -623,8 +866,22 @@ module cpu_and_mem #(
         .i_iup_req_wstrb(iup_req_wstrb),
         .o_iup_resp_valid(iup_resp_valid),
         .o_iup_resp_rdata(iup_resp_rdata),
-        .i_fence_sync(fence_i_sync_req),
+        .i_dma_req_valid(dma_line_req_valid),
+        .o_dma_req_ready(dma_line_req_ready),
+        .i_dma_req_write(dma_line_req_write),
+        .i_dma_req_addr(dma_line_req_addr),
+        .i_dma_req_wdata(dma_line_req_wdata),
+        .i_dma_req_wstrb(dma_line_req_wstrb),
+        .o_dma_resp_valid(dma_line_resp_valid),
+        .o_dma_resp_rdata(dma_line_resp_rdata),
+        // Hold the sync until the adapter's write-combine buffer has drained:
+        // the L1D writeback-all must observe every early-acked store.
+        .i_fence_sync(fence_i_sync_req && data_memory_cached_flush_idle),
         .o_fence_done(fence_i_sync_done),
+        // Same write-combine drain gating as the fence sync: the flush's
+        // writeback-all must observe every early-acked store.
+        .i_dflush_sync(dcache_flush_pending && data_memory_cached_flush_idle),
+        .o_dflush_done(dcache_flush_done),
         .o_down_req_valid(down_req_valid),
         .i_down_req_ready(down_req_ready),
         .o_down_req_write(down_req_write),
@@ -635,134 +892,172 @@ module cpu_and_mem #(
         .i_down_resp_rdata(down_resp_rdata)
     );
 
-    logic axi_awvalid, axi_awready, axi_wvalid, axi_wready, axi_bvalid, axi_bready;
-    logic axi_arvalid, axi_arready, axi_rvalid, axi_rready, axi_rlast, axi_wlast;
-    logic [31:0] axi_awaddr, axi_araddr;
-    logic [7:0] axi_awlen, axi_arlen;
-    logic [2:0] axi_awsize, axi_arsize;
-    logic [1:0] axi_awburst, axi_arburst, axi_bresp, axi_rresp;
-    logic [255:0] axi_wdata, axi_rdata;
-    logic [31:0] axi_wstrb;
+    if (EXPORT_LINE_PORT != 0) begin : gen_cluster_line_export
+      // Multi-core top owns the shared level and the single DDR bridge:
+      // hand the hierarchy's downstream master out of the module and
+      // quiesce the local DDR AXI port.
+      assign o_cl_req_valid = down_req_valid;
+      assign down_req_ready = i_cl_req_ready;
+      assign o_cl_req_write = down_req_write;
+      assign o_cl_req_addr = down_req_addr;
+      assign o_cl_req_wdata = down_req_wdata;
+      assign o_cl_req_wstrb = down_req_wstrb;
+      assign down_resp_valid = i_cl_resp_valid;
+      assign down_resp_rdata = i_cl_resp_rdata;
+      assign o_ddr_axi_awvalid = 1'b0;
+      assign o_ddr_axi_awaddr = '0;
+      assign o_ddr_axi_awlen = '0;
+      assign o_ddr_axi_awsize = '0;
+      assign o_ddr_axi_awburst = '0;
+      assign o_ddr_axi_wvalid = 1'b0;
+      assign o_ddr_axi_wdata = '0;
+      assign o_ddr_axi_wstrb = '0;
+      assign o_ddr_axi_wlast = 1'b0;
+      assign o_ddr_axi_bready = 1'b0;
+      assign o_ddr_axi_arvalid = 1'b0;
+      assign o_ddr_axi_araddr = '0;
+      assign o_ddr_axi_arlen = '0;
+      assign o_ddr_axi_arsize = '0;
+      assign o_ddr_axi_arburst = '0;
+      assign o_ddr_axi_rready = 1'b0;
+    end else begin : gen_local_ddr_bridge
+      logic axi_awvalid, axi_awready, axi_wvalid, axi_wready, axi_bvalid, axi_bready;
+      logic axi_arvalid, axi_arready, axi_rvalid, axi_rready, axi_rlast, axi_wlast;
+      logic [31:0] axi_awaddr, axi_araddr;
+      logic [7:0] axi_awlen, axi_arlen;
+      logic [2:0] axi_awsize, axi_arsize;
+      logic [1:0] axi_awburst, axi_arburst, axi_bresp, axi_rresp;
+      logic [255:0] axi_wdata, axi_rdata;
+      logic [31:0] axi_wstrb;
 
-    line_port_axi_bridge #(
-        .ADDR_WIDTH(32),
-        .LINE_BYTES(32),
-        .BASE_ADDR (CACHED_BASE)
-    ) ddr_bridge (
-        .i_clk(i_clk),
-        .i_rst(i_rst),
-        .i_req_valid(down_req_valid),
-        .o_req_ready(down_req_ready),
-        .i_req_write(down_req_write),
-        .i_req_addr(down_req_addr),
-        .i_req_wdata(down_req_wdata),
-        .i_req_wstrb(down_req_wstrb),
-        .o_resp_valid(down_resp_valid),
-        .o_resp_rdata(down_resp_rdata),
-        .o_axi_awvalid(axi_awvalid),
-        .i_axi_awready(axi_awready),
-        .o_axi_awaddr(axi_awaddr),
-        .o_axi_awlen(axi_awlen),
-        .o_axi_awsize(axi_awsize),
-        .o_axi_awburst(axi_awburst),
-        .o_axi_wvalid(axi_wvalid),
-        .i_axi_wready(axi_wready),
-        .o_axi_wdata(axi_wdata),
-        .o_axi_wstrb(axi_wstrb),
-        .o_axi_wlast(axi_wlast),
-        .i_axi_bvalid(axi_bvalid),
-        .o_axi_bready(axi_bready),
-        .i_axi_bresp(axi_bresp),
-        .o_axi_arvalid(axi_arvalid),
-        .i_axi_arready(axi_arready),
-        .o_axi_araddr(axi_araddr),
-        .o_axi_arlen(axi_arlen),
-        .o_axi_arsize(axi_arsize),
-        .o_axi_arburst(axi_arburst),
-        .i_axi_rvalid(axi_rvalid),
-        .o_axi_rready(axi_rready),
-        .i_axi_rdata(axi_rdata),
-        .i_axi_rresp(axi_rresp),
-        .i_axi_rlast(axi_rlast)
-    );
+      // Cluster line port unused when the bridge is local.
+      assign o_cl_req_valid = 1'b0;
+      assign o_cl_req_write = 1'b0;
+      assign o_cl_req_addr = '0;
+      assign o_cl_req_wdata = '0;
+      assign o_cl_req_wstrb = '0;
 
-    if (USE_BEHAVIORAL_DDR != 0) begin : gen_behavioral_ddr
-      // SIMULATION-ONLY main memory; hardware sets USE_BEHAVIORAL_DDR=0 and
-      // takes the bridge's AXI out through the o_ddr_axi_* ports instead.
-      axi_behavioral_memory #(
+      line_port_axi_bridge #(
+          .ADDR_WIDTH(32),
           .LINE_BYTES(32),
-          .MEM_BYTES(DDR_MODEL_BYTES),
-          .LATENCY(DDR_MODEL_LATENCY),
-          .USE_INIT_FILE(1'b1),
-          .INIT_FILE("sw_ddr.mem")
-      ) ddr_model (
+          .BASE_ADDR (CACHED_BASE)
+      ) ddr_bridge (
           .i_clk(i_clk),
           .i_rst(i_rst),
-          .i_axi_awvalid(axi_awvalid),
-          .o_axi_awready(axi_awready),
-          .i_axi_awaddr(axi_awaddr),
-          .i_axi_awlen(axi_awlen),
-          .i_axi_wvalid(axi_wvalid),
-          .o_axi_wready(axi_wready),
-          .i_axi_wdata(axi_wdata),
-          .i_axi_wstrb(axi_wstrb),
-          .o_axi_bvalid(axi_bvalid),
-          .i_axi_bready(axi_bready),
-          .o_axi_bresp(axi_bresp),
-          .i_axi_arvalid(axi_arvalid),
-          .o_axi_arready(axi_arready),
-          .i_axi_araddr(axi_araddr),
-          .i_axi_arlen(axi_arlen),
-          .o_axi_rvalid(axi_rvalid),
-          .i_axi_rready(axi_rready),
-          .o_axi_rdata(axi_rdata),
-          .o_axi_rresp(axi_rresp),
-          .o_axi_rlast(axi_rlast)
+          .i_req_valid(down_req_valid),
+          .o_req_ready(down_req_ready),
+          .i_req_write(down_req_write),
+          .i_req_addr(down_req_addr),
+          .i_req_wdata(down_req_wdata),
+          .i_req_wstrb(down_req_wstrb),
+          .o_resp_valid(down_resp_valid),
+          .o_resp_rdata(down_resp_rdata),
+          .o_axi_awvalid(axi_awvalid),
+          .i_axi_awready(axi_awready),
+          .o_axi_awaddr(axi_awaddr),
+          .o_axi_awlen(axi_awlen),
+          .o_axi_awsize(axi_awsize),
+          .o_axi_awburst(axi_awburst),
+          .o_axi_wvalid(axi_wvalid),
+          .i_axi_wready(axi_wready),
+          .o_axi_wdata(axi_wdata),
+          .o_axi_wstrb(axi_wstrb),
+          .o_axi_wlast(axi_wlast),
+          .i_axi_bvalid(axi_bvalid),
+          .o_axi_bready(axi_bready),
+          .i_axi_bresp(axi_bresp),
+          .o_axi_arvalid(axi_arvalid),
+          .i_axi_arready(axi_arready),
+          .o_axi_araddr(axi_araddr),
+          .o_axi_arlen(axi_arlen),
+          .o_axi_arsize(axi_arsize),
+          .o_axi_arburst(axi_arburst),
+          .i_axi_rvalid(axi_rvalid),
+          .o_axi_rready(axi_rready),
+          .i_axi_rdata(axi_rdata),
+          .i_axi_rresp(axi_rresp),
+          .i_axi_rlast(axi_rlast)
       );
-      assign o_ddr_axi_awvalid = 1'b0;
-      assign o_ddr_axi_awaddr  = '0;
-      assign o_ddr_axi_awlen   = '0;
-      assign o_ddr_axi_awsize  = '0;
-      assign o_ddr_axi_awburst = '0;
-      assign o_ddr_axi_wvalid  = 1'b0;
-      assign o_ddr_axi_wdata   = '0;
-      assign o_ddr_axi_wstrb   = '0;
-      assign o_ddr_axi_wlast   = 1'b0;
-      assign o_ddr_axi_bready  = 1'b0;
-      assign o_ddr_axi_arvalid = 1'b0;
-      assign o_ddr_axi_araddr  = '0;
-      assign o_ddr_axi_arlen   = '0;
-      assign o_ddr_axi_arsize  = '0;
-      assign o_ddr_axi_arburst = '0;
-      assign o_ddr_axi_rready  = 1'b0;
-    end else begin : gen_ddr_axi_export
-      // Hardware: the bridge's AXI master goes out to the board's DDR
-      // controller subsystem.
-      assign o_ddr_axi_awvalid = axi_awvalid;
-      assign axi_awready = i_ddr_axi_awready;
-      assign o_ddr_axi_awaddr = axi_awaddr;
-      assign o_ddr_axi_awlen = axi_awlen;
-      assign o_ddr_axi_awsize = axi_awsize;
-      assign o_ddr_axi_awburst = axi_awburst;
-      assign o_ddr_axi_wvalid = axi_wvalid;
-      assign axi_wready = i_ddr_axi_wready;
-      assign o_ddr_axi_wdata = axi_wdata;
-      assign o_ddr_axi_wstrb = axi_wstrb;
-      assign o_ddr_axi_wlast = axi_wlast;
-      assign axi_bvalid = i_ddr_axi_bvalid;
-      assign o_ddr_axi_bready = axi_bready;
-      assign axi_bresp = i_ddr_axi_bresp;
-      assign o_ddr_axi_arvalid = axi_arvalid;
-      assign axi_arready = i_ddr_axi_arready;
-      assign o_ddr_axi_araddr = axi_araddr;
-      assign o_ddr_axi_arlen = axi_arlen;
-      assign o_ddr_axi_arsize = axi_arsize;
-      assign o_ddr_axi_arburst = axi_arburst;
-      assign axi_rvalid = i_ddr_axi_rvalid;
-      assign o_ddr_axi_rready = axi_rready;
-      assign axi_rdata = i_ddr_axi_rdata;
-      assign axi_rresp = i_ddr_axi_rresp;
-      assign axi_rlast = i_ddr_axi_rlast;
+
+      if (USE_BEHAVIORAL_DDR != 0) begin : gen_behavioral_ddr
+        // SIMULATION-ONLY main memory; hardware sets USE_BEHAVIORAL_DDR=0 and
+        // takes the bridge's AXI out through the o_ddr_axi_* ports instead.
+        axi_behavioral_memory #(
+            .LINE_BYTES(32),
+            .MEM_BYTES(DDR_MODEL_BYTES),
+            .LATENCY(DDR_MODEL_LATENCY),
+            .USE_INIT_FILE(1'b1),
+            .INIT_FILE("sw_ddr.mem"),
+            .TIMING_PRESET(DDR_MODEL_PRESET)
+        ) ddr_model (
+            .i_clk(i_clk),
+            .i_rst(i_rst),
+            .i_axi_awvalid(axi_awvalid),
+            .o_axi_awready(axi_awready),
+            .i_axi_awaddr(axi_awaddr),
+            .i_axi_awlen(axi_awlen),
+            .i_axi_wvalid(axi_wvalid),
+            .o_axi_wready(axi_wready),
+            .i_axi_wdata(axi_wdata),
+            .i_axi_wstrb(axi_wstrb),
+            .o_axi_bvalid(axi_bvalid),
+            .i_axi_bready(axi_bready),
+            .o_axi_bresp(axi_bresp),
+            .i_axi_arvalid(axi_arvalid),
+            .o_axi_arready(axi_arready),
+            .i_axi_araddr(axi_araddr),
+            .i_axi_arlen(axi_arlen),
+            .o_axi_rvalid(axi_rvalid),
+            .i_axi_rready(axi_rready),
+            .o_axi_rdata(axi_rdata),
+            .o_axi_rresp(axi_rresp),
+            .o_axi_rlast(axi_rlast)
+        );
+        assign o_ddr_axi_awvalid = 1'b0;
+        assign o_ddr_axi_awaddr  = '0;
+        assign o_ddr_axi_awlen   = '0;
+        assign o_ddr_axi_awsize  = '0;
+        assign o_ddr_axi_awburst = '0;
+        assign o_ddr_axi_wvalid  = 1'b0;
+        assign o_ddr_axi_wdata   = '0;
+        assign o_ddr_axi_wstrb   = '0;
+        assign o_ddr_axi_wlast   = 1'b0;
+        assign o_ddr_axi_bready  = 1'b0;
+        assign o_ddr_axi_arvalid = 1'b0;
+        assign o_ddr_axi_araddr  = '0;
+        assign o_ddr_axi_arlen   = '0;
+        assign o_ddr_axi_arsize  = '0;
+        assign o_ddr_axi_arburst = '0;
+        assign o_ddr_axi_rready  = 1'b0;
+      end else begin : gen_ddr_axi_export
+        // Hardware: the bridge's AXI master goes out to the board's DDR
+        // controller subsystem.
+        assign o_ddr_axi_awvalid = axi_awvalid;
+        assign axi_awready = i_ddr_axi_awready;
+        assign o_ddr_axi_awaddr = axi_awaddr;
+        assign o_ddr_axi_awlen = axi_awlen;
+        assign o_ddr_axi_awsize = axi_awsize;
+        assign o_ddr_axi_awburst = axi_awburst;
+        assign o_ddr_axi_wvalid = axi_wvalid;
+        assign axi_wready = i_ddr_axi_wready;
+        assign o_ddr_axi_wdata = axi_wdata;
+        assign o_ddr_axi_wstrb = axi_wstrb;
+        assign o_ddr_axi_wlast = axi_wlast;
+        assign axi_bvalid = i_ddr_axi_bvalid;
+        assign o_ddr_axi_bready = axi_bready;
+        assign axi_bresp = i_ddr_axi_bresp;
+        assign o_ddr_axi_arvalid = axi_arvalid;
+        assign axi_arready = i_ddr_axi_arready;
+        assign o_ddr_axi_araddr = axi_araddr;
+        assign o_ddr_axi_arlen = axi_arlen;
+        assign o_ddr_axi_arsize = axi_arsize;
+        assign o_ddr_axi_arburst = axi_arburst;
+        assign axi_rvalid = i_ddr_axi_rvalid;
+        assign o_ddr_axi_rready = axi_rready;
+        assign axi_rdata = i_ddr_axi_rdata;
+        assign axi_rresp = i_ddr_axi_rresp;
+        assign axi_rlast = i_ddr_axi_rlast;
+      end
     end
   end else begin : gen_no_cached_tier
     // No hierarchy: the instruction-side line port has no slave.
@@ -785,6 +1080,29 @@ module cpu_and_mem #(
     end
     assign data_memory_cached_read_data = '0;
     assign data_memory_cached_write_inflight = 1'b0;
+    assign data_memory_cached_flush_idle = 1'b1;
+    // No caches to flush: the D-cache flush request completes immediately.
+    assign dcache_flush_done = dcache_flush_pending;
+    // No DMA engine without the cached tier (nothing for it to master).
+    // Starts complete immediately so a stray done poll cannot hang.
+    always_ff @(posedge i_clk) begin
+      if (i_rst) dma_done <= 1'b0;
+      else if (dma_ctrl_wr_en) dma_done <= data_memory_write_data_registered[0];
+    end
+    assign dma_src = '0;
+    assign dma_dst = '0;
+    assign dma_len = '0;
+    assign dma_busy = 1'b0;
+    assign dma_irq_en = 1'b0;
+    assign dma_irq = 1'b0;
+    assign dma_fifo0_rd_en = 1'b0;
+    assign dma_ring_wptr = '0;
+    assign dma_ring_active = 1'b0;
+    assign o_cl_req_valid = 1'b0;
+    assign o_cl_req_write = 1'b0;
+    assign o_cl_req_addr = '0;
+    assign o_cl_req_wdata = '0;
+    assign o_cl_req_wstrb = '0;
     assign o_ddr_axi_awvalid = 1'b0;
     assign o_ddr_axi_awaddr = '0;
     assign o_ddr_axi_awlen = '0;
@@ -836,6 +1154,43 @@ module cpu_and_mem #(
       MtimecmpLowMmioAddr:  mmio_read_data_comb = mtimecmp[31:0];
       MtimecmpHighMmioAddr: mmio_read_data_comb = mtimecmp[63:32];
       MsipMmioAddr:         mmio_read_data_comb = {31'b0, msip};
+      // D-cache flush busy: software writes the register then polls until 0.
+      DcacheFlushMmioAddr:  mmio_read_data_comb = {31'b0, dcache_flush_pending};
+      // Hardware mutex: the read itself is the acquire attempt; 0 = acquired
+      // (the top granted this core), 1 = busy. Grant answers the acquire
+      // pulse combinationally, in the same cycle as this capture.
+      HwMutexMmioAddr:      mmio_read_data_comb = {31'b0, ~i_hw_mutex_grant};
+      // DMA descriptor readback and status ({irq_en, done, busy}).
+      DmaSrcMmioAddr:       mmio_read_data_comb = dma_src;
+      DmaDstMmioAddr:       mmio_read_data_comb = dma_dst;
+      DmaLenMmioAddr:       mmio_read_data_comb = dma_len;
+      DmaCtrlMmioAddr:      mmio_read_data_comb = {28'b0, dma_ring_active, dma_irq_en,
+                                                    dma_done, dma_busy};
+      // UART TX control - bit 0 is the drain interrupt enable
+      UartTxCtrlMmioAddr:   mmio_read_data_comb = {31'b0, uart_tx_irq_en};
+      // Commit-trace buffer: the DATA_HI read pops the oldest entry (the pop
+      // pulse rides the same exactly-once read capture as the mutex acquire).
+      TraceCtrlMmioAddr:    mmio_read_data_comb = trace_ctrl;
+      TraceStatusMmioAddr:  mmio_read_data_comb = trace_status;
+      TraceDataLoMmioAddr:  mmio_read_data_comb = trace_data_lo;
+      TraceDataHiMmioAddr:  mmio_read_data_comb = trace_data_hi;
+      TraceFilterLoMmioAddr: mmio_read_data_comb = trace_filter_lo;
+      TraceFilterHiMmioAddr: mmio_read_data_comb = trace_filter_hi;
+      TraceTriggerMmioAddr: mmio_read_data_comb = trace_trigger;
+      // CRC-32 accumulator: raw running state (data registers are write-only).
+      CrcStateMmioAddr:     mmio_read_data_comb = crc_state;
+      // FIFO fill levels (non-destructive) and the threshold register.
+      FifoLevelMmioAddr:    mmio_read_data_comb = {i_fifo1_level, i_fifo0_level};
+      FifoThreshMmioAddr:   mmio_read_data_comb = fifo_thresh;
+      // DMA ring-ingest pointers: data below WPTR is committed to memory.
+      DmaRingWptrMmioAddr:  mmio_read_data_comb = dma_ring_wptr;
+      DmaRingRptrMmioAddr:  mmio_read_data_comb = dma_ring_rptr;
+      // FIFO arrival timestamps: the TS_HI read pops the oldest entry.
+      FifoTsStatusMmioAddr: mmio_read_data_comb = {12'b0, fifo1_ts_count, 12'b0, fifo0_ts_count};
+      Fifo0TsLoMmioAddr:    mmio_read_data_comb = fifo0_ts_lo;
+      Fifo0TsHiMmioAddr:    mmio_read_data_comb = fifo0_ts_hi;
+      Fifo1TsLoMmioAddr:    mmio_read_data_comb = fifo1_ts_lo;
+      Fifo1TsHiMmioAddr:    mmio_read_data_comb = fifo1_ts_hi;
       default:              ;
     endcase
   end
@@ -903,11 +1258,175 @@ module cpu_and_mem #(
                             data_memory_address_registered == Fifo1MmioAddr;
 
   // FIFO/UART consume pulses fire one cycle after the MMIO read request is
-  // accepted. The response data itself was already captured above.
-  assign o_fifo0_rd_en = mmio_fifo0_read_pulse;
+  // accepted. The response data itself was already captured above. FIFO0's
+  // pop side is shared with the DMA ring-ingest drain; software must not
+  // read FIFO0 through MMIO while the ring is active.
+  assign o_fifo0_rd_en = mmio_fifo0_read_pulse || dma_fifo0_rd_en;
   assign o_fifo1_rd_en = mmio_fifo1_read_pulse;
   assign o_uart_rx_ready = mmio_uart_rx_ready_pulse;
 
+  // Inter-core signalling decodes. The IPI send fires on a write of 1 (CLINT
+  // msip convention: writing 0 to your own MSIP is how the receiver clears).
+  // The mutex acquire rides the exactly-once MMIO read pulse, so a committed
+  // mutex load can never double-acquire; release is a plain write decode.
+  assign o_ipi_send = |data_memory_byte_write_enable_registered &&
+                       data_memory_address_registered == IpiMmioAddr &&
+                       data_memory_write_data_registered[0];
+  assign o_hw_mutex_acquire = mmio_read_capture && (mmio_load_addr == HwMutexMmioAddr);
+  assign o_hw_mutex_release = |data_memory_byte_write_enable_registered &&
+                               data_memory_address_registered == HwMutexMmioAddr;
+
+  // DMA register write strobes (registered store path, like the other
+  // peripherals; the engine consumes the registered store data).
+  assign dma_src_wr_en = |data_memory_byte_write_enable_registered &&
+                          data_memory_address_registered == DmaSrcMmioAddr;
+  assign dma_dst_wr_en = |data_memory_byte_write_enable_registered &&
+                          data_memory_address_registered == DmaDstMmioAddr;
+  assign dma_len_wr_en = |data_memory_byte_write_enable_registered &&
+                          data_memory_address_registered == DmaLenMmioAddr;
+  assign dma_ctrl_wr_en = |data_memory_byte_write_enable_registered &&
+                           data_memory_address_registered == DmaCtrlMmioAddr;
+
+  // Commit-trace buffer register write strobes (registered store path) and
+  // the destructive DATA_HI read pop.
+  assign trace_ctrl_wr_en = |data_memory_byte_write_enable_registered &&
+                             data_memory_address_registered == TraceCtrlMmioAddr;
+  assign trace_filter_lo_wr_en = |data_memory_byte_write_enable_registered &&
+                                  data_memory_address_registered == TraceFilterLoMmioAddr;
+  assign trace_filter_hi_wr_en = |data_memory_byte_write_enable_registered &&
+                                  data_memory_address_registered == TraceFilterHiMmioAddr;
+  assign trace_trigger_wr_en = |data_memory_byte_write_enable_registered &&
+                                data_memory_address_registered == TraceTriggerMmioAddr;
+  assign trace_data_pop = mmio_read_capture && (mmio_load_addr == TraceDataHiMmioAddr);
+
+  // Commit-trace buffer: branches-only {PC, cycle-delta} ring in BRAM,
+  // recording the core's committed-branch stream (see the module header for
+  // the register contract).
+  commit_trace_buffer commit_trace_buffer_inst (
+      .i_clk,
+      .i_rst,
+      .i_commit_valid(commit_trace_valid),
+      .i_commit_pc(commit_trace_pc),
+      .i_commit_taken(commit_trace_taken),
+      .i_ctrl_wr_en(trace_ctrl_wr_en),
+      .i_filter_lo_wr_en(trace_filter_lo_wr_en),
+      .i_filter_hi_wr_en(trace_filter_hi_wr_en),
+      .i_trigger_wr_en(trace_trigger_wr_en),
+      .i_wr_data(data_memory_write_data_registered),
+      .i_data_pop(trace_data_pop),
+      .o_ctrl(trace_ctrl),
+      .o_status(trace_status),
+      .o_data_lo(trace_data_lo),
+      .o_data_hi(trace_data_hi),
+      .o_filter_lo(trace_filter_lo),
+      .o_filter_hi(trace_filter_hi),
+      .o_trigger(trace_trigger)
+  );
+
+  // CRC-32 accumulator register write strobes (registered store path).
+  assign crc_state_wr_en = |data_memory_byte_write_enable_registered &&
+                            data_memory_address_registered == CrcStateMmioAddr;
+  assign crc_data_word_wr_en = |data_memory_byte_write_enable_registered &&
+                                data_memory_address_registered == CrcDataWordMmioAddr;
+  assign crc_data_byte_wr_en = |data_memory_byte_write_enable_registered &&
+                                data_memory_address_registered == CrcDataByteMmioAddr;
+
+  // CRC-32 accumulator: folds store data into a running reflected CRC-32 one
+  // word (or byte) per write (see the module header for the register
+  // contract).
+  crc32_unit crc32_unit_inst (
+      .i_clk,
+      .i_rst,
+      .i_state_wr_en(crc_state_wr_en),
+      .i_data_word_wr_en(crc_data_word_wr_en),
+      .i_data_byte_wr_en(crc_data_byte_wr_en),
+      .i_wr_data(data_memory_write_data_registered),
+      .o_state(crc_state)
+  );
+
+  // FIFO threshold register: {fifo1, fifo0} 16-bit fill thresholds; a zero
+  // threshold disables that FIFO's interrupt. Level-sensitive into MEIP
+  // while a fill count sits at or above its threshold; the wide compares are
+  // registered (like mtip) so they stay off the interrupt fanin.
+  always_ff @(posedge i_clk) begin
+    if (i_rst) begin
+      fifo_thresh     <= '0;
+      fifo_thresh_irq <= 1'b0;
+    end else begin
+      if (|data_memory_byte_write_enable_registered &&
+          data_memory_address_registered == FifoThreshMmioAddr) begin
+        fifo_thresh <= data_memory_write_data_registered;
+      end
+      fifo_thresh_irq <= (|fifo_thresh[15:0] && i_fifo0_level >= fifo_thresh[15:0]) ||
+                         (|fifo_thresh[31:16] && i_fifo1_level >= fifo_thresh[31:16]);
+    end
+  end
+
+  // DMA ring consume pointer: firmware republishes it as it parses in place;
+  // the engine stalls its FIFO drain rather than overrun it.
+  assign dma_ring_rptr_wr_en = |data_memory_byte_write_enable_registered &&
+                                data_memory_address_registered == DmaRingRptrMmioAddr;
+  always_ff @(posedge i_clk) begin
+    if (i_rst) dma_ring_rptr <= '0;
+    else if (dma_ring_rptr_wr_en) dma_ring_rptr <= data_memory_write_data_registered;
+  end
+
+  // FIFO arrival-timestamp latches: one mtime stamp per arrival burst
+  // (empty-to-non-empty transition), popped through the destructive TS_HI
+  // read riding the exactly-once MMIO read capture.
+  assign fifo0_ts_pop = mmio_read_capture && (mmio_load_addr == Fifo0TsHiMmioAddr);
+  assign fifo1_ts_pop = mmio_read_capture && (mmio_load_addr == Fifo1TsHiMmioAddr);
+
+  fifo_timestamp_latch fifo0_timestamp_latch_inst (
+      .i_clk,
+      .i_rst,
+      .i_fifo_wr_en(o_fifo0_wr_en),
+      .i_fifo_empty(i_fifo0_empty),
+      .i_mtime(mtime),
+      .i_ts_pop(fifo0_ts_pop),
+      .o_ts_lo(fifo0_ts_lo),
+      .o_ts_hi(fifo0_ts_hi),
+      .o_count(fifo0_ts_count)
+  );
+
+  fifo_timestamp_latch fifo1_timestamp_latch_inst (
+      .i_clk,
+      .i_rst,
+      .i_fifo_wr_en(o_fifo1_wr_en),
+      .i_fifo_empty(i_fifo1_empty),
+      .i_mtime(mtime),
+      .i_ts_pop(fifo1_ts_pop),
+      .o_ts_lo(fifo1_ts_lo),
+      .o_ts_hi(fifo1_ts_hi),
+      .o_count(fifo1_ts_count)
+  );
+
+  // UART TX drain interrupt enable. Level-sensitive into MEIP while the TX
+  // path can accept a byte; software sets it after queueing into its ring
+  // and clears it from the handler once the ring is empty.
+  always_ff @(posedge i_clk) begin
+    if (i_rst) begin
+      uart_tx_irq_en <= 1'b0;
+    end else if (|data_memory_byte_write_enable_registered &&
+                 data_memory_address_registered == UartTxCtrlMmioAddr) begin
+      uart_tx_irq_en <= data_memory_write_data_registered[0];
+    end
+  end
+
+  // D-cache flush request: set on the MMIO write, held until the hierarchy's
+  // writeback+invalidate walk reports done (immediately when the cached tier
+  // is disabled -- there is nothing to flush).
+  always_ff @(posedge i_clk) begin
+    if (i_rst) begin
+      dcache_flush_pending <= 1'b0;
+    end else if (dcache_flush_done) begin
+      dcache_flush_pending <= 1'b0;
+    end else if (|data_memory_byte_write_enable_registered &&
+                 data_memory_address_registered == DcacheFlushMmioAddr) begin
+      dcache_flush_pending <= 1'b1;
+    end
+  end
+
   // Timer register updates
   // mtime increments every clock cycle (provides wall-clock time)
   // mtimecmp and msip are memory-mapped writable registers
@@ -951,6 +1470,11 @@ module cpu_and_mem #(
           default:              ;
         endcase
       end
+
+      // Incoming IPI from the other core raises msip; it wins over a local
+      // write in the same cycle so a send racing the receiver's clear is
+      // never lost (the receiver clears again on the next handler pass).
+      if (i_ipi_set) msip <= 1'b1;
     end
   end
 
@@ -18,15 +18,27 @@
  * fetch_provider -- the variable-latency fetch window provider.
  *
  * Serves the high-address side of the core's fetch seam
- * ({instr64, sideband16, bank_sel_r} + valid) from a two-line fetch buffer
- * over the L1I line port.  The low instruction BRAM fast path is selected in
- * cpu_and_mem and drives imem_predecode directly from o_pc; this block never
- * drives the low-BRAM address pins.  Each filled line carries per-word
- * predecode sideband computed on fill (imem_predecode_line), so DDR code
- * predecodes bit-identically to BRAM code.  The buffer's two slots are
- * parity-mapped (line address bit 0), so the current line and the prefetched
- * next line can never collide, and a window spanning a line boundary always
- * has both halves resident before valid asserts.
+ * ({instr64, sideband16, bank_sel_r} + valid) from a BUFFER_LINES-line fetch
+ * buffer over the L1I line port.  The low instruction BRAM fast path is
+ * selected in cpu_and_mem and drives imem_predecode directly from o_pc; this
+ * block never drives the low-BRAM address pins.  Each filled line carries
+ * per-word predecode sideband computed on fill (imem_predecode_line), so DDR
+ * code predecodes bit-identically to BRAM code.  Slots are direct-mapped by
+ * the low line-address bits, so consecutive lines never collide: a window
+ * spanning a line boundary always has both halves resident before valid
+ * asserts, exactly as with the original two parity-mapped slots.
+ *
+ * LOOP BUFFER: with the default 8 slots (256 B) a hot loop whose body spans
+ * at most BUFFER_LINES - PREFETCH_LINES lines (run-ahead fills past the
+ * backward branch take the slots above that) stays fully resident after its
+ * first iteration, so the steady state replays windows every cycle with zero
+ * line-port traffic -- the backward branch just moves the ask to an
+ * already-present line.  The two-line buffer only gave this to loops that fit
+ * two lines; anything larger thrashed, re-paying the full DDR fill latency
+ * every iteration (CoreMark's matrix and CRC inner kernels straddle more than
+ * two lines at -O2).  Predecode sideband is captured on fill, so replayed
+ * iterations also skip recomputation, and the front end sees the same
+ * single-cycle fetch it gets from low BRAM.
  *
  * FETCH CONTRACT (established with the core in if_stage):
  *   The provider owns the 1-deep OWED-ASK register.  Each served cycle
@@ -41,15 +53,27 @@
  *   fuzz wrapper in cpu_and_mem), so redirected stale data can sit on the
  *   payload wires without being accepted as the new ask's instruction.
  *
- * MISS ENGINE: single-outstanding line-port master.  Wanted line = the
- * window's first absent line, else the following line (prefetch) -- one rule
- * covers both straddle completion and next-line prefetch.  A fill that is in
- * flight when the ask retargets completes into its slot (the line protocol
- * has no abort); a fill in flight across i_invalidate completes DISCARDED so
- * pre-invalidate data can never re-validate a slot (fence.i relies on this).
+ * MISS ENGINE: single-outstanding line-port master.  Wanted line = the first
+ * absent line among the ask line and the PREFETCH_LINES lines after it -- one
+ * rule covers straddle completion, next-line prefetch, and the decoupled
+ * sequential run-ahead that keeps filling while the decode is stalled.  A
+ * fill that is in flight when the ask retargets completes into its slot (the
+ * line protocol has no abort); a fill in flight across i_invalidate completes
+ * DISCARDED so pre-invalidate data can never re-validate a slot (fence.i
+ * relies on this).
  */
 module fetch_provider #(
-    parameter int unsigned LINE_BYTES = 32
+    parameter int unsigned LINE_BYTES = 32,
+    // Fetch-buffer capacity in lines.  Power of two, at least 2 (the
+    // straddle invariant needs current and next line in distinct slots).
+    parameter int unsigned BUFFER_LINES = 8,
+    // Sequential run-ahead depth: the fill engine chases the first absent
+    // line among the ask line and the PREFETCH_LINES lines after it, even
+    // while the decode is stalled.  Must satisfy
+    // PREFETCH_LINES <= BUFFER_LINES - 2 so run-ahead fills can never evict
+    // a line a buffer-resident loop still needs (a body of up to
+    // BUFFER_LINES - PREFETCH_LINES lines stays resident).
+    parameter int unsigned PREFETCH_LINES = 3
 ) (
     input logic i_clk,
     input logic i_rst,
@@ -93,6 +117,7 @@ module fetch_provider #(
   localparam int unsigned WordSelBits = $clog2(WordsPerLine);
   localparam int unsigned SbWidth = riscv_pkg::ImemSidebandWidth;
   localparam int unsigned LineSbBits = WordsPerLine * SbWidth;
+  localparam int unsigned SlotBits = $clog2(BUFFER_LINES);
 
   // ===========================================================================
   // Owed-ask tracking
@@ -144,12 +169,12 @@ module fetch_provider #(
   end
 
   // ===========================================================================
-  // Two-line fetch buffer (parity-mapped slots) + per-word sideband
+  // Fetch buffer (direct-mapped slots, low line-address bits) + sideband
   // ===========================================================================
-  logic [1:0] slot_valid_q;
-  logic [1:0][LineAddrBits-1:0] slot_line_q;
-  logic [1:0][LineBits-1:0] slot_data_q;
-  logic [1:0][LineSbBits-1:0] slot_sb_q;
+  logic [BUFFER_LINES-1:0] slot_valid_q;
+  logic [BUFFER_LINES-1:0][LineAddrBits-1:0] slot_line_q;
+  logic [BUFFER_LINES-1:0][LineBits-1:0] slot_data_q;
+  logic [BUFFER_LINES-1:0][LineSbBits-1:0] slot_sb_q;
 
   // The window's two word addresses (current word + next word).
   logic [31:0] win_addr0, win_addr1;
@@ -160,9 +185,13 @@ module fetch_provider #(
   assign win_line0 = win_addr0[31:OffsetBits];
   assign win_line1 = win_addr1[31:OffsetBits];
 
+  logic [SlotBits-1:0] win_slot0, win_slot1;
+  assign win_slot0 = win_line0[SlotBits-1:0];
+  assign win_slot1 = win_line1[SlotBits-1:0];
+
   logic present0, present1;
-  assign present0 = slot_valid_q[win_line0[0]] && (slot_line_q[win_line0[0]] == win_line0);
-  assign present1 = slot_valid_q[win_line1[0]] && (slot_line_q[win_line1[0]] == win_line1);
+  assign present0 = slot_valid_q[win_slot0] && (slot_line_q[win_slot0] == win_line0);
+  assign present1 = slot_valid_q[win_slot1] && (slot_line_q[win_slot1] == win_line1);
 
   // Word extraction for the (about to be registered) DDR window.
   logic [WordSelBits-1:0] word_sel0, word_sel1;
@@ -171,10 +200,10 @@ module fetch_provider #(
 
   logic [31:0] ddr_word0, ddr_word1;
   logic [SbWidth-1:0] ddr_sb0, ddr_sb1;
-  assign ddr_word0 = slot_data_q[win_line0[0]][word_sel0*32+:32];
-  assign ddr_word1 = slot_data_q[win_line1[0]][word_sel1*32+:32];
-  assign ddr_sb0   = slot_sb_q[win_line0[0]][word_sel0*SbWidth+:SbWidth];
-  assign ddr_sb1   = slot_sb_q[win_line1[0]][word_sel1*SbWidth+:SbWidth];
+  assign ddr_word0 = slot_data_q[win_slot0][word_sel0*32+:32];
+  assign ddr_word1 = slot_data_q[win_slot1][word_sel1*32+:32];
+  assign ddr_sb0   = slot_sb_q[win_slot0][word_sel0*SbWidth+:SbWidth];
+  assign ddr_sb1   = slot_sb_q[win_slot1][word_sel1*SbWidth+:SbWidth];
 
   // ===========================================================================
   // Window readiness (computed for the presented ask, registered with its tag)
@@ -223,39 +252,41 @@ module fetch_provider #(
   assign o_instr_bank_sel_r = bank_sel_q;
 
   // ===========================================================================
-  // Miss engine: single-outstanding line fills + next-line prefetch
+  // Miss engine: single-outstanding line fills + sequential run-ahead
   // ===========================================================================
-  // One rule covers straddle completion and prefetch: fetch the window's
-  // first line if absent, else the following line (which is the straddle's
-  // second half when the window crosses, and the prefetch otherwise).
+  // One rule covers straddle completion and run-ahead: fetch the first absent
+  // line among the ask line and the PREFETCH_LINES lines after it.  Candidate
+  // +1 is the straddle's second half when the window crosses; the deeper
+  // candidates are the decoupled run-ahead -- they keep the line port busy
+  // while the decode is stalled (the ask holds, but the fill engine does not),
+  // so I-side miss latency is paid during cycles the front end could not use
+  // anyway instead of serializing with consumption.  A taken branch abandons
+  // at most the run-ahead depth of wasted fills, and the D-side has priority
+  // at the line-port arbiter, so over-fetching only consumes idle bandwidth.
   // The fill engine works from the REGISTERED ask only (its own presence
   // comparators), so the o_pc/served muxing never reaches the line-port
   // request logic.  On ask transitions the wanted line lags one cycle --
   // noise against a multi-cycle miss.
-  logic [LineAddrBits-1:0] fill_line0, fill_line_after;
-  assign fill_line0 = ask_q[31:OffsetBits];
-  assign fill_line_after = fill_line0 + 1'b1;
-
-  logic fill_present0, fill_present_after;
-  assign fill_present0 = slot_valid_q[fill_line0[0]] && (slot_line_q[fill_line0[0]] == fill_line0);
-  assign fill_present_after = slot_valid_q[fill_line_after[0]] &&
-      (slot_line_q[fill_line_after[0]] == fill_line_after);
+  logic [PREFETCH_LINES:0][LineAddrBits-1:0] fill_cand_line;
+  logic [PREFETCH_LINES:0] fill_cand_present;
+  for (genvar k = 0; k <= PREFETCH_LINES; k++) begin : g_fill_cand
+    assign fill_cand_line[k] = ask_q[31:OffsetBits] + LineAddrBits'(k);
+    assign fill_cand_present[k] =
+        slot_valid_q[fill_cand_line[k][SlotBits-1:0]] &&
+        (slot_line_q[fill_cand_line[k][SlotBits-1:0]] == fill_cand_line[k]);
+  end
 
   logic [LineAddrBits-1:0] want_line;
   logic want_fill;
   always_comb begin
-    want_line = fill_line0;
+    want_line = fill_cand_line[0];
     want_fill = 1'b0;
     if (ask_q[31]) begin
-      if (!fill_present0) begin
-        want_line = fill_line0;
-        want_fill = 1'b1;
-      end else if (!fill_present_after) begin
-        // First ask line resident: fetch the following line -- the
-        // straddle's second half when the window crosses, the prefetch
-        // otherwise.
-        want_line = fill_line_after;
-        want_fill = 1'b1;
+      for (int k = PREFETCH_LINES; k >= 0; k--) begin
+        if (!fill_cand_present[k]) begin
+          want_line = fill_cand_line[k];
+          want_fill = 1'b1;
+        end
       end
     end
   end
@@ -287,12 +318,10 @@ module fetch_provider #(
       fill_busy_q     <= 1'b0;
       fill_sent_q     <= 1'b0;
       fill_discard_q  <= 1'b0;
-      slot_valid_q[0] <= 1'b0;
-      slot_valid_q[1] <= 1'b0;
+      slot_valid_q    <= '0;
     end else begin
       if (i_invalidate) begin
-        slot_valid_q[0] <= 1'b0;
-        slot_valid_q[1] <= 1'b0;
+        slot_valid_q <= '0;
         // An in-flight fill must complete (the line port has no abort), but
         // its pre-invalidate data must not re-validate a slot.
         if (fill_busy_q) fill_discard_q <= 1'b1;
@@ -310,10 +339,10 @@ module fetch_provider #(
           fill_busy_q <= 1'b0;
           fill_sent_q <= 1'b0;
           if (!fill_discard_q && !i_invalidate) begin
-            slot_valid_q[fill_line_q[0]] <= 1'b1;
-            slot_line_q[fill_line_q[0]]  <= fill_line_q;
-            slot_data_q[fill_line_q[0]]  <= i_line_resp_rdata;
-            slot_sb_q[fill_line_q[0]]    <= fill_sideband;
+            slot_valid_q[fill_line_q[SlotBits-1:0]] <= 1'b1;
+            slot_line_q[fill_line_q[SlotBits-1:0]]  <= fill_line_q;
+            slot_data_q[fill_line_q[SlotBits-1:0]]  <= i_line_resp_rdata;
+            slot_sb_q[fill_line_q[SlotBits-1:0]]    <= fill_sideband;
           end
           fill_discard_q <= 1'b0;
         end
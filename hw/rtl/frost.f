@@ -14,3 +14,6 @@
 
 # Top-level FROST integration module
 $(ROOT)/hw/rtl/frost.sv
+
+# Dual-core top: two cores over a shared L2 via the line-port arbiter
+$(ROOT)/hw/rtl/frost_dual.sv
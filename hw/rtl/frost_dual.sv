@@ -0,0 +1,688 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/*
+  frost_dual -- dual-core FROST top level.
+
+  Two complete FROST cores (each a cpu_and_mem instance with its own
+  instruction/data BRAMs, MMIO block, and private L1D/L1I hierarchy) share one
+  main-memory path: each core's hierarchy exports its downstream line port
+  (EXPORT_LINE_PORT=1, per-core hierarchies are L1-only), a line_port_arbiter
+  joins the two cores, and the shared level below the arbiter is an optional
+  URAM L2 over the single DDR bridge:
+
+      core 0: L1D/L1I -\
+                         arbiter -> [L2 (URAM)] -> DDR bridge -> main memory
+      core 1: L1D/L1I -/
+
+  Both instruction BRAMs are programmed in lockstep (broadcast writes): the
+  cores boot the same image and branch on mhartid. The low BRAM ranges and
+  MMIO blocks are per-core private; the cached DDR region is the shared
+  address space.
+
+  Coherence is software-managed -- the private L1Ds do not snoop each other.
+  The contract, supported by sw/lib/include/sync.h:
+    - Shared mutable data lives in the cached (DDR) region.
+    - A producer publishes with the D-cache flush register (L1D writeback-all
+      then invalidate-all, which lands every produced line at the shared
+      level); a consumer runs the same flush before reading so nothing stale
+      survives in its L1D or its L1 prefetch buffer (the flush's invalidate
+      pulse drops the prefetcher's speculatively buffered line too).
+    - AMOs/LR/SC execute in the private L1s and are therefore atomic only
+      core-locally; cross-core mutual exclusion uses the hardware mutex
+      arbitrated here (read-to-acquire, write-to-release, core 0 wins a
+      same-cycle tie).
+    - Small messages and doorbells avoid the flush entirely: the two MMIO
+      FIFOs are cross-wired as mailboxes (each core writes FIFO0 to send and
+      reads FIFO1 to receive), and the IPI register raises the other core's
+      msip for interrupt-driven handoff. A parse core can stream work
+      descriptors to a compute core through its mailbox without ever touching
+      the coherence machinery.
+
+  Console I/O: each core drives its own UART transmitter (o_uart_tx /
+  o_uart1_tx); the receive side and the external interrupt belong to core 0.
+*/
+module frost_dual #(
+    parameter int unsigned CLK_FREQ_HZ = 300000000,
+    parameter int unsigned MEM_SIZE_BYTES = 2 ** 18,
+    parameter int unsigned SIM_TIMER_SPEEDUP = 1,
+    // Cached memory tier (see frost.sv): this is the shared address space.
+    parameter int unsigned CACHED_BASE = 32'h8000_0000,
+    parameter int unsigned CACHED_SIZE_BYTES = 32'h4000_0000,  // 1 GiB
+    parameter int unsigned ENABLE_CACHED_TIER = 0,
+    // 1 splices the shared URAM L2 between the core arbiter and main memory
+    // (X3 shape); 0 runs both cores' misses straight at the DDR bridge.
+    parameter int unsigned CACHED_HAS_L2 = 1,
+    parameter int unsigned L1_CACHE_BYTES = 128 * 1024,
+    parameter int unsigned L1_NUM_WAYS = 2,
+    parameter int unsigned L1I_CACHE_BYTES = 16 * 1024,
+    parameter int unsigned L1I_NUM_WAYS = 2,
+    parameter int unsigned L2_CACHE_BYTES = 2 * 1024 * 1024,
+    parameter int unsigned L2_NUM_WAYS = 1,
+    // Behavioral main-memory model knobs (simulation only).
+    parameter int unsigned DDR_MODEL_BYTES = 64 * 1024 * 1024,
+    parameter int unsigned DDR_MODEL_LATENCY = 30,
+    // 0 = fixed DDR_MODEL_LATENCY; 1/2 = Genesys2/X3 controller timing.
+    parameter int unsigned DDR_MODEL_PRESET = 0,
+    parameter int unsigned USE_BEHAVIORAL_DDR = 1,
+    // Simulation-only fetch-latency fuzz (see cpu_and_mem). Hardware keeps 0.
+    parameter int unsigned FETCH_VALID_FUZZ = 0
+) (
+    input logic i_clk,
+    input logic i_clk_div4,
+    input logic i_rst_n,
+
+    // Instruction programming interface, broadcast to both cores' BRAMs
+    // (readback comes from core 0).
+    input  logic        i_instr_mem_en,
+    input  logic [ 3:0] i_instr_mem_we,
+    input  logic [31:0] i_instr_mem_addr,
+    input  logic [31:0] i_instr_mem_wrdata,
+    output logic [31:0] o_instr_mem_rddata,
+
+    output logic o_uart_tx,   // core 0 console
+    output logic o_uart1_tx,  // core 1 console
+    input  logic i_uart_rx,   // receive side belongs to core 0
+
+    // External interrupt input (core 0 MEIP). Optional: tie to 0 if not used.
+    input logic i_external_interrupt = 1'b0,
+
+    // DDR AXI master (shared bridge below the core arbiter / L2; see frost.sv).
+    output logic         o_ddr_axi_awvalid,
+    input  logic         i_ddr_axi_awready,
+    output logic [ 31:0] o_ddr_axi_awaddr,
+    output logic [  7:0] o_ddr_axi_awlen,
+    output logic [  2:0] o_ddr_axi_awsize,
+    output logic [  1:0] o_ddr_axi_awburst,
+    output logic         o_ddr_axi_wvalid,
+    input  logic         i_ddr_axi_wready,
+    output logic [255:0] o_ddr_axi_wdata,
+    output logic [ 31:0] o_ddr_axi_wstrb,
+    output logic         o_ddr_axi_wlast,
+    input  logic         i_ddr_axi_bvalid,
+    output logic         o_ddr_axi_bready,
+    input  logic [  1:0] i_ddr_axi_bresp,
+    output logic         o_ddr_axi_arvalid,
+    input  logic         i_ddr_axi_arready,
+    output logic [ 31:0] o_ddr_axi_araddr,
+    output logic [  7:0] o_ddr_axi_arlen,
+    output logic [  2:0] o_ddr_axi_arsize,
+    output logic [  1:0] o_ddr_axi_arburst,
+    input  logic         i_ddr_axi_rvalid,
+    output logic         o_ddr_axi_rready,
+    input  logic [255:0] i_ddr_axi_rdata,
+    input  logic [  1:0] i_ddr_axi_rresp,
+    input  logic         i_ddr_axi_rlast
+);
+
+  // Reset synchronization (same scheme as frost.sv).
+  localparam int unsigned NumResetSyncStages = 3;
+  (* ASYNC_REG = "TRUE" *)
+  logic [NumResetSyncStages-1:0] reset_synchronizer_shift_register;
+  (* MAX_FANOUT = 1000 *) logic reset_synchronized;
+  always_ff @(posedge i_clk)
+    for (int i = 0; i < NumResetSyncStages; ++i)
+      reset_synchronizer_shift_register[i] <= (i > 0) ?
+                                              reset_synchronizer_shift_register[i-1] :
+                                              ~i_rst_n;
+  always_ff @(posedge i_clk)
+    reset_synchronized <= reset_synchronizer_shift_register[NumResetSyncStages-1];
+
+  (* ASYNC_REG = "TRUE" *)
+  logic [NumResetSyncStages-1:0] reset_div4_synchronizer_shift_register;
+  logic reset_div4_synchronized;
+  always_ff @(posedge i_clk_div4)
+    for (int i = 0; i < NumResetSyncStages; ++i)
+      reset_div4_synchronizer_shift_register[i] <= (i > 0) ?
+                                                   reset_div4_synchronizer_shift_register[i-1] :
+                                                   ~i_rst_n;
+  assign reset_div4_synchronized = reset_div4_synchronizer_shift_register[NumResetSyncStages-1];
+
+  // ---------------------------------------------------------------------------
+  // Per-core interconnect wires.
+  // ---------------------------------------------------------------------------
+  // UART TX (one transmitter per core)
+  logic [1:0] uart_write_enable_from_cpu;
+  logic [1:0][7:0] uart_write_data_from_cpu;
+  logic [1:0] uart_fifo_input_ready;
+
+  // UART RX (core 0 only)
+  logic uart_rx_data_valid_to_cpu;
+  logic [7:0] uart_rx_data_to_cpu;
+  logic uart_rx_data_ready_from_cpu;
+
+  // Cross-core mailboxes: core i writes its FIFO0 port to send, reads its
+  // FIFO1 port to receive. FIFO0's read side and FIFO1's write side are
+  // therefore unused on each core.
+  logic [1:0] mailbox_write_enable;
+  logic [1:0][31:0] mailbox_write_data;
+  logic [1:0][31:0] mailbox_read_data;
+  logic [1:0] mailbox_is_empty;
+  logic [1:0] mailbox_read_enable;
+
+  // IPI pulses (o_ipi_send of one core -> i_ipi_set of the other)
+  logic [1:0] ipi_send;
+
+  // Hardware mutex handshake
+  logic [1:0] mutex_acquire, mutex_release, mutex_grant;
+
+  // Exported cluster line ports (downstream of each core's private hierarchy)
+  logic [1:0] cl_req_valid, cl_req_ready, cl_req_write;
+  logic [1:0][31:0] cl_req_addr;
+  logic [1:0][255:0] cl_req_wdata;
+  logic [1:0][31:0] cl_req_wstrb;
+  logic [1:0] cl_resp_valid;
+  logic [1:0][255:0] cl_resp_rdata;
+
+  // Programming readback and UART RX ready, per core (core 0's are used).
+  logic [1:0][31:0] instr_mem_rddata_per_core;
+  logic [1:0] uart_rx_ready_per_core;
+
+  // ---------------------------------------------------------------------------
+  // The two cores. Identical except for HART_ID; the per-core hierarchies are
+  // L1-only (CACHED_HAS_L2=0) because the L2 is shared below the arbiter.
+  // ---------------------------------------------------------------------------
+  for (genvar core = 0; core < 2; core++) begin : gen_core
+    cpu_and_mem #(
+        .MEM_SIZE_BYTES(MEM_SIZE_BYTES),
+        .SIM_TIMER_SPEEDUP(SIM_TIMER_SPEEDUP),
+        .CACHED_BASE(CACHED_BASE),
+        .CACHED_SIZE_BYTES(CACHED_SIZE_BYTES),
+        .ENABLE_CACHED_TIER(ENABLE_CACHED_TIER),
+        .CACHED_HAS_L2(0),
+        .L1_CACHE_BYTES(L1_CACHE_BYTES),
+        .L1_NUM_WAYS(L1_NUM_WAYS),
+        .L1I_CACHE_BYTES(L1I_CACHE_BYTES),
+        .L1I_NUM_WAYS(L1I_NUM_WAYS),
+        .DDR_MODEL_BYTES(DDR_MODEL_BYTES),
+        .DDR_MODEL_LATENCY(DDR_MODEL_LATENCY),
+        .DDR_MODEL_PRESET(DDR_MODEL_PRESET),
+        .USE_BEHAVIORAL_DDR(0),
+        .FETCH_VALID_FUZZ(FETCH_VALID_FUZZ),
+        .HART_ID(core),
+        .EXPORT_LINE_PORT(1)
+    ) core_subsystem (
+        .i_clk,
+        .i_clk_div4,
+        .i_rst(reset_synchronized),
+        // Local DDR bridge disabled (EXPORT_LINE_PORT=1): AXI port quiescent.
+        .o_ddr_axi_awvalid(),
+        .i_ddr_axi_awready(1'b0),
+        .o_ddr_axi_awaddr(),
+        .o_ddr_axi_awlen(),
+        .o_ddr_axi_awsize(),
+        .o_ddr_axi_awburst(),
+        .o_ddr_axi_wvalid(),
+        .i_ddr_axi_wready(1'b0),
+        .o_ddr_axi_wdata(),
+        .o_ddr_axi_wstrb(),
+        .o_ddr_axi_wlast(),
+        .i_ddr_axi_bvalid(1'b0),
+        .o_ddr_axi_bready(),
+        .i_ddr_axi_bresp(2'b00),
+        .o_ddr_axi_arvalid(),
+        .i_ddr_axi_arready(1'b0),
+        .o_ddr_axi_araddr(),
+        .o_ddr_axi_arlen(),
+        .o_ddr_axi_arsize(),
+        .o_ddr_axi_arburst(),
+        .i_ddr_axi_rvalid(1'b0),
+        .o_ddr_axi_rready(),
+        .i_ddr_axi_rdata('0),
+        .i_ddr_axi_rresp(2'b00),
+        .i_ddr_axi_rlast(1'b0),
+        // Broadcast instruction programming; core 0 provides readback.
+        .i_instr_mem_en(i_instr_mem_en),
+        .i_instr_mem_we(i_instr_mem_we),
+        .i_instr_mem_addr(i_instr_mem_addr),
+        .i_instr_mem_wrdata(i_instr_mem_wrdata),
+        .o_instr_mem_rddata(instr_mem_rddata_per_core[core]),
+        .o_uart_wr_en(uart_write_enable_from_cpu[core]),
+        .o_uart_wr_data(uart_write_data_from_cpu[core]),
+        .i_uart_tx_ready(uart_fifo_input_ready[core]),
+        // UART RX: core 0 only; core 1 never sees valid data.
+        .i_uart_rx_data(core == 0 ? uart_rx_data_to_cpu : 8'h00),
+        .i_uart_rx_valid(core == 0 ? uart_rx_data_valid_to_cpu : 1'b0),
+        .o_uart_rx_ready(uart_rx_ready_per_core[core]),
+        // FIFO0 = outbox (write side only), FIFO1 = inbox (read side only).
+        .o_fifo0_wr_en(mailbox_write_enable[core]),
+        .o_fifo0_wr_data(mailbox_write_data[core]),
+        .i_fifo0_rd_data('0),
+        .i_fifo0_empty(1'b1),
+        .o_fifo0_rd_en(),
+        .o_fifo1_wr_en(),
+        .o_fifo1_wr_data(),
+        .i_fifo1_rd_data(mailbox_read_data[core]),
+        .i_fifo1_empty(mailbox_is_empty[core]),
+        .o_fifo1_rd_en(mailbox_read_enable[core]),
+        // Mailbox FIFOs report no fill level (no threshold interrupt here).
+        .i_fifo0_level('0),
+        .i_fifo1_level('0),
+        .i_external_interrupt(core == 0 ? i_external_interrupt : 1'b0),
+        // Inter-core signalling: IPIs cross over, the mutex arbiter is below.
+        .o_ipi_send(ipi_send[core]),
+        .i_ipi_set(ipi_send[1-core]),
+        .o_hw_mutex_acquire(mutex_acquire[core]),
+        .o_hw_mutex_release(mutex_release[core]),
+        .i_hw_mutex_grant(mutex_grant[core]),
+        // Exported hierarchy downstream, into the shared-level arbiter.
+        .o_cl_req_valid(cl_req_valid[core]),
+        .i_cl_req_ready(cl_req_ready[core]),
+        .o_cl_req_write(cl_req_write[core]),
+        .o_cl_req_addr(cl_req_addr[core]),
+        .o_cl_req_wdata(cl_req_wdata[core]),
+        .o_cl_req_wstrb(cl_req_wstrb[core]),
+        .i_cl_resp_valid(cl_resp_valid[core]),
+        .i_cl_resp_rdata(cl_resp_rdata[core])
+    );
+  end
+
+  assign o_instr_mem_rddata = instr_mem_rddata_per_core[0];
+  assign uart_rx_data_ready_from_cpu = uart_rx_ready_per_core[0];
+
+  // ---------------------------------------------------------------------------
+  // Hardware mutex: one shared lock, read-to-acquire / write-to-release.
+  // Grants answer the acquire pulses combinationally (the MMIO read captures
+  // the result in the same cycle); core 0 wins a same-cycle tie. A release
+  // only takes effect from the current owner, so a stray unlock from the
+  // other core cannot steal the lock.
+  // ---------------------------------------------------------------------------
+  logic hw_mutex_taken;
+  logic hw_mutex_owner;
+  assign mutex_grant[0] = mutex_acquire[0] && (!hw_mutex_taken || hw_mutex_owner == 1'b0);
+  assign mutex_grant[1] = mutex_acquire[1] && (hw_mutex_taken ? hw_mutex_owner == 1'b1
+                                                              : !mutex_acquire[0]);
+  always_ff @(posedge i_clk) begin
+    if (reset_synchronized) begin
+      hw_mutex_taken <= 1'b0;
+      hw_mutex_owner <= 1'b0;
+    end else if (!hw_mutex_taken) begin
+      if (mutex_grant[0]) begin
+        hw_mutex_taken <= 1'b1;
+        hw_mutex_owner <= 1'b0;
+      end else if (mutex_grant[1]) begin
+        hw_mutex_taken <= 1'b1;
+        hw_mutex_owner <= 1'b1;
+      end
+    end else if ((mutex_release[0] && hw_mutex_owner == 1'b0) ||
+                 (mutex_release[1] && hw_mutex_owner == 1'b1)) begin
+      hw_mutex_taken <= 1'b0;
+    end
+  end
+
+  // ---------------------------------------------------------------------------
+  // Cross-core mailbox FIFOs (same distributed-RAM FIFOs as the single-core
+  // MMIO FIFOs; software manages overflow).
+  // ---------------------------------------------------------------------------
+  for (genvar core = 0; core < 2; core++) begin : gen_mailbox
+    // Written by `core`, read by the other core.
+    sync_dist_ram_fifo #(
+        .DATA_WIDTH(32),
+        .ADDR_WIDTH(9)    // 512 entries deep
+    ) mailbox_fifo (
+        .i_clk,
+        .i_rst(reset_synchronized),
+        .i_write_enable(mailbox_write_enable[core]),
+        .i_read_enable(mailbox_read_enable[1-core]),
+        .i_write_data(mailbox_write_data[core]),
+        .o_read_data(mailbox_read_data[1-core]),
+        .o_empty(mailbox_is_empty[1-core]),
+        .o_full(),
+        .o_fill_count()
+    );
+  end
+
+  // ---------------------------------------------------------------------------
+  // Shared memory path: 2:1 arbiter over the exported core line ports, then
+  // the optional shared URAM L2, then the DDR bridge. Core 0 gets fixed
+  // priority (matching the data-over-instruction convention inside the
+  // per-core hierarchies: somebody has to win, and ties are rare).
+  // ---------------------------------------------------------------------------
+  if (ENABLE_CACHED_TIER != 0) begin : gen_shared_tier
+    logic arb_down_req_valid, arb_down_req_ready, arb_down_req_write;
+    logic [31:0] arb_down_req_addr;
+    logic [255:0] arb_down_req_wdata;
+    logic [31:0] arb_down_req_wstrb;
+    logic arb_down_resp_valid;
+    logic [255:0] arb_down_resp_rdata;
+
+    logic bridge_req_valid, bridge_req_ready, bridge_req_write;
+    logic [31:0] bridge_req_addr;
+    logic [255:0] bridge_req_wdata;
+    logic [31:0] bridge_req_wstrb;
+    logic bridge_resp_valid;
+    logic [255:0] bridge_resp_rdata;
+
+    line_port_arbiter #(
+        .ADDR_WIDTH(32),
+        .LINE_BYTES(32)
+    ) core_arbiter (
+        .i_clk(i_clk),
+        .i_rst(reset_synchronized),
+        .i_up0_req_valid(cl_req_valid[0]),
+        .o_up0_req_ready(cl_req_ready[0]),
+        .i_up0_req_write(cl_req_write[0]),
+        .i_up0_req_addr(cl_req_addr[0]),
+        .i_up0_req_wdata(cl_req_wdata[0]),
+        .i_up0_req_wstrb(cl_req_wstrb[0]),
+        .o_up0_resp_valid(cl_resp_valid[0]),
+        .o_up0_resp_rdata(cl_resp_rdata[0]),
+        .i_up1_req_valid(cl_req_valid[1]),
+        .o_up1_req_ready(cl_req_ready[1]),
+        .i_up1_req_write(cl_req_write[1]),
+        .i_up1_req_addr(cl_req_addr[1]),
+        .i_up1_req_wdata(cl_req_wdata[1]),
+        .i_up1_req_wstrb(cl_req_wstrb[1]),
+        .o_up1_resp_valid(cl_resp_valid[1]),
+        .o_up1_resp_rdata(cl_resp_rdata[1]),
+        .o_down_req_valid(arb_down_req_valid),
+        .i_down_req_ready(arb_down_req_ready),
+        .o_down_req_write(arb_down_req_write),
+        .o_down_req_addr(arb_down_req_addr),
+        .o_down_req_wdata(arb_down_req_wdata),
+        .o_down_req_wstrb(arb_down_req_wstrb),
+        .i_down_resp_valid(arb_down_resp_valid),
+        .i_down_resp_rdata(arb_down_resp_rdata)
+    );
+
+    if (CACHED_HAS_L2 != 0) begin : gen_shared_l2
+      frost_cache #(
+          .ADDR_WIDTH(32),
+          .CACHE_SIZE_BYTES(L2_CACHE_BYTES),
+          .LINE_BYTES(32),
+          .NUM_WAYS(L2_NUM_WAYS),
+          .ENABLE_VICTIM_BUFFER(1),
+          .DATA_MEMORY_PRIMITIVE("ultra"),
+          .DATA_READ_LATENCY(6),
+          .DATA_WRITE_LATENCY(2)
+      ) shared_l2_cache (
+          .i_clk(i_clk),
+          .i_rst(reset_synchronized),
+          .i_writeback_all(1'b0),
+          .i_invalidate_all(1'b0),
+          .o_maint_busy(),
+          .i_up_req_valid(arb_down_req_valid),
+          .o_up_req_ready(arb_down_req_ready),
+          .i_up_req_write(arb_down_req_write),
+          .i_up_req_addr(arb_down_req_addr),
+          .i_up_req_wdata(arb_down_req_wdata),
+          .i_up_req_wstrb(arb_down_req_wstrb),
+          .o_up_resp_valid(arb_down_resp_valid),
+          .o_up_resp_rdata(arb_down_resp_rdata),
+          .o_up_resp_write(),
+          .o_down_req_valid(bridge_req_valid),
+          .i_down_req_ready(bridge_req_ready),
+          .o_down_req_write(bridge_req_write),
+          .o_down_req_addr(bridge_req_addr),
+          .o_down_req_wdata(bridge_req_wdata),
+          .o_down_req_wstrb(bridge_req_wstrb),
+          .i_down_resp_valid(bridge_resp_valid),
+          .i_down_resp_rdata(bridge_resp_rdata)
+      );
+    end else begin : gen_no_shared_l2
+      assign bridge_req_valid = arb_down_req_valid;
+      assign arb_down_req_ready = bridge_req_ready;
+      assign bridge_req_write = arb_down_req_write;
+      assign bridge_req_addr = arb_down_req_addr;
+      assign bridge_req_wdata = arb_down_req_wdata;
+      assign bridge_req_wstrb = arb_down_req_wstrb;
+      assign arb_down_resp_valid = bridge_resp_valid;
+      assign arb_down_resp_rdata = bridge_resp_rdata;
+    end
+
+    logic axi_awvalid, axi_awready, axi_wvalid, axi_wready, axi_bvalid, axi_bready;
+    logic axi_arvalid, axi_arready, axi_rvalid, axi_rready, axi_rlast, axi_wlast;
+    logic [31:0] axi_awaddr, axi_araddr;
+    logic [7:0] axi_awlen, axi_arlen;
+    logic [2:0] axi_awsize, axi_arsize;
+    logic [1:0] axi_awburst, axi_arburst, axi_bresp, axi_rresp;
+    logic [255:0] axi_wdata, axi_rdata;
+    logic [31:0] axi_wstrb;
+
+    line_port_axi_bridge #(
+        .ADDR_WIDTH(32),
+        .LINE_BYTES(32),
+        .BASE_ADDR (CACHED_BASE)
+    ) ddr_bridge (
+        .i_clk(i_clk),
+        .i_rst(reset_synchronized),
+        .i_req_valid(bridge_req_valid),
+        .o_req_ready(bridge_req_ready),
+        .i_req_write(bridge_req_write),
+        .i_req_addr(bridge_req_addr),
+        .i_req_wdata(bridge_req_wdata),
+        .i_req_wstrb(bridge_req_wstrb),
+        .o_resp_valid(bridge_resp_valid),
+        .o_resp_rdata(bridge_resp_rdata),
+        .o_axi_awvalid(axi_awvalid),
+        .i_axi_awready(axi_awready),
+        .o_axi_awaddr(axi_awaddr),
+        .o_axi_awlen(axi_awlen),
+        .o_axi_awsize(axi_awsize),
+        .o_axi_awburst(axi_awburst),
+        .o_axi_wvalid(axi_wvalid),
+        .i_axi_wready(axi_wready),
+        .o_axi_wdata(axi_wdata),
+        .o_axi_wstrb(axi_wstrb),
+        .o_axi_wlast(axi_wlast),
+        .i_axi_bvalid(axi_bvalid),
+        .o_axi_bready(axi_bready),
+        .i_axi_bresp(axi_bresp),
+        .o_axi_arvalid(axi_arvalid),
+        .i_axi_arready(axi_arready),
+        .o_axi_araddr(axi_araddr),
+        .o_axi_arlen(axi_arlen),
+        .o_axi_arsize(axi_arsize),
+        .o_axi_arburst(axi_arburst),
+        .i_axi_rvalid(axi_rvalid),
+        .o_axi_rready(axi_rready),
+        .i_axi_rdata(axi_rdata),
+        .i_axi_rresp(axi_rresp),
+        .i_axi_rlast(axi_rlast)
+    );
+
+    if (USE_BEHAVIORAL_DDR != 0) begin : gen_behavioral_ddr
+      // SIMULATION-ONLY main memory; hardware sets USE_BEHAVIORAL_DDR=0 and
+      // takes the bridge's AXI out through the o_ddr_axi_* ports instead.
+      axi_behavioral_memory #(
+          .LINE_BYTES(32),
+          .MEM_BYTES(DDR_MODEL_BYTES),
+          .LATENCY(DDR_MODEL_LATENCY),
+          .USE_INIT_FILE(1'b1),
+          .INIT_FILE("sw_ddr.mem"),
+          .TIMING_PRESET(DDR_MODEL_PRESET)
+      ) ddr_model (
+          .i_clk(i_clk),
+          .i_rst(reset_synchronized),
+          .i_axi_awvalid(axi_awvalid),
+          .o_axi_awready(axi_awready),
+          .i_axi_awaddr(axi_awaddr),
+          .i_axi_awlen(axi_awlen),
+          .i_axi_wvalid(axi_wvalid),
+          .o_axi_wready(axi_wready),
+          .i_axi_wdata(axi_wdata),
+          .i_axi_wstrb(axi_wstrb),
+          .o_axi_bvalid(axi_bvalid),
+          .i_axi_bready(axi_bready),
+          .o_axi_bresp(axi_bresp),
+          .i_axi_arvalid(axi_arvalid),
+          .o_axi_arready(axi_arready),
+          .i_axi_araddr(axi_araddr),
+          .i_axi_arlen(axi_arlen),
+          .o_axi_rvalid(axi_rvalid),
+          .i_axi_rready(axi_rready),
+          .o_axi_rdata(axi_rdata),
+          .o_axi_rresp(axi_rresp),
+          .o_axi_rlast(axi_rlast)
+      );
+      assign o_ddr_axi_awvalid = 1'b0;
+      assign o_ddr_axi_awaddr  = '0;
+      assign o_ddr_axi_awlen   = '0;
+      assign o_ddr_axi_awsize  = '0;
+      assign o_ddr_axi_awburst = '0;
+      assign o_ddr_axi_wvalid  = 1'b0;
+      assign o_ddr_axi_wdata   = '0;
+      assign o_ddr_axi_wstrb   = '0;
+      assign o_ddr_axi_wlast   = 1'b0;
+      assign o_ddr_axi_bready  = 1'b0;
+      assign o_ddr_axi_arvalid = 1'b0;
+      assign o_ddr_axi_araddr  = '0;
+      assign o_ddr_axi_arlen   = '0;
+      assign o_ddr_axi_arsize  = '0;
+      assign o_ddr_axi_arburst = '0;
+      assign o_ddr_axi_rready  = 1'b0;
+    end else begin : gen_ddr_axi_export
+      assign o_ddr_axi_awvalid = axi_awvalid;
+      assign axi_awready = i_ddr_axi_awready;
+      assign o_ddr_axi_awaddr = axi_awaddr;
+      assign o_ddr_axi_awlen = axi_awlen;
+      assign o_ddr_axi_awsize = axi_awsize;
+      assign o_ddr_axi_awburst = axi_awburst;
+      assign o_ddr_axi_wvalid = axi_wvalid;
+      assign axi_wready = i_ddr_axi_wready;
+      assign o_ddr_axi_wdata = axi_wdata;
+      assign o_ddr_axi_wstrb = axi_wstrb;
+      assign o_ddr_axi_wlast = axi_wlast;
+      assign axi_bvalid = i_ddr_axi_bvalid;
+      assign o_ddr_axi_bready = axi_bready;
+      assign axi_bresp = i_ddr_axi_bresp;
+      assign o_ddr_axi_arvalid = axi_arvalid;
+      assign axi_arready = i_ddr_axi_arready;
+      assign o_ddr_axi_araddr = axi_araddr;
+      assign o_ddr_axi_arlen = axi_arlen;
+      assign o_ddr_axi_arsize = axi_arsize;
+      assign o_ddr_axi_arburst = axi_arburst;
+      assign axi_rvalid = i_ddr_axi_rvalid;
+      assign o_ddr_axi_rready = axi_rready;
+      assign axi_rdata = i_ddr_axi_rdata;
+      assign axi_rresp = i_ddr_axi_rresp;
+      assign axi_rlast = i_ddr_axi_rlast;
+    end
+  end else begin : gen_no_shared_tier
+    // Tier disabled: the cores complete cached-region accesses internally
+    // (see cpu_and_mem gen_no_cached_tier) and never drive the line ports.
+    assign cl_req_ready = '0;
+    assign cl_resp_valid = '0;
+    assign cl_resp_rdata = '0;
+    assign o_ddr_axi_awvalid = 1'b0;
+    assign o_ddr_axi_awaddr = '0;
+    assign o_ddr_axi_awlen = '0;
+    assign o_ddr_axi_awsize = '0;
+    assign o_ddr_axi_awburst = '0;
+    assign o_ddr_axi_wvalid = 1'b0;
+    assign o_ddr_axi_wdata = '0;
+    assign o_ddr_axi_wstrb = '0;
+    assign o_ddr_axi_wlast = 1'b0;
+    assign o_ddr_axi_bready = 1'b0;
+    assign o_ddr_axi_arvalid = 1'b0;
+    assign o_ddr_axi_araddr = '0;
+    assign o_ddr_axi_arlen = '0;
+    assign o_ddr_axi_arsize = '0;
+    assign o_ddr_axi_arburst = '0;
+    assign o_ddr_axi_rready = 1'b0;
+  end
+
+  // ---------------------------------------------------------------------------
+  // UART transmitters: one delay chain + CDC FIFO + transmitter per core
+  // (same structure and rationale as frost.sv).
+  // ---------------------------------------------------------------------------
+  localparam int unsigned NumUartDelayStages = 10;
+  logic [1:0] uart_tx_out;
+  assign o_uart_tx  = uart_tx_out[0];
+  assign o_uart1_tx = uart_tx_out[1];
+
+  for (genvar core = 0; core < 2; core++) begin : gen_uart_tx
+    (* srl_style = "srl" *)logic [NumUartDelayStages-1:0]      uart_write_enable_delay_chain;
+    (* srl_style = "srl" *)logic [NumUartDelayStages-1:0][7:0] uart_write_data_delay_chain;
+    always_ff @(posedge i_clk)
+      for (int stage = 0; stage < NumUartDelayStages; ++stage) begin
+        uart_write_enable_delay_chain[stage] <= (stage > 0) ?
+                                                uart_write_enable_delay_chain[stage-1] :
+                                                uart_write_enable_from_cpu[core];
+        uart_write_data_delay_chain[stage] <= (stage > 0) ?
+                                              uart_write_data_delay_chain[stage-1] :
+                                              uart_write_data_from_cpu[core];
+      end
+
+    logic [7:0] uart_fifo_data;
+    logic uart_fifo_valid;
+    logic uart_fifo_ready;
+
+    dc_fifo #(
+        .DATA_WIDTH(8),
+        .DEPTH(32768),
+        .READY_MARGIN(64)
+    ) uart_transmit_clock_domain_crossing_fifo (
+        .o_clk(i_clk_div4),
+        .i_clk(i_clk),
+        .o_rst(reset_div4_synchronized),
+        .i_rst(reset_synchronized),
+        .i_data(uart_write_data_delay_chain[NumUartDelayStages-1]),
+        .i_valid(uart_write_enable_delay_chain[NumUartDelayStages-1]),
+        .o_ready(uart_fifo_input_ready[core]),
+        .o_data(uart_fifo_data),
+        .o_valid(uart_fifo_valid),
+        .i_ready(uart_fifo_ready)
+    );
+
+    uart_tx #(
+        .CLK_FREQ_HZ(CLK_FREQ_HZ / 4),
+        .BAUD_RATE(115200)
+    ) uart_transmitter (
+        .i_clk  (i_clk_div4),
+        .i_rst  (reset_div4_synchronized),
+        .i_data (uart_fifo_data),
+        .i_valid(uart_fifo_valid),
+        .o_ready(uart_fifo_ready),
+        .o_uart (uart_tx_out[core])
+    );
+  end
+
+  // ---------------------------------------------------------------------------
+  // UART receive subsystem (core 0), same structure as frost.sv.
+  // ---------------------------------------------------------------------------
+  logic [7:0] uart_rx_data_from_receiver;
+  logic uart_rx_valid_from_receiver;
+  logic uart_rx_ready_to_receiver;
+
+  uart_rx #(
+      .CLK_FREQ_HZ(CLK_FREQ_HZ / 4),
+      .BAUD_RATE(115200)
+  ) uart_receiver (
+      .i_clk  (i_clk_div4),
+      .i_rst  (reset_div4_synchronized),
+      .i_uart (i_uart_rx),
+      .o_data (uart_rx_data_from_receiver),
+      .o_valid(uart_rx_valid_from_receiver),
+      .i_ready(uart_rx_ready_to_receiver)
+  );
+
+  dc_fifo #(
+      .DATA_WIDTH(8)
+  ) uart_receive_clock_domain_crossing_fifo (
+      .i_clk(i_clk_div4),
+      .o_clk(i_clk),
+      .i_rst(reset_div4_synchronized),
+      .o_rst(reset_synchronized),
+      .i_data(uart_rx_data_from_receiver),
+      .i_valid(uart_rx_valid_from_receiver),
+      .o_ready(uart_rx_ready_to_receiver),
+      .o_data(uart_rx_data_to_cpu),
+      .o_valid(uart_rx_data_valid_to_cpu),
+      .i_ready(uart_rx_data_ready_from_cpu)
+  );
+
+endmodule : frost_dual
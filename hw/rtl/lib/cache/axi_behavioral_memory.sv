@@ -33,13 +33,49 @@
  * AXI side are already region-relative (the bridge subtracts the base).
  * Like hardware DDR contents, the array persists across CPU resets; the
  * caches re-invalidate on reset, so a reloaded program sees fresh memory.
+ *
+ * Timing model: TIMING_PRESET=0 keeps the historical behavior (every
+ * transaction takes exactly LATENCY cycles), so existing regressions are
+ * cycle-identical. Presets 1 (Genesys2, DDR3 MIG) and 2 (X3, DDR4)
+ * approximate the boards' controllers instead: per-bank open-row tracking
+ * gives row hits a short first-word latency and row conflicts the full
+ * precharge+activate penalty, a transfer-cadence gap bounds back-to-back
+ * line bandwidth, and a periodic refresh stalls requests and closes all
+ * rows (tREFI/tRFC). The detailed knobs default from the preset but remain
+ * individually overridable at the instantiation (the toplevels thread only
+ * DDR_MODEL_PRESET / DDR_MODEL_LATENCY through as -G knobs).
+ * Preset values are calibration starting points derived from the
+ * controllers' datasheet timings at the core clock; tune them against
+ * on-board counters, not the other way around.
  */
 module axi_behavioral_memory #(
     parameter int unsigned LINE_BYTES = 32,
     parameter int unsigned MEM_BYTES = 64 * 1024 * 1024,
     parameter int unsigned LATENCY = 30,  // cycles from AR (or AW+W) to R (or B)
     parameter bit USE_INIT_FILE = 1'b0,
-    parameter bit [8*64-1:0] INIT_FILE = "sw_ddr.mem"
+    parameter bit [8*64-1:0] INIT_FILE = "sw_ddr.mem",
+    // 0 = fixed LATENCY (legacy), 1 = Genesys2 DDR3 shape, 2 = X3 DDR4 shape.
+    parameter int unsigned TIMING_PRESET = 0,
+    // First-word latency when the target bank's row buffer already holds the
+    // row (CAS-limited) vs. when it must precharge and activate first.
+    parameter int unsigned ROW_HIT_LATENCY = (TIMING_PRESET == 2) ? 26 :
+                                             (TIMING_PRESET == 1) ? 18 : LATENCY,
+    parameter int unsigned ROW_MISS_LATENCY = (TIMING_PRESET == 2) ? 44 :
+                                              (TIMING_PRESET == 1) ? 34 : LATENCY,
+    // Minimum cycles between consecutive data transfers (line cadence = the
+    // controller's sustained-bandwidth bound for LINE_BYTES transactions).
+    parameter int unsigned TRANSFER_GAP_CYCLES = (TIMING_PRESET == 2) ? 2 :
+                                                 (TIMING_PRESET == 1) ? 4 : 0,
+    // Bank/row geometry for conflict modeling (DDR3: 8 banks, DDR4: 16).
+    parameter int unsigned BANK_COUNT = (TIMING_PRESET == 2) ? 16 : 8,
+    parameter int unsigned ROW_BYTES = 8192,
+    // Refresh: every REFRESH_INTERVAL cycles the model is busy for
+    // REFRESH_DURATION cycles and all row buffers close (tREFI / tRFC at
+    // the core clock). 0 disables refresh modeling.
+    parameter int unsigned REFRESH_INTERVAL = (TIMING_PRESET == 2) ? 1170 :
+                                              (TIMING_PRESET == 1) ? 780 : 0,
+    parameter int unsigned REFRESH_DURATION = (TIMING_PRESET == 2) ? 52 :
+                                              (TIMING_PRESET == 1) ? 26 : 0
 ) (
     input logic i_clk,
     input logic i_rst,
@@ -90,6 +126,43 @@ module axi_behavioral_memory #(
   end
 `endif
 
+  // ---- Timing model state -----------------------------------------------------
+  // Per-bank open-row tracking, refresh window, and transfer-cadence gap.
+  // Only updated when TIMING_PRESET != 0; request_latency() collapses to the
+  // fixed LATENCY otherwise, so preset 0 is cycle-identical to the old model.
+  localparam int unsigned BankShift = $clog2(ROW_BYTES);
+  localparam int unsigned BankBits = (BANK_COUNT > 1) ? $clog2(BANK_COUNT) : 1;
+
+  logic [31:0] open_row_q[BANK_COUNT];
+  logic [BANK_COUNT-1:0] row_valid_q;
+  logic [31:0] refresh_cnt_q;
+  logic [15:0] refresh_busy_q;
+  logic [15:0] transfer_gap_q;
+
+  logic read_accept;
+  logic write_accept;
+  logic [31:0] write_accept_addr;
+
+  function automatic logic [BankBits-1:0] bank_of(input logic [31:0] addr);
+    return addr[BankShift+:BankBits];
+  endfunction
+
+  function automatic logic [31:0] row_of(input logic [31:0] addr);
+    return addr >> (BankShift + BankBits);
+  endfunction
+
+  // First-word latency for a request accepted this cycle: row hit or the
+  // precharge+activate penalty, extended by any in-progress refresh and by
+  // the bandwidth cadence gap left behind by the previous transfer.
+  function automatic logic [15:0] request_latency(input logic [31:0] addr);
+    logic [15:0] base;
+    if (TIMING_PRESET == 0) return 16'(LATENCY);
+    base = (row_valid_q[bank_of(addr)] && open_row_q[bank_of(addr)] == row_of(addr))
+        ? 16'(ROW_HIT_LATENCY)
+        : 16'(ROW_MISS_LATENCY);
+    return base + refresh_busy_q + transfer_gap_q;
+  endfunction
+
   // ---- Write channel ----------------------------------------------------------
   typedef enum logic [1:0] {
     W_IDLE,
@@ -126,9 +199,8 @@ module axi_behavioral_memory #(
             wstrb_q <= i_axi_wstrb;
             w_got_q <= 1'b1;
           end
-          if ((aw_got_q || (i_axi_awvalid && o_axi_awready)) &&
-              (w_got_q || (i_axi_wvalid && o_axi_wready))) begin
-            wlat_q   <= 16'(LATENCY);
+          if (write_accept) begin
+            wlat_q   <= request_latency(write_accept_addr);
             wstate_q <= W_WAIT;
           end
         end
@@ -188,7 +260,7 @@ module axi_behavioral_memory #(
         R_IDLE: begin
           if (i_axi_arvalid) begin
             araddr_q <= i_axi_araddr;
-            rlat_q   <= 16'(LATENCY);
+            rlat_q   <= request_latency(i_axi_araddr);
             rstate_q <= R_WAIT;
           end
         end
@@ -215,6 +287,58 @@ module axi_behavioral_memory #(
     end
   end
 
+  // ---- Timing model update ----------------------------------------------------
+  assign read_accept = i_axi_arvalid && o_axi_arready;
+  assign write_accept = (wstate_q == W_IDLE) &&
+      (aw_got_q || (i_axi_awvalid && o_axi_awready)) &&
+      (w_got_q || (i_axi_wvalid && o_axi_wready));
+  assign write_accept_addr = aw_got_q ? awaddr_q : i_axi_awaddr;
+
+  always_ff @(posedge i_clk) begin
+    if (i_rst) begin
+      row_valid_q    <= '0;
+      refresh_cnt_q  <= '0;
+      refresh_busy_q <= '0;
+      transfer_gap_q <= '0;
+    end else if (TIMING_PRESET != 0) begin
+      // Bandwidth cadence: re-arm the gap on every data transfer completion
+      // so back-to-back lines cannot exceed the controller's sustained rate.
+      if ((o_axi_rvalid && i_axi_rready) || (o_axi_bvalid && i_axi_bready)) begin
+        transfer_gap_q <= 16'(TRANSFER_GAP_CYCLES);
+      end else if (transfer_gap_q != 0) begin
+        transfer_gap_q <= transfer_gap_q - 1'b1;
+      end
+
+      // Open-row tracking on request acceptance. The read and write channels
+      // are independent FSMs; on a same-cycle tie the write's row wins, which
+      // is fine for a behavioral model (no scheduler is modeled).
+      if (read_accept) begin
+        open_row_q[bank_of(i_axi_araddr)]  <= row_of(i_axi_araddr);
+        row_valid_q[bank_of(i_axi_araddr)] <= 1'b1;
+      end
+      if (write_accept) begin
+        open_row_q[bank_of(write_accept_addr)]  <= row_of(write_accept_addr);
+        row_valid_q[bank_of(write_accept_addr)] <= 1'b1;
+      end
+
+      // Refresh: every tREFI the model goes busy for tRFC and every row
+      // buffer closes (all-banks precharge). Requests accepted inside the
+      // window absorb the remaining busy cycles into their latency.
+      if (REFRESH_INTERVAL != 0) begin
+        if (refresh_busy_q != 0) begin
+          refresh_busy_q <= refresh_busy_q - 1'b1;
+        end
+        if (refresh_cnt_q >= 32'(REFRESH_INTERVAL - 1)) begin
+          refresh_cnt_q  <= '0;
+          refresh_busy_q <= 16'(REFRESH_DURATION);
+          row_valid_q    <= '0;
+        end else begin
+          refresh_cnt_q <= refresh_cnt_q + 1'b1;
+        end
+      end
+    end
+  end
+
 `ifndef SYNTHESIS
   // Out-of-model accesses alias into the array (harmless for wrong-path
   // speculation); warn a few times so an undersized DDR_MODEL_BYTES against a
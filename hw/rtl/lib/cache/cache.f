@@ -2,15 +2,21 @@
 # Recursive line-port cache + the bottom-of-hierarchy AXI bridge and the
 # simulation-only behavioral main memory.
 
-# Write-back direct-mapped line cache (one module for L1 and L2)
+# Write-back set-associative line cache (one module for L1 and L2)
 $(ROOT)/hw/rtl/lib/cache/frost_cache.sv
 
 # Per-board cache hierarchy wrapper (L1, optional URAM L2)
 $(ROOT)/hw/rtl/lib/cache/frost_cache_hierarchy.sv
 
+# Next-line/stride prefetcher spliced into the L1 miss streams
+$(ROOT)/hw/rtl/lib/cache/line_port_prefetcher.sv
+
 # 2:1 arbiter for single-outstanding line ports (L1I/L1D -> L2/bridge)
 $(ROOT)/hw/rtl/lib/cache/line_port_arbiter.sv
 
+# Optional register slice for a line port (Fmax cut; wires when disabled)
+$(ROOT)/hw/rtl/lib/cache/line_port_register_slice.sv
+
 # Line-port -> AXI4 master bridge (bottom of the hierarchy)
 $(ROOT)/hw/rtl/lib/cache/line_port_axi_bridge.sv
 
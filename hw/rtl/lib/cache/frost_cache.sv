@@ -17,8 +17,9 @@
 /*
  * frost_cache -- recursive, line-granular, write-back write-allocate cache.
  *
- * Direct-mapped, single-outstanding, blocking. One module serves every level
- * of the hierarchy: the upstream port (slave) and downstream port (master)
+ * Direct-mapped or set-associative (NUM_WAYS = 1, 2 or 4, tree pseudo-LRU),
+ * single-outstanding, blocking. One module serves every level of the
+ * hierarchy: the upstream port (slave) and downstream port (master)
  * speak the SAME line protocol, so caches stack by instantiation:
  *   CPU adapter -> frost_cache(L1, BRAM) -> DDR
  *   CPU adapter -> frost_cache(L1, BRAM) -> frost_cache(L2, URAM) -> DDR
@@ -37,12 +38,18 @@
  *   fetch (whole-line allocate) -- this is the common case for evictions
  *   arriving from the level above, so L2 never reads DDR to absorb one.
  *
- * GEOMETRY: CACHE_SIZE_BYTES / LINE_BYTES direct-mapped lines; a 32-byte line
- * is exactly one 256-bit data-array row (sdp_ram_byte_en: BRAM or URAM via
- * MEMORY_PRIMITIVE). Tags+valid+dirty live in a block RAM (sdp_block_ram).
+ * GEOMETRY: CACHE_SIZE_BYTES / LINE_BYTES lines in NUM_WAYS ways (sets =
+ * lines / ways, so associativity trades index bits for tag bits at constant
+ * data-array size); a 32-byte line is exactly one 256-bit data-array row
+ * (sdp_ram_byte_en: BRAM or URAM via MEMORY_PRIMITIVE), rows addressed
+ * {way, set}. One tag-RAM row per set holds every way's {valid, dirty, tag}
+ * plus the set's pseudo-LRU tree bits (sdp_block_ram), so a single read
+ * compares all ways in parallel and hit latency does not change with
+ * associativity. Replacement picks an invalid way first, else the tree-PLRU
+ * victim; the tree bits are touched on every hit and allocate.
  *
  * RESET: a sweep FSM walks the tag array clearing every valid bit
- * (NUM_LINES cycles) before asserting req_ready. This re-invalidates the
+ * (one cycle per set) before asserting req_ready. This re-invalidates the
  * cache on ANY reset -- including the image-load reset the JTAG loader
  * asserts while it rewrites memory -- so stale (possibly dirty) lines from a
  * previous program are discarded by design, never written back.
@@ -51,7 +58,7 @@
  * (ready stays low for the duration; o_maint_busy covers the walk).
  * INVALIDATE_ALL re-runs the reset sweep -- dirty contents are DISCARDED,
  * which is only correct for caches used read-only (the L1I).
- * WRITEBACK_ALL walks every index, writes each valid+dirty line downstream,
+ * WRITEBACK_ALL walks every set and way, writes each valid+dirty line downstream,
  * and clears its dirty bit (lines stay valid and servable) -- the L1D's
  * fence.i operation, making store-produced code visible at the level the
  * L1I fills from.
@@ -60,11 +67,53 @@
  * pulse and the SQ waits for a done pulse), so hits and misses may take any
  * number of cycles. Hit latencies with the default DATA_READ_LATENCY:
  * read hit = DATA_READ_LATENCY+3 cycles from fire, write hit = 3 cycles.
+ *
+ * EARLY RESTART: a miss's upstream response pulses the same cycle the fill
+ * arrives (downstream response or victim-buffer forward), with the line
+ * forwarded combinationally; the allocate then happens in the shadow of the
+ * requester consuming it, not in front of it. Stacked levels chain the
+ * forward, so a DDR fill reaches the CPU adapter the cycle it lands at the
+ * bottom instead of walking an alloc+respond pair per level. (The line is a
+ * single 256-bit beat end to end, so there is no word order to rearrange --
+ * this is the whole of critical-word-first at this granularity.) When the
+ * overlap port happens to be pulsing its own response that cycle, the miss
+ * falls back to the ordinary S_RESPOND path.
+ *
+ * VICTIM BUFFER (ENABLE_VICTIM_BUFFER != 0): a miss that evicts a dirty line
+ * parks it in a one-entry buffer and launches the fill immediately, instead
+ * of paying writeback + fill in series; the buffer drains downstream in the
+ * background once the miss's own transactions are done (the drain FSM only
+ * takes the port between the main FSM's uses of it). A later fill whose
+ * address matches the still-buffered line is served from the buffer -- the
+ * level below may not have the data yet, so the forward is correctness, not
+ * just latency. A second dirty miss arriving before the drain completes
+ * falls back to the serial writeback-then-fill path, and writeback-all
+ * waits for the buffer to empty before walking.
+ *
+ * HIT-UNDER-MISS (ENABLE_HIT_UNDER_MISS != 0): the registered miss request
+ * is a one-entry MSHR. While its downstream writeback/fill is in flight the
+ * arrays sit idle, so req_ready re-asserts and ONE more request may fire; a
+ * hit to a different set is served in the shadow of the miss, anything else
+ * (miss, or the miss's own set -- whose victim snapshot must not be
+ * disturbed) is held and replayed once the miss retires. Responses can
+ * therefore complete out of order, so every response carries o_up_resp_write
+ * and an upstream master with both a read and a write outstanding matches
+ * completions on it. The downstream port stays single-outstanding, which
+ * caps the MSHR file at one entry; miss-under-miss needs a multi-outstanding
+ * bottom port first.
  */
 module frost_cache #(
     parameter int unsigned ADDR_WIDTH = 32,
     parameter int unsigned CACHE_SIZE_BYTES = 128 * 1024,
     parameter int unsigned LINE_BYTES = 32,
+    // Associativity: 1 (direct-mapped), 2 or 4 (tree pseudo-LRU replacement).
+    parameter int unsigned NUM_WAYS = 1,
+    // Non-blocking upstream port: serve one hit while a miss is in flight
+    // (see header). The L1D enables this; read-only/lower levels keep 0.
+    parameter int unsigned ENABLE_HIT_UNDER_MISS = 0,
+    // One-entry victim buffer: fill-before-writeback on dirty misses (see
+    // header). Pointless on read-only instances (nothing is ever dirty).
+    parameter int unsigned ENABLE_VICTIM_BUFFER = 0,
     // Data-array primitive + latencies (see sdp_ram_byte_en). "block" for L1,
     // "ultra" for the X3 L2. Simulation behaviour is primitive-agnostic.
     // Untyped on purpose: Vivado fails to resolve string-typed parameters
@@ -86,6 +135,9 @@ module frost_cache #(
     input  logic [  LINE_BYTES-1:0] i_up_req_wstrb,
     output logic                    o_up_resp_valid,
     output logic [LINE_BYTES*8-1:0] o_up_resp_rdata,
+    // Which kind of request this response completes. Only meaningful to
+    // masters that use hit-under-miss to keep two transactions in flight.
+    output logic                    o_up_resp_write,
 
     // Maintenance requests (see header). Hold the request until o_maint_busy
     // rises; the walk completes when it falls.
@@ -106,16 +158,30 @@ module frost_cache #(
 
   localparam int unsigned LineBits = LINE_BYTES * 8;
   localparam int unsigned NumLines = CACHE_SIZE_BYTES / LINE_BYTES;
+  localparam int unsigned NumSets = NumLines / NUM_WAYS;
   localparam int unsigned OffsetBits = $clog2(LINE_BYTES);
-  localparam int unsigned IndexBits = $clog2(NumLines);
+  localparam int unsigned IndexBits = $clog2(NumSets);
   localparam int unsigned TagBits = ADDR_WIDTH - IndexBits - OffsetBits;
-  // Tag entry layout: {valid, dirty, tag}
+  // Per-way tag entry layout: {valid, dirty, tag}
   localparam int unsigned TagEntryBits = TagBits + 2;
+  // Way-select widths. Floored at 1 bit so the direct-mapped build keeps
+  // every signal width-positive; the extra bit is constant zero there.
+  localparam int unsigned WayBits = (NUM_WAYS > 1) ? $clog2(NUM_WAYS) : 1;
+  // Tree-PLRU bits per set (NUM_WAYS-1 nodes), same 1-bit floor.
+  localparam int unsigned PlruBits = (NUM_WAYS > 1) ? NUM_WAYS - 1 : 1;
+  // One tag-RAM row per set: {plru, wayN-1 entry, ..., way0 entry}.
+  localparam int unsigned TagRowBits = PlruBits + NUM_WAYS * TagEntryBits;
+  // Data-array rows addressed {way, set}.
+  localparam int unsigned DataAddrBits = (NUM_WAYS > 1) ? IndexBits + $clog2(NUM_WAYS) : IndexBits;
 
   initial begin
     if (NumLines * LINE_BYTES != CACHE_SIZE_BYTES)
       $fatal(1, "frost_cache: CACHE_SIZE_BYTES must be a multiple of LINE_BYTES");
-    if (2 ** IndexBits != NumLines) $fatal(1, "frost_cache: line count must be a power of 2");
+    if (NUM_WAYS != 1 && NUM_WAYS != 2 && NUM_WAYS != 4)
+      $fatal(1, "frost_cache: NUM_WAYS must be 1, 2 or 4");
+    if (NumSets * NUM_WAYS != NumLines)
+      $fatal(1, "frost_cache: line count must be a multiple of NUM_WAYS");
+    if (2 ** IndexBits != NumSets) $fatal(1, "frost_cache: set count must be a power of 2");
     if (2 ** OffsetBits != LINE_BYTES) $fatal(1, "frost_cache: LINE_BYTES must be a power of 2");
   end
 
@@ -131,7 +197,7 @@ module frost_cache #(
   assign req_tag   = req_addr_q[ADDR_WIDTH-1-:TagBits];
 
   // ---- FSM ------------------------------------------------------------------
-  typedef enum logic [3:0] {
+  typedef enum logic [4:0] {
     S_SWEEP,         // reset/invalidate-all: clear every tag entry
     S_IDLE,          // accept a request; tag read issued at the fire
     S_TAG_CHECK,     // tag compare; dispatch hit/miss work
@@ -141,6 +207,7 @@ module frost_cache #(
     S_WB_WAIT,       // wait for the writeback ack
     S_FILL_REQ,      // present the line fetch downstream
     S_FILL_WAIT,     // wait for the fetched line
+    S_ALLOC_WAIT,    // fill arrived mid-overlap-hit: let the hit finish
     S_ALLOC,         // write the new line + tag
     S_RESPOND,       // pulse the upstream response
     S_FLUSH_SCAN,    // writeback-all: present the walk index to the tags
@@ -163,21 +230,81 @@ module frost_cache #(
       (state_q == S_FLUSH_WB_WAIT);
   assign o_maint_busy = flush_active || (state_q == S_SWEEP);
   logic [             7:0] wait_cnt_q;  // data-array latency countdown (latencies are small)
+  logic [     WayBits-1:0] flush_way_q;
+  logic [  TagRowBits-1:0] flush_row_q;
+  logic [     WayBits-1:0] victim_way_q;
+  logic [  TagRowBits-1:0] tag_row_q;
   logic [     TagBits-1:0] victim_tag_q;
   logic [    LineBits-1:0] victim_line_q;
   logic [    LineBits-1:0] line_buf_q;
   logic [    LineBits-1:0] resp_data_q;
 
-  // ---- Tag array (sync 1-cycle read; written by sweep / hit / allocate) -----
-  logic                    tag_we;
-  logic [   IndexBits-1:0] tag_waddr;
-  logic [TagEntryBits-1:0] tag_wdata;
-  logic [   IndexBits-1:0] tag_raddr;
-  logic [TagEntryBits-1:0] tag_rdata;
+  // ---- Hit-under-miss overlap port (see header) -----------------------------
+  localparam bit EnableHum = (ENABLE_HIT_UNDER_MISS != 0);
+
+  typedef enum logic [2:0] {
+    OV_IDLE,       // no overlap request
+    OV_TAG_CHECK,  // tag compare for the overlap request
+    OV_READ_WAIT,  // overlap read hit: wait out the data-array read latency
+    OV_RESPOND,    // pulse the overlap response
+    OV_HOLD        // overlap missed (or aliased the miss's set): replay later
+  } ov_state_e;
+
+  ov_state_e ov_state_q;
+
+  // The main FSM is only waiting on the downstream port in these states; the
+  // arrays are idle, so an overlap request may borrow them.
+  logic main_in_wait;
+  assign main_in_wait = (state_q == S_WB_REQ) || (state_q == S_WB_WAIT) ||
+      (state_q == S_FILL_REQ) || (state_q == S_FILL_WAIT);
+
+  logic ov_ready, ov_fire, ov_busy, ov_hold, ov_takeover;
+  assign ov_ready = EnableHum && main_in_wait && (ov_state_q == OV_IDLE);
+  assign ov_fire  = ov_ready && i_up_req_valid;
+  // Busy from the fire cycle onward: the fill response may land that same
+  // cycle and the main FSM must detour through S_ALLOC_WAIT.
+  assign ov_busy = ov_fire || (ov_state_q == OV_TAG_CHECK) || (ov_state_q == OV_READ_WAIT) ||
+      (ov_state_q == OV_RESPOND);
+  assign ov_hold = (ov_state_q == OV_HOLD);
+  // A held overlap request is replayed through the main FSM from idle, as if
+  // it had just fired (maintenance keeps priority; the hold survives it).
+  assign ov_takeover = (state_q == S_IDLE) && !i_invalidate_all && !i_writeback_all && ov_hold;
+
+  logic                    ov_req_write_q;
+  logic [  ADDR_WIDTH-1:0] ov_req_addr_q;
+  logic [    LineBits-1:0] ov_req_wdata_q;
+  logic [  LINE_BYTES-1:0] ov_req_wstrb_q;
+  logic [    LineBits-1:0] ov_resp_data_q;
+
+  logic [   IndexBits-1:0] ov_index;
+  logic [     TagBits-1:0] ov_tag;
+  assign ov_index = ov_req_addr_q[OffsetBits+:IndexBits];
+  assign ov_tag   = ov_req_addr_q[ADDR_WIDTH-1-:TagBits];
+
+  // Overlap drives into the shared arrays (merged at the instances; by
+  // construction they never collide with the main FSM's drives).
+  logic                    ov_tag_we;
+  logic [  TagRowBits-1:0] ov_tag_wdata;
+  logic                    ov_data_re;
+  logic                    ov_data_we;
+  logic [DataAddrBits-1:0] ov_data_addr;
 
-  logic tag_rdata_valid, tag_rdata_dirty;
-  logic [TagBits-1:0] tag_rdata_tag;
-  assign {tag_rdata_valid, tag_rdata_dirty, tag_rdata_tag} = tag_rdata;
+  // ---- Tag array (sync 1-cycle read; written by sweep / hit / allocate) -----
+  // One row per set: every way's entry plus the set's PLRU tree bits, so one
+  // read serves the whole-set compare and one write updates entry + PLRU.
+  logic                  tag_we;
+  logic [ IndexBits-1:0] tag_waddr;
+  logic [TagRowBits-1:0] tag_wdata;
+  logic [ IndexBits-1:0] tag_raddr;
+  logic [TagRowBits-1:0] tag_rdata;
+
+  logic [NUM_WAYS-1:0] way_valid, way_dirty;
+  logic [TagBits-1:0] way_tag[NUM_WAYS];
+  logic [PlruBits-1:0] plru_rd;
+  assign plru_rd = tag_rdata[TagRowBits-1-:PlruBits];
+  for (genvar gw = 0; gw < int'(NUM_WAYS); gw++) begin : gen_tag_unpack
+    assign {way_valid[gw], way_dirty[gw], way_tag[gw]} = tag_rdata[gw*TagEntryBits+:TagEntryBits];
+  end
 
   // Tag compare, explicitly balanced: 3-bit equality groups (one LUT6 each)
   // whose nets synthesis must keep, then a flat reduce. A plain == here has
@@ -185,57 +312,146 @@ module frost_cache #(
   // 8 levels when the L1I joined the X3 build), and this cone drives the
   // data-array byte-enable fanout the cycle the tag arrives from block RAM.
   localparam int unsigned TagCmpGroups = (TagBits + 2) / 3;
-  (* dont_touch = "true" *) logic [TagCmpGroups-1:0] tag_match_group;
-  for (genvar gg = 0; gg < int'(TagCmpGroups); gg++) begin : gen_tag_compare
-    localparam int unsigned Lo = gg * 3;
-    localparam int unsigned Hi = (Lo + 3 <= TagBits) ? Lo + 3 : TagBits;
-    assign tag_match_group[gg] = (tag_rdata_tag[Hi-1:Lo] == req_tag[Hi-1:Lo]);
+  logic [NUM_WAYS-1:0] way_match;
+  for (genvar gw = 0; gw < int'(NUM_WAYS); gw++) begin : gen_way_compare
+    (* dont_touch = "true" *) logic [TagCmpGroups-1:0] tag_match_group;
+    for (genvar gg = 0; gg < int'(TagCmpGroups); gg++) begin : gen_tag_compare
+      localparam int unsigned Lo = gg * 3;
+      localparam int unsigned Hi = (Lo + 3 <= TagBits) ? Lo + 3 : TagBits;
+      assign tag_match_group[gg] = (way_tag[gw][Hi-1:Lo] == req_tag[Hi-1:Lo]);
+    end
+    assign way_match[gw] = way_valid[gw] && (&tag_match_group);
   end
 
   logic hit;
-  assign hit = tag_rdata_valid && (&tag_match_group);
+  assign hit = |way_match;
+
+  logic [WayBits-1:0] hit_way;
+  always_comb begin
+    hit_way = '0;
+    for (int w = 0; w < int'(NUM_WAYS); w++) begin
+      if (way_match[w]) hit_way = WayBits'(w);
+    end
+  end
+
+  // ---- Replacement: invalid way first, else the tree-PLRU victim -----------
+  // Node bits point AT the next victim (root selects the pair, leaves select
+  // within a pair); touching a way flips every node on its path away from it.
+  logic [WayBits-1:0] plru_victim;
+  if (NUM_WAYS == 4) begin : gen_plru_victim4
+    assign plru_victim = plru_rd[0] ? {1'b1, plru_rd[2]} : {1'b0, plru_rd[1]};
+  end else if (NUM_WAYS == 2) begin : gen_plru_victim2
+    assign plru_victim = WayBits'(plru_rd[0]);
+  end else begin : gen_plru_victim1
+    assign plru_victim = '0;
+  end
+
+  logic have_invalid_way;
+  logic [WayBits-1:0] invalid_way;
+  always_comb begin
+    have_invalid_way = 1'b0;
+    invalid_way      = '0;
+    for (int w = int'(NUM_WAYS) - 1; w >= 0; w--) begin
+      if (!way_valid[w]) begin
+        have_invalid_way = 1'b1;
+        invalid_way      = WayBits'(w);
+      end
+    end
+  end
+
+  logic [WayBits-1:0] victim_way;
+  assign victim_way = have_invalid_way ? invalid_way : plru_victim;
+
+  // PLRU tree after an access to `way` (computed in 3/2-bit working copies so
+  // the narrow direct-mapped/2-way widths never see an out-of-range select).
+  function automatic logic [PlruBits-1:0] plru_touch(logic [PlruBits-1:0] plru,
+                                                     logic [WayBits-1:0] way);
+    logic [2:0] p;
+    logic [1:0] w;
+    p = 3'(plru);
+    w = 2'(way);
+    if (NUM_WAYS == 2) begin
+      p[0] = ~w[0];
+    end else if (NUM_WAYS == 4) begin
+      p[0] = ~w[1];
+      if (w[1]) p[2] = ~w[0];
+      else p[1] = ~w[0];
+    end
+    return PlruBits'(p);
+  endfunction
+
+  // A tag row with one way's entry and the PLRU bits replaced.
+  function automatic logic [TagRowBits-1:0] tag_row_update(logic [TagRowBits-1:0] row,
+                                                           logic [WayBits-1:0] way,
+                                                           logic [TagEntryBits-1:0] entry,
+                                                           logic [PlruBits-1:0] plru);
+    logic [TagRowBits-1:0] r;
+    r = row;
+    r[32'(way)*TagEntryBits+:TagEntryBits] = entry;
+    r[TagRowBits-1-:PlruBits] = plru;
+    return r;
+  endfunction
 
   sdp_block_ram #(
       .ADDR_WIDTH(IndexBits),
-      .DATA_WIDTH(TagEntryBits)
+      .DATA_WIDTH(TagRowBits)
   ) tag_array (
       .i_clk(i_clk),
-      .i_write_enable(tag_we),
-      .i_write_address(tag_waddr),
+      // Write port shared with the hit-under-miss overlap path (its drives
+      // are declared below the arrays; the FSMs never write the same cycle).
+      .i_write_enable(tag_we | ov_tag_we),
+      .i_write_address(ov_tag_we ? ov_index : tag_waddr),
       .i_read_address(tag_raddr),
-      .i_write_data(tag_wdata),
+      .i_write_data(ov_tag_we ? ov_tag_wdata : tag_wdata),
       .o_read_data(tag_rdata)
   );
 
   // Tag read address: the incoming request's index, sampled at the fire so
-  // the entry is readable in S_TAG_CHECK; the walk index during the
-  // writeback-all scan. Don't-care in every other state.
-  assign tag_raddr = (state_q == S_FLUSH_SCAN) ? flush_idx_q : i_up_req_addr[OffsetBits+:IndexBits];
-
-  // ---- Data array (one row per line) ----------------------------------------
-  logic                  data_re;
-  logic [ IndexBits-1:0] data_raddr;
-  logic [  LineBits-1:0] data_rdata;
-  logic                  data_row_we;  // qualifies the byte strobes below
-  logic [LINE_BYTES-1:0] data_wbyte_en;
-  logic [  LineBits-1:0] data_wdata;
+  // the entry is readable in S_TAG_CHECK (a replayed overlap hold supplies
+  // its own registered index); the walk index during the writeback-all scan.
+  // Don't-care in every other state.
+  assign tag_raddr = (state_q == S_FLUSH_SCAN) ? flush_idx_q :
+      ov_takeover ? ov_req_addr_q[OffsetBits+:IndexBits] : i_up_req_addr[OffsetBits+:IndexBits];
+
+  // ---- Data array (one row per line, addressed {way, set}) -----------------
+  logic                    data_re;
+  logic [DataAddrBits-1:0] data_raddr;
+  logic [DataAddrBits-1:0] data_waddr;
+  logic [    LineBits-1:0] data_rdata;
+  logic                    data_row_we;  // qualifies the byte strobes below
+  logic [  LINE_BYTES-1:0] data_wbyte_en;
+  logic [    LineBits-1:0] data_wdata;
+
+  function automatic logic [DataAddrBits-1:0] data_row_addr(logic [IndexBits-1:0] set,
+                                                            logic [WayBits-1:0] way);
+    return DataAddrBits'(set) | (DataAddrBits'(way) << IndexBits);
+  endfunction
 
   sdp_ram_byte_en #(
       .DATA_WIDTH(LineBits),
-      .ADDR_WIDTH(IndexBits),
+      .ADDR_WIDTH(DataAddrBits),
       .READ_LATENCY(DATA_READ_LATENCY),
       .WRITE_LATENCY(DATA_WRITE_LATENCY),
       .MEMORY_PRIMITIVE(DATA_MEMORY_PRIMITIVE)
   ) data_array (
       .i_clk(i_clk),
-      .i_waddr(req_index),
-      .i_wdata(data_wdata),
-      .i_wbyte_en(data_wbyte_en & {LINE_BYTES{data_row_we}}),
-      .i_re(data_re),
-      .i_raddr(data_raddr),
+      // Ports shared with the hit-under-miss overlap path; the FSMs never
+      // drive the same port in the same cycle.
+      .i_waddr(ov_data_we ? ov_data_addr : data_waddr),
+      .i_wdata(ov_data_we ? ov_req_wdata_q : data_wdata),
+      .i_wbyte_en((data_wbyte_en & {LINE_BYTES{data_row_we}}) |
+                  (ov_req_wstrb_q & {LINE_BYTES{ov_data_we}})),
+      .i_re(data_re | ov_data_re),
+      .i_raddr(ov_data_re ? ov_data_addr : data_raddr),
       .o_rdata(data_rdata)
   );
-  assign data_raddr = flush_active ? flush_idx_q : req_index;
+  // Reads are only sampled at the data_re pulse: the hit way (read hit) or
+  // the victim way (dirty eviction) in S_TAG_CHECK, the walk way in
+  // S_FLUSH_CHECK. Writes land in the hit way (write hit, in S_TAG_CHECK)
+  // or the registered victim way (S_ALLOC).
+  assign data_raddr = flush_active ? data_row_addr(flush_idx_q, flush_way_q)
+                                   : data_row_addr(req_index, hit ? hit_way : victim_way);
+  assign data_waddr = data_row_addr(req_index, (state_q == S_TAG_CHECK) ? hit_way : victim_way_q);
 
   // The (partial) upstream write merged into the fetched line: strobed bytes
   // take the request's data, the rest keep the fill. (A generate rather than
@@ -246,11 +462,217 @@ module frost_cache #(
         req_wstrb_q[gb] ? req_wdata_q[gb*8+:8] : i_down_resp_rdata[gb*8+:8];
   end
 
+  // ---- Victim buffer (fetch-before-writeback on dirty misses; see header) ---
+  localparam bit EnableVb = (ENABLE_VICTIM_BUFFER != 0);
+
+  typedef enum logic [1:0] {
+    VB_IDLE,  // nothing draining (the buffer may still hold a captured line)
+    VB_REQ,   // present the buffered writeback downstream
+    VB_WAIT   // wait for the writeback ack; then the buffer empties
+  } vb_state_e;
+
+  vb_state_e vb_state_q;
+
+  logic                  vb_valid_q;
+  logic [ADDR_WIDTH-1:0] vb_addr_q;
+  logic [  LineBits-1:0] vb_line_q;
+
+  logic vb_busy;
+  assign vb_busy = (vb_state_q == VB_REQ) || (vb_state_q == VB_WAIT);
+
+  // States in which the main FSM owns (or is about to handshake on) the
+  // downstream port; the drain only launches outside them, and the main
+  // request states stall while a drain is mid-flight.
+  logic main_port_active;
+  assign main_port_active = (state_q == S_WB_REQ) || (state_q == S_WB_WAIT) ||
+      (state_q == S_FILL_REQ) || (state_q == S_FILL_WAIT) ||
+      (state_q == S_FLUSH_WB_REQ) || (state_q == S_FLUSH_WB_WAIT);
+
+  // The victim line lands in the buffer at the end of the eviction read,
+  // provided the buffer is free (else the serial writeback path runs).
+  logic vb_capture;
+  assign vb_capture = EnableVb && (state_q == S_EVICT_WAIT) && (wait_cnt_q == 8'd1) &&
+      !vb_valid_q;
+
+  // Fill forwarding: the pending fill's line is still in the buffer.
+  logic vb_forward;
+  assign vb_forward = EnableVb && vb_valid_q &&
+      (vb_addr_q == {req_addr_q[ADDR_WIDTH-1:OffsetBits], {OffsetBits{1'b0}}});
+
+  // The upstream (partial) write merged into the forwarded buffer line.
+  logic [LineBits-1:0] vb_fill_merged;
+  for (genvar gb = 0; gb < int'(LINE_BYTES); gb++) begin : gen_vb_fill_merge
+    assign vb_fill_merged[gb*8+:8] =
+        req_wstrb_q[gb] ? req_wdata_q[gb*8+:8] : vb_line_q[gb*8+:8];
+  end
+
+  if (EnableVb) begin : gen_victim_buffer
+    always_ff @(posedge i_clk) begin
+      if (i_rst) begin
+        vb_state_q <= VB_IDLE;
+        vb_valid_q <= 1'b0;
+      end else begin
+        if (vb_capture) begin
+          vb_valid_q <= 1'b1;
+          vb_addr_q  <= {victim_tag_q, req_index, {OffsetBits{1'b0}}};
+          vb_line_q  <= data_rdata;
+        end
+
+        unique case (vb_state_q)
+          // Launch only between the main FSM's own port transactions; on the
+          // capture cycle vb_valid_q is still low, and by the next cycle the
+          // miss is in its fill states, so the demand fill always goes first.
+          VB_IDLE: if (vb_valid_q && !main_port_active) vb_state_q <= VB_REQ;
+
+          VB_REQ: if (i_down_req_ready) vb_state_q <= VB_WAIT;
+
+          VB_WAIT: begin
+            if (i_down_resp_valid) begin
+              vb_valid_q <= 1'b0;
+              vb_state_q <= VB_IDLE;
+            end
+          end
+
+          default: vb_state_q <= VB_IDLE;
+        endcase
+      end
+    end
+  end else begin : gen_no_victim_buffer
+    assign vb_state_q = VB_IDLE;
+    assign vb_valid_q = 1'b0;
+    assign vb_addr_q  = '0;
+    assign vb_line_q  = '0;
+  end
+
+  // ---- Hit-under-miss overlap service (see header; declarations above the
+  // arrays, which share their ports with this path) ---------------------------
+  if (EnableHum) begin : gen_hit_under_miss
+    // Plain per-way compare: the overlap path is not on the tag-arrival
+    // critical cone (the balanced main compare is), so no grouping needed.
+    logic [NUM_WAYS-1:0] ov_way_match;
+    for (genvar gw = 0; gw < int'(NUM_WAYS); gw++) begin : gen_ov_compare
+      assign ov_way_match[gw] = way_valid[gw] && (way_tag[gw] == ov_tag);
+    end
+
+    logic ov_hit;
+    assign ov_hit = |ov_way_match;
+
+    logic [WayBits-1:0] ov_hit_way;
+    always_comb begin
+      ov_hit_way = '0;
+      for (int w = 0; w < int'(NUM_WAYS); w++) begin
+        if (ov_way_match[w]) ov_hit_way = WayBits'(w);
+      end
+    end
+
+    // The miss's set is off limits: its victim was snapshotted at tag check,
+    // and an overlap write there would be silently lost under the
+    // writeback/allocate. Same-set requests hold instead.
+    logic ov_same_set;
+    assign ov_same_set = (ov_index == req_index);
+
+    assign ov_data_addr = data_row_addr(ov_index, ov_hit_way);
+
+    always_comb begin
+      ov_tag_we    = 1'b0;
+      ov_tag_wdata = '0;
+      ov_data_re   = 1'b0;
+      ov_data_we   = 1'b0;
+
+      if (ov_state_q == OV_TAG_CHECK && ov_hit && !ov_same_set) begin
+        if (ov_req_write_q) begin
+          // Overlap write hit: strobed byte write, mark dirty, touch PLRU.
+          ov_data_we   = 1'b1;
+          ov_tag_we    = 1'b1;
+          ov_tag_wdata = tag_row_update(tag_rdata, ov_hit_way, {1'b1, 1'b1, ov_tag},
+                                        plru_touch(plru_rd, ov_hit_way));
+        end else begin
+          ov_data_re = 1'b1;
+          if (NUM_WAYS > 1) begin
+            ov_tag_we    = 1'b1;
+            ov_tag_wdata = tag_row_update(tag_rdata, ov_hit_way,
+                                          {1'b1, way_dirty[ov_hit_way], way_tag[ov_hit_way]},
+                                          plru_touch(plru_rd, ov_hit_way));
+          end
+        end
+      end
+    end
+
+    logic [7:0] ov_wait_cnt_q;
+    always_ff @(posedge i_clk) begin
+      if (i_rst) begin
+        ov_state_q <= OV_IDLE;
+      end else begin
+        unique case (ov_state_q)
+          OV_IDLE: begin
+            if (ov_fire) begin
+              ov_req_write_q <= i_up_req_write;
+              ov_req_addr_q  <= i_up_req_addr;
+              ov_req_wdata_q <= i_up_req_wdata;
+              ov_req_wstrb_q <= i_up_req_wstrb;
+              ov_state_q     <= OV_TAG_CHECK;
+            end
+          end
+
+          OV_TAG_CHECK: begin
+            if (!ov_hit || ov_same_set) begin
+              ov_state_q <= OV_HOLD;
+            end else if (ov_req_write_q) begin
+              ov_state_q <= OV_RESPOND;
+            end else begin
+              ov_wait_cnt_q <= 8'(DATA_READ_LATENCY);
+              ov_state_q    <= OV_READ_WAIT;
+            end
+          end
+
+          OV_READ_WAIT: begin
+            ov_wait_cnt_q <= ov_wait_cnt_q - 1'b1;
+            if (ov_wait_cnt_q == 8'd1) begin
+              ov_resp_data_q <= data_rdata;
+              ov_state_q     <= OV_RESPOND;
+            end
+          end
+
+          OV_RESPOND: ov_state_q <= OV_IDLE;
+
+          OV_HOLD: if (ov_takeover) ov_state_q <= OV_IDLE;
+
+          default: ov_state_q <= OV_IDLE;
+        endcase
+      end
+    end
+  end else begin : gen_no_hit_under_miss
+    assign ov_state_q     = OV_IDLE;
+    assign ov_req_write_q = 1'b0;
+    assign ov_req_addr_q  = '0;
+    assign ov_req_wdata_q = '0;
+    assign ov_req_wstrb_q = '0;
+    assign ov_resp_data_q = '0;
+    assign ov_tag_we      = 1'b0;
+    assign ov_tag_wdata   = '0;
+    assign ov_data_re     = 1'b0;
+    assign ov_data_we     = 1'b0;
+    assign ov_data_addr   = '0;
+  end
+
+  // ---- Early restart (see header) -------------------------------------------
+  // The fill's upstream response pulses as the line lands; S_ALLOC then skips
+  // S_RESPOND (resp_sent_q). Suppressed if the overlap port is responding
+  // this very cycle -- the two may not collide on the response channel.
+  logic early_resp;
+  assign early_resp = (((state_q == S_FILL_WAIT) && i_down_resp_valid) ||
+                       ((state_q == S_FILL_REQ) && vb_forward)) &&
+      (ov_state_q != OV_RESPOND);
+
+  logic resp_sent_q;
+
   logic up_req_fire;
   assign up_req_fire = i_up_req_valid && o_up_req_ready;
   // Ready masks the (registered) maintenance requests so a request firing
   // and a maintenance acceptance can never collide in the same idle cycle.
-  assign o_up_req_ready = (state_q == S_IDLE) && !i_invalidate_all && !i_writeback_all;
+  // A held overlap request also masks ready: it replays first.
+  assign o_up_req_ready =
+      ((state_q == S_IDLE) && !i_invalidate_all && !i_writeback_all && !ov_hold) || ov_ready;
 
   logic whole_line_write;
   assign whole_line_write = req_write_q && (&req_wstrb_q);
@@ -281,20 +703,28 @@ module frost_cache #(
       S_TAG_CHECK: begin
         if (hit && !req_write_q) begin
           data_re = 1'b1;  // read hit: start the data-array read
+          if (NUM_WAYS > 1) begin
+            // Touch the set's PLRU tree (the way's entry is unchanged).
+            tag_we    = 1'b1;
+            tag_wdata = tag_row_update(tag_rdata, hit_way,
+                                       {1'b1, way_dirty[hit_way], way_tag[hit_way]},
+                                       plru_touch(plru_rd, hit_way));
+          end
         end else if (hit && req_write_q) begin
-          // Write hit: strobed byte write into the line, mark dirty.
+          // Write hit: strobed byte write into the hit way, mark dirty.
           data_row_we   = 1'b1;
           data_wbyte_en = req_wstrb_q;
           data_wdata    = req_wdata_q;
           tag_we        = 1'b1;
-          tag_wdata     = {1'b1, 1'b1, req_tag};
-        end else if (tag_rdata_valid && tag_rdata_dirty) begin
+          tag_wdata     = tag_row_update(tag_rdata, hit_way, {1'b1, 1'b1, req_tag},
+                                         plru_touch(plru_rd, hit_way));
+        end else if (way_valid[victim_way] && way_dirty[victim_way]) begin
           data_re = 1'b1;  // miss with dirty victim: read it out for writeback
         end
       end
 
       S_WB_REQ: begin
-        o_down_req_valid = 1'b1;
+        o_down_req_valid = !vb_busy;
         o_down_req_write = 1'b1;
         o_down_req_addr  = {victim_tag_q, req_index, {OffsetBits{1'b0}}};
         o_down_req_wdata = victim_line_q;
@@ -302,7 +732,9 @@ module frost_cache #(
       end
 
       S_FILL_REQ: begin
-        o_down_req_valid = 1'b1;
+        // Held back while a victim drain owns the port, and not presented at
+        // all when the buffer forwards the line.
+        o_down_req_valid = !vb_busy && !vb_forward;
         o_down_req_write = 1'b0;
       end
 
@@ -312,11 +744,13 @@ module frost_cache #(
         data_wbyte_en = '1;
         data_wdata    = line_buf_q;
         tag_we        = 1'b1;
-        tag_wdata     = {1'b1, req_write_q, req_tag};
+        tag_wdata     = tag_row_update(tag_row_q, victim_way_q, {1'b1, req_write_q, req_tag},
+                                       plru_touch(tag_row_q[TagRowBits-1-:PlruBits],
+                                                  victim_way_q));
       end
 
       S_FLUSH_CHECK: begin
-        if (tag_rdata_valid && tag_rdata_dirty) begin
+        if (way_valid[flush_way_q] && way_dirty[flush_way_q]) begin
           data_re = 1'b1;  // dirty entry: read it out for writeback
         end
       end
@@ -331,25 +765,41 @@ module frost_cache #(
 
       S_FLUSH_WB_WAIT: begin
         if (i_down_resp_valid) begin
-          // Written back: keep the line valid, clear its dirty bit.
+          // Written back: keep the way valid, clear its dirty bit. (The next
+          // S_FLUSH_SCAN read lands an edge after this write, so the walk
+          // never sees the pre-write row.)
           tag_we    = 1'b1;
           tag_waddr = flush_idx_q;
-          tag_wdata = {1'b1, 1'b0, flush_tag_q};
+          tag_wdata = tag_row_update(flush_row_q, flush_way_q, {1'b1, 1'b0, flush_tag_q},
+                                     flush_row_q[TagRowBits-1-:PlruBits]);
         end
       end
 
       default: ;
     endcase
+
+    // A mid-flight victim drain owns the downstream port (the main FSM's
+    // request states above hold their valid low on vb_busy).
+    if (EnableVb && vb_busy) begin
+      o_down_req_valid = (vb_state_q == VB_REQ);
+      o_down_req_write = 1'b1;
+      o_down_req_addr  = vb_addr_q;
+      o_down_req_wdata = vb_line_q;
+      o_down_req_wstrb = '1;
+    end
   end
 
-  assign o_up_resp_valid = (state_q == S_RESPOND);
-  assign o_up_resp_rdata = resp_data_q;
+  assign o_up_resp_valid = (state_q == S_RESPOND) || (ov_state_q == OV_RESPOND) || early_resp;
+  assign o_up_resp_rdata = (ov_state_q == OV_RESPOND) ? ov_resp_data_q :
+      early_resp ? ((state_q == S_FILL_REQ) ? vb_line_q : i_down_resp_rdata) : resp_data_q;
+  assign o_up_resp_write = (ov_state_q == OV_RESPOND) ? ov_req_write_q : req_write_q;
 
   // ---- Sequential FSM --------------------------------------------------------
   always_ff @(posedge i_clk) begin
     if (i_rst) begin
       state_q     <= S_SWEEP;
       sweep_idx_q <= '0;
+      resp_sent_q <= 1'b0;
     end else begin
       unique case (state_q)
         S_SWEEP: begin
@@ -359,13 +809,24 @@ module frost_cache #(
 
         S_IDLE: begin
           // Maintenance has priority; ready is masked while requested, so an
-          // upstream fire can never coincide with an acceptance here.
-          if (i_invalidate_all) begin
+          // upstream fire can never coincide with an acceptance here. A
+          // maintenance walk waits for a captured victim to drain first (the
+          // drain launches from this very state), so writeback-all covers it.
+          if (i_invalidate_all && !vb_valid_q) begin
             sweep_idx_q <= '0;
             state_q     <= S_SWEEP;
-          end else if (i_writeback_all) begin
+          end else if (i_writeback_all && !vb_valid_q) begin
             flush_idx_q <= '0;
+            flush_way_q <= '0;
             state_q     <= S_FLUSH_SCAN;
+          end else if (ov_takeover) begin
+            // Replay the held overlap request as if it had just fired (the
+            // tag read is already steered to its index this cycle).
+            req_write_q <= ov_req_write_q;
+            req_addr_q  <= ov_req_addr_q;
+            req_wdata_q <= ov_req_wdata_q;
+            req_wstrb_q <= ov_req_wstrb_q;
+            state_q     <= S_TAG_CHECK;
           end else if (up_req_fire) begin
             req_write_q <= i_up_req_write;
             req_addr_q  <= i_up_req_addr;
@@ -381,16 +842,22 @@ module frost_cache #(
             state_q    <= S_READ_WAIT;
           end else if (hit && req_write_q) begin
             state_q <= S_RESPOND;
-          end else if (tag_rdata_valid && tag_rdata_dirty) begin
-            wait_cnt_q   <= 8'(DATA_READ_LATENCY);
-            victim_tag_q <= tag_rdata_tag;
-            state_q      <= S_EVICT_WAIT;
-          end else if (whole_line_write) begin
-            // Clean/invalid victim + whole-line write: allocate without a fetch.
-            line_buf_q <= req_wdata_q;
-            state_q    <= S_ALLOC;
           end else begin
-            state_q <= S_FILL_REQ;
+            // Miss: pin the victim way and the pre-miss tag row (S_ALLOC
+            // rewrites the row long after tag_rdata has moved on).
+            victim_way_q <= victim_way;
+            tag_row_q    <= tag_rdata;
+            if (way_valid[victim_way] && way_dirty[victim_way]) begin
+              wait_cnt_q   <= 8'(DATA_READ_LATENCY);
+              victim_tag_q <= way_tag[victim_way];
+              state_q      <= S_EVICT_WAIT;
+            end else if (whole_line_write) begin
+              // Clean/invalid victim + whole-line write: allocate without a fetch.
+              line_buf_q <= req_wdata_q;
+              state_q    <= S_ALLOC;
+            end else begin
+              state_q <= S_FILL_REQ;
+            end
           end
         end
 
@@ -405,36 +872,64 @@ module frost_cache #(
         S_EVICT_WAIT: begin
           wait_cnt_q <= wait_cnt_q - 1'b1;
           if (wait_cnt_q == 8'd1) begin
-            victim_line_q <= data_rdata;
-            state_q       <= S_WB_REQ;
+            if (vb_capture) begin
+              // Victim parked in the buffer (vb FSM captures it this cycle):
+              // go straight to the fill; the drain follows in the background.
+              if (whole_line_write) begin
+                line_buf_q <= req_wdata_q;
+                state_q    <= ov_busy ? S_ALLOC_WAIT : S_ALLOC;
+              end else begin
+                state_q <= S_FILL_REQ;
+              end
+            end else begin
+              // Buffer disabled or still occupied: serial writeback-then-fill.
+              victim_line_q <= data_rdata;
+              state_q       <= S_WB_REQ;
+            end
           end
         end
 
-        S_WB_REQ: if (i_down_req_ready) state_q <= S_WB_WAIT;
+        S_WB_REQ: if (!vb_busy && i_down_req_ready) state_q <= S_WB_WAIT;
 
         S_WB_WAIT: begin
           if (i_down_resp_valid) begin
             if (whole_line_write) begin
               line_buf_q <= req_wdata_q;
-              state_q    <= S_ALLOC;
+              state_q    <= ov_busy ? S_ALLOC_WAIT : S_ALLOC;
             end else begin
               state_q <= S_FILL_REQ;
             end
           end
         end
 
-        S_FILL_REQ: if (i_down_req_ready) state_q <= S_FILL_WAIT;
+        S_FILL_REQ: begin
+          if (vb_forward) begin
+            // The line never left: serve the fill from the victim buffer.
+            // (Mandatory when the drain hasn't reached the level below yet.)
+            line_buf_q  <= req_write_q ? vb_fill_merged : vb_line_q;
+            resp_sent_q <= early_resp;
+            state_q     <= ov_busy ? S_ALLOC_WAIT : S_ALLOC;
+          end else if (!vb_busy && i_down_req_ready) begin
+            state_q <= S_FILL_WAIT;
+          end
+        end
 
         S_FILL_WAIT: begin
           if (i_down_resp_valid) begin
-            line_buf_q <= req_write_q ? fill_merged : i_down_resp_rdata;
-            state_q <= S_ALLOC;
+            line_buf_q  <= req_write_q ? fill_merged : i_down_resp_rdata;
+            resp_sent_q <= early_resp;
+            state_q <= ov_busy ? S_ALLOC_WAIT : S_ALLOC;
           end
         end
 
+        // An overlap hit was mid-service when the fill arrived: the arrays
+        // are still its until it responds, then allocate.
+        S_ALLOC_WAIT: if (!ov_busy) state_q <= S_ALLOC;
+
         S_ALLOC: begin
           resp_data_q <= line_buf_q;
-          state_q     <= S_RESPOND;
+          resp_sent_q <= 1'b0;
+          state_q     <= resp_sent_q ? S_IDLE : S_RESPOND;
         end
 
         S_RESPOND: state_q <= S_IDLE;
@@ -442,14 +937,19 @@ module frost_cache #(
         S_FLUSH_SCAN: state_q <= S_FLUSH_CHECK;
 
         S_FLUSH_CHECK: begin
-          if (tag_rdata_valid && tag_rdata_dirty) begin
+          if (way_valid[flush_way_q] && way_dirty[flush_way_q]) begin
             wait_cnt_q  <= 8'(DATA_READ_LATENCY);
-            flush_tag_q <= tag_rdata_tag;
+            flush_tag_q <= way_tag[flush_way_q];
+            flush_row_q <= tag_rdata;
             state_q     <= S_FLUSH_DATA;
+          end else if (flush_way_q != WayBits'(NUM_WAYS - 1)) begin
+            flush_way_q <= flush_way_q + 1'b1;
+            state_q     <= S_FLUSH_SCAN;
           end else if (flush_idx_q == {IndexBits{1'b1}}) begin
             state_q <= S_IDLE;
           end else begin
             flush_idx_q <= flush_idx_q + 1'b1;
+            flush_way_q <= '0;
             state_q     <= S_FLUSH_SCAN;
           end
         end
@@ -466,10 +966,14 @@ module frost_cache #(
 
         S_FLUSH_WB_WAIT: begin
           if (i_down_resp_valid) begin
-            if (flush_idx_q == {IndexBits{1'b1}}) begin
+            if (flush_way_q != WayBits'(NUM_WAYS - 1)) begin
+              flush_way_q <= flush_way_q + 1'b1;
+              state_q     <= S_FLUSH_SCAN;
+            end else if (flush_idx_q == {IndexBits{1'b1}}) begin
               state_q <= S_IDLE;
             end else begin
               flush_idx_q <= flush_idx_q + 1'b1;
+              flush_way_q <= '0;
               state_q     <= S_FLUSH_SCAN;
             end
           end
@@ -484,11 +988,16 @@ module frost_cache #(
   // Protocol checks (simulation only).
   always_ff @(posedge i_clk) begin
     if (!i_rst) begin
-      if (i_down_resp_valid &&
-          !(state_q == S_WB_WAIT || state_q == S_FILL_WAIT || state_q == S_FLUSH_WB_WAIT))
+      if (i_down_resp_valid && !(state_q == S_WB_WAIT || state_q == S_FILL_WAIT ||
+                                 state_q == S_FLUSH_WB_WAIT || vb_state_q == VB_WAIT))
         $error("frost_cache: downstream response outside a WAIT state (state=%0d)", state_q);
+      if (i_down_resp_valid && vb_state_q == VB_WAIT &&
+          (state_q == S_WB_WAIT || state_q == S_FILL_WAIT || state_q == S_FLUSH_WB_WAIT))
+        $error("frost_cache: victim drain and main FSM both awaiting the downstream port");
       if (i_up_req_valid && o_up_req_ready && i_up_req_write && i_up_req_wstrb == '0)
         $error("frost_cache: write request with empty strobes");
+      if ((state_q == S_RESPOND) && (ov_state_q == OV_RESPOND))
+        $error("frost_cache: main and overlap responses collided");
     end
   end
 `endif
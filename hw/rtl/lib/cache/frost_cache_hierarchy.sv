@@ -20,14 +20,16 @@
  * Instantiates the data-side L1, the instruction-side L1I, the 2:1 line-port
  * arbiter below them, and, when HAS_L2 != 0, L2 (URAM) behind the arbiter;
  * every port speaks the frost_cache line protocol, so the hierarchy is a
- * two-slave line-port module with one downstream master:
+ * three-slave line-port module with one downstream master:
  *
  *   Genesys2 (HAS_L2=0):  up  -> L1(BRAM)  -\
- *                                            arbiter -> down (DDR3)
- *                         iup -> L1I(BRAM) -/
+ *                                            arbiter -\
+ *                         iup -> L1I(BRAM) -/          arbiter -> down (DDR3)
+ *                         dma ------------------------/
  *   X3       (HAS_L2=1):  up  -> L1(BRAM)  -\
- *                                            arbiter -> L2(URAM) -> down (DDR4)
- *                         iup -> L1I(BRAM) -/
+ *                                            arbiter -\
+ *                         iup -> L1I(BRAM) -/          arbiter -> L2 -> down
+ *                         dma ------------------------/         (URAM) (DDR4)
  *
  * The arbiter gives the data side fixed priority (its misses stall committed
  * work; the instruction side fetches ahead through a buffer).  L1I sits above
@@ -35,20 +37,75 @@
  * visible to instruction fetch once it reaches that level -- the property
  * fence.i relies on.  The L1I is a plain frost_cache used read-only: the
  * instruction side never issues writes, so its dirty/evict logic stays idle.
+ * Each level's associativity is a parameter (L1s default to 2-way so code and
+ * data working sets stop conflict-thrashing each other; the big L2 stays
+ * direct-mapped -- its set count already spreads the hot footprints).
  * Both shapes are exercised by the cocotb cache unit tests.
+ *
+ * The DMA port (the copy engine in hw/rtl/peripherals) joins the miss stream
+ * through a second arbiter below the L1 arbiter: CPU misses keep fixed
+ * priority, and DMA lines land at the shared level, never in an L1.  That
+ * places the engine under the same software coherence contract as a second
+ * core -- a D-cache flush publishes the lines it must read and drops stale
+ * copies of the lines it writes (see dma.h in sw/lib).
+ *
+ * Each L1's miss stream runs through a line_port_prefetcher (per-level enable
+ * parameters): sequential/strided misses fetch the predicted next line into a
+ * one-line buffer above the arbiter, turning the common streaming miss into a
+ * 2-cycle fill. Each L1 prefetcher is invalidated together with its L1: the
+ * L1I instance during the fence.i sequence (so the buffer can never serve a
+ * pre-writeback instruction line), the L1D instance during the dflush
+ * sequence (so a line the DMA engine -- or another core's hierarchy -- wrote
+ * below it can never be served stale from the buffer after a flush). The
+ * shared level below the arbiter can take one too
+ * (L2_PREFETCH), but it defaults off: the interleaved D+I miss stream there
+ * rarely holds a stride.
+ *
+ * The line-port modules compose combinationally, so the request fan-down and
+ * response broadcast paths grow with hierarchy depth. Two optional register
+ * slices (ARB_REGISTER_SLICE below the arbiters, DOWN_REGISTER_SLICE on the
+ * downstream port) cut those paths for clock headroom at one cycle of miss
+ * latency per registered direction; both default off.
+ *
+ * Besides the fence.i sync, the hierarchy exposes a software D-cache flush
+ * (i_dflush_sync): L1D writeback-all followed by L1D invalidate-all. Multi-
+ * core tops put a shared level below several of these hierarchies; the flush
+ * is how software publishes and re-reads shared lines there.
  */
 module frost_cache_hierarchy #(
     parameter int unsigned ADDR_WIDTH = 32,
     parameter int unsigned LINE_BYTES = 32,
     parameter int unsigned HAS_L2 = 1,
     parameter int unsigned L1_CACHE_BYTES = 128 * 1024,
+    parameter int unsigned L1_NUM_WAYS = 2,
+    // Data-side L1 hit-under-miss (single-MSHR overlap; see frost_cache).
+    // The read-only L1I and the L2 stay blocking: their masters never keep
+    // two transactions in flight.
+    parameter int unsigned L1_HIT_UNDER_MISS = 1,
+    // Victim buffers (fill-before-writeback on dirty misses; see frost_cache)
+    // on the two write-back levels. Meaningless for the read-only L1I.
+    parameter int unsigned L1_VICTIM_BUFFER = 1,
+    parameter int unsigned L1_PREFETCH = 1,
     parameter int unsigned L1_DATA_READ_LATENCY = 2,
     parameter int unsigned L1_DATA_WRITE_LATENCY = 1,
     parameter int unsigned L1I_CACHE_BYTES = 16 * 1024,
+    parameter int unsigned L1I_NUM_WAYS = 2,
+    parameter int unsigned L1I_PREFETCH = 1,
     parameter int unsigned L1I_DATA_READ_LATENCY = 2,
     parameter int unsigned L2_CACHE_BYTES = 2 * 1024 * 1024,
+    parameter int unsigned L2_NUM_WAYS = 1,
+    parameter int unsigned L2_VICTIM_BUFFER = 1,
+    parameter int unsigned L2_PREFETCH = 0,
     parameter int unsigned L2_DATA_READ_LATENCY = 6,
-    parameter int unsigned L2_DATA_WRITE_LATENCY = 2
+    parameter int unsigned L2_DATA_WRITE_LATENCY = 2,
+    // Optional line-port register slices (wires when 0; see
+    // line_port_register_slice). Each registers both directions of its link,
+    // trading one cycle of miss latency per direction for clock headroom on
+    // the combinational line-port compose. ARB_REGISTER_SLICE cuts below the
+    // two arbiters (above the shared level); DOWN_REGISTER_SLICE cuts the
+    // hierarchy's downstream port (above the AXI bridge).
+    parameter int unsigned ARB_REGISTER_SLICE = 0,
+    parameter int unsigned DOWN_REGISTER_SLICE = 0
 ) (
     input logic i_clk,
     input logic i_rst,
@@ -62,6 +119,9 @@ module frost_cache_hierarchy #(
     input  logic [  LINE_BYTES-1:0] i_up_req_wstrb,
     output logic                    o_up_resp_valid,
     output logic [LINE_BYTES*8-1:0] o_up_resp_rdata,
+    // Response kind sideband: lets the adapter keep a read and a write in
+    // flight at once under L1 hit-under-miss and match completions.
+    output logic                    o_up_resp_write,
 
     // Upstream line port (slave) -- instruction side (read-only use: FROST
     // never issues writes here; wdata/wstrb exist for protocol symmetry).
@@ -74,6 +134,18 @@ module frost_cache_hierarchy #(
     output logic                    o_iup_resp_valid,
     output logic [LINE_BYTES*8-1:0] o_iup_resp_rdata,
 
+    // Upstream line port (slave) -- DMA copy engine. Joins below the L1s and
+    // above the shared level, so transfers are visible to (and see) everything
+    // the dflush publishes there. Tie req_valid low when no engine is wired.
+    input  logic                    i_dma_req_valid,
+    output logic                    o_dma_req_ready,
+    input  logic                    i_dma_req_write,
+    input  logic [  ADDR_WIDTH-1:0] i_dma_req_addr,
+    input  logic [LINE_BYTES*8-1:0] i_dma_req_wdata,
+    input  logic [  LINE_BYTES-1:0] i_dma_req_wstrb,
+    output logic                    o_dma_resp_valid,
+    output logic [LINE_BYTES*8-1:0] o_dma_resp_rdata,
+
     // fence.i cache sync: hold i_fence_sync until o_fence_done rises (done
     // stays high while the request is held). Sequencing matters and is owned
     // here: the data L1 writes back every dirty line FIRST, then the L1I
@@ -84,6 +156,19 @@ module frost_cache_hierarchy #(
     input  logic i_fence_sync,
     output logic o_fence_done,
 
+    // D-cache flush (software cache maintenance): writeback-all then
+    // invalidate-all on the data L1, same hold-until-done handshake as the
+    // fence sync. This is the primitive behind the multi-core software
+    // coherence contract -- after the flush, every line this core produced is
+    // visible at the shared level below the arbiter, and nothing stale
+    // remains in the L1D or its prefetch buffer (the invalidate pulse also
+    // drops the L1D prefetcher's buffered line -- DMA and other cores write
+    // below that buffer). The invalidate walks a fully clean cache (the
+    // writeback ran first), so no data is lost. A fence sync request in the
+    // same window wins arbitration; the flush starts once it finishes.
+    input  logic i_dflush_sync,
+    output logic o_dflush_done,
+
     // Downstream line port (master) -- to the AXI bridge / main memory.
     output logic                    o_down_req_valid,
     input  logic                    i_down_req_ready,
@@ -115,6 +200,25 @@ module frost_cache_hierarchy #(
   logic                    l1i_down_resp_valid;
   logic [LINE_BYTES*8-1:0] l1i_down_resp_rdata;
 
+  // Below each L1's prefetcher, into the arbiter.
+  logic                    l1pf_down_req_valid;
+  logic                    l1pf_down_req_ready;
+  logic                    l1pf_down_req_write;
+  logic [  ADDR_WIDTH-1:0] l1pf_down_req_addr;
+  logic [LINE_BYTES*8-1:0] l1pf_down_req_wdata;
+  logic [  LINE_BYTES-1:0] l1pf_down_req_wstrb;
+  logic                    l1pf_down_resp_valid;
+  logic [LINE_BYTES*8-1:0] l1pf_down_resp_rdata;
+
+  logic                    l1ipf_down_req_valid;
+  logic                    l1ipf_down_req_ready;
+  logic                    l1ipf_down_req_write;
+  logic [  ADDR_WIDTH-1:0] l1ipf_down_req_addr;
+  logic [LINE_BYTES*8-1:0] l1ipf_down_req_wdata;
+  logic [  LINE_BYTES-1:0] l1ipf_down_req_wstrb;
+  logic                    l1ipf_down_resp_valid;
+  logic [LINE_BYTES*8-1:0] l1ipf_down_resp_rdata;
+
   logic                    arb_down_req_valid;
   logic                    arb_down_req_ready;
   logic                    arb_down_req_write;
@@ -124,14 +228,57 @@ module frost_cache_hierarchy #(
   logic                    arb_down_resp_valid;
   logic [LINE_BYTES*8-1:0] arb_down_resp_rdata;
 
-  // fence.i sequencer handshakes (FSM below, after the arbiter).
+  // Below the DMA arbiter, into the shared-level prefetcher.
+  logic                    dmaarb_down_req_valid;
+  logic                    dmaarb_down_req_ready;
+  logic                    dmaarb_down_req_write;
+  logic [  ADDR_WIDTH-1:0] dmaarb_down_req_addr;
+  logic [LINE_BYTES*8-1:0] dmaarb_down_req_wdata;
+  logic [  LINE_BYTES-1:0] dmaarb_down_req_wstrb;
+  logic                    dmaarb_down_resp_valid;
+  logic [LINE_BYTES*8-1:0] dmaarb_down_resp_rdata;
+
+  // Below the arbiter register slice, into the shared-level prefetcher.
+  logic                    arbsl_down_req_valid;
+  logic                    arbsl_down_req_ready;
+  logic                    arbsl_down_req_write;
+  logic [  ADDR_WIDTH-1:0] arbsl_down_req_addr;
+  logic [LINE_BYTES*8-1:0] arbsl_down_req_wdata;
+  logic [  LINE_BYTES-1:0] arbsl_down_req_wstrb;
+  logic                    arbsl_down_resp_valid;
+  logic [LINE_BYTES*8-1:0] arbsl_down_resp_rdata;
+
+  // Below the shared-level prefetcher, into the L2 (or straight downstream).
+  logic                    l2pf_down_req_valid;
+  logic                    l2pf_down_req_ready;
+  logic                    l2pf_down_req_write;
+  logic [  ADDR_WIDTH-1:0] l2pf_down_req_addr;
+  logic [LINE_BYTES*8-1:0] l2pf_down_req_wdata;
+  logic [  LINE_BYTES-1:0] l2pf_down_req_wstrb;
+  logic                    l2pf_down_resp_valid;
+  logic [LINE_BYTES*8-1:0] l2pf_down_resp_rdata;
+
+  // Below the L2 (or the no-L2 wires), into the downstream register slice.
+  logic                    predown_req_valid;
+  logic                    predown_req_ready;
+  logic                    predown_req_write;
+  logic [  ADDR_WIDTH-1:0] predown_req_addr;
+  logic [LINE_BYTES*8-1:0] predown_req_wdata;
+  logic [  LINE_BYTES-1:0] predown_req_wstrb;
+  logic                    predown_resp_valid;
+  logic [LINE_BYTES*8-1:0] predown_resp_rdata;
+
+  // fence.i / dflush sequencer handshakes (FSM below, after the arbiter).
   logic l1d_maint_busy, l1i_maint_busy;
-  logic l1d_writeback_req, l1i_invalidate_req;
+  logic l1d_writeback_req, l1i_invalidate_req, l1d_invalidate_req;
 
   frost_cache #(
       .ADDR_WIDTH(ADDR_WIDTH),
       .CACHE_SIZE_BYTES(L1_CACHE_BYTES),
       .LINE_BYTES(LINE_BYTES),
+      .NUM_WAYS(L1_NUM_WAYS),
+      .ENABLE_HIT_UNDER_MISS(L1_HIT_UNDER_MISS),
+      .ENABLE_VICTIM_BUFFER(L1_VICTIM_BUFFER),
       .DATA_MEMORY_PRIMITIVE("block"),
       .DATA_READ_LATENCY(L1_DATA_READ_LATENCY),
       .DATA_WRITE_LATENCY(L1_DATA_WRITE_LATENCY)
@@ -139,7 +286,7 @@ module frost_cache_hierarchy #(
       .i_clk(i_clk),
       .i_rst(i_rst),
       .i_writeback_all(l1d_writeback_req),
-      .i_invalidate_all(1'b0),
+      .i_invalidate_all(l1d_invalidate_req),
       .o_maint_busy(l1d_maint_busy),
       .i_up_req_valid(i_up_req_valid),
       .o_up_req_ready(o_up_req_ready),
@@ -149,6 +296,7 @@ module frost_cache_hierarchy #(
       .i_up_req_wstrb(i_up_req_wstrb),
       .o_up_resp_valid(o_up_resp_valid),
       .o_up_resp_rdata(o_up_resp_rdata),
+      .o_up_resp_write(o_up_resp_write),
       .o_down_req_valid(l1_down_req_valid),
       .i_down_req_ready(l1_down_req_ready),
       .o_down_req_write(l1_down_req_write),
@@ -163,6 +311,7 @@ module frost_cache_hierarchy #(
       .ADDR_WIDTH(ADDR_WIDTH),
       .CACHE_SIZE_BYTES(L1I_CACHE_BYTES),
       .LINE_BYTES(LINE_BYTES),
+      .NUM_WAYS(L1I_NUM_WAYS),
       .DATA_MEMORY_PRIMITIVE("block"),
       .DATA_READ_LATENCY(L1I_DATA_READ_LATENCY)
   ) l1i_cache (
@@ -179,6 +328,7 @@ module frost_cache_hierarchy #(
       .i_up_req_wstrb(i_iup_req_wstrb),
       .o_up_resp_valid(o_iup_resp_valid),
       .o_up_resp_rdata(o_iup_resp_rdata),
+      .o_up_resp_write(),
       .o_down_req_valid(l1i_down_req_valid),
       .i_down_req_ready(l1i_down_req_ready),
       .o_down_req_write(l1i_down_req_write),
@@ -189,6 +339,65 @@ module frost_cache_hierarchy #(
       .i_down_resp_rdata(l1i_down_resp_rdata)
   );
 
+  // Per-L1 prefetchers on the miss streams (wires when disabled). Each one
+  // shares its owning L1's invalidate pulse: the L1I instance the fence.i
+  // invalidate, the data-side instance the dflush invalidate. The prefetcher's
+  // internal writeback-invalidate rule only covers this L1's own writes; the
+  // DMA engine (and, in multi-core tops, the other cores) write below this
+  // point, so the dflush must drop a speculatively buffered line along with
+  // the L1D's copies or the post-flush refill would return pre-flush data.
+  line_port_prefetcher #(
+      .ADDR_WIDTH(ADDR_WIDTH),
+      .LINE_BYTES(LINE_BYTES),
+      .ENABLE(L1_PREFETCH)
+  ) l1_prefetcher (
+      .i_clk(i_clk),
+      .i_rst(i_rst),
+      .i_invalidate(l1d_invalidate_req),
+      .i_up_req_valid(l1_down_req_valid),
+      .o_up_req_ready(l1_down_req_ready),
+      .i_up_req_write(l1_down_req_write),
+      .i_up_req_addr(l1_down_req_addr),
+      .i_up_req_wdata(l1_down_req_wdata),
+      .i_up_req_wstrb(l1_down_req_wstrb),
+      .o_up_resp_valid(l1_down_resp_valid),
+      .o_up_resp_rdata(l1_down_resp_rdata),
+      .o_down_req_valid(l1pf_down_req_valid),
+      .i_down_req_ready(l1pf_down_req_ready),
+      .o_down_req_write(l1pf_down_req_write),
+      .o_down_req_addr(l1pf_down_req_addr),
+      .o_down_req_wdata(l1pf_down_req_wdata),
+      .o_down_req_wstrb(l1pf_down_req_wstrb),
+      .i_down_resp_valid(l1pf_down_resp_valid),
+      .i_down_resp_rdata(l1pf_down_resp_rdata)
+  );
+
+  line_port_prefetcher #(
+      .ADDR_WIDTH(ADDR_WIDTH),
+      .LINE_BYTES(LINE_BYTES),
+      .ENABLE(L1I_PREFETCH)
+  ) l1i_prefetcher (
+      .i_clk(i_clk),
+      .i_rst(i_rst),
+      .i_invalidate(l1i_invalidate_req),
+      .i_up_req_valid(l1i_down_req_valid),
+      .o_up_req_ready(l1i_down_req_ready),
+      .i_up_req_write(l1i_down_req_write),
+      .i_up_req_addr(l1i_down_req_addr),
+      .i_up_req_wdata(l1i_down_req_wdata),
+      .i_up_req_wstrb(l1i_down_req_wstrb),
+      .o_up_resp_valid(l1i_down_resp_valid),
+      .o_up_resp_rdata(l1i_down_resp_rdata),
+      .o_down_req_valid(l1ipf_down_req_valid),
+      .i_down_req_ready(l1ipf_down_req_ready),
+      .o_down_req_write(l1ipf_down_req_write),
+      .o_down_req_addr(l1ipf_down_req_addr),
+      .o_down_req_wdata(l1ipf_down_req_wdata),
+      .o_down_req_wstrb(l1ipf_down_req_wstrb),
+      .i_down_resp_valid(l1ipf_down_resp_valid),
+      .i_down_resp_rdata(l1ipf_down_resp_rdata)
+  );
+
   // 2:1 arbiter below the two L1s: data side on port 0 (fixed priority).
   line_port_arbiter #(
       .ADDR_WIDTH(ADDR_WIDTH),
@@ -196,22 +405,22 @@ module frost_cache_hierarchy #(
   ) l1_arbiter (
       .i_clk(i_clk),
       .i_rst(i_rst),
-      .i_up0_req_valid(l1_down_req_valid),
-      .o_up0_req_ready(l1_down_req_ready),
-      .i_up0_req_write(l1_down_req_write),
-      .i_up0_req_addr(l1_down_req_addr),
-      .i_up0_req_wdata(l1_down_req_wdata),
-      .i_up0_req_wstrb(l1_down_req_wstrb),
-      .o_up0_resp_valid(l1_down_resp_valid),
-      .o_up0_resp_rdata(l1_down_resp_rdata),
-      .i_up1_req_valid(l1i_down_req_valid),
-      .o_up1_req_ready(l1i_down_req_ready),
-      .i_up1_req_write(l1i_down_req_write),
-      .i_up1_req_addr(l1i_down_req_addr),
-      .i_up1_req_wdata(l1i_down_req_wdata),
-      .i_up1_req_wstrb(l1i_down_req_wstrb),
-      .o_up1_resp_valid(l1i_down_resp_valid),
-      .o_up1_resp_rdata(l1i_down_resp_rdata),
+      .i_up0_req_valid(l1pf_down_req_valid),
+      .o_up0_req_ready(l1pf_down_req_ready),
+      .i_up0_req_write(l1pf_down_req_write),
+      .i_up0_req_addr(l1pf_down_req_addr),
+      .i_up0_req_wdata(l1pf_down_req_wdata),
+      .i_up0_req_wstrb(l1pf_down_req_wstrb),
+      .o_up0_resp_valid(l1pf_down_resp_valid),
+      .o_up0_resp_rdata(l1pf_down_resp_rdata),
+      .i_up1_req_valid(l1ipf_down_req_valid),
+      .o_up1_req_ready(l1ipf_down_req_ready),
+      .i_up1_req_write(l1ipf_down_req_write),
+      .i_up1_req_addr(l1ipf_down_req_addr),
+      .i_up1_req_wdata(l1ipf_down_req_wdata),
+      .i_up1_req_wstrb(l1ipf_down_req_wstrb),
+      .o_up1_resp_valid(l1ipf_down_resp_valid),
+      .o_up1_resp_rdata(l1ipf_down_resp_rdata),
       .o_down_req_valid(arb_down_req_valid),
       .i_down_req_ready(arb_down_req_ready),
       .o_down_req_write(arb_down_req_write),
@@ -222,48 +431,164 @@ module frost_cache_hierarchy #(
       .i_down_resp_rdata(arb_down_resp_rdata)
   );
 
+  // 2:1 arbiter below the L1 arbiter: the CPU miss stream keeps fixed
+  // priority on port 0 (its misses stall committed work; a DMA line can
+  // absorb the wait), the copy engine feeds port 1.
+  line_port_arbiter #(
+      .ADDR_WIDTH(ADDR_WIDTH),
+      .LINE_BYTES(LINE_BYTES)
+  ) dma_arbiter (
+      .i_clk(i_clk),
+      .i_rst(i_rst),
+      .i_up0_req_valid(arb_down_req_valid),
+      .o_up0_req_ready(arb_down_req_ready),
+      .i_up0_req_write(arb_down_req_write),
+      .i_up0_req_addr(arb_down_req_addr),
+      .i_up0_req_wdata(arb_down_req_wdata),
+      .i_up0_req_wstrb(arb_down_req_wstrb),
+      .o_up0_resp_valid(arb_down_resp_valid),
+      .o_up0_resp_rdata(arb_down_resp_rdata),
+      .i_up1_req_valid(i_dma_req_valid),
+      .o_up1_req_ready(o_dma_req_ready),
+      .i_up1_req_write(i_dma_req_write),
+      .i_up1_req_addr(i_dma_req_addr),
+      .i_up1_req_wdata(i_dma_req_wdata),
+      .i_up1_req_wstrb(i_dma_req_wstrb),
+      .o_up1_resp_valid(o_dma_resp_valid),
+      .o_up1_resp_rdata(o_dma_resp_rdata),
+      .o_down_req_valid(dmaarb_down_req_valid),
+      .i_down_req_ready(dmaarb_down_req_ready),
+      .o_down_req_write(dmaarb_down_req_write),
+      .o_down_req_addr(dmaarb_down_req_addr),
+      .o_down_req_wdata(dmaarb_down_req_wdata),
+      .o_down_req_wstrb(dmaarb_down_req_wstrb),
+      .i_down_resp_valid(dmaarb_down_resp_valid),
+      .i_down_resp_rdata(dmaarb_down_resp_rdata)
+  );
+
   // ---------------------------------------------------------------------------
-  // fence.i sync sequencer: L1D writeback-all, then L1I invalidate-all.
+  // Maintenance sequencer. Two requesters share the L1D writeback walk:
+  //   fence.i sync: L1D writeback-all, then L1I invalidate-all.
+  //   dflush:       L1D writeback-all, then L1D invalidate-all.
+  // One FSM serializes them (a fence sync in the same idle cycle starts
+  // first); the registered kind flag steers the post-writeback step.
   // ---------------------------------------------------------------------------
-  typedef enum logic [2:0] {
-    FENCE_IDLE,      // waiting for a sync request
-    FENCE_L1D_REQ,   // request the L1D writeback-all (until its busy rises)
-    FENCE_L1D_WAIT,  // wait out the writeback walk
-    FENCE_L1I_REQ,   // request the L1I invalidate-all (until its busy rises)
-    FENCE_L1I_WAIT,  // wait out the invalidate sweep
-    FENCE_DONE       // hold done until the requester drops the request
+  typedef enum logic [3:0] {
+    FENCE_IDLE,       // waiting for a sync request
+    FENCE_L1D_REQ,    // request the L1D writeback-all (until its busy rises)
+    FENCE_L1D_WAIT,   // wait out the writeback walk
+    FENCE_L1I_REQ,    // request the L1I invalidate-all (until its busy rises)
+    FENCE_L1I_WAIT,   // wait out the invalidate sweep
+    FENCE_DONE,       // hold done until the requester drops the request
+    DFLUSH_INV_REQ,   // request the L1D invalidate-all (cache is clean now)
+    DFLUSH_INV_WAIT,  // wait out the L1D invalidate sweep
+    DFLUSH_DONE       // hold done until the requester drops the request
   } fence_state_e;
 
   fence_state_e fence_state_q;
+  logic dflush_active_q;  // current walk belongs to the dflush requester
 
   assign l1d_writeback_req = (fence_state_q == FENCE_L1D_REQ);
   assign l1i_invalidate_req = (fence_state_q == FENCE_L1I_REQ);
+  assign l1d_invalidate_req = (fence_state_q == DFLUSH_INV_REQ);
   assign o_fence_done = (fence_state_q == FENCE_DONE);
+  assign o_dflush_done = (fence_state_q == DFLUSH_DONE);
 
   always_ff @(posedge i_clk) begin
     if (i_rst) begin
-      fence_state_q <= FENCE_IDLE;
+      fence_state_q   <= FENCE_IDLE;
+      dflush_active_q <= 1'b0;
     end else begin
       unique case (fence_state_q)
-        FENCE_IDLE:     if (i_fence_sync) fence_state_q <= FENCE_L1D_REQ;
+        FENCE_IDLE: begin
+          if (i_fence_sync) begin
+            fence_state_q   <= FENCE_L1D_REQ;
+            dflush_active_q <= 1'b0;
+          end else if (i_dflush_sync) begin
+            fence_state_q   <= FENCE_L1D_REQ;
+            dflush_active_q <= 1'b1;
+          end
+        end
         FENCE_L1D_REQ:  if (l1d_maint_busy) fence_state_q <= FENCE_L1D_WAIT;
-        FENCE_L1D_WAIT: if (!l1d_maint_busy) fence_state_q <= FENCE_L1I_REQ;
+        FENCE_L1D_WAIT:
+          if (!l1d_maint_busy)
+            fence_state_q <= dflush_active_q ? DFLUSH_INV_REQ : FENCE_L1I_REQ;
         FENCE_L1I_REQ:  if (l1i_maint_busy) fence_state_q <= FENCE_L1I_WAIT;
         FENCE_L1I_WAIT: if (!l1i_maint_busy) fence_state_q <= FENCE_DONE;
         // Once started the sequence always completes (the sweeps are not
         // abortable); a requester that vanished mid-way (pipeline flush)
         // just finds done already low again on its next request.
-        FENCE_DONE:     if (!i_fence_sync) fence_state_q <= FENCE_IDLE;
-        default:        fence_state_q <= FENCE_IDLE;
+        FENCE_DONE:      if (!i_fence_sync) fence_state_q <= FENCE_IDLE;
+        DFLUSH_INV_REQ:  if (l1d_maint_busy) fence_state_q <= DFLUSH_INV_WAIT;
+        DFLUSH_INV_WAIT: if (!l1d_maint_busy) fence_state_q <= DFLUSH_DONE;
+        DFLUSH_DONE:     if (!i_dflush_sync) fence_state_q <= FENCE_IDLE;
+        default:         fence_state_q <= FENCE_IDLE;
       endcase
     end
   end
 
+  // Optional register slice below the two arbiters: cuts the request
+  // fan-down and the response broadcast where every upstream path has
+  // already merged (wires when disabled).
+  line_port_register_slice #(
+      .ADDR_WIDTH(ADDR_WIDTH),
+      .LINE_BYTES(LINE_BYTES),
+      .ENABLE(ARB_REGISTER_SLICE)
+  ) arb_slice (
+      .i_clk(i_clk),
+      .i_rst(i_rst),
+      .i_up_req_valid(dmaarb_down_req_valid),
+      .o_up_req_ready(dmaarb_down_req_ready),
+      .i_up_req_write(dmaarb_down_req_write),
+      .i_up_req_addr(dmaarb_down_req_addr),
+      .i_up_req_wdata(dmaarb_down_req_wdata),
+      .i_up_req_wstrb(dmaarb_down_req_wstrb),
+      .o_up_resp_valid(dmaarb_down_resp_valid),
+      .o_up_resp_rdata(dmaarb_down_resp_rdata),
+      .o_down_req_valid(arbsl_down_req_valid),
+      .i_down_req_ready(arbsl_down_req_ready),
+      .o_down_req_write(arbsl_down_req_write),
+      .o_down_req_addr(arbsl_down_req_addr),
+      .o_down_req_wdata(arbsl_down_req_wdata),
+      .o_down_req_wstrb(arbsl_down_req_wstrb),
+      .i_down_resp_valid(arbsl_down_resp_valid),
+      .i_down_resp_rdata(arbsl_down_resp_rdata)
+  );
+
+  // Optional prefetcher on the shared miss stream below the arbiter.
+  line_port_prefetcher #(
+      .ADDR_WIDTH(ADDR_WIDTH),
+      .LINE_BYTES(LINE_BYTES),
+      .ENABLE(L2_PREFETCH)
+  ) l2_prefetcher (
+      .i_clk(i_clk),
+      .i_rst(i_rst),
+      .i_invalidate(1'b0),
+      .i_up_req_valid(arbsl_down_req_valid),
+      .o_up_req_ready(arbsl_down_req_ready),
+      .i_up_req_write(arbsl_down_req_write),
+      .i_up_req_addr(arbsl_down_req_addr),
+      .i_up_req_wdata(arbsl_down_req_wdata),
+      .i_up_req_wstrb(arbsl_down_req_wstrb),
+      .o_up_resp_valid(arbsl_down_resp_valid),
+      .o_up_resp_rdata(arbsl_down_resp_rdata),
+      .o_down_req_valid(l2pf_down_req_valid),
+      .i_down_req_ready(l2pf_down_req_ready),
+      .o_down_req_write(l2pf_down_req_write),
+      .o_down_req_addr(l2pf_down_req_addr),
+      .o_down_req_wdata(l2pf_down_req_wdata),
+      .o_down_req_wstrb(l2pf_down_req_wstrb),
+      .i_down_resp_valid(l2pf_down_resp_valid),
+      .i_down_resp_rdata(l2pf_down_resp_rdata)
+  );
+
   if (HAS_L2 != 0) begin : gen_l2
     frost_cache #(
         .ADDR_WIDTH(ADDR_WIDTH),
         .CACHE_SIZE_BYTES(L2_CACHE_BYTES),
         .LINE_BYTES(LINE_BYTES),
+        .NUM_WAYS(L2_NUM_WAYS),
+        .ENABLE_VICTIM_BUFFER(L2_VICTIM_BUFFER),
         .DATA_MEMORY_PRIMITIVE("ultra"),
         .DATA_READ_LATENCY(L2_DATA_READ_LATENCY),
         .DATA_WRITE_LATENCY(L2_DATA_WRITE_LATENCY)
@@ -273,32 +598,60 @@ module frost_cache_hierarchy #(
         .i_writeback_all(1'b0),
         .i_invalidate_all(1'b0),
         .o_maint_busy(),
-        .i_up_req_valid(arb_down_req_valid),
-        .o_up_req_ready(arb_down_req_ready),
-        .i_up_req_write(arb_down_req_write),
-        .i_up_req_addr(arb_down_req_addr),
-        .i_up_req_wdata(arb_down_req_wdata),
-        .i_up_req_wstrb(arb_down_req_wstrb),
-        .o_up_resp_valid(arb_down_resp_valid),
-        .o_up_resp_rdata(arb_down_resp_rdata),
-        .o_down_req_valid(o_down_req_valid),
-        .i_down_req_ready(i_down_req_ready),
-        .o_down_req_write(o_down_req_write),
-        .o_down_req_addr(o_down_req_addr),
-        .o_down_req_wdata(o_down_req_wdata),
-        .o_down_req_wstrb(o_down_req_wstrb),
-        .i_down_resp_valid(i_down_resp_valid),
-        .i_down_resp_rdata(i_down_resp_rdata)
+        .i_up_req_valid(l2pf_down_req_valid),
+        .o_up_req_ready(l2pf_down_req_ready),
+        .i_up_req_write(l2pf_down_req_write),
+        .i_up_req_addr(l2pf_down_req_addr),
+        .i_up_req_wdata(l2pf_down_req_wdata),
+        .i_up_req_wstrb(l2pf_down_req_wstrb),
+        .o_up_resp_valid(l2pf_down_resp_valid),
+        .o_up_resp_rdata(l2pf_down_resp_rdata),
+        .o_up_resp_write(),
+        .o_down_req_valid(predown_req_valid),
+        .i_down_req_ready(predown_req_ready),
+        .o_down_req_write(predown_req_write),
+        .o_down_req_addr(predown_req_addr),
+        .o_down_req_wdata(predown_req_wdata),
+        .o_down_req_wstrb(predown_req_wstrb),
+        .i_down_resp_valid(predown_resp_valid),
+        .i_down_resp_rdata(predown_resp_rdata)
     );
   end else begin : gen_no_l2
-    assign o_down_req_valid    = arb_down_req_valid;
-    assign arb_down_req_ready  = i_down_req_ready;
-    assign o_down_req_write    = arb_down_req_write;
-    assign o_down_req_addr     = arb_down_req_addr;
-    assign o_down_req_wdata    = arb_down_req_wdata;
-    assign o_down_req_wstrb    = arb_down_req_wstrb;
-    assign arb_down_resp_valid = i_down_resp_valid;
-    assign arb_down_resp_rdata = i_down_resp_rdata;
+    assign predown_req_valid    = l2pf_down_req_valid;
+    assign l2pf_down_req_ready  = predown_req_ready;
+    assign predown_req_write    = l2pf_down_req_write;
+    assign predown_req_addr     = l2pf_down_req_addr;
+    assign predown_req_wdata    = l2pf_down_req_wdata;
+    assign predown_req_wstrb    = l2pf_down_req_wstrb;
+    assign l2pf_down_resp_valid = predown_resp_valid;
+    assign l2pf_down_resp_rdata = predown_resp_rdata;
   end
 
+  // Optional register slice on the downstream port, above the AXI bridge
+  // (wires when disabled).
+  line_port_register_slice #(
+      .ADDR_WIDTH(ADDR_WIDTH),
+      .LINE_BYTES(LINE_BYTES),
+      .ENABLE(DOWN_REGISTER_SLICE)
+  ) down_slice (
+      .i_clk(i_clk),
+      .i_rst(i_rst),
+      .i_up_req_valid(predown_req_valid),
+      .o_up_req_ready(predown_req_ready),
+      .i_up_req_write(predown_req_write),
+      .i_up_req_addr(predown_req_addr),
+      .i_up_req_wdata(predown_req_wdata),
+      .i_up_req_wstrb(predown_req_wstrb),
+      .o_up_resp_valid(predown_resp_valid),
+      .o_up_resp_rdata(predown_resp_rdata),
+      .o_down_req_valid(o_down_req_valid),
+      .i_down_req_ready(i_down_req_ready),
+      .o_down_req_write(o_down_req_write),
+      .o_down_req_addr(o_down_req_addr),
+      .o_down_req_wdata(o_down_req_wdata),
+      .o_down_req_wstrb(o_down_req_wstrb),
+      .i_down_resp_valid(i_down_resp_valid),
+      .i_down_resp_rdata(i_down_resp_rdata)
+  );
+
 endmodule : frost_cache_hierarchy
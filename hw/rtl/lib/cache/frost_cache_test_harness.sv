@@ -17,8 +17,9 @@
 /*
  * frost_cache_test_harness -- cocotb unit-bench top for the cache hierarchy.
  *
- * Exposes both upstream line ports (data side + instruction side) and wires
- * the SAME backside topology the CPU integration uses:
+ * Exposes all three upstream line ports (data side, instruction side, and the
+ * DMA port that joins below the L1s) and wires the SAME backside topology the
+ * CPU integration uses:
  * frost_cache_hierarchy -> line_port_axi_bridge -> axi_behavioral_memory.
  * The bench drives raw line transactions and checks them against a reference
  * model; -G parameters select the board shape (HAS_L2) and shrink the caches
@@ -29,11 +30,21 @@ module frost_cache_test_harness #(
     parameter int unsigned LINE_BYTES = 32,
     parameter int unsigned HAS_L2 = 1,
     parameter int unsigned L1_CACHE_BYTES = 1024,
+    parameter int unsigned L1_NUM_WAYS = 2,
     parameter int unsigned L1I_CACHE_BYTES = 1024,
+    parameter int unsigned L1I_NUM_WAYS = 2,
     parameter int unsigned L2_CACHE_BYTES = 4096,
+    parameter int unsigned L2_NUM_WAYS = 1,
+    parameter int unsigned L1_VICTIM_BUFFER = 1,
+    parameter int unsigned L2_VICTIM_BUFFER = 1,
+    parameter int unsigned L1_PREFETCH = 1,
+    parameter int unsigned L1I_PREFETCH = 1,
+    parameter int unsigned L2_PREFETCH = 0,
     parameter int unsigned L1_DATA_READ_LATENCY = 2,
     parameter int unsigned L2_DATA_READ_LATENCY = 6,
     parameter int unsigned L2_DATA_WRITE_LATENCY = 2,
+    parameter int unsigned ARB_REGISTER_SLICE = 0,
+    parameter int unsigned DOWN_REGISTER_SLICE = 0,
     parameter logic [31:0] BASE_ADDR = 32'h8000_0000,
     parameter int unsigned MEM_BYTES = 4 * 1024 * 1024,
     parameter int unsigned MEM_LATENCY = 12
@@ -48,6 +59,7 @@ module frost_cache_test_harness #(
     input  logic [  LINE_BYTES-1:0] i_up_req_wstrb,
     output logic                    o_up_resp_valid,
     output logic [LINE_BYTES*8-1:0] o_up_resp_rdata,
+    output logic                    o_up_resp_write,
     input  logic                    i_iup_req_valid,
     output logic                    o_iup_req_ready,
     input  logic                    i_iup_req_write,
@@ -56,8 +68,18 @@ module frost_cache_test_harness #(
     input  logic [  LINE_BYTES-1:0] i_iup_req_wstrb,
     output logic                    o_iup_resp_valid,
     output logic [LINE_BYTES*8-1:0] o_iup_resp_rdata,
+    input  logic                    i_dma_req_valid,
+    output logic                    o_dma_req_ready,
+    input  logic                    i_dma_req_write,
+    input  logic [  ADDR_WIDTH-1:0] i_dma_req_addr,
+    input  logic [LINE_BYTES*8-1:0] i_dma_req_wdata,
+    input  logic [  LINE_BYTES-1:0] i_dma_req_wstrb,
+    output logic                    o_dma_resp_valid,
+    output logic [LINE_BYTES*8-1:0] o_dma_resp_rdata,
     input  logic                    i_fence_sync,
-    output logic                    o_fence_done
+    output logic                    o_fence_done,
+    input  logic                    i_dflush_sync,
+    output logic                    o_dflush_done
 );
 
   logic stack_down_req_valid, stack_down_req_ready, stack_down_req_write;
@@ -72,11 +94,21 @@ module frost_cache_test_harness #(
       .LINE_BYTES(LINE_BYTES),
       .HAS_L2(HAS_L2),
       .L1_CACHE_BYTES(L1_CACHE_BYTES),
+      .L1_NUM_WAYS(L1_NUM_WAYS),
       .L1_DATA_READ_LATENCY(L1_DATA_READ_LATENCY),
       .L1I_CACHE_BYTES(L1I_CACHE_BYTES),
+      .L1I_NUM_WAYS(L1I_NUM_WAYS),
       .L2_CACHE_BYTES(L2_CACHE_BYTES),
+      .L2_NUM_WAYS(L2_NUM_WAYS),
+      .L1_VICTIM_BUFFER(L1_VICTIM_BUFFER),
+      .L2_VICTIM_BUFFER(L2_VICTIM_BUFFER),
+      .L1_PREFETCH(L1_PREFETCH),
+      .L1I_PREFETCH(L1I_PREFETCH),
+      .L2_PREFETCH(L2_PREFETCH),
       .L2_DATA_READ_LATENCY(L2_DATA_READ_LATENCY),
-      .L2_DATA_WRITE_LATENCY(L2_DATA_WRITE_LATENCY)
+      .L2_DATA_WRITE_LATENCY(L2_DATA_WRITE_LATENCY),
+      .ARB_REGISTER_SLICE(ARB_REGISTER_SLICE),
+      .DOWN_REGISTER_SLICE(DOWN_REGISTER_SLICE)
   ) cache_hierarchy (
       .i_clk(i_clk),
       .i_rst(i_rst),
@@ -88,6 +120,7 @@ module frost_cache_test_harness #(
       .i_up_req_wstrb(i_up_req_wstrb),
       .o_up_resp_valid(o_up_resp_valid),
       .o_up_resp_rdata(o_up_resp_rdata),
+      .o_up_resp_write(o_up_resp_write),
       .i_iup_req_valid(i_iup_req_valid),
       .o_iup_req_ready(o_iup_req_ready),
       .i_iup_req_write(i_iup_req_write),
@@ -96,8 +129,21 @@ module frost_cache_test_harness #(
       .i_iup_req_wstrb(i_iup_req_wstrb),
       .o_iup_resp_valid(o_iup_resp_valid),
       .o_iup_resp_rdata(o_iup_resp_rdata),
+      // Raw DMA-port transactions (the engine itself has its own harness,
+      // dma_engine_test_harness; this bench covers the port's composition
+      // with the prefetchers and maintenance walks).
+      .i_dma_req_valid(i_dma_req_valid),
+      .o_dma_req_ready(o_dma_req_ready),
+      .i_dma_req_write(i_dma_req_write),
+      .i_dma_req_addr(i_dma_req_addr),
+      .i_dma_req_wdata(i_dma_req_wdata),
+      .i_dma_req_wstrb(i_dma_req_wstrb),
+      .o_dma_resp_valid(o_dma_resp_valid),
+      .o_dma_resp_rdata(o_dma_resp_rdata),
       .i_fence_sync(i_fence_sync),
       .o_fence_done(o_fence_done),
+      .i_dflush_sync(i_dflush_sync),
+      .o_dflush_done(o_dflush_done),
       .o_down_req_valid(stack_down_req_valid),
       .i_down_req_ready(stack_down_req_ready),
       .o_down_req_write(stack_down_req_write),
@@ -17,11 +17,23 @@
 /*
  * line_port_axi_bridge -- line-port slave to AXI4 master.
  *
- * The bottom of the cache hierarchy: converts single-outstanding line
- * transactions into single-beat AXI4 bursts (AxLEN=0, AxSIZE=log2(LINE_BYTES),
- * 256-bit data). Writes drive AW and W concurrently and complete on B; reads
+ * The bottom of the cache hierarchy: converts line transactions into
+ * single-beat AXI4 bursts (AxLEN=0, AxSIZE=log2(LINE_BYTES), 256-bit data --
+ * a full line per beat, so multi-beat bursts buy nothing here). Reads
  * complete on R. IDs are constant 0; responses are assumed OKAY (checked in
- * simulation). One transaction in flight, matching the line protocol.
+ * simulation).
+ *
+ * WRITES ARE POSTED: the line-port response pulses as soon as the write is
+ * accepted, and the AXI write response (B) drains in the background -- up to
+ * POSTED_WRITES may be outstanding. The upper port is single-outstanding, so
+ * without posting, an eviction's writeback round trip would serialize in
+ * front of the fill read that caused it; posting hides the controller's
+ * write latency behind the fill. Correctness: pending write addresses sit in
+ * a small FIFO/CAM, and a read whose line matches a still-pending write is
+ * held at the request handshake until its B returns (AXI orders a same-ID
+ * write stream, but not a read against a write). The AW/W handshakes of one
+ * write still complete before the next transaction launches, so the data
+ * channel needs no queue.
  *
  * BASE_ADDR is subtracted from the line address so the AXI side sees a
  * zero-based region offset: in simulation the behavioral DDR indexes from 0,
@@ -32,7 +44,9 @@
 module line_port_axi_bridge #(
     parameter int unsigned ADDR_WIDTH = 32,
     parameter int unsigned LINE_BYTES = 32,
-    parameter logic [31:0] BASE_ADDR = 32'h8000_0000
+    parameter logic [31:0] BASE_ADDR = 32'h8000_0000,
+    // Max AXI write responses outstanding past the line-port completion.
+    parameter int unsigned POSTED_WRITES = 4
 ) (
     input logic i_clk,
     input logic i_rst,
@@ -75,13 +89,20 @@ module line_port_axi_bridge #(
     input  logic                    i_axi_rlast
 );
 
-  typedef enum logic [2:0] {
-    B_IDLE,
-    B_WRITE,   // AW/W handshakes in progress
-    B_BRESP,   // waiting for the write response
-    B_READ,    // AR handshake in progress
-    B_RRESP,   // waiting for read data
-    B_RESPOND  // pulse the line-port response
+  localparam int unsigned PwPtrBits = $clog2(POSTED_WRITES);
+  localparam int unsigned PwCntBits = $clog2(POSTED_WRITES + 1);
+
+  initial begin
+    // Pointer arithmetic wraps at the FIFO depth.
+    if (2 ** PwPtrBits != POSTED_WRITES)
+      $fatal(1, "line_port_axi_bridge: POSTED_WRITES must be a power of 2");
+  end
+
+  typedef enum logic [1:0] {
+    B_IDLE,   // accept the next line transaction
+    B_WRITE,  // AW/W handshakes in progress (line-port response already sent)
+    B_READ,   // AR handshake in progress
+    B_RRESP   // waiting for read data
   } state_e;
 
   state_e state_q;
@@ -91,8 +112,38 @@ module line_port_axi_bridge #(
   logic [LINE_BYTES-1:0] wstrb_q;
   logic aw_done_q, w_done_q;
   logic [LINE_BYTES*8-1:0] rdata_q;
+  logic resp_pulse_q;
+
+  // ---- Posted-write tracker: in-order address FIFO doubling as the CAM -------
+  // B responses for a single AXI ID return in AW order, so retirement is a
+  // simple pop; the valid entries are the read-hazard CAM.
+  logic [31:0] pw_addr_q[POSTED_WRITES];
+  logic [POSTED_WRITES-1:0] pw_valid_q;
+  logic [PwPtrBits-1:0] pw_wr_ptr_q, pw_rd_ptr_q;
+  logic [PwCntBits-1:0] pw_count_q;
 
-  assign o_req_ready   = (state_q == B_IDLE);
+  logic pw_full;
+  assign pw_full = (pw_count_q == PwCntBits'(POSTED_WRITES));
+
+  // Read-vs-posted-write hazard on the incoming request (AXI-side address).
+  logic [31:0] req_axi_addr;
+  assign req_axi_addr = i_req_addr - BASE_ADDR;
+
+  logic pw_read_hazard;
+  always_comb begin
+    pw_read_hazard = 1'b0;
+    for (int e = 0; e < int'(POSTED_WRITES); e++) begin
+      if (pw_valid_q[e] && pw_addr_q[e] == req_axi_addr) pw_read_hazard = 1'b1;
+    end
+  end
+
+  // A write needs a free tracker slot; a read must not pass a pending write
+  // to the same line.
+  assign o_req_ready = (state_q == B_IDLE) &&
+      (i_req_write ? !pw_full : !pw_read_hazard);
+
+  logic req_fire;
+  assign req_fire = i_req_valid && o_req_ready;
 
   // Constant burst geometry: one beat of LINE_BYTES.
   assign o_axi_awlen   = 8'd0;
@@ -108,8 +159,8 @@ module line_port_axi_bridge #(
   assign o_axi_wdata   = wdata_q;
   assign o_axi_wstrb   = wstrb_q;
   assign o_axi_wlast   = 1'b1;
-  // Always ready for responses: the single-outstanding master can always
-  // accept, and -- critically -- an image-load CPU reset that interrupts an
+  // Always ready for responses: B's drain whenever the controller produces
+  // them, and -- critically -- an image-load CPU reset that interrupts an
   // in-flight transaction must still drain the controller's response instead
   // of wedging the interconnect (stale data/acks are discarded by the reset
   // state machine).
@@ -119,24 +170,52 @@ module line_port_axi_bridge #(
   assign o_axi_araddr  = addr_q;
   assign o_axi_rready  = 1'b1;  // see o_axi_bready
 
-  assign o_resp_valid  = (state_q == B_RESPOND);
+  assign o_resp_valid  = resp_pulse_q;
   assign o_resp_rdata  = rdata_q;
 
+  logic b_fire;
+  assign b_fire = i_axi_bvalid && o_axi_bready;
+
   always_ff @(posedge i_clk) begin
     if (i_rst) begin
-      state_q   <= B_IDLE;
-      aw_done_q <= 1'b0;
-      w_done_q  <= 1'b0;
+      state_q      <= B_IDLE;
+      aw_done_q    <= 1'b0;
+      w_done_q     <= 1'b0;
+      resp_pulse_q <= 1'b0;
+      pw_valid_q   <= '0;
+      pw_wr_ptr_q  <= '0;
+      pw_rd_ptr_q  <= '0;
+      pw_count_q   <= '0;
     end else begin
+      resp_pulse_q <= 1'b0;
+
+      // Retire posted writes as their B responses return (in order).
+      if (b_fire) begin
+        pw_valid_q[pw_rd_ptr_q] <= 1'b0;
+        pw_rd_ptr_q <= pw_rd_ptr_q + PwPtrBits'(1);
+      end
+      // push/pop may coincide; count tracks the difference.
+      pw_count_q <= pw_count_q + PwCntBits'(req_fire && i_req_write) -
+          PwCntBits'(b_fire);
+
       unique case (state_q)
         B_IDLE: begin
-          if (i_req_valid) begin
-            addr_q    <= i_req_addr - BASE_ADDR;
+          if (req_fire) begin
+            addr_q    <= req_axi_addr;
             wdata_q   <= i_req_wdata;
             wstrb_q   <= i_req_wstrb;
             aw_done_q <= 1'b0;
             w_done_q  <= 1'b0;
-            state_q   <= i_req_write ? B_WRITE : B_READ;
+            if (i_req_write) begin
+              // Post the write: complete the line port now, track the B.
+              resp_pulse_q <= 1'b1;
+              pw_addr_q[pw_wr_ptr_q] <= req_axi_addr;
+              pw_valid_q[pw_wr_ptr_q] <= 1'b1;
+              pw_wr_ptr_q <= pw_wr_ptr_q + PwPtrBits'(1);
+              state_q <= B_WRITE;
+            end else begin
+              state_q <= B_READ;
+            end
           end
         end
 
@@ -145,24 +224,20 @@ module line_port_axi_bridge #(
           if (o_axi_wvalid && i_axi_wready) w_done_q <= 1'b1;
           if ((aw_done_q || (o_axi_awvalid && i_axi_awready)) &&
               (w_done_q || (o_axi_wvalid && i_axi_wready))) begin
-            state_q <= B_BRESP;
+            state_q <= B_IDLE;
           end
         end
 
-        B_BRESP: if (i_axi_bvalid) state_q <= B_RESPOND;
-
-
         B_READ: if (i_axi_arready) state_q <= B_RRESP;
 
         B_RRESP: begin
           if (i_axi_rvalid) begin
-            rdata_q <= i_axi_rdata;
-            state_q <= B_RESPOND;
+            rdata_q      <= i_axi_rdata;
+            resp_pulse_q <= 1'b1;
+            state_q      <= B_IDLE;
           end
         end
 
-        B_RESPOND: state_q <= B_IDLE;
-
         default: state_q <= B_IDLE;
       endcase
     end
@@ -173,6 +248,8 @@ module line_port_axi_bridge #(
     if (!i_rst) begin
       if (i_axi_bvalid && o_axi_bready && i_axi_bresp != 2'b00)
         $error("line_port_axi_bridge: write response error (bresp=%0d)", i_axi_bresp);
+      if (i_axi_bvalid && o_axi_bready && pw_count_q == '0)
+        $error("line_port_axi_bridge: write response with no posted write outstanding");
       if (i_axi_rvalid && o_axi_rready && i_axi_rresp != 2'b00)
         $error("line_port_axi_bridge: read response error (rresp=%0d)", i_axi_rresp);
       if (i_axi_rvalid && o_axi_rready && !i_axi_rlast)
@@ -0,0 +1,235 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/*
+ * line_port_prefetcher -- next-line/stride prefetch engine for a line port.
+ *
+ * Splices transparently into a cache's downstream link (the level above's
+ * miss stream): demand requests pass straight through, and the read-address
+ * sequence trains a single stride detector -- two consecutive equal line
+ * deltas (the sequential case is delta == +LINE_BYTES) make it confident.
+ * While the link is otherwise idle, one speculative line fill for the
+ * predicted next address is issued downstream into a one-line buffer; a
+ * demand read that matches the buffer is answered in 2 cycles instead of the
+ * full downstream round trip. The port protocol stays single-outstanding: a
+ * demand arriving mid-prefetch simply waits out the prefetch (and then
+ * usually hits the fresh buffer).
+ *
+ * Coherence: an upstream WRITE (dirty writeback from the level above) that
+ * matches the buffered line invalidates the buffer -- the level below now
+ * holds newer data than our copy. Writes never train the detector.
+ * i_invalidate drops the buffer and the training state in one cycle; the
+ * hierarchy raises it alongside the owning cache's invalidate-all so a
+ * fence.i can never leave a pre-writeback instruction line buffered here.
+ *
+ * ENABLE == 0 collapses the module to wires.
+ */
+module line_port_prefetcher #(
+    parameter int unsigned ADDR_WIDTH = 32,
+    parameter int unsigned LINE_BYTES = 32,
+    parameter int unsigned ENABLE = 1
+) (
+    input logic i_clk,
+    input logic i_rst,
+
+    // Drop the prefetch buffer + training state (see header).
+    input logic i_invalidate,
+
+    // Upstream line port (slave) -- the cache above's downstream master.
+    input  logic                    i_up_req_valid,
+    output logic                    o_up_req_ready,
+    input  logic                    i_up_req_write,
+    input  logic [  ADDR_WIDTH-1:0] i_up_req_addr,
+    input  logic [LINE_BYTES*8-1:0] i_up_req_wdata,
+    input  logic [  LINE_BYTES-1:0] i_up_req_wstrb,
+    output logic                    o_up_resp_valid,
+    output logic [LINE_BYTES*8-1:0] o_up_resp_rdata,
+
+    // Downstream line port (master) -- toward the next level.
+    output logic                    o_down_req_valid,
+    input  logic                    i_down_req_ready,
+    output logic                    o_down_req_write,
+    output logic [  ADDR_WIDTH-1:0] o_down_req_addr,
+    output logic [LINE_BYTES*8-1:0] o_down_req_wdata,
+    output logic [  LINE_BYTES-1:0] o_down_req_wstrb,
+    input  logic                    i_down_resp_valid,
+    input  logic [LINE_BYTES*8-1:0] i_down_resp_rdata
+);
+
+  localparam int unsigned LineBits = LINE_BYTES * 8;
+  localparam int unsigned OffsetBits = $clog2(LINE_BYTES);
+
+  if (ENABLE == 0) begin : gen_passthrough
+    assign o_down_req_valid = i_up_req_valid;
+    assign o_up_req_ready   = i_down_req_ready;
+    assign o_down_req_write = i_up_req_write;
+    assign o_down_req_addr  = i_up_req_addr;
+    assign o_down_req_wdata = i_up_req_wdata;
+    assign o_down_req_wstrb = i_up_req_wstrb;
+    assign o_up_resp_valid  = i_down_resp_valid;
+    assign o_up_resp_rdata  = i_down_resp_rdata;
+  end else begin : gen_prefetcher
+
+    // ---- FSM ----------------------------------------------------------------
+    typedef enum logic [2:0] {
+      P_IDLE,         // accept a demand / launch a pending prefetch
+      P_HIT_RESP,     // demand read matched the buffer: pulse the response
+      P_DEMAND_REQ,   // present the forwarded demand downstream
+      P_DEMAND_WAIT,  // demand in flight; response is forwarded combinationally
+      P_PF_REQ,       // present the speculative fill downstream
+      P_PF_WAIT       // prefetch in flight; lands in the buffer
+    } state_e;
+
+    state_e state_q;
+
+    // Captured demand being forwarded.
+    logic                  req_write_q;
+    logic [ADDR_WIDTH-1:0] req_addr_q;
+    logic [  LineBits-1:0] req_wdata_q;
+    logic [LINE_BYTES-1:0] req_wstrb_q;
+
+    // One-line prefetch buffer.
+    logic                  pf_valid_q;
+    logic [ADDR_WIDTH-1:0] pf_addr_q;
+    logic [  LineBits-1:0] pf_line_q;
+
+    // Stride detector (line-aligned deltas; ADDR_WIDTH wrap-around math).
+    logic                  last_valid_q;
+    logic [ADDR_WIDTH-1:0] last_addr_q;
+    logic [ADDR_WIDTH-1:0] last_stride_q;
+
+    // Prediction awaiting an idle link.
+    logic                  pf_pending_q;
+    logic [ADDR_WIDTH-1:0] pf_pending_addr_q;
+
+    logic [  LineBits-1:0] hit_resp_data_q;
+
+    logic [ADDR_WIDTH-1:0] up_line_addr;
+    assign up_line_addr = {i_up_req_addr[ADDR_WIDTH-1:OffsetBits], {OffsetBits{1'b0}}};
+
+    logic [ADDR_WIDTH-1:0] up_stride;
+    assign up_stride = up_line_addr - last_addr_q;
+
+    logic stride_confident;
+    assign stride_confident = last_valid_q && (up_stride == last_stride_q) && (up_stride != '0);
+
+    logic up_req_fire;
+    assign up_req_fire = i_up_req_valid && o_up_req_ready;
+    assign o_up_req_ready = (state_q == P_IDLE);
+
+    logic buffer_hit;
+    assign buffer_hit = pf_valid_q && !i_up_req_write && (up_line_addr == pf_addr_q);
+
+    // Downstream drives: the forwarded demand, or the speculative read.
+    assign o_down_req_valid = (state_q == P_DEMAND_REQ) || (state_q == P_PF_REQ);
+    assign o_down_req_write = (state_q == P_DEMAND_REQ) && req_write_q;
+    assign o_down_req_addr = (state_q == P_PF_REQ) ? pf_pending_addr_q : req_addr_q;
+    assign o_down_req_wdata = req_wdata_q;
+    assign o_down_req_wstrb = req_wstrb_q;
+
+    // Upstream response: forwarded downstream response during a demand flight,
+    // or the registered buffer-hit pulse.
+    assign o_up_resp_valid = ((state_q == P_DEMAND_WAIT) && i_down_resp_valid) ||
+        (state_q == P_HIT_RESP);
+    assign o_up_resp_rdata = (state_q == P_HIT_RESP) ? hit_resp_data_q : i_down_resp_rdata;
+
+    always_ff @(posedge i_clk) begin
+      if (i_rst) begin
+        state_q      <= P_IDLE;
+        pf_valid_q   <= 1'b0;
+        pf_pending_q <= 1'b0;
+        last_valid_q <= 1'b0;
+      end else begin
+        // Invalidate wins over everything below that touches the buffer or
+        // the detector; an in-flight prefetch is dropped on arrival (the
+        // P_PF_WAIT arm re-checks pf_pending_q as the keep qualifier).
+        if (i_invalidate) begin
+          pf_valid_q   <= 1'b0;
+          pf_pending_q <= 1'b0;
+          last_valid_q <= 1'b0;
+        end
+
+        unique case (state_q)
+          P_IDLE: begin
+            if (up_req_fire) begin
+              if (!i_up_req_write) begin
+                // Train on every demand read; predict one line ahead.
+                last_valid_q  <= 1'b1;
+                last_addr_q   <= up_line_addr;
+                last_stride_q <= up_stride;
+                if (stride_confident && !i_invalidate) begin
+                  pf_pending_q      <= 1'b1;
+                  pf_pending_addr_q <= up_line_addr + up_stride;
+                end
+              end else if (pf_valid_q && up_line_addr == pf_addr_q) begin
+                // Writeback over the buffered line: our copy is now stale.
+                pf_valid_q <= 1'b0;
+              end
+
+              if (buffer_hit) begin
+                hit_resp_data_q <= pf_line_q;
+                pf_valid_q      <= 1'b0;  // consumed: the level above caches it now
+                state_q         <= P_HIT_RESP;
+              end else begin
+                req_write_q <= i_up_req_write;
+                req_addr_q  <= i_up_req_addr;
+                req_wdata_q <= i_up_req_wdata;
+                req_wstrb_q <= i_up_req_wstrb;
+                state_q     <= P_DEMAND_REQ;
+              end
+            end else if (pf_pending_q && !i_invalidate) begin
+              pf_pending_q <= 1'b0;
+              pf_valid_q   <= 1'b0;  // the buffer is being replaced
+              pf_addr_q    <= pf_pending_addr_q;
+              state_q      <= P_PF_REQ;
+            end
+          end
+
+          P_HIT_RESP: state_q <= P_IDLE;
+
+          P_DEMAND_REQ: if (i_down_req_ready) state_q <= P_DEMAND_WAIT;
+
+          P_DEMAND_WAIT: if (i_down_resp_valid) state_q <= P_IDLE;
+
+          P_PF_REQ: if (i_down_req_ready) state_q <= P_PF_WAIT;
+
+          P_PF_WAIT: begin
+            if (i_down_resp_valid) begin
+              // Keep the line unless an invalidate arrived mid-flight.
+              pf_valid_q <= !i_invalidate;
+              pf_line_q  <= i_down_resp_rdata;
+              state_q    <= P_IDLE;
+            end
+          end
+
+          default: state_q <= P_IDLE;
+        endcase
+      end
+    end
+
+`ifndef SYNTHESIS
+    always_ff @(posedge i_clk) begin
+      if (!i_rst) begin
+        if (i_down_resp_valid && !(state_q == P_DEMAND_WAIT || state_q == P_PF_WAIT))
+          $error("line_port_prefetcher: downstream response outside a WAIT state (state=%0d)",
+                 state_q);
+      end
+    end
+`endif
+
+  end
+
+endmodule : line_port_prefetcher
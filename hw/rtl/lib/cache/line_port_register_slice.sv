@@ -0,0 +1,145 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/*
+ * line_port_register_slice -- one-transaction register stage for a line port.
+ *
+ * The line-port modules (frost_cache, line_port_arbiter, line_port_prefetcher
+ * in its pass paths, line_port_axi_bridge) compose combinationally across
+ * hierarchy levels, so the request fan-down and the response broadcast both
+ * grow with hierarchy depth and show up on the critical path. Splicing this
+ * module between any line-port master and slave registers both directions:
+ * the request is captured into a one-entry holding register (upstream ready
+ * is simply "holding register free" -- with one transaction outstanding a
+ * skid entry buys nothing), and the response pulse and rdata are re-timed
+ * through a flop. Each direction costs one cycle of miss latency; the cut
+ * buys clock headroom, which is the better trade at the hierarchy's depths.
+ *
+ * Single-outstanding is preserved strictly: upstream ready stays low from
+ * the accepted request until its response has been delivered, mirroring the
+ * arbiter's busy tracking.
+ *
+ * ENABLE == 0 collapses the module to wires, so instantiations can stay
+ * unconditional (same convention as line_port_prefetcher).
+ */
+module line_port_register_slice #(
+    parameter int unsigned ADDR_WIDTH = 32,
+    parameter int unsigned LINE_BYTES = 32,
+    parameter int unsigned ENABLE = 1
+) (
+    input logic i_clk,
+    input logic i_rst,
+
+    // Upstream line port (slave) -- the master above.
+    input  logic                    i_up_req_valid,
+    output logic                    o_up_req_ready,
+    input  logic                    i_up_req_write,
+    input  logic [  ADDR_WIDTH-1:0] i_up_req_addr,
+    input  logic [LINE_BYTES*8-1:0] i_up_req_wdata,
+    input  logic [  LINE_BYTES-1:0] i_up_req_wstrb,
+    output logic                    o_up_resp_valid,
+    output logic [LINE_BYTES*8-1:0] o_up_resp_rdata,
+
+    // Downstream line port (master) -- the slave below.
+    output logic                    o_down_req_valid,
+    input  logic                    i_down_req_ready,
+    output logic                    o_down_req_write,
+    output logic [  ADDR_WIDTH-1:0] o_down_req_addr,
+    output logic [LINE_BYTES*8-1:0] o_down_req_wdata,
+    output logic [  LINE_BYTES-1:0] o_down_req_wstrb,
+    input  logic                    i_down_resp_valid,
+    input  logic [LINE_BYTES*8-1:0] i_down_resp_rdata
+);
+
+  localparam int unsigned LineBits = LINE_BYTES * 8;
+
+  if (ENABLE == 0) begin : gen_passthrough
+    assign o_down_req_valid = i_up_req_valid;
+    assign o_up_req_ready   = i_down_req_ready;
+    assign o_down_req_write = i_up_req_write;
+    assign o_down_req_addr  = i_up_req_addr;
+    assign o_down_req_wdata = i_up_req_wdata;
+    assign o_down_req_wstrb = i_up_req_wstrb;
+    assign o_up_resp_valid  = i_down_resp_valid;
+    assign o_up_resp_rdata  = i_down_resp_rdata;
+  end else begin : gen_slice
+
+    // Request holding register: captured at the upstream fire, presented
+    // downstream until its fire drains it.
+    logic                  req_valid_q;
+    logic                  req_write_q;
+    logic [ADDR_WIDTH-1:0] req_addr_q;
+    logic [  LineBits-1:0] req_wdata_q;
+    logic [LINE_BYTES-1:0] req_wstrb_q;
+
+    // Transaction-in-flight tracking: set at the downstream fire, cleared by
+    // the response pulse. Keeps upstream ready low until the response has
+    // gone back up, so the port stays single-outstanding end to end.
+    logic flight_q;
+
+    assign o_up_req_ready = !req_valid_q && !flight_q;
+
+    assign o_down_req_valid = req_valid_q;
+    assign o_down_req_write = req_write_q;
+    assign o_down_req_addr = req_addr_q;
+    assign o_down_req_wdata = req_wdata_q;
+    assign o_down_req_wstrb = req_wstrb_q;
+
+    always_ff @(posedge i_clk) begin
+      if (i_rst) begin
+        req_valid_q <= 1'b0;
+        flight_q    <= 1'b0;
+      end else begin
+        if (i_up_req_valid && o_up_req_ready) begin
+          req_valid_q <= 1'b1;
+          req_write_q <= i_up_req_write;
+          req_addr_q  <= i_up_req_addr;
+          req_wdata_q <= i_up_req_wdata;
+          req_wstrb_q <= i_up_req_wstrb;
+        end else if (req_valid_q && i_down_req_ready) begin
+          req_valid_q <= 1'b0;
+          flight_q    <= 1'b1;
+        end
+        if (i_down_resp_valid) flight_q <= 1'b0;
+      end
+    end
+
+    // Response re-timing: the pulse and the broadcast rdata each go through
+    // one flop on the way back up.
+    logic                resp_valid_q;
+    logic [LineBits-1:0] resp_rdata_q;
+
+    always_ff @(posedge i_clk) begin
+      if (i_rst) resp_valid_q <= 1'b0;
+      else resp_valid_q <= i_down_resp_valid;
+      resp_rdata_q <= i_down_resp_rdata;
+    end
+
+    assign o_up_resp_valid = resp_valid_q;
+    assign o_up_resp_rdata = resp_rdata_q;
+
+`ifndef SYNTHESIS
+    always_ff @(posedge i_clk) begin
+      if (!i_rst) begin
+        if (i_down_resp_valid && !flight_q)
+          $error("line_port_register_slice: downstream response with no request in flight");
+      end
+    end
+`endif
+
+  end
+
+endmodule : line_port_register_slice
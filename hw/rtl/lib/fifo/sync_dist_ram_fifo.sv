@@ -35,7 +35,8 @@ module sync_dist_ram_fifo #(
     input logic [DATA_WIDTH-1:0] i_write_data,
     output logic [DATA_WIDTH-1:0] o_read_data,
     output logic o_empty,  // FIFO is empty (no data available)
-    output logic o_full  // FIFO is full (no space available)
+    output logic o_full,  // FIFO is full (no space available)
+    output logic [ADDR_WIDTH:0] o_fill_count  // Number of entries currently buffered
 );
 
   localparam int unsigned FifoDepth = 2 ** ADDR_WIDTH;
@@ -90,5 +91,6 @@ module sync_dist_ram_fifo #(
   assign fifo_is_empty = (fill_count == '0);
   assign o_full        = (fill_count == FillCountWidth'(FifoDepth));
   assign o_empty       = fifo_is_empty;
+  assign o_fill_count  = fill_count;
 
 endmodule : sync_dist_ram_fifo
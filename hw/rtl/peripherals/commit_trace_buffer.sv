@@ -0,0 +1,200 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/*
+ * commit_trace_buffer -- branches-only commit trace ring for on-hardware
+ * profiling.
+ *
+ * Records one entry per retired branch/jump from the core's commit stream
+ * into a BRAM ring: {cycle delta since the previous entry, branch PC, taken}.
+ * Because execution between branches is straight-line, the committed-branch
+ * sequence plus the program image reconstructs the full committed path, and
+ * the cycle deltas attribute time to it -- gprof-quality attribution at
+ * speed, where Verilator traces were previously the only option
+ * (fpga/decode_commit_trace.py does the host-side decode).
+ *
+ * Entry layout (64 bits):
+ *   [63:32] cycle delta since the previous recorded entry (mod 2^32)
+ *   [31:1]  branch PC bits [31:1] (PCs are at least 2-byte aligned)
+ *   [0]     branch taken
+ *
+ * Register contract (decode lives in cpu_and_mem):
+ *   CTRL      : write bit 0 = enable, bit 1 = clear (reset pointers, wrapped
+ *               flag and trigger arm); read {wrapped, triggered, enable}.
+ *   STATUS    : entry count (read-only).
+ *   DATA_LO   : oldest entry {pc[31:1], taken} (non-destructive read).
+ *   DATA_HI   : oldest entry cycle delta; the read pops the entry.  Read
+ *               DATA_LO first.  Pops are MMIO loads, so the one-cycle BRAM
+ *               refill after a pop is always hidden.
+ *   FILTER_LO : inclusive lower PC bound for recording (reset 0).
+ *   FILTER_HI : exclusive upper PC bound; 0 = unbounded (reset 0).
+ *   TRIGGER   : recording starts at the first committed branch at this PC
+ *               once enabled; 0 = start immediately (reset 0).
+ *
+ * When the ring fills, the oldest entry is dropped (wrapped flag set), so a
+ * free-running capture keeps the most recent DEPTH branches before the stop.
+ */
+module commit_trace_buffer #(
+    // Ring entries (power of 2). 2048 x 64 b fills two RAMB36s.
+    parameter int unsigned DEPTH = 2048
+) (
+    input logic i_clk,
+    input logic i_rst,
+
+    // Committed-branch stream from the core: one pulse per retired
+    // branch/jump with its PC and outcome.
+    input logic        i_commit_valid,
+    input logic [31:0] i_commit_pc,
+    input logic        i_commit_taken,
+
+    // MMIO register write strobes (decoded by cpu_and_mem from the registered
+    // store path) sharing the registered store data.
+    input logic        i_ctrl_wr_en,
+    input logic        i_filter_lo_wr_en,
+    input logic        i_filter_hi_wr_en,
+    input logic        i_trigger_wr_en,
+    input logic [31:0] i_wr_data,
+
+    // Exactly-once pop pulse (MMIO read of DATA_HI).
+    input logic i_data_pop,
+
+    // Register readback.
+    output logic [31:0] o_ctrl,
+    output logic [31:0] o_status,
+    output logic [31:0] o_data_lo,
+    output logic [31:0] o_data_hi,
+    output logic [31:0] o_filter_lo,
+    output logic [31:0] o_filter_hi,
+    output logic [31:0] o_trigger
+);
+
+  localparam int unsigned PtrBits = $clog2(DEPTH);
+
+  initial begin
+    if (2 ** PtrBits != DEPTH) $fatal(1, "commit_trace_buffer: DEPTH must be a power of 2");
+  end
+
+  // Configuration registers.
+  logic        enable_q;
+  logic [31:0] filter_lo_q;
+  logic [31:0] filter_hi_q;
+  logic [31:0] trigger_q;
+
+  // Trigger/wrap state.
+  logic        triggered_q;
+  logic        wrapped_q;
+
+  // Ring pointers carry an extra bit so count and full drop out of the
+  // subtraction (standard FIFO idiom).
+  logic [PtrBits:0] wr_ptr_q;
+  logic [PtrBits:0] rd_ptr_q;
+  logic [PtrBits:0] count;
+  logic             full;
+  assign count = wr_ptr_q - rd_ptr_q;
+  assign full  = count == (PtrBits + 1)'(DEPTH);
+
+  // Free-running cycle counter and the cycle of the last recorded entry;
+  // deltas are mod 2^32 so no saturation logic is needed.
+  logic [31:0] cycle_q;
+  logic [31:0] last_cycle_q;
+
+  // Recording decision. The triggering branch itself is recorded, so the
+  // first entry's delta is measured from the trigger point.
+  logic trigger_hit;
+  logic triggered_eff;
+  logic in_filter;
+  logic record_fire;
+  assign trigger_hit = (trigger_q == 32'd0) ||
+                       (i_commit_valid && (i_commit_pc == trigger_q));
+  assign triggered_eff = triggered_q || (enable_q && trigger_hit);
+  assign in_filter = (i_commit_pc >= filter_lo_q) &&
+                     ((filter_hi_q == 32'd0) || (i_commit_pc < filter_hi_q));
+  assign record_fire = enable_q && triggered_eff && i_commit_valid && in_filter;
+
+  // BRAM ring. The read port continuously presents the oldest entry so the
+  // MMIO readback needs no wait states.
+  logic [63:0] ring_mem[DEPTH];
+  logic [63:0] rd_data_q;
+  logic [63:0] record_entry;
+  assign record_entry = {cycle_q - last_cycle_q, i_commit_pc[31:1], i_commit_taken};
+
+  always_ff @(posedge i_clk) begin
+    if (record_fire) begin
+      ring_mem[wr_ptr_q[PtrBits-1:0]] <= record_entry;
+    end
+    rd_data_q <= ring_mem[rd_ptr_q[PtrBits-1:0]];
+  end
+
+  always_ff @(posedge i_clk) begin
+    if (i_rst) begin
+      enable_q     <= 1'b0;
+      filter_lo_q  <= 32'd0;
+      filter_hi_q  <= 32'd0;
+      trigger_q    <= 32'd0;
+      triggered_q  <= 1'b0;
+      wrapped_q    <= 1'b0;
+      wr_ptr_q     <= '0;
+      rd_ptr_q     <= '0;
+      cycle_q      <= 32'd0;
+      last_cycle_q <= 32'd0;
+    end else begin
+      cycle_q <= cycle_q + 32'd1;
+
+      if (i_ctrl_wr_en) begin
+        enable_q <= i_wr_data[0];
+        if (i_wr_data[1]) begin
+          // Clear: empty the ring and re-arm the trigger.
+          wr_ptr_q    <= '0;
+          rd_ptr_q    <= '0;
+          wrapped_q   <= 1'b0;
+          triggered_q <= 1'b0;
+        end
+      end
+      if (i_filter_lo_wr_en) filter_lo_q <= i_wr_data;
+      if (i_filter_hi_wr_en) filter_hi_q <= i_wr_data;
+      if (i_trigger_wr_en) trigger_q <= i_wr_data;
+
+      if (enable_q && !triggered_q && trigger_hit) begin
+        triggered_q  <= 1'b1;
+        // Delta of the first entry counts from the trigger point.
+        last_cycle_q <= cycle_q;
+      end
+
+      if (record_fire) begin
+        wr_ptr_q     <= wr_ptr_q + 1'b1;
+        last_cycle_q <= cycle_q;
+        if (full && !i_data_pop) begin
+          // Overwrite the oldest entry: keep the most recent DEPTH branches.
+          rd_ptr_q  <= rd_ptr_q + 1'b1;
+          wrapped_q <= 1'b1;
+        end
+      end
+
+      if (i_data_pop && count != '0) begin
+        rd_ptr_q <= rd_ptr_q + 1'b1;
+      end
+    end
+  end
+
+  assign o_ctrl      = {29'b0, wrapped_q, triggered_q, enable_q};
+  assign o_status    = 32'(count);
+  assign o_data_lo   = rd_data_q[31:0];
+  assign o_data_hi   = rd_data_q[63:32];
+  assign o_filter_lo = filter_lo_q;
+  assign o_filter_hi = filter_hi_q;
+  assign o_trigger   = trigger_q;
+
+endmodule : commit_trace_buffer
@@ -0,0 +1,101 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/*
+ * crc32_unit -- memory-mapped CRC-32 accumulator.
+ *
+ * Holds the running CRC state in a register and folds store data into it
+ * combinationally: a word store advances the CRC by four bytes in one write,
+ * a byte store by one. The polynomial is the reflected IEEE 802.3 CRC-32
+ * (0xEDB88320), processed LSB-first, so results match zlib's crc32() when
+ * software seeds the state with ~0 and finalizes with ~state (the unit
+ * stores raw state and leaves both inversions to the crc.h driver).
+ *
+ * The 32-bit step is 32 unrolled LFSR stages; each stage is a shift plus a
+ * conditional XOR with a constant, so the whole step flattens into a XOR
+ * network well inside a cycle at our clock targets.
+ *
+ * Register contract (decode lives in cpu_and_mem):
+ *   STATE     : write = set the raw CRC state (seed); read = current state.
+ *   DATA_WORD : write folds the 32-bit store data into the state, low byte
+ *               first (write-only; reads return 0).
+ *   DATA_BYTE : write folds store data bits [7:0] into the state
+ *               (write-only; reads return 0).
+ */
+module crc32_unit (
+    input logic i_clk,
+    input logic i_rst,
+
+    // MMIO register write strobes (decoded by cpu_and_mem from the registered
+    // store path) sharing the registered store data.
+    input logic        i_state_wr_en,
+    input logic        i_data_word_wr_en,
+    input logic        i_data_byte_wr_en,
+    input logic [31:0] i_wr_data,
+
+    // Register readback.
+    output logic [31:0] o_state
+);
+
+  // Reflected IEEE 802.3 polynomial (LSB-first processing).
+  localparam logic [31:0] Polynomial = 32'hEDB8_8320;
+
+  logic [31:0] crc_state;
+
+  // One LFSR stage: consume one message bit into the reflected CRC.
+  function automatic logic [31:0] crc_step_bit(logic [31:0] state, logic message_bit);
+    if (state[0] ^ message_bit) begin
+      return (state >> 1) ^ Polynomial;
+    end else begin
+      return state >> 1;
+    end
+  endfunction
+
+  // Fold one byte (8 unrolled stages, LSB first).
+  function automatic logic [31:0] crc_step_byte(logic [31:0] state, logic [7:0] data);
+    logic [31:0] next_state;
+    next_state = state;
+    for (int bit_index = 0; bit_index < 8; bit_index++) begin
+      next_state = crc_step_bit(next_state, data[bit_index]);
+    end
+    return next_state;
+  endfunction
+
+  // Fold one word (low byte first, matching little-endian memory order).
+  function automatic logic [31:0] crc_step_word(logic [31:0] state, logic [31:0] data);
+    logic [31:0] next_state;
+    next_state = state;
+    for (int byte_index = 0; byte_index < 4; byte_index++) begin
+      next_state = crc_step_byte(next_state, data[8*byte_index+:8]);
+    end
+    return next_state;
+  endfunction
+
+  always_ff @(posedge i_clk) begin
+    if (i_rst) begin
+      crc_state <= 32'h0;
+    end else if (i_state_wr_en) begin
+      crc_state <= i_wr_data;
+    end else if (i_data_word_wr_en) begin
+      crc_state <= crc_step_word(crc_state, i_wr_data);
+    end else if (i_data_byte_wr_en) begin
+      crc_state <= crc_step_byte(crc_state, i_wr_data[7:0]);
+    end
+  end
+
+  assign o_state = crc_state;
+
+endmodule
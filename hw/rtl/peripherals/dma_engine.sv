@@ -0,0 +1,359 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/*
+ * dma_engine -- descriptor-based memory-to-memory line copy engine.
+ *
+ * Software programs one descriptor (source, destination, byte length) through
+ * the MMIO register strobes and writes the start bit; the engine then moves
+ * the transfer line by line over its line-port master -- read a full line
+ * from the source, write it to the destination, advance, repeat -- and
+ * raises done (and, when enabled, a level interrupt) at the end.  A 32-byte
+ * line per read/write transaction moves an order of magnitude more bytes per
+ * line-port round trip than the word-at-a-time copies the core issues
+ * through the LQ/SQ, and the core is free to run ahead while the copy drains.
+ *
+ * The line port speaks the frost_cache protocol (see frost_cache.sv): single
+ * outstanding, payload captured at the fire, one response pulse per
+ * transaction.  FROST wires this master into frost_cache_hierarchy's DMA
+ * slave port -- below the L1s, above the shared level -- so coherence follows
+ * the same software contract as a second core: flush the L1D before starting
+ * a transfer that touches lines the core has written (sw/lib dma.h does
+ * this).
+ *
+ * The engine also has a FIFO ring-ingest mode for zero-copy packet intake:
+ * instead of copying memory to memory, it drains the MMIO FIFO0 pop
+ * interface word by word, packs words into lines, and writes them into a
+ * DDR ring buffer so firmware parses arriving data in place -- no per-word
+ * MMIO loads on the consume path.  Partial lines are flushed (with a byte
+ * write strobe covering only the collected words) whenever the FIFO runs
+ * dry, so latency does not wait on a full line.  The committed write
+ * pointer is exported for firmware to chase; firmware publishes its consume
+ * point back through i_ring_rptr and the engine stalls rather than overrun
+ * it (one word of the ring is kept unused to distinguish full from empty).
+ *
+ * Register contract (decode lives in cpu_and_mem):
+ *   SRC/DST : line-aligned byte addresses (low 5 bits ignored).  Ring mode
+ *             uses DST as the ring base; SRC is ignored.
+ *   LEN     : transfer length in bytes, rounded up to whole lines.  Ring
+ *             mode uses it as the ring size.
+ *   CTRL    : write bit 0 = start (ignored while busy), bit 1 = interrupt
+ *             enable (latched on every CTRL write), bit 2 = ring-ingest
+ *             mode (sampled with start; a CTRL write with bit 0 clear while
+ *             the ring is active stops it after flushing collected words);
+ *             every CTRL write also acknowledges (clears) done.
+ *   Status  : o_busy/o_done/o_irq_en/o_ring_active, packed into the CTRL
+ *             readback by cpu_and_mem as {ring_active, irq_en, done, busy}.
+ */
+module dma_engine #(
+    parameter int unsigned ADDR_WIDTH = 32,
+    parameter int unsigned LINE_BYTES = 32
+) (
+    input logic i_clk,
+    input logic i_rst,
+
+    // MMIO register write strobes (decoded by cpu_and_mem from the registered
+    // store path) sharing the registered store data.
+    input logic        i_src_wr_en,
+    input logic        i_dst_wr_en,
+    input logic        i_len_wr_en,
+    input logic        i_ctrl_wr_en,
+    input logic [31:0] i_wr_data,
+
+    // Register readback and status.
+    output logic [31:0] o_src,
+    output logic [31:0] o_dst,
+    output logic [31:0] o_len,
+    output logic        o_busy,
+    output logic        o_done,
+    output logic        o_irq_en,
+    output logic        o_irq,
+
+    // Ring-ingest mode: pop interface of the MMIO FIFO being drained
+    // (cpu_and_mem muxes this onto FIFO0's read side while the ring is
+    // active), plus the software-visible ring pointers.  o_ring_wptr is the
+    // absolute byte address of the next write -- data below it is committed
+    // to memory; i_ring_rptr is the firmware consume point the engine must
+    // not overrun.
+    input  logic [31:0] i_fifo_rd_data,
+    input  logic        i_fifo_empty,
+    output logic        o_fifo_rd_en,
+    output logic [31:0] o_ring_wptr,
+    input  logic [31:0] i_ring_rptr,
+    output logic        o_ring_active,
+
+    // Line port master (into the cache hierarchy's DMA slave port).
+    output logic                    o_line_req_valid,
+    input  logic                    i_line_req_ready,
+    output logic                    o_line_req_write,
+    output logic [  ADDR_WIDTH-1:0] o_line_req_addr,
+    output logic [LINE_BYTES*8-1:0] o_line_req_wdata,
+    output logic [  LINE_BYTES-1:0] o_line_req_wstrb,
+    input  logic                    i_line_resp_valid,
+    input  logic [LINE_BYTES*8-1:0] i_line_resp_rdata
+);
+
+  localparam int unsigned LineAddrBits = $clog2(LINE_BYTES);
+  // Worst case: a full 4 GiB space of lines still fits the counter.
+  localparam int unsigned LineCountBits = 32 - LineAddrBits;
+
+  localparam int unsigned WordsPerLine = LINE_BYTES / 4;
+  localparam int unsigned WordCountBits = $clog2(WordsPerLine) + 1;
+
+  typedef enum logic [2:0] {
+    DMA_IDLE,        // waiting for a start
+    DMA_READ_REQ,    // presenting the source line read (until ready)
+    DMA_READ_WAIT,   // waiting out the read response
+    DMA_WRITE_REQ,   // presenting the destination line write (until ready)
+    DMA_WRITE_WAIT,  // waiting out the write response
+    RING_COLLECT,    // ring mode: packing FIFO words into the line buffer
+    RING_WRITE_REQ,  // ring mode: presenting the (possibly partial) line write
+    RING_WRITE_WAIT  // ring mode: waiting out the write response
+  } dma_state_e;
+
+  dma_state_e state_q;
+
+  // Programmed descriptor (stable readback; a mid-transfer rewrite only
+  // affects the next start).
+  logic [31:0] src_q, dst_q, len_q;
+
+  // Working copy of the active transfer.
+  logic [ADDR_WIDTH-1:0] cur_src_q, cur_dst_q;
+  logic [LineCountBits-1:0] lines_left_q;
+  logic [LINE_BYTES*8-1:0] line_q;
+
+  logic done_q, irq_en_q;
+
+  // Ring-mode working state: byte offset of the current line within the
+  // ring, words of that line already committed to memory, and words newly
+  // collected from the FIFO since the last flush.
+  logic [31:0] ring_off_q;
+  logic [WordCountBits-1:0] ring_fill_q, ring_collect_q;
+  logic ring_stop_q;
+
+  // Length in whole lines, rounded up.
+  logic [LineCountBits-1:0] len_lines;
+  assign len_lines = LineCountBits'((len_q + 32'(LINE_BYTES) - 1) >> LineAddrBits);
+
+  logic start, start_ring;
+  assign start = i_ctrl_wr_en && i_wr_data[0] && !i_wr_data[2] && (state_q == DMA_IDLE);
+  assign start_ring = i_ctrl_wr_en && i_wr_data[0] && i_wr_data[2] && (state_q == DMA_IDLE);
+
+  logic ring_active;
+  assign ring_active = (state_q == RING_COLLECT) || (state_q == RING_WRITE_REQ) ||
+                       (state_q == RING_WRITE_WAIT);
+
+  assign o_src = src_q;
+  assign o_dst = dst_q;
+  assign o_len = len_q;
+  assign o_busy = (state_q != DMA_IDLE);
+  assign o_done = done_q;
+  assign o_irq_en = irq_en_q;
+  assign o_irq = done_q && irq_en_q;
+  assign o_ring_active = ring_active;
+
+  // Ring pointer bookkeeping. The ring spans len_lines whole lines starting
+  // at the (line-aligned) destination; pointers are byte offsets into it.
+  logic [31:0] ring_base;
+  assign ring_base = {dst_q[31:LineAddrBits], {LineAddrBits{1'b0}}};
+  logic [31:0] ring_bytes;
+  assign ring_bytes = 32'(len_lines) << LineAddrBits;
+
+  // Committed write pointer: bytes at offsets below it have reached memory.
+  logic [31:0] ring_wptr_off;
+  assign ring_wptr_off = ring_off_q + (32'(ring_fill_q) << 2);
+  assign o_ring_wptr = ring_base + ring_wptr_off;
+
+  // Firmware consume pointer, as an offset (software publishes it absolute).
+  logic [31:0] ring_rptr_off;
+  assign ring_rptr_off = i_ring_rptr - ring_base;
+
+  // Offset the next popped word would land at, and the full check: stall
+  // rather than let the collect pointer catch the consume pointer (one word
+  // of the ring stays unused so full and empty are distinguishable).
+  logic [31:0] ring_word_off, ring_word_off_next;
+  assign ring_word_off = ring_off_q + (32'(ring_fill_q + ring_collect_q) << 2);
+  assign ring_word_off_next =
+      (ring_word_off + 32'd4 == ring_bytes) ? 32'd0 : ring_word_off + 32'd4;
+  logic ring_full;
+  assign ring_full = (ring_word_off_next == ring_rptr_off);
+
+  // Pop a word whenever one is available, the line buffer has room, the
+  // ring has space, and no stop is pending (a stop leaves residual FIFO
+  // data for MMIO reads).
+  logic ring_pop;
+  assign ring_pop = (state_q == RING_COLLECT) && !i_fifo_empty && !ring_full && !ring_stop_q &&
+                    (ring_fill_q + ring_collect_q != WordCountBits'(WordsPerLine));
+  assign o_fifo_rd_en = ring_pop;
+
+  // Flush the collected words when the line is complete or the FIFO runs
+  // dry (or a stop is draining) -- partial-line writes keep ingest latency
+  // independent of line size.
+  logic ring_flush;
+  assign ring_flush = (state_q == RING_COLLECT) && !ring_pop && (ring_collect_q != '0);
+
+  // Ring write strobe: only the bytes of the line collected so far (bytes
+  // already committed by an earlier partial flush are rewritten with the
+  // same data, which is harmless).
+  logic [LINE_BYTES-1:0] ring_wstrb;
+  always_comb begin
+    for (int unsigned b = 0; b < LINE_BYTES; b++) begin
+      ring_wstrb[b] = (b < 4 * 32'(ring_fill_q + ring_collect_q));
+    end
+  end
+
+  // Line-port master: valid held through the REQ states, payload stable
+  // until the fire (the slave captures it then).
+  assign o_line_req_valid = (state_q == DMA_READ_REQ) || (state_q == DMA_WRITE_REQ) ||
+                            (state_q == RING_WRITE_REQ);
+  assign o_line_req_write = (state_q == DMA_WRITE_REQ) || (state_q == RING_WRITE_REQ);
+  assign o_line_req_addr = (state_q == RING_WRITE_REQ || state_q == RING_WRITE_WAIT)
+      ? ring_base + ring_off_q
+      : (o_line_req_write ? cur_dst_q : cur_src_q);
+  assign o_line_req_wdata = line_q;
+  assign o_line_req_wstrb = (state_q == RING_WRITE_REQ) ? ring_wstrb
+                          : (o_line_req_write ? {LINE_BYTES{1'b1}} : '0);
+
+  always_ff @(posedge i_clk) begin
+    if (i_rst) begin
+      state_q      <= DMA_IDLE;
+      src_q        <= '0;
+      dst_q        <= '0;
+      len_q        <= '0;
+      cur_src_q    <= '0;
+      cur_dst_q    <= '0;
+      lines_left_q <= '0;
+      done_q       <= 1'b0;
+      irq_en_q     <= 1'b0;
+      ring_off_q   <= '0;
+      ring_fill_q  <= '0;
+      ring_collect_q <= '0;
+      ring_stop_q  <= 1'b0;
+    end else begin
+      if (i_src_wr_en) src_q <= i_wr_data;
+      if (i_dst_wr_en) dst_q <= i_wr_data;
+      if (i_len_wr_en) len_q <= i_wr_data;
+      if (i_ctrl_wr_en) begin
+        // Every CTRL write acknowledges done and refreshes the irq enable.
+        done_q   <= 1'b0;
+        irq_en_q <= i_wr_data[1];
+        // Clearing the start bit while the ring is active requests a stop;
+        // the engine flushes collected words first.
+        if (!i_wr_data[0] && ring_active) ring_stop_q <= 1'b1;
+      end
+
+      // Capture a popped FIFO word into its slot of the line buffer (the
+      // pop and the capture share the edge; the FIFO's read data is the
+      // head until then).
+      if (ring_pop) begin
+        line_q[32*(ring_fill_q+ring_collect_q)+:32] <= i_fifo_rd_data;
+        ring_collect_q <= ring_collect_q + 1'b1;
+      end
+
+      unique case (state_q)
+        DMA_IDLE: begin
+          if (start) begin
+            if (len_lines == '0) begin
+              // Zero-length transfer: complete immediately, no traffic.
+              done_q <= 1'b1;
+            end else begin
+              cur_src_q    <= {src_q[ADDR_WIDTH-1:LineAddrBits], {LineAddrBits{1'b0}}};
+              cur_dst_q    <= {dst_q[ADDR_WIDTH-1:LineAddrBits], {LineAddrBits{1'b0}}};
+              lines_left_q <= len_lines;
+              state_q      <= DMA_READ_REQ;
+            end
+          end else if (start_ring) begin
+            if (len_lines == '0) begin
+              // Zero-sized ring: nothing to ingest into.
+              done_q <= 1'b1;
+            end else begin
+              ring_off_q     <= '0;
+              ring_fill_q    <= '0;
+              ring_collect_q <= '0;
+              ring_stop_q    <= 1'b0;
+              state_q        <= RING_COLLECT;
+            end
+          end
+        end
+        DMA_READ_REQ: if (i_line_req_ready) state_q <= DMA_READ_WAIT;
+        DMA_READ_WAIT: begin
+          if (i_line_resp_valid) begin
+            line_q  <= i_line_resp_rdata;
+            state_q <= DMA_WRITE_REQ;
+          end
+        end
+        DMA_WRITE_REQ: if (i_line_req_ready) state_q <= DMA_WRITE_WAIT;
+        DMA_WRITE_WAIT: begin
+          if (i_line_resp_valid) begin
+            cur_src_q    <= cur_src_q + ADDR_WIDTH'(LINE_BYTES);
+            cur_dst_q    <= cur_dst_q + ADDR_WIDTH'(LINE_BYTES);
+            lines_left_q <= lines_left_q - 1'b1;
+            if (lines_left_q == LineCountBits'(1)) begin
+              done_q  <= 1'b1;
+              state_q <= DMA_IDLE;
+            end else begin
+              state_q <= DMA_READ_REQ;
+            end
+          end
+        end
+        RING_COLLECT: begin
+          if (ring_flush) begin
+            state_q <= RING_WRITE_REQ;
+          end else if (ring_stop_q && ring_collect_q == '0) begin
+            // Stop request with nothing left to flush: ring session over.
+            done_q      <= 1'b1;
+            ring_stop_q <= 1'b0;
+            state_q     <= DMA_IDLE;
+          end
+        end
+        RING_WRITE_REQ: if (i_line_req_ready) state_q <= RING_WRITE_WAIT;
+        RING_WRITE_WAIT: begin
+          if (i_line_resp_valid) begin
+            // The collected words are committed: publish them through the
+            // write pointer and advance (with wrap) on a completed line.
+            if (ring_fill_q + ring_collect_q == WordCountBits'(WordsPerLine)) begin
+              ring_fill_q <= '0;
+              ring_off_q  <= (ring_off_q + 32'(LINE_BYTES) == ring_bytes)
+                  ? 32'd0
+                  : ring_off_q + 32'(LINE_BYTES);
+            end else begin
+              ring_fill_q <= ring_fill_q + ring_collect_q;
+            end
+            ring_collect_q <= '0;
+            state_q        <= RING_COLLECT;
+          end
+        end
+        default: state_q <= DMA_IDLE;
+      endcase
+    end
+  end
+
+`ifndef SYNTHESIS
+  // Protocol/contract checks (simulation only).
+  always_ff @(posedge i_clk) begin
+    if (!i_rst) begin
+      if (i_line_resp_valid && state_q != DMA_READ_WAIT && state_q != DMA_WRITE_WAIT &&
+          state_q != RING_WRITE_WAIT)
+        $error("dma_engine: line response with no transaction in flight");
+      if (start && (src_q[LineAddrBits-1:0] != '0 || dst_q[LineAddrBits-1:0] != '0))
+        $error("dma_engine: transfer started with a misaligned source or destination");
+      if (start_ring && dst_q[LineAddrBits-1:0] != '0)
+        $error("dma_engine: ring started with a misaligned base");
+    end
+  end
+`endif
+
+endmodule : dma_engine
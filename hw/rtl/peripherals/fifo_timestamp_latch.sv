@@ -0,0 +1,84 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/*
+ * fifo_timestamp_latch -- hardware arrival timestamps for an MMIO FIFO.
+ *
+ * Latches mtime into a small side FIFO on every empty-to-non-empty
+ * transition of the data FIFO it watches (a write arriving while the FIFO
+ * is empty), i.e. one timestamp per arrival burst. Software pops them
+ * alongside the data, so wire-to-done latency accounting reflects when the
+ * data actually arrived rather than when a polling loop got to it.
+ *
+ * A burst that software drains to empty mid-stream starts a new burst and
+ * latches a new timestamp with its next word. If the side FIFO is full the
+ * oldest pending timestamps are preserved and the new arrival's stamp is
+ * dropped (an unconsumed backlog is already stale for latency purposes).
+ *
+ * Register contract (decode lives in cpu_and_mem):
+ *   TS_LO : oldest pending timestamp, mtime[31:0] (non-destructive read).
+ *   TS_HI : mtime[63:32] of the same entry; the read pops it. Read LO
+ *           first, then HI.
+ *   Count : o_count, exported for the shared FIFO_TS_STATUS readback.
+ */
+module fifo_timestamp_latch #(
+    parameter int unsigned ADDR_WIDTH = 3  // 2^ADDR_WIDTH pending timestamps
+) (
+    input logic i_clk,
+    input logic i_rst,
+
+    // Watched data FIFO: its write enable and current empty flag.
+    input logic i_fifo_wr_en,
+    input logic i_fifo_empty,
+
+    // Current mtime value (cpu_and_mem's CLINT-style counter).
+    input logic [63:0] i_mtime,
+
+    // Destructive-read pop pulse (the TS_HI MMIO read).
+    input logic i_ts_pop,
+
+    output logic [31:0] o_ts_lo,
+    output logic [31:0] o_ts_hi,
+    output logic [ADDR_WIDTH:0] o_count
+);
+
+  logic ts_fifo_empty, ts_fifo_full;
+  logic [63:0] ts_head;
+
+  // First word into an empty FIFO marks the start of an arrival burst.
+  logic burst_start;
+  assign burst_start = i_fifo_wr_en && i_fifo_empty && !ts_fifo_full;
+
+  sync_dist_ram_fifo #(
+      .ADDR_WIDTH(ADDR_WIDTH),
+      .DATA_WIDTH(64)
+  ) timestamp_fifo (
+      .i_clk,
+      .i_rst,
+      .i_write_enable(burst_start),
+      .i_read_enable(i_ts_pop),
+      .i_write_data(i_mtime),
+      .o_read_data(ts_head),
+      .o_empty(ts_fifo_empty),
+      .o_full(ts_fifo_full),
+      .o_fill_count(o_count)
+  );
+
+  // An empty side FIFO reads as zero (software checks the count first).
+  assign o_ts_lo = ts_fifo_empty ? 32'b0 : ts_head[31:0];
+  assign o_ts_hi = ts_fifo_empty ? 32'b0 : ts_head[63:32];
+
+endmodule : fifo_timestamp_latch
@@ -4,3 +4,18 @@
 # UART transmitter and receiver
 $(ROOT)/hw/rtl/peripherals/uart_tx.sv
 $(ROOT)/hw/rtl/peripherals/uart_rx.sv
+
+# Descriptor-based DMA copy engine (masters a cache-hierarchy line port)
+$(ROOT)/hw/rtl/peripherals/dma_engine.sv
+
+# Branches-only commit trace ring (on-hardware profiling)
+$(ROOT)/hw/rtl/peripherals/commit_trace_buffer.sv
+
+# Memory-mapped CRC-32 accumulator (one word per store)
+$(ROOT)/hw/rtl/peripherals/crc32_unit.sv
+
+# MMIO FIFO arrival-timestamp latch (one mtime stamp per burst)
+$(ROOT)/hw/rtl/peripherals/fifo_timestamp_latch.sv
+
+# Cocotb unit-bench harness (engine + arbiter + bridge + behavioral memory)
+$(ROOT)/hw/rtl/peripherals/dma_engine_test_harness.sv
@@ -0,0 +1,156 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+// Native Verilator harness for the frost top level.
+//
+// Minimal direct testbench for fast software regression: no cocotb, no VPI.
+// Drives i_clk / i_clk_div4 (div4 toggles every 2 main-clock rising edges,
+// matching the cocotb clock coroutine), holds reset for a few cycles, taps
+// the byte-wide UART write strobe inside frost (public_flat_rd signals — no
+// serial-line decoding), and echoes program output to stdout.  The program
+// image loads through the same $readmemh("sw.mem") / $readmemh("sw_ddr.mem")
+// path the cocotb flow uses, so the run directory must contain those files
+// (the Makefile's `run` target symlinks them from sw/apps/<APP>/).
+//
+// Pass/fail contract matches verif/cocotb_tests/test_real_program.py:
+//   exit 0  program printed "<<PASS>>"
+//   exit 1  program printed "<<FAIL>>" (or $finish without a marker)
+//   exit 2  cycle limit reached without either marker
+//
+// Usage: Vfrost [--max-cycles N] [--quiet]
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include <verilated.h>
+
+#include "Vfrost.h"
+#include "Vfrost___024root.h"
+
+namespace {
+
+constexpr uint64_t kDefaultMaxCycles = 15000000;  // CoreMark-class budget
+constexpr int kResetCycles = 20;
+
+const char kPassMarker[] = "<<PASS>>";
+const char kFailMarker[] = "<<FAIL>>";
+
+// Rolling tail of UART output, long enough to hold either marker.
+class MarkerScanner {
+ public:
+  void Push(char c) { tail_ += c; if (tail_.size() > 32) tail_.erase(0, tail_.size() - 32); }
+  bool Saw(const char* marker) const { return tail_.find(marker) != std::string::npos; }
+
+ private:
+  std::string tail_;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Verilated::commandArgs(argc, argv);
+
+  uint64_t max_cycles = kDefaultMaxCycles;
+  bool quiet = false;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--max-cycles") == 0 && i + 1 < argc) {
+      max_cycles = std::strtoull(argv[++i], nullptr, 0);
+    } else if (std::strcmp(argv[i], "--quiet") == 0) {
+      quiet = true;
+    }
+  }
+
+  auto* top = new Vfrost;
+
+  // Idle / tied-off inputs: no JTAG programming port activity, UART RX idle
+  // high, no external interrupt, external DDR AXI quiescent (the behavioral
+  // DDR model inside cpu_and_mem serves the cached tier in simulation).
+  top->i_rst_n = 0;
+  top->i_clk = 0;
+  top->i_clk_div4 = 0;
+  top->i_instr_mem_en = 0;
+  top->i_instr_mem_we = 0;
+  top->i_instr_mem_addr = 0;
+  top->i_instr_mem_wrdata = 0;
+  top->i_uart_rx = 1;
+  top->i_external_interrupt = 0;
+  top->i_ddr_axi_awready = 0;
+  top->i_ddr_axi_wready = 0;
+  top->i_ddr_axi_bvalid = 0;
+  top->i_ddr_axi_bresp = 0;
+  top->i_ddr_axi_arready = 0;
+  top->i_ddr_axi_rvalid = 0;
+  std::memset(top->i_ddr_axi_rdata.data(), 0, sizeof(top->i_ddr_axi_rdata));
+  top->i_ddr_axi_rresp = 0;
+  top->i_ddr_axi_rlast = 0;
+
+  MarkerScanner scanner;
+  uint64_t cycle = 0;
+  int div4_phase = 0;
+  int exit_code = 2;
+
+  while (cycle < max_cycles && !Verilated::gotFinish()) {
+    // Rising edge of i_clk; i_clk_div4 rises together with every 4th one.
+    top->i_clk = 1;
+    if (++div4_phase == 2) {
+      div4_phase = 0;
+      top->i_clk_div4 = !top->i_clk_div4;
+    }
+    top->eval();
+
+    // Falling edge.
+    top->i_clk = 0;
+    top->eval();
+
+    ++cycle;
+    if (cycle == kResetCycles) top->i_rst_n = 1;
+
+    if (top->rootp->frost__DOT__uart_write_enable_from_cpu) {
+      const char c = static_cast<char>(top->rootp->frost__DOT__uart_write_data_from_cpu);
+      if (!quiet) {
+        std::putchar(c);
+        std::fflush(stdout);
+      }
+      scanner.Push(c);
+      if (scanner.Saw(kPassMarker)) {
+        exit_code = 0;
+        break;
+      }
+      if (scanner.Saw(kFailMarker)) {
+        exit_code = 1;
+        break;
+      }
+    }
+  }
+
+  top->final();
+
+  if (exit_code == 0) {
+    std::fprintf(stderr, "\n[frost_sim] PASS after %llu cycles\n",
+                 static_cast<unsigned long long>(cycle));
+  } else if (exit_code == 1) {
+    std::fprintf(stderr, "\n[frost_sim] FAIL marker after %llu cycles\n",
+                 static_cast<unsigned long long>(cycle));
+  } else {
+    std::fprintf(stderr, "\n[frost_sim] no pass/fail marker within %llu cycles\n",
+                 static_cast<unsigned long long>(cycle));
+  }
+
+  delete top;
+  return exit_code;
+}
@@ -14,15 +14,59 @@
 #    See the License for the specific language governing permissions and
 #    limitations under the License.
 
-"""Build all software applications in the sw/apps directory."""
+"""Build all software applications in the sw/apps directory.
 
+Apps build in parallel (up to --jobs at a time); each app's output is
+captured and printed as it finishes so logs stay readable. The shared FROST
+library archive (sw/lib) is safe to build concurrently — its Makefile stages
+each archive privately and publishes it with an atomic rename — so no
+serialization is needed here.
+"""
+
+import argparse
+import os
 import subprocess
 import sys
+from concurrent.futures import ThreadPoolExecutor
 from pathlib import Path
 
 
+def build_app(app_dir: Path) -> tuple[str, bool, str]:
+    """Run 'make clean && make' in one app directory, capturing output."""
+    output_parts = []
+    ok = True
+    for command in (["make", "clean"], ["make"]):
+        result = subprocess.run(
+            command,
+            cwd=app_dir,
+            capture_output=True,
+            text=True,
+        )
+        output_parts.append(result.stdout + result.stderr)
+        if result.returncode != 0:
+            output_parts.append(
+                f"Error: '{' '.join(command)}' failed in {app_dir.name} "
+                f"(exit code {result.returncode})"
+            )
+            ok = False
+            break
+    return app_dir.name, ok, "".join(output_parts)
+
+
 def main() -> int:
-    """Build all applications by running 'make clean && make' in each subdirectory."""
+    """Build all applications, dispatching up to --jobs in parallel."""
+    parser = argparse.ArgumentParser(description="Build all FROST applications")
+    parser.add_argument(
+        "-j",
+        "--jobs",
+        type=int,
+        default=os.cpu_count() or 1,
+        help="Maximum concurrent app builds (default: CPU count)",
+    )
+    args = parser.parse_args()
+    if args.jobs < 1:
+        parser.error("--jobs must be at least 1")
+
     # Get the directory where this script lives (sw/apps)
     apps_dir = Path(__file__).parent.resolve()
 
@@ -37,22 +81,13 @@ def main() -> int:
     )
 
     failed = []
-    for app_dir in app_dirs:
-        print(f"Building in {app_dir.name}...")
-        try:
-            subprocess.run(
-                ["make", "clean"],
-                cwd=app_dir,
-                check=True,
-            )
-            subprocess.run(
-                ["make"],
-                cwd=app_dir,
-                check=True,
-            )
-        except subprocess.CalledProcessError as e:
-            print(f"Error: Build failed in {app_dir.name} (exit code {e.returncode})")
-            failed.append(app_dir.name)
+    with ThreadPoolExecutor(max_workers=args.jobs) as executor:
+        for name, ok, output in executor.map(build_app, app_dirs):
+            print(f"===== {name} =====")
+            if output:
+                print(output, end="" if output.endswith("\n") else "\n")
+            if not ok:
+                failed.append(name)
 
     if failed:
         print(f"\nFailed to build: {', '.join(failed)}")
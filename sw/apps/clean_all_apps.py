@@ -47,6 +47,20 @@ def main() -> int:
             print(f"Error: Clean failed in {app_dir.name} (exit code {e.returncode})")
             failed.append(app_dir.name)
 
+    # Also drop the shared FROST library archives (sw/lib/build)
+    lib_dir = apps_dir.parent / "lib"
+    print("Cleaning lib...")
+    try:
+        subprocess.run(
+            ["make", "clean"],
+            cwd=lib_dir,
+            check=True,
+            capture_output=True,
+        )
+    except subprocess.CalledProcessError as e:
+        print(f"Error: Clean failed in lib (exit code {e.returncode})")
+        failed.append("lib")
+
     if failed:
         print(f"\nFailed to clean: {', '.join(failed)}")
         return 1
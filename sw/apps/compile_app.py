@@ -37,6 +37,10 @@ APP_SIM_SETTINGS: dict[str, dict[str, str]] = {
         # Use low clock frequency so timing calculations don't overflow
         "FPGA_CPU_CLK_FREQ": "30000",
     },
+    "microbench": {
+        # Shrink footprints and iteration counts for simulation
+        "MICROBENCH_SIM": "1",
+    },
 }
 
 
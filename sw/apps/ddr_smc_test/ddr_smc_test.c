@@ -33,6 +33,13 @@
  * buffer, and only a correct sync chain makes the call return the new
  * constant instead of the cached old code.
  *
+ * Phase 2 alternates compressed and uncompressed encodings of the same
+ * function in the same buffer. The fetch path's predecode sideband
+ * (per-halfword is-compressed bits, recomputed by imem_predecode_line on
+ * every L1I fill) must track each rewrite: stale sideband paired with new
+ * code would misalign the RVC instruction stream even when the raw bytes
+ * are correct, which the 32-bit-only rounds can never detect.
+ *
  * Prints "<<PASS>>" if every call returns its round's constant.
  */
 
@@ -56,6 +63,15 @@ static void write_const_fn(uint32_t imm)
     __asm__ volatile("fence.i" ::: "memory");
 }
 
+/* Emit the compressed equivalent { c.li a0, imm; c.jr ra } (one 32-bit
+ * store: two RVC halfwords). imm must fit c.li's signed 6-bit immediate. */
+static void write_const_fn_rvc(uint32_t imm)
+{
+    uint32_t c_li = 0x4501u | ((imm & 0x1Fu) << 2) | (((imm >> 5) & 1u) << 12);
+    ddr_code[0] = (0x8082u << 16) | c_li; /* { c.jr ra, c.li a0, imm } */
+    __asm__ volatile("fence.i" ::: "memory");
+}
+
 int main(void)
 {
     static const uint32_t constants[] = {11, 0x2A, 0x355};
@@ -79,6 +95,31 @@ int main(void)
         }
     }
 
+    /* Phase 2: the same buffer flips between compressed and uncompressed
+     * encodings. Every rewrite after the first replaces a line whose old
+     * sideband claimed the opposite instruction widths, so a fill path that
+     * reused cached predecode instead of recomputing it would derail here. */
+    static const uint32_t rvc_constants[] = {7, 0x1F, 3};
+    for (int round = 0; round < 3; round++) {
+        uint32_t want = rvc_constants[round];
+        const_fn_t fn = (const_fn_t) (uintptr_t) &ddr_code[0];
+
+        write_const_fn_rvc(want);
+        int compressed = fn();
+        if (compressed != (int) want) {
+            uart_printf("FAIL: rvc round %d got %d want %d\n", round, compressed, (int) want);
+            failures++;
+        }
+
+        write_const_fn(want + 1);
+        int wide = fn();
+        if (wide != (int) (want + 1)) {
+            uart_printf("FAIL: rvc round %d wide got %d want %d\n", round, wide,
+                        (int) (want + 1));
+            failures++;
+        }
+    }
+
     if (failures == 0) {
         uart_printf("<<PASS>>\n");
     } else {
@@ -155,6 +155,111 @@ void vPortDebugRA(uint32_t ra)
     print_hex(ra);
 }
 
+/*-----------------------------------------------------------*/
+
+/* Lazy FP context switching
+ *
+ * Task stacks carry no FP state and the context switch path never touches
+ * the FP register file. Instead, each task's mstatus.FS rides in the saved
+ * mstatus word of its trap frame: new tasks start with FS = Off (see
+ * pxPortInitialiseStack), and the switch-in path in port_frost_asm.S
+ * (switched_in) clears FS in every incoming frame, so the hardware raises
+ * an illegal-instruction trap on the first FP instruction after any
+ * switch. vPortLazyFpTrap then migrates the live FP file between owners --
+ * a full 32 x double save/restore happens only when FPU ownership actually
+ * changes hands (an unmoved owner is re-granted in one trap with no
+ * save/restore), and integer-only tasks never pay for it at all.
+ *
+ * Limitation: FP context slots are never reclaimed, so at most
+ * configMAX_FP_TASKS distinct tasks may use the FPU over the lifetime of
+ * the scheduler (task deletion is not supported by this demo port).
+ */
+
+#ifndef configMAX_FP_TASKS
+#define configMAX_FP_TASKS 4
+#endif
+
+#define portMSTATUS_FS_MASK 0x00006000UL
+#define portMSTATUS_FS_DIRTY 0x00006000UL
+
+/* Layout shared with vPortSaveFpContext/vPortRestoreFpContext in
+ * port_frost_asm.S: 32 doubles then fcsr. */
+typedef struct {
+    uint64_t ullRegs[32];
+    uint32_t ulFcsr;
+    void *pvOwner;      /* TCB this slot belongs to (NULL = free) */
+    BaseType_t xSaved;  /* Slot holds a saved context (vs freshly granted) */
+} FpContext_t;
+
+static FpContext_t xFpContexts[configMAX_FP_TASKS];
+static void *pvFpOwner = NULL; /* Task whose FP state is live in the registers */
+
+extern void vPortSaveFpContext(FpContext_t *pxContext);
+extern void vPortRestoreFpContext(FpContext_t *pxContext);
+
+/* Find (or allocate) the FP context slot for a task. */
+static FpContext_t *prvFpContextFor(void *pvTask)
+{
+    FpContext_t *pxFree = NULL;
+    for (int i = 0; i < configMAX_FP_TASKS; i++) {
+        if (xFpContexts[i].pvOwner == pvTask) {
+            return &xFpContexts[i];
+        }
+        if (xFpContexts[i].pvOwner == NULL && pxFree == NULL) {
+            pxFree = &xFpContexts[i];
+        }
+    }
+    if (pxFree == NULL) {
+        /* Out of FP context slots - raise configMAX_FP_TASKS */
+        UART_TX = 'F';
+        UART_TX = '!';
+        for (;;) {
+        }
+    }
+    pxFree->pvOwner = pvTask;
+    pxFree->xSaved = pdFALSE;
+    return pxFree;
+}
+
+/* Called from the trap handler on an illegal-instruction exception with
+ * pulFrame pointing at the saved context (mstatus at word 29). Returns
+ * pdTRUE if this was an FP first-use fault and the FPU has been granted;
+ * the faulting instruction is then retried with FS = Dirty. */
+BaseType_t vPortLazyFpTrap(uint32_t *pulFrame)
+{
+    if ((pulFrame[29] & portMSTATUS_FS_MASK) != 0) {
+        /* FPU was already on: a genuinely illegal instruction */
+        return pdFALSE;
+    }
+
+    /* Enable the unit so our own save/restore instructions execute */
+    __asm volatile("csrs mstatus, %0" ::"r"(portMSTATUS_FS_DIRTY));
+
+    if (pvFpOwner != pxCurrentTCB) {
+        if (pvFpOwner != NULL) {
+            FpContext_t *pxOld = prvFpContextFor(pvFpOwner);
+            vPortSaveFpContext(pxOld);
+            pxOld->xSaved = pdTRUE;
+        }
+        FpContext_t *pxNew = prvFpContextFor(pxCurrentTCB);
+        if (pxNew->xSaved != pdFALSE) {
+            vPortRestoreFpContext(pxNew);
+        }
+        /* else: first FP use ever for this task - register values are
+         * architecturally undefined, no restore needed */
+        pvFpOwner = pxCurrentTCB;
+    }
+
+    /* Resume the task with the FPU on. FS stays Dirty in its frame only
+     * until the next context switch: the switch-in path clears it, so the
+     * task re-traps here after every switch and the ownership check above
+     * decides whether anything actually needs migrating. */
+    pulFrame[29] |= portMSTATUS_FS_DIRTY;
+    return pdTRUE;
+}
+
+/*-----------------------------------------------------------*/
+
 /* Timer interrupt handler - called from trap handler */
 void vPortTimerTickHandler(void)
 {
@@ -237,8 +342,10 @@ pxPortInitialiseStack(StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pv
     pxTopOfStack--;
     *pxTopOfStack = 0; /* uxCriticalNesting at offset 30*4 */
 
-    /* Initial mstatus: MPIE=1, MPP=11 (M-mode), MIE=0
-     * When MRET executes, it will set MIE from MPIE (enabling interrupts) */
+    /* Initial mstatus: MPIE=1, MPP=11 (M-mode), MIE=0, FS=00 (Off)
+     * When MRET executes, it will set MIE from MPIE (enabling interrupts).
+     * FS = Off means the task's first FP instruction traps into
+     * vPortLazyFpTrap, which grants the FPU lazily. */
     pxTopOfStack--;
     *pxTopOfStack = 0x00001880; /* mstatus at offset 29*4 */
 
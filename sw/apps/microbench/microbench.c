@@ -0,0 +1,475 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * Microbenchmark Suite
+ *
+ * Fixed kernels measuring the core's fundamental latencies and throughputs,
+ * reported as one machine-readable CSV block over UART for per-commit
+ * performance regression tracking (parsed by software_registry.py's
+ * parse_microbench_csv). Human-readable commentary goes before the block;
+ * nothing but CSV rows between the <<CSV_BEGIN>> and <<CSV_END>> markers.
+ *
+ * Kernels:
+ *   1. Load latency   - dependent pointer chase over a random cyclic
+ *                       permutation (line-spaced slots, so the next-line
+ *                       prefetchers cannot help) at four footprints: the low
+ *                       BRAM tier, and cached-region buffers sized to hit in
+ *                       L1, in L2 (where present; DDR on boards without one),
+ *                       and in DDR.
+ *   2. Branch cost    - the same branchy loop over an always-taken pattern
+ *                       and an LCG-random pattern; the delta estimates the
+ *                       mispredict penalty (random is ~50% mispredicted).
+ *   3. FU throughput  - .rept blocks of independent ADD/MUL/FADD.D/FMUL.D
+ *                       and same-address loads/stores, reported as
+ *                       operations per 100 cycles.
+ *   4. memcpy         - lib memcpy bandwidth over BRAM and DDR buffers.
+ *   5. Context switch - ecall trap round trip, and a cooperative two-stack
+ *                       switch saving/restoring the full callee-saved
+ *                       integer state (ra + s0-s11), like an RTOS yield.
+ *
+ * All values are integers; latencies are reported x100 so sub-cycle changes
+ * are visible without floating point.
+ */
+
+#include "csr.h"
+#include "memory.h"
+#include "string.h"
+#include "trap.h"
+#include "uart.h"
+#include <stdint.h>
+
+#ifndef MICROBENCH_SIM
+#define MICROBENCH_SIM 0
+#endif
+
+/* Footprints and iteration counts. Simulation shrinks both so cocotb runs
+ * finish quickly; the tiers each footprint exercises are unchanged except
+ * that the sim "l2"/"ddr" buffers are only big enough to spill the level
+ * above, not to look like the hardware working sets. */
+#if MICROBENCH_SIM
+#define BRAM_CHASE_BYTES (4 * 1024)
+#define L1_CHASE_BYTES (16 * 1024)
+#define L2_CHASE_BYTES (64 * 1024)
+#define DDR_CHASE_BYTES (256 * 1024)
+#define CHASE_LOADS 2000u
+#define BRANCH_REPS 4u
+#define FU_REPS 32u
+#define MEMCPY_BRAM_REPS 8u
+#define MEMCPY_DDR_BYTES (32 * 1024)
+#define TRAP_REPS 64u
+#define CTX_REPS 64u
+#else
+#define BRAM_CHASE_BYTES (16 * 1024)
+#define L1_CHASE_BYTES (64 * 1024)
+#define L2_CHASE_BYTES (1024 * 1024)
+#define DDR_CHASE_BYTES (16 * 1024 * 1024)
+#define CHASE_LOADS 100000u
+#define BRANCH_REPS 64u
+#define FU_REPS 1024u
+#define MEMCPY_BRAM_REPS 64u
+#define MEMCPY_DDR_BYTES (256 * 1024)
+#define TRAP_REPS 1024u
+#define CTX_REPS 1024u
+#endif
+
+/* Chase slots are one per 64 bytes: two cache lines apart, so neither the
+ * L1 nor the shared-level next-line prefetcher can cover the next hop. */
+#define CHASE_STRIDE_WORDS 16u
+
+/* Static buffers land in the low BRAM tier under MEM_CONFIG=bram (today's
+ * default); under the ddr config the whole program is cached-region, and the
+ * "bram" rows simply measure that placement instead. */
+static uint32_t bram_chase[BRAM_CHASE_BYTES / 4];
+static uint32_t branch_pattern[4096];
+static uint32_t bram_copy_src[2048];
+static uint32_t bram_copy_dst[2048];
+
+static uint32_t lcg_state = 0x12345678u;
+
+static uint32_t lcg_next(void)
+{
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state;
+}
+
+/* ========================================================================== */
+/* CSV output                                                                 */
+/* ========================================================================== */
+
+static void csv_row(const char *benchmark, const char *metric, uint32_t value)
+{
+    uart_printf("%s,%s,%lu\n", benchmark, metric, (unsigned long) value);
+}
+
+/* ========================================================================== */
+/* 1. Load latency: dependent pointer chase                                   */
+/* ========================================================================== */
+
+/* Link the line-spaced slots of buf into one random cycle (Sattolo's
+ * algorithm), so every load depends on the previous one and the visit order
+ * defeats the next-line prefetchers. Each slot holds the address of its
+ * successor slot. */
+static void build_chase(uint32_t *buf, uint32_t bytes)
+{
+    uint32_t slots = bytes / (CHASE_STRIDE_WORDS * 4);
+    /* perm[i] = slot visited after perm's position i; start as identity. */
+    for (uint32_t i = 0; i < slots; i++) {
+        buf[i * CHASE_STRIDE_WORDS] = i;
+    }
+    /* Sattolo: single-cycle permutation of the slot indices. */
+    for (uint32_t i = slots - 1; i > 0; i--) {
+        uint32_t j = lcg_next() % i;
+        uint32_t tmp = buf[i * CHASE_STRIDE_WORDS];
+        buf[i * CHASE_STRIDE_WORDS] = buf[j * CHASE_STRIDE_WORDS];
+        buf[j * CHASE_STRIDE_WORDS] = tmp;
+    }
+    /* Replace successor indices with successor addresses. */
+    for (uint32_t i = 0; i < slots; i++) {
+        uint32_t next = buf[i * CHASE_STRIDE_WORDS];
+        buf[i * CHASE_STRIDE_WORDS] = (uint32_t) &buf[next * CHASE_STRIDE_WORDS];
+    }
+}
+
+/* Chase loads pointers through the cycle; returns cycles per load x100.
+ * One full warm-up traversal first so the timed pass measures steady state
+ * (footprints larger than a level keep missing it by construction). */
+static uint32_t bench_load_latency(uint32_t *buf, uint32_t bytes)
+{
+    uint32_t slots = bytes / (CHASE_STRIDE_WORDS * 4);
+    volatile uint32_t *p = (volatile uint32_t *) buf;
+
+    build_chase(buf, bytes);
+    for (uint32_t i = 0; i < slots; i++) {
+        p = (volatile uint32_t *) *p;
+    }
+
+    uint32_t c0 = rdcycle();
+    for (uint32_t i = 0; i < CHASE_LOADS; i++) {
+        p = (volatile uint32_t *) *p;
+    }
+    uint32_t cycles = rdcycle() - c0;
+
+    /* Keep the chase result live so the loop cannot be dead-code eliminated. */
+    __asm__ volatile("" ::"r"(p));
+    return (uint32_t) (((uint64_t) cycles * 100) / CHASE_LOADS);
+}
+
+/* ========================================================================== */
+/* 2. Branch cost                                                             */
+/* ========================================================================== */
+
+/* One data-dependent branch per element, in asm so the compiler cannot turn
+ * it branchless (the march includes Zicond). The loop's own back-edge branch
+ * is near-perfectly predicted and contributes equally to both patterns.
+ * Returns cycles per element x100. */
+static uint32_t bench_branches(const uint32_t *pattern, uint32_t n)
+{
+    uint32_t acc = 0;
+    uint32_t c0 = rdcycle();
+    for (uint32_t r = 0; r < BRANCH_REPS; r++) {
+        const uint32_t *p = pattern;
+        const uint32_t *end = pattern + n;
+        uint32_t a = acc;
+        __asm__ volatile("1:\n"
+                         "lw   t0, 0(%[p])\n"
+                         "addi %[p], %[p], 4\n"
+                         "beqz t0, 2f\n"
+                         "addi %[a], %[a], 1\n"
+                         "2:\n"
+                         "bltu %[p], %[end], 1b\n"
+                         : [p] "+r"(p), [a] "+r"(a)
+                         : [end] "r"(end)
+                         : "t0", "memory");
+        acc = a;
+    }
+    uint32_t cycles = rdcycle() - c0;
+    __asm__ volatile("" ::"r"(acc));
+    return (uint32_t) (((uint64_t) cycles * 100) / ((uint64_t) n * BRANCH_REPS));
+}
+
+/* ========================================================================== */
+/* 3. Functional unit throughput                                              */
+/* ========================================================================== */
+
+/* Each kernel retires 64 independent operations per iteration (all write the
+ * same destination, so rename breaks every dependence). Returns operations
+ * per 100 cycles. */
+#define FU_BENCH(name, body)                                                                       \
+    static uint32_t name(void)                                                                     \
+    {                                                                                              \
+        uint32_t c0 = rdcycle();                                                                   \
+        for (uint32_t r = 0; r < FU_REPS; r++) {                                                   \
+            body;                                                                                  \
+        }                                                                                          \
+        uint32_t cycles = rdcycle() - c0;                                                          \
+        return (uint32_t) (((uint64_t) FU_REPS * 64 * 100) / cycles);                              \
+    }
+
+FU_BENCH(bench_fu_add, {
+    uint32_t d;
+    __asm__ volatile(".rept 64\n"
+                     "add %[d], %[a], %[b]\n"
+                     ".endr\n"
+                     : [d] "=r"(d)
+                     : [a] "r"(r), [b] "r"(c0));
+    (void) d;
+})
+
+FU_BENCH(bench_fu_mul, {
+    uint32_t d;
+    __asm__ volatile(".rept 64\n"
+                     "mul %[d], %[a], %[b]\n"
+                     ".endr\n"
+                     : [d] "=r"(d)
+                     : [a] "r"(r), [b] "r"(c0));
+    (void) d;
+})
+
+FU_BENCH(bench_fu_fadd_d, {
+    double d;
+    __asm__ volatile(".rept 64\n"
+                     "fadd.d %[d], %[a], %[b]\n"
+                     ".endr\n"
+                     : [d] "=f"(d)
+                     : [a] "f"(1.5), [b] "f"(2.5));
+    (void) d;
+})
+
+FU_BENCH(bench_fu_fmul_d, {
+    double d;
+    __asm__ volatile(".rept 64\n"
+                     "fmul.d %[d], %[a], %[b]\n"
+                     ".endr\n"
+                     : [d] "=f"(d)
+                     : [a] "f"(1.5), [b] "f"(2.5));
+    (void) d;
+})
+
+FU_BENCH(bench_fu_load, {
+    uint32_t d;
+    __asm__ volatile(".rept 64\n"
+                     "lw %[d], 0(%[base])\n"
+                     ".endr\n"
+                     : [d] "=r"(d)
+                     : [base] "r"(bram_chase)
+                     : "memory");
+})
+
+FU_BENCH(bench_fu_store, {
+    __asm__ volatile(".rept 64\n"
+                     "sw %[v], 0(%[base])\n"
+                     ".endr\n" ::[v] "r"(r),
+                     [base] "r"(bram_chase)
+                     : "memory");
+})
+
+/* ========================================================================== */
+/* 4. memcpy bandwidth                                                        */
+/* ========================================================================== */
+
+/* Returns bytes moved per 1000 cycles. */
+static uint32_t bench_memcpy(uint32_t *dst, const uint32_t *src, uint32_t bytes, uint32_t reps)
+{
+    memcpy(dst, src, bytes); /* warm up */
+    uint32_t c0 = rdcycle();
+    for (uint32_t r = 0; r < reps; r++) {
+        memcpy(dst, src, bytes);
+    }
+    uint32_t cycles = rdcycle() - c0;
+    return (uint32_t) (((uint64_t) bytes * reps * 1000) / cycles);
+}
+
+/* ========================================================================== */
+/* 5. Trap round trip and cooperative context switch                          */
+/* ========================================================================== */
+
+/* Minimal ecall handler: skip the ecall and return. Clobbers only t0, which
+ * the measurement loop declares. */
+__asm__(".text\n"
+        ".align 2\n"
+        "mb_ecall_handler:\n"
+        "csrr t0, mepc\n"
+        "addi t0, t0, 4\n"
+        "csrw mepc, t0\n"
+        "mret\n");
+void mb_ecall_handler(void);
+
+/* Cooperative switch: save ra + s0-s11 on the current stack, publish sp to
+ * *a0, load the next context's sp from *a1, restore, return -- the integer
+ * half of an RTOS yield. The 64-byte frame keeps sp 16-byte aligned. */
+__asm__(".text\n"
+        ".align 2\n"
+        "mb_ctx_switch:\n"
+        "addi sp, sp, -64\n"
+        "sw   ra, 0(sp)\n"
+        "sw   s0, 4(sp)\n"
+        "sw   s1, 8(sp)\n"
+        "sw   s2, 12(sp)\n"
+        "sw   s3, 16(sp)\n"
+        "sw   s4, 20(sp)\n"
+        "sw   s5, 24(sp)\n"
+        "sw   s6, 28(sp)\n"
+        "sw   s7, 32(sp)\n"
+        "sw   s8, 36(sp)\n"
+        "sw   s9, 40(sp)\n"
+        "sw   s10, 44(sp)\n"
+        "sw   s11, 48(sp)\n"
+        "sw   sp, 0(a0)\n"
+        "lw   sp, 0(a1)\n"
+        "lw   ra, 0(sp)\n"
+        "lw   s0, 4(sp)\n"
+        "lw   s1, 8(sp)\n"
+        "lw   s2, 12(sp)\n"
+        "lw   s3, 16(sp)\n"
+        "lw   s4, 20(sp)\n"
+        "lw   s5, 24(sp)\n"
+        "lw   s6, 28(sp)\n"
+        "lw   s7, 32(sp)\n"
+        "lw   s8, 36(sp)\n"
+        "lw   s9, 40(sp)\n"
+        "lw   s10, 44(sp)\n"
+        "lw   s11, 48(sp)\n"
+        "addi sp, sp, 64\n"
+        "ret\n");
+void mb_ctx_switch(volatile uint32_t *save_sp, volatile uint32_t *load_sp);
+
+static uint32_t task_stack[512] __attribute__((aligned(16)));
+static volatile uint32_t main_sp;
+static volatile uint32_t task_sp;
+
+static void bounce_task(void)
+{
+    for (;;) {
+        mb_ctx_switch(&task_sp, &main_sp);
+    }
+}
+
+static uint32_t bench_trap_roundtrip(void)
+{
+    set_trap_handler(mb_ecall_handler);
+    __asm__ volatile("ecall" ::: "t0"); /* warm up */
+    uint32_t c0 = rdcycle();
+    for (uint32_t r = 0; r < TRAP_REPS; r++) {
+        __asm__ volatile("ecall" ::: "t0");
+    }
+    uint32_t cycles = rdcycle() - c0;
+    return (uint32_t) (((uint64_t) cycles * 100) / TRAP_REPS);
+}
+
+static uint32_t bench_context_switch(void)
+{
+    /* Hand-build bounce_task's initial frame: a saved context whose restore
+     * "returns" into the task's entry point. */
+    uint32_t *frame = &task_stack[512] - 16; /* 64-byte frame */
+    frame[0] = (uint32_t) bounce_task;       /* ra slot */
+    task_sp = (uint32_t) frame;
+
+    mb_ctx_switch(&main_sp, &task_sp); /* warm up one round trip */
+    uint32_t c0 = rdcycle();
+    for (uint32_t r = 0; r < CTX_REPS; r++) {
+        mb_ctx_switch(&main_sp, &task_sp);
+    }
+    uint32_t cycles = rdcycle() - c0;
+    /* Each iteration is two switches: out to the task and back. */
+    return (uint32_t) (((uint64_t) cycles * 100) / ((uint64_t) CTX_REPS * 2));
+}
+
+/* ========================================================================== */
+
+int main(void)
+{
+    uart_printf("\n");
+    uart_printf("============================================================\n");
+    uart_printf("     MICROBENCHMARK SUITE\n");
+    uart_printf("============================================================\n");
+    uart_printf("  Footprints: bram %luK  l1 %luK  l2 %luK  ddr %luK%s\n\n",
+                (unsigned long) (BRAM_CHASE_BYTES / 1024),
+                (unsigned long) (L1_CHASE_BYTES / 1024),
+                (unsigned long) (L2_CHASE_BYTES / 1024),
+                (unsigned long) (DDR_CHASE_BYTES / 1024),
+                MICROBENCH_SIM ? "  (sim sizes)" : "");
+
+    /* The l1/l2/ddr chase buffers live in the cached DDR region (the heap),
+     * so each is served by the shallowest level it fits in. */
+    uint32_t *l1_buf = malloc(L1_CHASE_BYTES);
+    uint32_t *l2_buf = malloc(L2_CHASE_BYTES);
+    uint32_t *ddr_buf = malloc(DDR_CHASE_BYTES);
+    uint32_t *ddr_copy = malloc(2 * MEMCPY_DDR_BYTES);
+    if (!l1_buf || !l2_buf || !ddr_buf || !ddr_copy) {
+        uart_printf("malloc failed\n");
+        uart_printf("<<FAIL>>\n");
+        return 1;
+    }
+
+    uint32_t lat_bram = bench_load_latency(bram_chase, BRAM_CHASE_BYTES);
+    uint32_t lat_l1 = bench_load_latency(l1_buf, L1_CHASE_BYTES);
+    uint32_t lat_l2 = bench_load_latency(l2_buf, L2_CHASE_BYTES);
+    uint32_t lat_ddr = bench_load_latency(ddr_buf, DDR_CHASE_BYTES);
+
+    for (uint32_t i = 0; i < 4096; i++) {
+        branch_pattern[i] = 1;
+    }
+    uint32_t br_pred = bench_branches(branch_pattern, 4096);
+    for (uint32_t i = 0; i < 4096; i++) {
+        branch_pattern[i] = lcg_next() & 1;
+    }
+    uint32_t br_rand = bench_branches(branch_pattern, 4096);
+    /* Random is mispredicted on ~half the elements, so the penalty is about
+     * twice the per-element delta. An estimate, not a direct measurement. */
+    uint32_t br_penalty = (br_rand > br_pred) ? 2 * (br_rand - br_pred) : 0;
+
+    uint32_t fu_add = bench_fu_add();
+    uint32_t fu_mul = bench_fu_mul();
+    uint32_t fu_fadd = bench_fu_fadd_d();
+    uint32_t fu_fmul = bench_fu_fmul_d();
+    uint32_t fu_load = bench_fu_load();
+    uint32_t fu_store = bench_fu_store();
+
+    for (uint32_t i = 0; i < 2048; i++) {
+        bram_copy_src[i] = lcg_next();
+    }
+    uint32_t cp_bram =
+        bench_memcpy(bram_copy_dst, bram_copy_src, sizeof(bram_copy_src), MEMCPY_BRAM_REPS);
+    uint32_t cp_ddr = bench_memcpy(ddr_copy, ddr_copy + MEMCPY_DDR_BYTES / 4, MEMCPY_DDR_BYTES, 4);
+
+    uint32_t trap_rt = bench_trap_roundtrip();
+    uint32_t ctx_sw = bench_context_switch();
+
+    uart_printf("<<CSV_BEGIN>>\n");
+    uart_printf("benchmark,metric,value\n");
+    csv_row("load_latency_bram", "cycles_per_load_x100", lat_bram);
+    csv_row("load_latency_l1", "cycles_per_load_x100", lat_l1);
+    csv_row("load_latency_l2", "cycles_per_load_x100", lat_l2);
+    csv_row("load_latency_ddr", "cycles_per_load_x100", lat_ddr);
+    csv_row("branch_predictable", "cycles_per_branch_x100", br_pred);
+    csv_row("branch_random", "cycles_per_branch_x100", br_rand);
+    csv_row("branch_mispredict", "penalty_cycles_x100", br_penalty);
+    csv_row("fu_add", "ops_per_100_cycles", fu_add);
+    csv_row("fu_mul", "ops_per_100_cycles", fu_mul);
+    csv_row("fu_fadd_d", "ops_per_100_cycles", fu_fadd);
+    csv_row("fu_fmul_d", "ops_per_100_cycles", fu_fmul);
+    csv_row("fu_load", "ops_per_100_cycles", fu_load);
+    csv_row("fu_store", "ops_per_100_cycles", fu_store);
+    csv_row("memcpy_bram", "bytes_per_kcycle", cp_bram);
+    csv_row("memcpy_ddr", "bytes_per_kcycle", cp_ddr);
+    csv_row("trap_roundtrip", "cycles_x100", trap_rt);
+    csv_row("context_switch", "cycles_x100", ctx_sw);
+    uart_printf("<<CSV_END>>\n");
+
+    uart_printf("<<PASS>>\n");
+    return 0;
+}
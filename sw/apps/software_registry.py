@@ -201,3 +201,45 @@ def coremark_pro_make_vars(
     if hardware:
         make_vars["COREMARK_PRO_OFFICIAL"] = "1"
     return make_vars
+
+
+# =============================================================================
+# Microbenchmark suite (sw/apps/microbench)
+# =============================================================================
+
+MICROBENCH_APP_NAME = "microbench"
+MICROBENCH_CSV_BEGIN = "<<CSV_BEGIN>>"
+MICROBENCH_CSV_END = "<<CSV_END>>"
+
+
+def parse_microbench_csv(uart_text: str) -> dict[str, int]:
+    """Parse the microbench CSV block out of captured UART output.
+
+    The suite prints one ``benchmark,metric,value`` block between the
+    MICROBENCH_CSV_BEGIN and MICROBENCH_CSV_END markers. Returns a mapping
+    from ``benchmark.metric`` to its integer value, so regression trackers
+    can diff runs without caring about row order.
+
+    >>> parse_microbench_csv(
+    ...     "noise\\n<<CSV_BEGIN>>\\nbenchmark,metric,value\\n"
+    ...     "fu_add,ops_per_100_cycles,312\\n<<CSV_END>>\\n<<PASS>>\\n"
+    ... )
+    {'fu_add.ops_per_100_cycles': 312}
+    >>> parse_microbench_csv("no block here")
+    Traceback (most recent call last):
+        ...
+    ValueError: no microbench CSV block found in UART output
+    """
+    try:
+        block = uart_text.split(MICROBENCH_CSV_BEGIN, 1)[1]
+        block = block.split(MICROBENCH_CSV_END, 1)[0]
+    except IndexError:
+        raise ValueError("no microbench CSV block found in UART output") from None
+
+    results: dict[str, int] = {}
+    for line in block.strip().splitlines():
+        benchmark, metric, value = line.strip().split(",")
+        if benchmark == "benchmark":  # header row
+            continue
+        results[f"{benchmark}.{metric}"] = int(value)
+    return results
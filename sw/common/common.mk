@@ -43,6 +43,18 @@ UNROLL_LOOPS ?= -funroll-loops
 # Some apps (e.g., coremark) may prefer ilp32f for better performance
 MABI ?= ilp32d
 
+# Link-time optimization (opt-in: set USE_LTO=1 before including common.mk or
+# on the make command line). Enables cross-module inlining -- uart_printf and
+# the fix.c helpers inline into their callers -- which is unreachable with
+# per-translation-unit compilation. Off by default so the microarchitectural
+# test apps keep their deliberate call/branch structure.
+USE_LTO ?= 0
+ifeq ($(USE_LTO),1)
+LTO_FLAGS := -flto=auto
+else
+LTO_FLAGS :=
+endif
+
 # RISC-V compilation flags
 #
 # Architecture flags (-march, -mabi):
@@ -92,7 +104,7 @@ RISCV_FLAGS  = -march=rv32imafdc_zicsr_zicntr_zifencei_zba_zbb_zbs_zicond_zbkb_z
                -nostdlib -nostartfiles -ffreestanding \
                -fno-unwind-tables -fno-asynchronous-unwind-tables \
                -ffunction-sections -fdata-sections \
-               $(OPT_LEVEL) $(UNROLL_LOOPS) -fno-strict-aliasing
+               $(OPT_LEVEL) $(UNROLL_LOOPS) -fno-strict-aliasing $(LTO_FLAGS)
 
 # Memory configuration -- selects the linker + image split (apps/CI pass this via
 # MEM_CONFIG):
@@ -130,6 +142,39 @@ CFLAGS += '-DCOMPILER_VERSION="$(COMPILER_VERSION)"' \
           '-DFPGA_CPU_CLK_FREQ=$(FPGA_CPU_CLK_FREQ)' \
           $(EXTRA_CFLAGS)
 
+# Shared FROST library archive -- library sources listed in SRC_C
+# (../../lib/src/*.c) are no longer recompiled per app: they link from a
+# static archive built once by sw/lib/Makefile and shared by every app with
+# the same library-relevant flags. The variant name hashes those flags (POSIX
+# cksum plus readable ABI/LTO markers), so apps with special defines (e.g.
+# coremark's UART_PRINTF_ENABLE_FLOAT) get their own archive while the common
+# case builds exactly once. Set USE_LIB_ARCHIVE=0 to fall back to compiling
+# the library sources directly into the app.
+USE_LIB_ARCHIVE ?= 1
+
+FROST_LIB_DIR := ../../lib
+LIB_SRC_C := $(filter $(FROST_LIB_DIR)/src/%,$(SRC_C))
+APP_SRC_C := $(filter-out $(FROST_LIB_DIR)/src/%,$(SRC_C))
+
+ifeq ($(USE_LIB_ARCHIVE),1)
+ifneq ($(LIB_SRC_C),)
+# Only flags that affect library code go in: no -I. or other app-relative
+# paths, so the variant (and archive) is shared across app directories.
+LIB_CFLAGS := $(RISCV_FLAGS) -I$(abspath $(FROST_LIB_DIR)/include) \
+              '-DFPGA_CPU_CLK_FREQ=$(FPGA_CPU_CLK_FREQ)' $(EXTRA_CFLAGS)
+LIB_VARIANT := $(MABI)$(if $(LTO_FLAGS),_lto)_$(firstword $(shell printf '%s' "$(LIB_CFLAGS)" | cksum))
+LIB_ARCHIVE := $(FROST_LIB_DIR)/build/$(LIB_VARIANT)/libfrost.a
+LIB_LINK_INPUTS := $(LIB_ARCHIVE)
+
+$(LIB_ARCHIVE): $(wildcard $(FROST_LIB_DIR)/src/*.c) $(wildcard $(FROST_LIB_DIR)/include/*.h)
+	+$(MAKE) -C $(FROST_LIB_DIR) archive LIB_VARIANT=$(LIB_VARIANT) LIB_CFLAGS="$(LIB_CFLAGS)"
+else
+LIB_LINK_INPUTS :=
+endif
+else
+LIB_LINK_INPUTS := $(LIB_SRC_C)
+endif
+
 # Assembly startup code (initializes stack, zeroes BSS, calls main)
 ASSEMBLY_STARTUP_FILE := ../../common/crt0.S
 
@@ -159,9 +204,11 @@ endif
 all: $(EXECUTABLE_ELF_FILE) $(VERILOG_HEX_FILE) $(RAW_BINARY_FILE) $(VIVADO_BRAM_FILE) $(DDR_HEX_FILE) \
      $(DDR_TXT_FILE) $(DISASSEMBLY_FILE) $(IMEM_INIT_TARGETS)
 
-# Link C sources and assembly startup into ELF executable
-$(EXECUTABLE_ELF_FILE): $(SRC_C) $(DDR_BOOT_STUB) $(ASSEMBLY_STARTUP_FILE) $(EXTRA_ASM_SRC) $(LINKER_SCRIPT)
-	$(CC) $(CFLAGS) $(DDR_BOOT_STUB) $(ASSEMBLY_STARTUP_FILE) $(EXTRA_ASM_SRC) $(SRC_C) $(LDFLAGS) -o $@
+# Link C sources and assembly startup into ELF executable. Library code comes
+# from the shared archive (placed after the app sources so the linker only
+# pulls the members the app references).
+$(EXECUTABLE_ELF_FILE): $(APP_SRC_C) $(LIB_LINK_INPUTS) $(DDR_BOOT_STUB) $(ASSEMBLY_STARTUP_FILE) $(EXTRA_ASM_SRC) $(LINKER_SCRIPT)
+	$(CC) $(CFLAGS) $(DDR_BOOT_STUB) $(ASSEMBLY_STARTUP_FILE) $(EXTRA_ASM_SRC) $(APP_SRC_C) $(LIB_LINK_INPUTS) $(LDFLAGS) -o $@
 
 # Generate disassembly listing for debugging
 $(DISASSEMBLY_FILE): $(EXECUTABLE_ELF_FILE)
@@ -35,6 +35,9 @@ OPC_FMSUB = 0b1000111
 OPC_FNMSUB = 0b1001011
 OPC_FNMADD = 0b1001111
 OPC_OP_FP = 0b1010011
+OPC_BRANCH = 0b1100011
+OPC_JAL = 0b1101111
+OPC_JALR = 0b1100111
 SIDEBAND_WIDTH = 12
 
 
@@ -72,6 +75,11 @@ def compressed_control(parcel: int) -> bool:
     )
 
 
+def native_control(opcode: int) -> bool:
+    """Return whether a native instruction opcode is control flow."""
+    return opcode in {OPC_BRANCH, OPC_JAL, OPC_JALR}
+
+
 def native_serialize(opcode: int) -> bool:
     """Return whether a native instruction opcode must serialize dispatch."""
     return opcode in {OPC_CSR, OPC_MISC_MEM, OPC_AMO}
@@ -106,9 +114,15 @@ def make_sideband(word: int) -> int:
         sideband |= 1 << 6
     if native_fp_compute(opcode_hi):
         sideband |= 1 << 7
-    if (sideband & (1 << 0)) and not (sideband & (1 << 2)):
+    if sideband & (1 << 0):
+        if not (sideband & (1 << 2)):
+            sideband |= 1 << 8
+    elif not (native_control(opcode_lo) or (sideband & ((1 << 4) | (1 << 6)))):
         sideband |= 1 << 8
-    if (sideband & (1 << 1)) and not (sideband & (1 << 3)):
+    if sideband & (1 << 1):
+        if not (sideband & (1 << 3)):
+            sideband |= 1 << 9
+    elif not (native_control(opcode_hi) or (sideband & ((1 << 5) | (1 << 7)))):
         sideband |= 1 << 9
     if (sideband & (1 << 0)) or not (sideband & ((1 << 4) | (1 << 6))):
         sideband |= 1 << 10
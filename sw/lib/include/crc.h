@@ -0,0 +1,80 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#ifndef CRC_H
+#define CRC_H
+
+#include "mmio.h"
+#include <stdint.h>
+
+/* Intrinsics for the hardware CRC-32 accumulator (hw/rtl/peripherals/
+ * crc32_unit.sv). The unit folds one word (or byte) of store data into a
+ * running reflected IEEE CRC-32 per MMIO write, replacing the ~8 instructions
+ * per byte of a table-free software loop. Results match zlib's crc32().
+ *
+ * Streaming use:
+ *
+ *   crc32_begin();
+ *   crc32_feed_word(header);
+ *   crc32_feed_byte(flags);
+ *   uint32_t crc = crc32_end();
+ *
+ * or one call for a buffer:
+ *
+ *   uint32_t crc = crc32_buf(packet, length);
+ *
+ * The accumulator is a single shared register: do not interleave two
+ * checksums, and on dual-core builds guard it with the hardware mutex like
+ * the other stateful peripherals. */
+
+/* Seed the accumulator for a fresh CRC-32 (state = ~0). */
+static inline void crc32_begin(void)
+{
+    CRC_STATE = 0xFFFFFFFFu;
+}
+
+/* Fold 4 bytes into the running CRC, low byte first (little-endian order,
+ * so feeding words over a byte stream matches feeding the bytes). */
+static inline void crc32_feed_word(uint32_t word)
+{
+    CRC_DATA_WORD = word;
+}
+
+/* Fold a single byte into the running CRC. */
+static inline void crc32_feed_byte(uint8_t byte)
+{
+    CRC_DATA_BYTE = byte;
+}
+
+/* Finalize and return the CRC-32 of everything fed since crc32_begin().
+ * Non-destructive: more data may still be fed afterwards. */
+static inline uint32_t crc32_end(void)
+{
+    return ~CRC_STATE;
+}
+
+/* Resume a previously finalized CRC (inverse of crc32_end), for checksums
+ * built up across scattered buffers. */
+static inline void crc32_resume(uint32_t crc)
+{
+    CRC_STATE = ~crc;
+}
+
+/* CRC-32 of a buffer in one call: begin, feed (word-at-a-time over the
+ * aligned middle, bytes at the edges), end. */
+uint32_t crc32_buf(const void *data, uint32_t length);
+
+#endif /* CRC_H */
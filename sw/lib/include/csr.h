@@ -84,6 +84,22 @@
 #define CSR_MPERFDATAH 0xFC1 /* Selected profiling counter high 32 bits */
 #define CSR_MPERFCOUNT 0xFC2 /* Number of implemented profiling counters */
 
+/* ========================================================================== */
+/* Hardware performance monitor (programmable event counters)                 */
+/* ========================================================================== */
+/* mhpmcounter3..6 count one of the top-level profiling events, selected at
+ * run time through mhpmevent3..6. Event numbering is the MPERF top-level
+ * counter index + 1 (see tomasulo_profile.h); 0 parks the counter. */
+#define CSR_MHPMCOUNTER3 0xB03  /* First programmable counter (low 32 bits) */
+#define CSR_MHPMCOUNTER3H 0xB83 /* First programmable counter (high 32 bits) */
+#define CSR_MHPMEVENT3 0x323    /* First event selector */
+#define CSR_HPM_COUNTER_COUNT 4 /* mhpmcounter3..6 implemented */
+
+/* mhpmevent field layout */
+#define HPM_EVENT_SEL(ev) (((uint32_t) (ev) + 1U) & 0xFFU) /* MPERF index -> EVENT field */
+#define HPM_EVENT_EDGE (1U << 8)            /* Count 0->1 transitions, not cycles */
+#define HPM_EVENT_THRESH(n) (((uint32_t) (n) & 0xFFU) << 9) /* Min consecutive cycles */
+
 /* ========================================================================== */
 /* mstatus bit definitions                                                    */
 /* ========================================================================== */
@@ -0,0 +1,82 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#ifndef CTRACE_H
+#define CTRACE_H
+
+#include <stdint.h>
+
+/* Driver for the commit-trace buffer (hw/rtl/peripherals/
+ * commit_trace_buffer.sv). The hardware records one entry per retired
+ * branch/jump -- {cycle delta, PC, taken} -- into a BRAM ring, so a captured
+ * trace plus the program image reconstructs the committed path with cycle
+ * attribution. Typical flow:
+ *
+ *   ctrace_start();
+ *   workload();
+ *   ctrace_stop();
+ *   ctrace_dump();       // text dump over UART
+ *
+ * then feed the captured console output and the ELF to
+ * fpga/decode_commit_trace.py for a gprof-style flat profile.
+ *
+ * When the ring fills, the oldest entries are dropped (ctrace_wrapped()
+ * reports this), so an un-filtered capture holds the most recent branches
+ * before the stop. Use the PC filter or start trigger to pin the window to
+ * the code of interest. */
+
+/* TRACE_CTRL write bits */
+#define CTRACE_CTRL_ENABLE 0x1u
+#define CTRACE_CTRL_CLEAR 0x2u
+
+/* TRACE_CTRL read (status) bits */
+#define CTRACE_STAT_ENABLED 0x1u
+#define CTRACE_STAT_TRIGGERED 0x2u
+#define CTRACE_STAT_WRAPPED 0x4u
+
+/* Restrict recording to PCs in [lo, hi); hi = 0 removes the upper bound.
+ * Configure before ctrace_start. */
+void ctrace_set_filter(uint32_t lo, uint32_t hi);
+
+/* Arm recording to start at the first committed branch at `pc` after enable;
+ * 0 (the default) starts immediately. Configure before ctrace_start. */
+void ctrace_set_trigger(uint32_t pc);
+
+/* Clear the ring and start recording. */
+void ctrace_start(void);
+
+/* Stop recording (captured entries stay readable). */
+void ctrace_stop(void);
+
+/* Number of entries currently in the ring. */
+uint32_t ctrace_count(void);
+
+/* Whether the ring overflowed and dropped oldest entries since the last
+ * clear (1 = dropped). */
+int ctrace_wrapped(void);
+
+/* Pop the oldest entry; returns 0 when the ring is empty. On success *lo is
+ * {pc[31:1], taken} and *hi the cycle delta since the previous entry. */
+int ctrace_pop(uint32_t *lo, uint32_t *hi);
+
+/* Drain the ring as a text dump over UART in the format
+ * decode_commit_trace.py parses:
+ *   CTRACE-BEGIN <count> <wrapped>
+ *   <lo_hex> <hi_hex>          (one entry per line, oldest first)
+ *   CTRACE-END */
+void ctrace_dump(void);
+
+#endif /* CTRACE_H */
@@ -0,0 +1,109 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#ifndef DMA_H
+#define DMA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mmio.h"
+
+/* Driver for the descriptor-based DMA copy engine (hw/rtl/peripherals/
+ * dma_engine.sv). The engine moves whole 32-byte cache lines through the
+ * cache hierarchy's DMA port -- below the L1s, above the shared level -- so
+ * it copies an order of magnitude more bytes per transaction than the core's
+ * word-at-a-time loops, and the core runs ahead while the copy drains.
+ *
+ * Constraints:
+ *   - Source and destination must be DMA_LINE_BYTES-aligned addresses in the
+ *     cached (DDR) region; the length is rounded up to whole lines.
+ *   - Coherence is software-managed, like cross-core sharing: the engine
+ *     reads and writes at the shared level, invisible to the L1D. dma_start
+ *     flushes the L1D first (publishing source lines and dropping stale
+ *     destination copies); do not touch the destination through the core
+ *     until the transfer finishes.
+ *   - One transfer at a time: starting while busy is ignored by hardware.
+ *
+ * Availability: cached-tier builds only. With the tier disabled the start
+ * completes immediately and nothing is copied. */
+
+/* Line size moved per engine transaction (hardware LINE_BYTES). */
+#define DMA_LINE_BYTES 32u
+
+/* DMA_CTRL write bits */
+#define DMA_CTRL_START 0x1u
+#define DMA_CTRL_IRQ_EN 0x2u
+#define DMA_CTRL_RING 0x4u
+
+/* DMA_CTRL read (status) bits */
+#define DMA_STAT_BUSY 0x1u
+#define DMA_STAT_DONE 0x2u
+#define DMA_STAT_IRQ_EN 0x4u
+#define DMA_STAT_RING_ACTIVE 0x8u
+
+/* Start a line-aligned copy of len bytes (rounded up to whole lines).
+ * Flushes the L1D first, then returns as soon as the engine is launched. */
+void dma_start(void *dst, const void *src, size_t len);
+
+/* Check whether a transfer is still in flight (1 = busy). */
+int dma_busy(void);
+
+/* Block until the current transfer finishes and acknowledge its done flag. */
+void dma_wait(void);
+
+/* Enable (1) or disable (0) the completion interrupt. The engine raises
+ * MEIP while done is pending; the handler acknowledges through dma_wait or
+ * a DMA_CTRL write. */
+void dma_irq_enable(int enable);
+
+/* Blocking convenience wrapper: dma_start + dma_wait. */
+void dma_copy(void *dst, const void *src, size_t len);
+
+/* Ring-ingest mode: the engine drains MMIO FIFO0 word by word and writes
+ * arriving data into a DDR ring so firmware parses it in place -- no
+ * per-word MMIO loads on the consume path. DMA_RING_WPTR is the next byte
+ * the engine will write (data below it is committed to memory); firmware
+ * republishes its consume point through dma_ring_publish_rptr and the
+ * engine stalls rather than overrun it (one ring word stays unused so full
+ * and empty are distinguishable).
+ *
+ * Coherence follows the dma.h contract: the engine writes at the shared
+ * level, so flush the L1D before reading newly published ring bytes (or map
+ * the consume loop to re-flush per batch). Do not read FIFO0 through MMIO
+ * while the ring is active -- the engine owns its pop side. */
+
+/* Start draining FIFO0 into the ring at base (line-aligned, in DDR) of
+ * ring_bytes bytes (rounded up to whole lines). Flushes the L1D first. */
+void dma_ring_start(void *base, size_t ring_bytes);
+
+/* Stop the ring session: collected words are flushed, then done rises.
+ * Blocks until the engine is idle and acknowledges done. */
+void dma_ring_stop(void);
+
+/* Committed write pointer: ring bytes below it have reached memory. */
+static inline uint32_t dma_ring_wptr(void)
+{
+    return DMA_RING_WPTR;
+}
+
+/* Publish the firmware consume pointer (an absolute ring address). */
+static inline void dma_ring_publish_rptr(const void *rptr)
+{
+    DMA_RING_RPTR = (uint32_t) (uintptr_t) rptr;
+}
+
+#endif /* DMA_H */
@@ -49,5 +49,55 @@ static inline uint32_t fifo1_read(void)
     return FIFO1;
 }
 
+/* Current fill level of FIFO 0 in words (non-destructive) */
+static inline uint16_t fifo0_level(void)
+{
+    return (uint16_t) (FIFO_LEVEL & 0xFFFFu);
+}
+
+/* Current fill level of FIFO 1 in words (non-destructive) */
+static inline uint16_t fifo1_level(void)
+{
+    return (uint16_t) (FIFO_LEVEL >> 16);
+}
+
+/* Number of pending arrival timestamps for FIFO 0 */
+static inline uint16_t fifo0_ts_pending(void)
+{
+    return (uint16_t) (FIFO_TS_STATUS & 0xFFFFu);
+}
+
+/* Number of pending arrival timestamps for FIFO 1 */
+static inline uint16_t fifo1_ts_pending(void)
+{
+    return (uint16_t) (FIFO_TS_STATUS >> 16);
+}
+
+/* Pop the oldest FIFO 0 arrival timestamp: the mtime value latched by
+ * hardware when the first word of a burst landed in the empty FIFO. Only
+ * call when fifo0_ts_pending() is nonzero (the HI read pops the entry). */
+static inline uint64_t fifo0_arrival_ts(void)
+{
+    uint32_t lo = FIFO0_TS_LO;
+    uint32_t hi = FIFO0_TS_HI;
+    return ((uint64_t) hi << 32) | lo;
+}
+
+/* Pop the oldest FIFO 1 arrival timestamp (see fifo0_arrival_ts) */
+static inline uint64_t fifo1_arrival_ts(void)
+{
+    uint32_t lo = FIFO1_TS_LO;
+    uint32_t hi = FIFO1_TS_HI;
+    return ((uint64_t) hi << 32) | lo;
+}
+
+/* Program the fill thresholds (in words) for the FIFO level interrupt.
+ * While a FIFO's level sits at or above its nonzero threshold, MEIP is
+ * asserted (level-sensitive; shared with the DMA and UART TX drain
+ * interrupts). A threshold of 0 disables that FIFO's interrupt. */
+static inline void fifo_set_irq_thresholds(uint16_t fifo0_words, uint16_t fifo1_words)
+{
+    FIFO_THRESH = ((uint32_t) fifo1_words << 16) | fifo0_words;
+}
 
 #endif /* FIFO_H */
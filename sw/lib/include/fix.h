@@ -57,4 +57,73 @@ uint64_t parse_timestamp(const char *timestamp_string);
  */
 fix_price_t parse_price(const char *price_string);
 
+/* ==========================================================================
+ * Packed SIMD intrinsics (Zpn subset)
+ * ==========================================================================
+ * Hardware packed ops on the MUL pipeline (hw/rtl/.../int_muldiv_shim.sv):
+ * four 8-bit or two 16-bit lanes per 32-bit register, wrapping per lane.
+ * Encoded with .insn since the stock toolchain does not assemble the
+ * P-extension mnemonics (OP-P major opcode 0x77, standard Zpn funct7).
+ */
+
+/* Lane-wise 8-bit add: r[i] = a[i] + b[i] for each of the 4 bytes (ADD8) */
+static inline uint32_t padd8(uint32_t a, uint32_t b)
+{
+    uint32_t result;
+    __asm__(".insn r 0x77, 0x0, 0x24, %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+}
+
+/* Lane-wise 8-bit subtract (SUB8) */
+static inline uint32_t psub8(uint32_t a, uint32_t b)
+{
+    uint32_t result;
+    __asm__(".insn r 0x77, 0x0, 0x25, %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+}
+
+/* Lane-wise 16-bit add: r[i] = a[i] + b[i] for each halfword (ADD16) */
+static inline uint32_t padd16(uint32_t a, uint32_t b)
+{
+    uint32_t result;
+    __asm__(".insn r 0x77, 0x0, 0x20, %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+}
+
+/* Lane-wise 16-bit subtract (SUB16) */
+static inline uint32_t psub16(uint32_t a, uint32_t b)
+{
+    uint32_t result;
+    __asm__(".insn r 0x77, 0x0, 0x21, %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+}
+
+/* Signed quad-int8 dot product: sum of a[i] * b[i] over the 4 byte lanes.
+ * Uses the SMAQA encoding, but unlike full SMAQA the rd accumulation
+ * happens in software -- write acc += pdot8(a, b). */
+static inline int32_t pdot8(uint32_t a, uint32_t b)
+{
+    int32_t result;
+    __asm__(".insn r 0x77, 0x0, 0x64, %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+}
+
+/* 4-lane multiply-accumulate over int8 buffers of equal length (a whole
+ * word per step versus 8+ instructions per byte scalar). Length in bytes;
+ * the word loop handles the aligned body, the tail falls back to scalar. */
+static inline int32_t pmac8(const int8_t *a, const int8_t *b, uint32_t length, int32_t acc)
+{
+    const uint32_t *wa = (const uint32_t *) a;
+    const uint32_t *wb = (const uint32_t *) b;
+    uint32_t i = 0;
+
+    for (; i + 4 <= length; i += 4) {
+        acc += pdot8(*wa++, *wb++);
+    }
+    for (; i < length; i++) {
+        acc += (int32_t) a[i] * (int32_t) b[i];
+    }
+    return acc;
+}
+
 #endif /* FIX_H */
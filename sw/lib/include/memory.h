@@ -44,9 +44,15 @@ void arena_pop(arena_t *arena, uint32_t size);
 /* Clear all bytes from arena. */
 void arena_clear(arena_t *arena);
 
+/* General-purpose allocator: segregated size-class free lists with O(1)
+ * alloc/free for requests up to 2 KiB; larger blocks use a first-fit list. */
 void *malloc(size_t size);
 void free(void *ptr);
 
+/* Print heap usage, alloc/free counts, and per-class free-list occupancy
+ * over UART (fragmentation monitoring for long-running deployments). */
+void malloc_stats(void);
+
 /* Allocate and zero an array of nmemb elements of `size` bytes each. */
 void *calloc(size_t nmemb, size_t size);
 
@@ -47,6 +47,33 @@ extern volatile uint32_t MTIME_HI_ADDR;
 extern volatile uint32_t MTIMECMP_LO_ADDR;
 extern volatile uint32_t MTIMECMP_HI_ADDR;
 extern volatile uint32_t MSIP_ADDR;
+extern volatile uint32_t IPI_ADDR;
+extern volatile uint32_t DCACHE_FLUSH_ADDR;
+extern volatile uint32_t HW_MUTEX_ADDR;
+extern volatile uint32_t DMA_SRC_ADDR;
+extern volatile uint32_t DMA_DST_ADDR;
+extern volatile uint32_t DMA_LEN_ADDR;
+extern volatile uint32_t DMA_CTRL_ADDR;
+extern volatile uint32_t UART_TX_CTRL_ADDR;
+extern volatile uint32_t TRACE_CTRL_ADDR;
+extern volatile uint32_t TRACE_STATUS_ADDR;
+extern volatile uint32_t TRACE_DATA_LO_ADDR;
+extern volatile uint32_t TRACE_DATA_HI_ADDR;
+extern volatile uint32_t TRACE_FILTER_LO_ADDR;
+extern volatile uint32_t TRACE_FILTER_HI_ADDR;
+extern volatile uint32_t TRACE_TRIGGER_ADDR;
+extern volatile uint32_t CRC_STATE_ADDR;
+extern volatile uint32_t CRC_DATA_WORD_ADDR;
+extern volatile uint32_t CRC_DATA_BYTE_ADDR;
+extern volatile uint32_t FIFO_LEVEL_ADDR;
+extern volatile uint32_t FIFO_THRESH_ADDR;
+extern volatile uint32_t DMA_RING_WPTR_ADDR;
+extern volatile uint32_t DMA_RING_RPTR_ADDR;
+extern volatile uint32_t FIFO_TS_STATUS_ADDR;
+extern volatile uint32_t FIFO0_TS_LO_ADDR;
+extern volatile uint32_t FIFO0_TS_HI_ADDR;
+extern volatile uint32_t FIFO1_TS_LO_ADDR;
+extern volatile uint32_t FIFO1_TS_HI_ADDR;
 
 /* ========================================================================== */
 /* UART (0x40000000)                                                          */
@@ -56,6 +83,10 @@ extern volatile uint32_t MSIP_ADDR;
 #define UART_RX_DATA (*(volatile uint8_t *) &UART_RX_DATA_ADDR)
 #define UART_RX_STATUS (*(volatile uint32_t *) &UART_RX_STATUS_ADDR)
 #define UART_TX_STATUS (*(volatile uint32_t *) &UART_TX_STATUS_ADDR)
+/* Bit 0 (at 0x40000048): TX drain interrupt enable. While set, MEIP is
+ * asserted whenever the TX path can accept a byte; the uart.c async ring
+ * uses it to refill from the trap handler instead of spin-waiting. */
+#define UART_TX_CTRL (*(volatile uint32_t *) &UART_TX_CTRL_ADDR)
 
 /* ========================================================================== */
 /* FIFOs (0x40000008, 0x4000000C)                                             */
@@ -64,6 +95,23 @@ extern volatile uint32_t MSIP_ADDR;
 #define FIFO0 (*(volatile uint32_t *) &FIFO0_ADDR)
 #define FIFO1 (*(volatile uint32_t *) &FIFO1_ADDR)
 
+/* Fill levels (at 0x40000074): {FIFO1 level[31:16], FIFO0 level[15:0]} in
+ * words, non-destructive. Threshold register (0x40000078) in the same
+ * layout: while a level sits at or above its (nonzero) threshold, MEIP is
+ * asserted; a threshold of 0 disables that FIFO's interrupt. */
+#define FIFO_LEVEL (*(volatile uint32_t *) &FIFO_LEVEL_ADDR)
+#define FIFO_THRESH (*(volatile uint32_t *) &FIFO_THRESH_ADDR)
+
+/* Arrival timestamps (0x40000084-0x40000094): hardware latches mtime when a
+ * word lands in an empty FIFO (one stamp per arrival burst). STATUS packs
+ * the pending counts as {FIFO1[31:16], FIFO0[15:0]}; the TS_HI read pops
+ * the oldest stamp, so read TS_LO first. Use the fifo.h accessors. */
+#define FIFO_TS_STATUS (*(volatile uint32_t *) &FIFO_TS_STATUS_ADDR)
+#define FIFO0_TS_LO (*(volatile uint32_t *) &FIFO0_TS_LO_ADDR)
+#define FIFO0_TS_HI (*(volatile uint32_t *) &FIFO0_TS_HI_ADDR)
+#define FIFO1_TS_LO (*(volatile uint32_t *) &FIFO1_TS_LO_ADDR)
+#define FIFO1_TS_HI (*(volatile uint32_t *) &FIFO1_TS_HI_ADDR)
+
 /* ========================================================================== */
 /* CLINT-compatible Timer Registers (0x40000010-0x40000020)                   */
 /* ========================================================================== */
@@ -74,4 +122,67 @@ extern volatile uint32_t MSIP_ADDR;
 #define MTIMECMP_HI (*(volatile uint32_t *) &MTIMECMP_HI_ADDR)
 #define MSIP (*(volatile uint32_t *) &MSIP_ADDR)
 
+/* ========================================================================== */
+/* Inter-core signalling (0x4000002C-0x40000034, dual-core builds)            */
+/* ========================================================================== */
+
+/* Write 1 to interrupt the other core (raises its msip). Single-core: no-op. */
+#define IPI (*(volatile uint32_t *) &IPI_ADDR)
+/* Write to start an L1D writeback+invalidate; poll until it reads 0. */
+#define DCACHE_FLUSH (*(volatile uint32_t *) &DCACHE_FLUSH_ADDR)
+/* Reading attempts acquisition (0 = acquired, 1 = busy); write to release.
+ * Single-core builds tie the grant high, so acquisition always succeeds. */
+#define HW_MUTEX (*(volatile uint32_t *) &HW_MUTEX_ADDR)
+
+/* ========================================================================== */
+/* DMA copy engine (0x40000038-0x40000044, cached-tier builds)                */
+/* ========================================================================== */
+
+/* Descriptor registers for line-granular memory-to-memory copies; use the
+ * dma.h driver rather than programming these directly. */
+#define DMA_SRC (*(volatile uint32_t *) &DMA_SRC_ADDR)
+#define DMA_DST (*(volatile uint32_t *) &DMA_DST_ADDR)
+#define DMA_LEN (*(volatile uint32_t *) &DMA_LEN_ADDR)
+/* Write: bit 0 starts, bit 1 latches irq enable, any write acks done.
+ * Read: bit 0 busy, bit 1 done, bit 2 irq enabled. */
+#define DMA_CTRL (*(volatile uint32_t *) &DMA_CTRL_ADDR)
+
+/* Ring-ingest pointers (0x4000007C/0x40000080): with the engine in ring
+ * mode, WPTR is the next DDR byte it will write (data below it is
+ * committed); firmware republishes its consume point through RPTR and the
+ * engine stalls rather than overrun it. See dma.h for the driver. */
+#define DMA_RING_WPTR (*(volatile uint32_t *) &DMA_RING_WPTR_ADDR)
+#define DMA_RING_RPTR (*(volatile uint32_t *) &DMA_RING_RPTR_ADDR)
+
+/* ========================================================================== */
+/* Commit-trace buffer (0x4000004C-0x40000064)                                */
+/* ========================================================================== */
+
+/* Branches-only {PC, cycle-delta} ring for on-hardware profiling; use the
+ * ctrace.h driver rather than programming these directly. */
+/* Write: bit 0 enable, bit 1 clear. Read: bit 0 enable, bit 1 triggered,
+ * bit 2 wrapped (oldest entries were overwritten). */
+#define TRACE_CTRL (*(volatile uint32_t *) &TRACE_CTRL_ADDR)
+#define TRACE_STATUS (*(volatile uint32_t *) &TRACE_STATUS_ADDR)
+/* Oldest entry: read DATA_LO ({pc[31:1], taken}) first; reading DATA_HI
+ * (cycle delta since the previous entry) pops the entry. */
+#define TRACE_DATA_LO (*(volatile uint32_t *) &TRACE_DATA_LO_ADDR)
+#define TRACE_DATA_HI (*(volatile uint32_t *) &TRACE_DATA_HI_ADDR)
+#define TRACE_FILTER_LO (*(volatile uint32_t *) &TRACE_FILTER_LO_ADDR)
+#define TRACE_FILTER_HI (*(volatile uint32_t *) &TRACE_FILTER_HI_ADDR)
+#define TRACE_TRIGGER (*(volatile uint32_t *) &TRACE_TRIGGER_ADDR)
+
+/* ========================================================================== */
+/* CRC-32 accumulator (0x40000068-0x40000070)                                 */
+/* ========================================================================== */
+
+/* Running reflected CRC-32 (zlib-compatible) folded in hardware; use the
+ * crc.h intrinsics rather than programming these directly. */
+/* Write: seed the raw CRC state. Read: current state. */
+#define CRC_STATE (*(volatile uint32_t *) &CRC_STATE_ADDR)
+/* Write-only: a word store folds 4 bytes (low byte first). */
+#define CRC_DATA_WORD (*(volatile uint32_t *) &CRC_DATA_WORD_ADDR)
+/* Write-only: a byte store folds bits [7:0]. */
+#define CRC_DATA_BYTE (*(volatile uint8_t *) &CRC_DATA_BYTE_ADDR)
+
 #endif /* MMIO_H */
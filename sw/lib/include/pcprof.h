@@ -0,0 +1,77 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#ifndef PCPROF_H
+#define PCPROF_H
+
+#include "timer.h"
+#include <stdint.h>
+
+/* Statistical PC-sampling profiler driven by the mtimecmp interrupt.
+ *
+ * Each timer tick records the interrupted PC (mepc) into a histogram of
+ * fixed-granularity address buckets, then re-arms mtimecmp. Overhead is a
+ * few dozen cycles per sample, so apps too long to simulate can be profiled
+ * at full speed on the board. Typical flow:
+ *
+ *   pcprof_init(0, 96 * 1024);            // cover ROM text (link.ld)
+ *   pcprof_start(PCPROF_PERIOD_DEFAULT);
+ *   workload();
+ *   pcprof_stop();
+ *   pcprof_report();                      // text dump over UART
+ *
+ * then feed the captured console output and the ELF to fpga/decode_pcprof.py
+ * for a symbolized flat profile.
+ *
+ * Installing the profiler replaces mtvec for the sampling window (the
+ * previous handler is restored by pcprof_stop), so it cannot be combined
+ * with other interrupt users such as the uart.c async TX ring. The sampling
+ * handler saves integer caller-saved registers only; that is sufficient
+ * because the sample path is integer-only, but FP-context users must not
+ * take other traps while sampling is active. */
+
+/* Histogram size: 4 KiB of BSS as uint32_t counts. */
+#define PCPROF_BUCKET_COUNT 1024
+
+/* Default sample period: ~1 kHz at the default clock. Slow enough that
+ * sampling overhead is negligible, fast enough for second-scale runs. */
+#define PCPROF_PERIOD_DEFAULT (FPGA_CPU_CLK_FREQ / 1000)
+
+/* Configure the profiled address window [base, base + size) and clear the
+ * histogram. Bucket granularity is the smallest power of two that covers
+ * the window with PCPROF_BUCKET_COUNT buckets. Samples outside the window
+ * are counted but not attributed. */
+void pcprof_init(uint32_t base, uint32_t size);
+
+/* Install the sampling handler (saving the previous mtvec) and start
+ * sampling every period_ticks cycles. */
+void pcprof_start(uint32_t period_ticks);
+
+/* Stop sampling and restore the previous trap handler. The histogram is
+ * kept, so start/stop can bracket several regions cumulatively. */
+void pcprof_stop(void);
+
+/* Total samples taken since the last pcprof_init. */
+uint32_t pcprof_samples(void);
+
+/* Dump the histogram over UART in the format decode_pcprof.py parses:
+ *   PCPROF-BEGIN <base> <shift> <samples> <other>
+ *   <bucket_index> <count>       (one line per non-zero bucket)
+ *   PCPROF-END
+ * where <other> counts samples that fell outside the profiled window. */
+void pcprof_report(void);
+
+#endif /* PCPROF_H */
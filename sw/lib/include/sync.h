@@ -17,6 +17,9 @@
 #ifndef SYNC_H
 #define SYNC_H
 
+#include "csr.h"
+#include "mmio.h"
+
 /**
  * Synchronization primitives for RISC-V (Zifencei extension)
  *
@@ -36,6 +39,24 @@
  *
  * However, using these primitives ensures code portability to more
  * complex RISC-V implementations where they have real effects.
+ *
+ * Cross-core primitives (dual-core frost_dual builds)
+ * ---------------------------------------------------
+ * The two cores' private L1 data caches do not snoop each other; coherence
+ * is software-managed over the shared level below them. The contract:
+ *   - A producer writes its data, then calls dcache_flush() before telling
+ *     the other core (mailbox FIFO write or ipi_notify_other()). The flush
+ *     writes back and invalidates the whole L1D, landing every produced
+ *     line at the shared level.
+ *   - A consumer calls dcache_flush() after the notification and before
+ *     reading, so no stale line survives in its L1D -- the flush also drops
+ *     its L1 prefetcher's buffered line, which sits above the shared level
+ *     and cannot see the other core's (or the DMA engine's) writes.
+ *   - AMOs and LR/SC execute in the private L1s: they stay atomic on one
+ *     core but are NOT atomic across cores. Cross-core mutual exclusion
+ *     uses the hardware mutex (spin_lock()/spin_unlock()).
+ * All of these degrade to cheap or free operations on single-core builds,
+ * so shared code can use them unconditionally.
  */
 
 /**
@@ -71,4 +92,81 @@ static inline __attribute__((always_inline)) void fence_i(void)
     __asm__ volatile("fence.i" ::: "memory");
 }
 
+/**
+ * Hart (core) index of the calling core, from mhartid.
+ *
+ * Both cores of a dual-core build boot the same image; branch on this to
+ * split work. Single-core builds always return 0.
+ */
+static inline __attribute__((always_inline)) uint32_t hart_id(void)
+{
+    return csr_read(mhartid);
+}
+
+/**
+ * Flush the local L1 data cache (writeback-all, then invalidate-all).
+ *
+ * This is the coherence primitive of the dual-core contract: producers call
+ * it to publish written lines at the shared level, consumers call it to
+ * drop stale copies before reading (the invalidate covers the L1 prefetch
+ * buffer too, so a speculatively fetched line written behind this core's
+ * back cannot outlive the flush). Blocks until the walk completes. On a
+ * build without the cached tier the register reads back 0 immediately.
+ */
+static inline void dcache_flush(void)
+{
+    fence();
+    DCACHE_FLUSH = 1;
+    while (DCACHE_FLUSH) {
+    }
+    fence();
+}
+
+/**
+ * Interrupt the other core (raises its msip; it takes a machine software
+ * interrupt if MIE/MSIE are enabled, or wakes from WFI). The receiver
+ * clears its own MSIP in the handler. No-op on single-core builds.
+ */
+static inline __attribute__((always_inline)) void ipi_notify_other(void)
+{
+    IPI = 1;
+}
+
+/**
+ * Try to take the cross-core hardware mutex. Returns 1 on success.
+ *
+ * The MMIO read itself is the atomic acquire attempt (the hardware
+ * arbitrates simultaneous attempts from both cores). Non-recursive: the
+ * owner re-reading sees success without deepening any count.
+ */
+static inline int spin_trylock(void)
+{
+    return HW_MUTEX == 0;
+}
+
+/**
+ * Take the cross-core hardware mutex, spinning until it is free.
+ *
+ * The trailing fence keeps the critical section's accesses from hoisting
+ * above the acquire on future out-of-order implementations; remember that
+ * protected SHARED data still needs dcache_flush() on entry/exit when the
+ * other core writes it.
+ */
+static inline void spin_lock(void)
+{
+    while (HW_MUTEX != 0) {
+    }
+    fence();
+}
+
+/**
+ * Release the cross-core hardware mutex (owner only; a release from the
+ * non-owner is ignored by the hardware).
+ */
+static inline void spin_unlock(void)
+{
+    fence();
+    HW_MUTEX = 0;
+}
+
 #endif /* SYNC_H */
@@ -18,6 +18,7 @@
 #define TOMASULO_PROFILE_H
 
 #include "csr.h"
+#include "mmio.h"
 #include "uart.h"
 
 #include <stdint.h>
@@ -149,6 +150,28 @@ static inline void tomasulo_profile_take_snapshot(tomasulo_profile_snapshot_t *s
     }
 }
 
+/* Region-scoped profiling: a region bundles the start/stop snapshot pair so
+ * call sites do not juggle two snapshot structs. The MPERFCTL write in
+ * take_snapshot latches every counter into the hardware shadow bank in one
+ * cycle; the per-counter reads that follow drain that bank, so the stop
+ * boundary is exact. The start boundary includes the start-side read-out
+ * (~2 CSR ops per counter) inside the region -- size regions accordingly,
+ * or compare regions of equal shape so the constant cost cancels. */
+typedef struct tomasulo_profile_region {
+    tomasulo_profile_snapshot_t start;
+    tomasulo_profile_snapshot_t stop;
+} tomasulo_profile_region_t;
+
+static inline void tomasulo_profile_region_start(tomasulo_profile_region_t *region)
+{
+    tomasulo_profile_take_snapshot(&region->start);
+}
+
+static inline void tomasulo_profile_region_stop(tomasulo_profile_region_t *region)
+{
+    tomasulo_profile_take_snapshot(&region->stop);
+}
+
 static inline uint64_t tomasulo_profile_delta(const tomasulo_profile_snapshot_t *start,
                                               const tomasulo_profile_snapshot_t *end,
                                               uint32_t idx)
@@ -761,4 +784,104 @@ static inline void tomasulo_profile_print_report(const char *label,
         "FDIV RS", tomasulo_profile_delta(start, end, TOMASULO_PERF_FDIV_RS_OCCUPANCY_SUM), cycles);
 }
 
+/* Compact binary dump: ships a region's deltas to the host in a few hundred
+ * bytes instead of the multi-KB text report. Record layout (all multi-byte
+ * fields are ULEB128 varints, so small deltas cost one byte):
+ *
+ *   'T' 'P' '0' '1'            magic + format version
+ *   u8   counter_count
+ *   var  cycles delta
+ *   var  instret delta
+ *   var  counters[0..counter_count) deltas
+ *   u8   checksum (XOR of every byte after the magic)
+ *
+ * Bytes go straight to the UART data register, bypassing uart_putchar's
+ * LF -> CRLF translation, so the payload survives capture verbatim. The
+ * record is bracketed by text lines ("TPROF-BEGIN <label>" / "TPROF-END")
+ * so a host script can locate it in a mixed console log. */
+static inline void tomasulo_profile_emit_raw_byte(uint8_t byte)
+{
+    while (!uart_tx_ready()) {
+    }
+    UART_TX = byte;
+}
+
+static inline uint8_t tomasulo_profile_emit_varint(uint64_t value)
+{
+    uint8_t checksum = 0;
+    do {
+        uint8_t byte = (uint8_t) (value & 0x7Fu);
+        value >>= 7;
+        if (value != 0) {
+            byte |= 0x80u;
+        }
+        tomasulo_profile_emit_raw_byte(byte);
+        checksum ^= byte;
+    } while (value != 0);
+    return checksum;
+}
+
+static inline void tomasulo_profile_dump_binary(const char *label,
+                                                const tomasulo_profile_snapshot_t *start,
+                                                const tomasulo_profile_snapshot_t *end)
+{
+    uint32_t count = start->counter_count;
+    uint8_t checksum;
+    uint32_t i;
+
+    if (end->counter_count < count) {
+        count = end->counter_count;
+    }
+
+    uart_printf("TPROF-BEGIN %s\n", label);
+    tomasulo_profile_emit_raw_byte('T');
+    tomasulo_profile_emit_raw_byte('P');
+    tomasulo_profile_emit_raw_byte('0');
+    tomasulo_profile_emit_raw_byte('1');
+    tomasulo_profile_emit_raw_byte((uint8_t) count);
+    checksum = (uint8_t) count;
+    checksum ^= tomasulo_profile_emit_varint(end->cycles - start->cycles);
+    checksum ^= tomasulo_profile_emit_varint(end->instret - start->instret);
+    for (i = 0; i < count; i++) {
+        checksum ^= tomasulo_profile_emit_varint(tomasulo_profile_delta(start, end, i));
+    }
+    tomasulo_profile_emit_raw_byte(checksum);
+    uart_printf("\nTPROF-END\n");
+}
+
+/* Region-flavoured wrappers over the snapshot-pair reporting entry points. */
+static inline uint64_t tomasulo_profile_region_delta(const tomasulo_profile_region_t *region,
+                                                     uint32_t idx)
+{
+    return tomasulo_profile_delta(&region->start, &region->stop, idx);
+}
+
+static inline uint64_t tomasulo_profile_region_cycles(const tomasulo_profile_region_t *region)
+{
+    return region->stop.cycles - region->start.cycles;
+}
+
+static inline uint64_t tomasulo_profile_region_instret(const tomasulo_profile_region_t *region)
+{
+    return region->stop.instret - region->start.instret;
+}
+
+static inline void tomasulo_profile_region_print_brief(const char *label,
+                                                       const tomasulo_profile_region_t *region)
+{
+    tomasulo_profile_print_brief_report(label, &region->start, &region->stop);
+}
+
+static inline void tomasulo_profile_region_print_report(const char *label,
+                                                        const tomasulo_profile_region_t *region)
+{
+    tomasulo_profile_print_report(label, &region->start, &region->stop);
+}
+
+static inline void tomasulo_profile_region_dump_binary(const char *label,
+                                                       const tomasulo_profile_region_t *region)
+{
+    tomasulo_profile_dump_binary(label, &region->start, &region->stop);
+}
+
 #endif /* TOMASULO_PROFILE_H */
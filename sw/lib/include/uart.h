@@ -52,6 +52,50 @@ void uart_puts(const char *s);
  */
 void uart_printf(const char *fmt, ...);
 
+/* ========================================================================= */
+/* Asynchronous (interrupt-driven) Transmit                                  */
+/* ========================================================================= */
+
+/* The async path formats into a software ring buffer and returns without
+ * waiting for the transmitter, so logging does not distort the timing of the
+ * code being measured. The ring is drained from the trap handler: while the
+ * UART_TX_CTRL drain-interrupt enable is set, MEIP fires whenever the TX path
+ * can accept a byte.
+ *
+ * Setup (once, before the first async call):
+ *   set_trap_handler(...);          // handler calls uart_tx_service()
+ *   enable_external_interrupt();    // MEIP
+ *   enable_interrupts();
+ *
+ * MEIP is shared (DMA completion uses it too); uart_tx_service() is safe to
+ * call when no TX bytes are pending. If interrupts are never enabled, the
+ * async calls still work: uart_tx_drain() (or a full ring) drains in-line. */
+
+/* Bytes the async ring can hold before producers block on the drain. */
+#define UART_TX_RING_SIZE 4096u
+
+/* Longest single uart_printf_async message (longer output is truncated). */
+#define UART_ASYNC_MSG_MAX 256
+
+/* UART_TX_CTRL bit 0: TX drain interrupt enable */
+#define UART_TX_IRQ_ENABLE 0x1u
+
+/* Queue a null-terminated string for transmission and return immediately */
+void uart_puts_async(const char *s);
+
+/* Format like uart_printf into the TX ring and return immediately.
+ * Uses the full snprintf formatter; output is truncated to
+ * UART_ASYNC_MSG_MAX - 1 characters per call. */
+void uart_printf_async(const char *fmt, ...);
+
+/* Move queued bytes into the hardware TX FIFO; call from the MEIP handler.
+ * Clears the drain-interrupt enable once the ring is empty.
+ * Returns: 1 if bytes remain queued, 0 if the ring is drained */
+int uart_tx_service(void);
+
+/* Block until every queued byte has entered the hardware TX FIFO */
+void uart_tx_drain(void);
+
 /* ========================================================================= */
 /* UART Receive Functions                                                    */
 /* ========================================================================= */
@@ -0,0 +1,53 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * Hardware CRC-32 Driver (crc.c)
+ *
+ * Buffer-level helper over the crc32_unit MMIO accumulator. See crc.h for
+ * the streaming intrinsics.
+ */
+
+#include "crc.h"
+
+uint32_t crc32_buf(const void *data, uint32_t length)
+{
+    const uint8_t *bytes = (const uint8_t *) data;
+
+    crc32_begin();
+
+    /* Unaligned head, byte at a time. */
+    while (length > 0 && ((uintptr_t) bytes & 0x3u) != 0) {
+        crc32_feed_byte(*bytes++);
+        length--;
+    }
+
+    /* Aligned middle, a word per store. */
+    const uint32_t *words = (const uint32_t *) bytes;
+    while (length >= 4) {
+        crc32_feed_word(*words++);
+        length -= 4;
+    }
+
+    /* Tail. */
+    bytes = (const uint8_t *) words;
+    while (length > 0) {
+        crc32_feed_byte(*bytes++);
+        length--;
+    }
+
+    return crc32_end();
+}
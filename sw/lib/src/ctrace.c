@@ -0,0 +1,82 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * Commit-Trace Buffer Driver (ctrace.c)
+ *
+ * Thin driver over the MMIO registers of the commit-trace ring.
+ * See ctrace.h for the capture/dump flow.
+ */
+
+#include "ctrace.h"
+
+#include "mmio.h"
+#include "uart.h"
+
+void ctrace_set_filter(uint32_t lo, uint32_t hi)
+{
+    TRACE_FILTER_LO = lo;
+    TRACE_FILTER_HI = hi;
+}
+
+void ctrace_set_trigger(uint32_t pc)
+{
+    TRACE_TRIGGER = pc;
+}
+
+void ctrace_start(void)
+{
+    TRACE_CTRL = CTRACE_CTRL_ENABLE | CTRACE_CTRL_CLEAR;
+}
+
+void ctrace_stop(void)
+{
+    TRACE_CTRL = 0;
+}
+
+uint32_t ctrace_count(void)
+{
+    return TRACE_STATUS;
+}
+
+int ctrace_wrapped(void)
+{
+    return (TRACE_CTRL & CTRACE_STAT_WRAPPED) != 0;
+}
+
+int ctrace_pop(uint32_t *lo, uint32_t *hi)
+{
+    if (TRACE_STATUS == 0) {
+        return 0;
+    }
+    /* DATA_LO is non-destructive; the DATA_HI read pops the entry. */
+    *lo = TRACE_DATA_LO;
+    *hi = TRACE_DATA_HI;
+    return 1;
+}
+
+void ctrace_dump(void)
+{
+    uint32_t lo;
+    uint32_t hi;
+
+    uart_printf("CTRACE-BEGIN %u %u\n", (unsigned int) ctrace_count(),
+                (unsigned int) ctrace_wrapped());
+    while (ctrace_pop(&lo, &hi)) {
+        uart_printf("%08x %08x\n", (unsigned int) lo, (unsigned int) hi);
+    }
+    uart_printf("CTRACE-END\n");
+}
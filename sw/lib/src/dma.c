@@ -0,0 +1,96 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * DMA Copy Engine Driver (dma.c)
+ *
+ * Thin driver over the MMIO descriptor registers of the line-copy engine.
+ * See dma.h for the alignment and coherence contract.
+ */
+
+#include "dma.h"
+#include "mmio.h"
+
+/* Every CTRL write latches the irq-enable bit, so each write must carry the
+ * currently requested setting alongside start/ack. */
+static uint32_t dma_ctrl_irq_bit;
+
+void dma_start(void *dst, const void *src, size_t len)
+{
+    /* Publish source lines (and drop stale destination copies) at the shared
+     * level the engine reads and writes -- the same flush a producer core
+     * runs before handing lines to another core. */
+    DCACHE_FLUSH = 1;
+    while (DCACHE_FLUSH != 0)
+        ;
+
+    DMA_SRC = (uint32_t) (uintptr_t) src;
+    DMA_DST = (uint32_t) (uintptr_t) dst;
+    DMA_LEN = (uint32_t) len;
+    DMA_CTRL = DMA_CTRL_START | dma_ctrl_irq_bit;
+}
+
+int dma_busy(void)
+{
+    return (DMA_CTRL & DMA_STAT_BUSY) != 0;
+}
+
+void dma_wait(void)
+{
+    while (dma_busy())
+        ;
+    /* Acknowledge done (keeping the irq enable as configured). */
+    DMA_CTRL = dma_ctrl_irq_bit;
+}
+
+void dma_irq_enable(int enable)
+{
+    dma_ctrl_irq_bit = enable ? DMA_CTRL_IRQ_EN : 0;
+    /* Apply immediately; this also acknowledges any pending done, which is
+     * the desired effect when disabling a completed transfer's interrupt. */
+    DMA_CTRL = dma_ctrl_irq_bit;
+}
+
+void dma_copy(void *dst, const void *src, size_t len)
+{
+    dma_start(dst, src, len);
+    dma_wait();
+}
+
+void dma_ring_start(void *base, size_t ring_bytes)
+{
+    /* Drop stale L1D copies of the ring region before the engine starts
+     * publishing into it at the shared level. */
+    DCACHE_FLUSH = 1;
+    while (DCACHE_FLUSH != 0)
+        ;
+
+    DMA_RING_RPTR = (uint32_t) (uintptr_t) base;
+    DMA_DST = (uint32_t) (uintptr_t) base;
+    DMA_LEN = (uint32_t) ring_bytes;
+    DMA_CTRL = DMA_CTRL_START | DMA_CTRL_RING | dma_ctrl_irq_bit;
+}
+
+void dma_ring_stop(void)
+{
+    /* Clearing the start bit while the ring is active requests a stop; the
+     * engine flushes collected words, then raises done. */
+    DMA_CTRL = dma_ctrl_irq_bit;
+    while (dma_busy())
+        ;
+    /* Acknowledge done (keeping the irq enable as configured). */
+    DMA_CTRL = dma_ctrl_irq_bit;
+}
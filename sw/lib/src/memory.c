@@ -23,15 +23,19 @@
  * 1. Arena Allocator - Fast bump-pointer allocation with bulk deallocation.
  *    Best for allocations with uniform lifetime (e.g., per-frame or per-request).
  *
- * 2. malloc/free - Traditional freelist allocator with first-fit strategy.
- *    Best for allocations with varied lifetimes.
+ * 2. malloc/free - Segregated size-class free lists with an O(1) alloc/free
+ *    hot path; requests beyond the largest class fall back to a first-fit
+ *    list. Best for allocations with varied lifetimes (FreeRTOS heaps,
+ *    long-running benchmark harnesses).
  *
  * Both allocators use _sbrk() to request memory from a simple heap that grows
  * from _heap_start toward _heap_end (defined in the linker script).
+ * malloc_stats() prints heap usage and per-class fragmentation over UART.
  */
 
 #include "memory.h"
 #include "string.h"
+#include "uart.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -79,20 +83,24 @@ arena_t arena_alloc(uint32_t size)
 #if FROST_MALLOC_EVICT_FREE
 static void evict_l0_words_for_range(uintptr_t start, uint32_t size)
 {
-    volatile uint32_t sink = 0;
     uintptr_t end = start + size;
     start &= ~(uintptr_t) (sizeof(uint32_t) - 1);
 
     /*
-     * FROST's load-queue L0 is direct-mapped and indexed by address bits [8:2].
-     * Toggling bit 9 preserves the index and changes the tag, forcing the word
-     * entry out without needing hardware support for explicit cache management.
+     * FROST's load-queue L0 snoops committed stores: a store invalidates the
+     * matching word in every way. Reading each word and storing the value
+     * back is therefore an exact evict that is independent of the cache
+     * geometry (the earlier alias-read trick relied on the direct-mapped
+     * index/tag split at bits [8:2] and does not generalize to the
+     * set-associative configuration). The block is being freed, so the
+     * redundant store is architecturally invisible.
      */
     for (uintptr_t addr = start; addr < end; addr += sizeof(uint32_t)) {
-        sink ^= *(volatile uint32_t *) (addr ^ 0x200u);
+        volatile uint32_t *word = (volatile uint32_t *) addr;
+        *word = *word;
     }
 
-    __asm__ volatile("" : : "r"(sink) : "memory");
+    __asm__ volatile("" : : : "memory");
 }
 #endif
 
@@ -157,10 +165,31 @@ struct free_slot {
 _Static_assert(sizeof(struct free_slot) == DEFAULT_ALIGN,
                "Can't fit a free slot in the minimum space that malloc aligns to");
 
+/* Payload size classes for the segregated free lists. Classes at and above
+ * the 32-byte cache line are line multiples, so a recycled block covers whole
+ * lines instead of straddling an extra one. Requests beyond the largest class
+ * go to the first-fit large list. Rounding a request up to its class bounds
+ * internal fragmentation; never splitting class blocks keeps alloc and free
+ * O(1) and means a class list can only grow to that class's high-water count. */
+static const uint32_t malloc_class_payload[] = {
+    8, 16, 32, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048,
+};
+#define MALLOC_NUM_CLASSES \
+    ((uint32_t) (sizeof(malloc_class_payload) / sizeof(malloc_class_payload[0])))
+#define MALLOC_CLASS_LARGE 0xFFFFFFFFu
+
+/* Heads of the per-class free lists (small path) */
+static struct free_slot *class_freelist[MALLOC_NUM_CLASSES];
+/* First-fit list for blocks beyond the largest class (large path) */
 static struct free_slot *freelist = NULL;
 
+/* Counters for malloc_stats() */
+static uint32_t malloc_alloc_calls;
+static uint32_t malloc_free_calls;
+
 struct metadata {
-    uint32_t size;
+    uint32_t size;       /* header + payload bytes */
+    uint32_t size_class; /* class list index, or MALLOC_CLASS_LARGE */
 };
 
 void *malloc(size_t size)
@@ -168,11 +197,38 @@ void *malloc(size_t size)
     if (size == 0) {
         return NULL;
     }
+    malloc_alloc_calls++;
+
+    uint32_t header_size = ALIGN(sizeof(struct metadata), DEFAULT_ALIGN);
+
+    /* Small path: round up to the smallest fitting class and pop its free
+     * list. One bounded scan of the class table, then O(1). */
+    for (uint32_t cls = 0; cls < MALLOC_NUM_CLASSES; ++cls) {
+        if (size <= malloc_class_payload[cls]) {
+            uint32_t block_size = malloc_class_payload[cls] + header_size;
+            struct free_slot *slot = class_freelist[cls];
+            char *result;
+
+            if (slot != NULL) {
+                class_freelist[cls] = slot->next;
+                result = (char *) slot + header_size;
+            } else {
+                char *raw =
+                    _sbrk(block_size + ALIGN_PADDING((uintptr_t) heap_mark, DEFAULT_ALIGN));
+                if (raw == NULL)
+                    return NULL;
+                result = (char *) ALIGN((uintptr_t) raw, DEFAULT_ALIGN) + header_size;
+            }
+
+            struct metadata *md = (struct metadata *) result - 1;
+            *md = (struct metadata) {.size = block_size, .size_class = cls};
+            return result;
+        }
+    }
 
-    /* Allocate using a first-fit algorithm */
+    /* Large path: first-fit over the large-block list */
     struct free_slot **p = &freelist;
-    uint32_t block_size =
-        ALIGN(size, DEFAULT_ALIGN) + ALIGN(sizeof(struct metadata), DEFAULT_ALIGN);
+    uint32_t block_size = ALIGN(size, DEFAULT_ALIGN) + header_size;
 
     char *result = NULL;
     while (*p != NULL) {
@@ -181,7 +237,7 @@ void *malloc(size_t size)
         if (block_size <= slot->size) {
             /* Shrink down free slot */
             slot->size -= block_size;
-            result = (char *) slot + slot->size + ALIGN(sizeof(struct metadata), DEFAULT_ALIGN);
+            result = (char *) slot + slot->size + header_size;
 
             if (slot->size == 0) {
                 /* Delete this node from the freelist */
@@ -197,13 +253,12 @@ void *malloc(size_t size)
         char *raw = _sbrk(block_size + ALIGN_PADDING((uintptr_t) heap_mark, DEFAULT_ALIGN));
         if (raw == NULL)
             return NULL;
-        result = (char *) ALIGN((uintptr_t) raw, DEFAULT_ALIGN) +
-                 ALIGN(sizeof(struct metadata), DEFAULT_ALIGN);
+        result = (char *) ALIGN((uintptr_t) raw, DEFAULT_ALIGN) + header_size;
     }
 
     /* Write metadata */
     struct metadata *md = (struct metadata *) result - 1;
-    *md = (struct metadata) {.size = block_size};
+    *md = (struct metadata) {.size = block_size, .size_class = MALLOC_CLASS_LARGE};
 
     return result;
 }
@@ -237,21 +292,68 @@ void free(void *ptr)
         guarded_size > heap_limit - (payload - header_size)) {
         return;
     }
+    if (guard_md->size_class != MALLOC_CLASS_LARGE &&
+        guard_md->size_class >= MALLOC_NUM_CLASSES) {
+        return;
+    }
 #endif
     struct metadata *md = (struct metadata *) ptr - 1;
     uint32_t block_size = md->size;
+    uint32_t size_class = md->size_class;
+    malloc_free_calls++;
 
 #if FROST_MALLOC_EVICT_FREE
     evict_l0_words_for_range((uintptr_t) ptr - header_size, block_size);
 #endif
 
+    /* Push onto the owning class list (O(1)); large blocks return to the
+     * first-fit list. */
     struct free_slot *slot = ptr - header_size;
-    slot->next = freelist;
     slot->size = block_size;
-    freelist = slot;
+    if (size_class < MALLOC_NUM_CLASSES) {
+        slot->next = class_freelist[size_class];
+        class_freelist[size_class] = slot;
+    } else {
+        slot->next = freelist;
+        freelist = slot;
+    }
 #endif
 }
 
+/* Print heap usage and free-list fragmentation over UART. */
+void malloc_stats(void)
+{
+    uint32_t heap_total = (uint32_t) (&_heap_end - &_heap_start);
+    uint32_t heap_used = (uint32_t) (heap_mark - &_heap_start);
+
+    uart_printf("malloc: %u/%u heap bytes taken, %u allocs, %u frees\n", heap_used, heap_total,
+                malloc_alloc_calls, malloc_free_calls);
+
+    for (uint32_t cls = 0; cls < MALLOC_NUM_CLASSES; ++cls) {
+        uint32_t count = 0;
+        for (struct free_slot *slot = class_freelist[cls]; slot != NULL; slot = slot->next)
+            count++;
+        if (count != 0) {
+            uart_printf("  class %4u: %u free (%u bytes)\n", malloc_class_payload[cls], count,
+                        count * malloc_class_payload[cls]);
+        }
+    }
+
+    uint32_t large_count = 0;
+    uint32_t large_bytes = 0;
+    uint32_t large_max = 0;
+    for (struct free_slot *slot = freelist; slot != NULL; slot = slot->next) {
+        large_count++;
+        large_bytes += slot->size;
+        if (slot->size > large_max)
+            large_max = slot->size;
+    }
+    if (large_count != 0) {
+        uart_printf("  large: %u fragments (%u bytes, largest %u)\n", large_count, large_bytes,
+                    large_max);
+    }
+}
+
 /* Allocate and zero an array of nmemb elements of `size` bytes each. */
 void *calloc(size_t nmemb, size_t size)
 {
@@ -0,0 +1,165 @@
+/*
+ *    Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * PC-Sampling Profiler (pcprof.c)
+ *
+ * mtimecmp-driven statistical profiler. See pcprof.h for the capture flow.
+ *
+ * The trap entry is hand-written assembly (naked): it saves the integer
+ * caller-saved registers, calls the C sample service, restores them and
+ * returns with MRET. The service itself is integer-only, so FP caller-saved
+ * state is deliberately not spilled.
+ */
+
+#include "pcprof.h"
+
+#include "trap.h"
+#include "uart.h"
+
+static uint32_t pcprof_buckets[PCPROF_BUCKET_COUNT];
+static uint32_t pcprof_base;
+static uint32_t pcprof_shift;
+static uint32_t pcprof_period;
+static uint32_t pcprof_sample_count;
+static uint32_t pcprof_other;
+static uint32_t pcprof_saved_mtvec;
+
+/* Called from pcprof_trap_entry with integer caller-saved registers spilled.
+ * Not static: the asm `call` below needs an emitted symbol. */
+void pcprof_trap_service(void)
+{
+    uint32_t cause = csr_read(mcause);
+    if (cause != 0x80000007u) {
+        /* Not the machine timer interrupt. A synchronous trap during a
+         * sampling window is a bug in the profiled code; report and stop
+         * rather than mret into a retry loop. */
+        uart_printf("pcprof: unexpected trap mcause=0x%08x mepc=0x%08x\n",
+                    (unsigned int) cause, (unsigned int) csr_read(mepc));
+        for (;;) {
+        }
+    }
+
+    uint32_t pc = csr_read(mepc);
+    uint32_t index = (pc - pcprof_base) >> pcprof_shift;
+    if (pc >= pcprof_base && index < PCPROF_BUCKET_COUNT) {
+        pcprof_buckets[index]++;
+    } else {
+        pcprof_other++;
+    }
+    pcprof_sample_count++;
+
+    /* Re-arm relative to now, not the previous compare value: if a long
+     * uninterruptible stretch swallowed several periods we want one sample,
+     * not a burst of catch-up interrupts. */
+    set_timer_cmp(rdmtime() + (uint64_t) pcprof_period);
+}
+
+/* Must be 4-byte aligned for mtvec (bits [1:0] are MODE bits) */
+__attribute__((naked, aligned(4))) static void pcprof_trap_entry(void)
+{
+    __asm__ volatile(
+        /* Spill the integer caller-saved registers */
+        "addi sp, sp, -64\n"
+        "sw ra, 0(sp)\n"
+        "sw t0, 4(sp)\n"
+        "sw t1, 8(sp)\n"
+        "sw t2, 12(sp)\n"
+        "sw t3, 16(sp)\n"
+        "sw t4, 20(sp)\n"
+        "sw t5, 24(sp)\n"
+        "sw t6, 28(sp)\n"
+        "sw a0, 32(sp)\n"
+        "sw a1, 36(sp)\n"
+        "sw a2, 40(sp)\n"
+        "sw a3, 44(sp)\n"
+        "sw a4, 48(sp)\n"
+        "sw a5, 52(sp)\n"
+        "sw a6, 56(sp)\n"
+        "sw a7, 60(sp)\n"
+        "call pcprof_trap_service\n"
+        "lw ra, 0(sp)\n"
+        "lw t0, 4(sp)\n"
+        "lw t1, 8(sp)\n"
+        "lw t2, 12(sp)\n"
+        "lw t3, 16(sp)\n"
+        "lw t4, 20(sp)\n"
+        "lw t5, 24(sp)\n"
+        "lw t6, 28(sp)\n"
+        "lw a0, 32(sp)\n"
+        "lw a1, 36(sp)\n"
+        "lw a2, 40(sp)\n"
+        "lw a3, 44(sp)\n"
+        "lw a4, 48(sp)\n"
+        "lw a5, 52(sp)\n"
+        "lw a6, 56(sp)\n"
+        "lw a7, 60(sp)\n"
+        "addi sp, sp, 64\n"
+        "mret\n");
+}
+
+void pcprof_init(uint32_t base, uint32_t size)
+{
+    pcprof_base = base;
+    /* Smallest power-of-two granularity that covers the window (minimum
+     * 4 bytes: one 32-bit instruction per bucket). */
+    pcprof_shift = 2;
+    while (((size + (1u << pcprof_shift) - 1) >> pcprof_shift) > PCPROF_BUCKET_COUNT) {
+        pcprof_shift++;
+    }
+    for (uint32_t i = 0; i < PCPROF_BUCKET_COUNT; i++) {
+        pcprof_buckets[i] = 0;
+    }
+    pcprof_sample_count = 0;
+    pcprof_other = 0;
+}
+
+void pcprof_start(uint32_t period_ticks)
+{
+    pcprof_period = period_ticks;
+    pcprof_saved_mtvec = get_trap_handler();
+    set_trap_handler(&pcprof_trap_entry);
+    set_timer_cmp(rdmtime() + (uint64_t) period_ticks);
+    enable_timer_interrupt();
+    enable_interrupts();
+}
+
+void pcprof_stop(void)
+{
+    disable_timer_interrupt();
+    /* Park the compare value so a stale MTIP cannot fire once a later
+     * handler re-enables MTIE. */
+    set_timer_cmp(UINT64_MAX);
+    csr_write(mtvec, pcprof_saved_mtvec);
+}
+
+uint32_t pcprof_samples(void)
+{
+    return pcprof_sample_count;
+}
+
+void pcprof_report(void)
+{
+    uart_printf("PCPROF-BEGIN %08x %u %u %u\n", (unsigned int) pcprof_base,
+                (unsigned int) pcprof_shift, (unsigned int) pcprof_sample_count,
+                (unsigned int) pcprof_other);
+    for (uint32_t i = 0; i < PCPROF_BUCKET_COUNT; i++) {
+        if (pcprof_buckets[i] != 0) {
+            uart_printf("%u %u\n", (unsigned int) i, (unsigned int) pcprof_buckets[i]);
+        }
+    }
+    uart_printf("PCPROF-END\n");
+}
@@ -61,22 +61,76 @@ static void ctx_term(OutCtx *c)
 
 /* ── Integer conversion ────────────────────────────────────────────────── */
 
+/* Two digits at a time: halves the divisions on the decimal path. Every
+ * conversion (including the %f/%e/%g integer-scaled parts) funnels through
+ * u64str, so this is the digit hot path for telemetry-style output. */
+static const char kDigitPairs[201] = "00010203040506070809"
+                                     "10111213141516171819"
+                                     "20212223242526272829"
+                                     "30313233343536373839"
+                                     "40414243444546474849"
+                                     "50515253545556575859"
+                                     "60616263646566676869"
+                                     "70717273747576777879"
+                                     "80818283848586878889"
+                                     "90919293949596979899";
+
 #define IBUF 66
 static const char *u64str(uint64_t v, unsigned base, bool up, char buf[IBUF], size_t *ol)
 {
     static const char lo[] = "0123456789abcdef", hi[] = "0123456789ABCDEF";
     const char *d = up ? hi : lo;
-    size_t i = IBUF;
-    buf[--i] = '\0';
-    if (!v)
-        buf[--i] = '0';
-    else
-        while (v) {
-            buf[--i] = d[v % base];
-            v /= base;
+    char *end = &buf[IBUF - 1];
+    char *s = end;
+    *end = '\0';
+
+    if (base == 10) {
+        /* RV32 has no hardware 64-bit divide, so peel nine-digit chunks with
+         * one (software) 64-bit division each until the value fits in 32
+         * bits, then finish with hardware 32-bit divisions via the pair
+         * table. */
+        while (v > UINT32_MAX) {
+            uint64_t q = v / 1000000000ULL;
+            uint32_t r = (uint32_t) (v - q * 1000000000ULL);
+            v = q;
+            for (int k = 0; k < 4; k++) {
+                uint32_t pr = r % 100u;
+                r /= 100u;
+                *--s = kDigitPairs[2 * pr + 1];
+                *--s = kDigitPairs[2 * pr];
+            }
+            *--s = (char) ('0' + r);
+        }
+        uint32_t v32 = (uint32_t) v;
+        while (v32 >= 100u) {
+            uint32_t pr = v32 % 100u;
+            v32 /= 100u;
+            *--s = kDigitPairs[2 * pr + 1];
+            *--s = kDigitPairs[2 * pr];
         }
-    *ol = IBUF - 1 - i;
-    return &buf[i];
+        if (v32 >= 10u) {
+            *--s = kDigitPairs[2 * v32 + 1];
+            *--s = kDigitPairs[2 * v32];
+        } else if (v32 != 0 || s == end) {
+            *--s = (char) ('0' + v32);
+        }
+    } else if (base == 16 || base == 8) {
+        /* Power-of-two bases need no division at all */
+        unsigned shift = (base == 16) ? 4u : 3u;
+        unsigned mask = base - 1u;
+        do {
+            *--s = d[v & mask];
+            v >>= shift;
+        } while (v);
+    } else {
+        do {
+            *--s = d[v % base];
+            v /= base;
+        } while (v);
+    }
+
+    *ol = (size_t) (end - s);
+    return s;
 }
 
 /* ── Floating-point helpers ────────────────────────────────────────────── */
@@ -21,8 +21,10 @@
  * bare-metal use. Provides memory operations (memset, memcpy) and string
  * operations (strlen, strncpy, strcmp, strncmp, strchr, strstr).
  *
- * These implementations prioritize correctness and code size over speed,
- * using simple byte-by-byte operations rather than word-sized optimizations.
+ * The bulk memory routines (memset, memcpy, memcmp) carry word-wide fast
+ * paths with 4x unrolling and byte head/tail handling, since compression and
+ * image workloads spend double-digit cycle percentages in them; the string
+ * routines stay simple byte-by-byte implementations.
  */
 
 #include "string.h"
@@ -45,62 +47,121 @@ static inline void frost_memory_write_fence(void) {}
 #endif
 
 /* Fill memory region with specified byte value.
- * Fast path writes one machine word at a time when the destination and length
- * are word-aligned; otherwise falls back to a byte fill. */
+ * Byte head to reach word alignment, then 4x-unrolled 32-bit stores, then a
+ * byte tail. Short fills skip straight to the byte loop. */
 void *memset(void *dst, int c, size_t n)
 {
-    if ((((uintptr_t) dst | n) & (sizeof(uintptr_t) - 1)) == 0) {
-        uintptr_t word = (unsigned char) c;
+    unsigned char *p = (unsigned char *) dst;
+
+    if (n >= 2 * sizeof(uint32_t)) {
+        uint32_t word = (unsigned char) c;
         word |= word << 8;
         word |= word << 16;
-#if UINTPTR_MAX > 0xffffffffU
-        word |= word << 32;
-#endif
-        uintptr_t *d = (uintptr_t *) dst;
-        uintptr_t *end = (uintptr_t *) ((char *) dst + n);
-        while (d < end)
-            *d++ = word;
-    } else {
-        unsigned char *p = (unsigned char *) dst;
-        while (n--)
+
+        /* Byte head: align the destination to a word boundary */
+        while ((uintptr_t) p & (sizeof(uint32_t) - 1)) {
             *p++ = (unsigned char) c;
+            n--;
+        }
+
+        uint32_t *w = (uint32_t *) p;
+        size_t words = n / sizeof(uint32_t);
+        while (words >= 4) {
+            w[0] = word;
+            w[1] = word;
+            w[2] = word;
+            w[3] = word;
+            w += 4;
+            words -= 4;
+        }
+        while (words--)
+            *w++ = word;
+        p = (unsigned char *) w;
+        n &= sizeof(uint32_t) - 1;
     }
+
+    /* Byte tail (and whole short fills) */
+    while (n--)
+        *p++ = (unsigned char) c;
     frost_memory_write_fence();
     return dst;
 }
 
 /* Copy memory from source to destination.
- * Fast path copies machine words (8-word unrolled blocks) at a time when the
- * source, destination, and length are all word-aligned; otherwise falls back to
- * a byte copy. Roughly 4x fewer loads/stores than byte-wise for aligned bulk
- * copies. Does not handle overlap (use memmove for that). */
+ * A byte head aligns the destination, then the bulk moves as 32-bit words
+ * (4x unrolled), then a byte tail finishes. When the source lands word-aligned
+ * too the bulk is plain word loads; when the two pointers are mutually
+ * misaligned, aligned source words are read and shift-merged into aligned
+ * destination stores, so no word loop ever issues a misaligned access.
+ * Does not handle overlap (use memmove for that). */
 void *memcpy(void *dst, const void *src, size_t n)
 {
-    if ((((uintptr_t) dst | (uintptr_t) src | n) & (sizeof(uintptr_t) - 1)) == 0) {
-        uintptr_t *d = (uintptr_t *) dst;
-        const uintptr_t *s = (const uintptr_t *) src;
-        uintptr_t *end = (uintptr_t *) ((char *) dst + n);
-        while (d + 8 < end) {
-            uintptr_t reg[8] = {s[0], s[1], s[2], s[3], s[4], s[5], s[6], s[7]};
-            d[0] = reg[0];
-            d[1] = reg[1];
-            d[2] = reg[2];
-            d[3] = reg[3];
-            d[4] = reg[4];
-            d[5] = reg[5];
-            d[6] = reg[6];
-            d[7] = reg[7];
-            d += 8;
-            s += 8;
-        }
-        while (d < end)
-            *d++ = *s++;
-    } else {
-        unsigned char *d = (unsigned char *) dst;
-        const unsigned char *s = (const unsigned char *) src;
-        while (n--)
+    unsigned char *d = (unsigned char *) dst;
+    const unsigned char *s = (const unsigned char *) src;
+
+    if (n >= 2 * sizeof(uint32_t)) {
+        /* Byte head: align the destination to a word boundary */
+        while ((uintptr_t) d & (sizeof(uint32_t) - 1)) {
             *d++ = *s++;
+            n--;
+        }
+
+        uint32_t *dw = (uint32_t *) d;
+        size_t words = n / sizeof(uint32_t);
+
+        if (((uintptr_t) s & (sizeof(uint32_t) - 1)) == 0) {
+            /* Co-aligned bulk: 4x-unrolled word copy */
+            const uint32_t *sw = (const uint32_t *) s;
+            while (words >= 4) {
+                uint32_t w0 = sw[0], w1 = sw[1], w2 = sw[2], w3 = sw[3];
+                dw[0] = w0;
+                dw[1] = w1;
+                dw[2] = w2;
+                dw[3] = w3;
+                dw += 4;
+                sw += 4;
+                words -= 4;
+            }
+            while (words--)
+                *dw++ = *sw++;
+            s = (const unsigned char *) sw;
+        } else {
+            /* Mutually misaligned bulk: read aligned source words and merge
+             * neighbouring pairs with shifts (little-endian: the older word
+             * supplies the low bytes). The aligned reads may touch up to
+             * three bytes outside the source buffer but stay within the
+             * words containing its first and last bytes, which is harmless
+             * on this flat bare-metal memory map. */
+            size_t off = (uintptr_t) s & (sizeof(uint32_t) - 1);
+            const uint32_t *sw = (const uint32_t *) (s - off);
+            unsigned shift_lo = 8u * (unsigned) off;
+            unsigned shift_hi = 32u - shift_lo;
+            uint32_t lo = *sw++;
+            while (words >= 4) {
+                uint32_t w0 = sw[0], w1 = sw[1], w2 = sw[2], w3 = sw[3];
+                dw[0] = (lo >> shift_lo) | (w0 << shift_hi);
+                dw[1] = (w0 >> shift_lo) | (w1 << shift_hi);
+                dw[2] = (w1 >> shift_lo) | (w2 << shift_hi);
+                dw[3] = (w2 >> shift_lo) | (w3 << shift_hi);
+                lo = w3;
+                dw += 4;
+                sw += 4;
+                words -= 4;
+            }
+            while (words--) {
+                uint32_t hi = *sw++;
+                *dw++ = (lo >> shift_lo) | (hi << shift_hi);
+                lo = hi;
+            }
+            s = (const unsigned char *) sw - sizeof(uint32_t) + off;
+        }
+        d = (unsigned char *) dw;
+        n &= sizeof(uint32_t) - 1;
     }
+
+    /* Byte tail (and whole short copies) */
+    while (n--)
+        *d++ = *s++;
     frost_memory_write_fence();
     return dst;
 }
@@ -132,14 +193,47 @@ void *memmove(void *dst, const void *src, size_t n)
     return dst;
 }
 
-/* Compare two memory regions byte-by-byte
+/* Compare two memory regions
  * Returns: 0 if equal, <0 if s1 < s2, >0 if s1 > s2
- */
+ * When both pointers share the same word alignment, whole 32-bit words are
+ * compared (4x unrolled) until one differs, and the byte loop then locates
+ * the differing byte; mutually misaligned inputs compare bytewise. */
 int memcmp(const void *s1, const void *s2, size_t n)
 {
     const unsigned char *p1 = s1;
     const unsigned char *p2 = s2;
 
+    if (n >= 2 * sizeof(uint32_t) &&
+        (((uintptr_t) p1 ^ (uintptr_t) p2) & (sizeof(uint32_t) - 1)) == 0) {
+        /* Byte head: reach a shared word boundary */
+        while ((uintptr_t) p1 & (sizeof(uint32_t) - 1)) {
+            if (*p1 != *p2) {
+                return *p1 - *p2;
+            }
+            p1++;
+            p2++;
+            n--;
+        }
+
+        const uint32_t *w1 = (const uint32_t *) p1;
+        const uint32_t *w2 = (const uint32_t *) p2;
+        size_t words = n / sizeof(uint32_t);
+        while (words >= 4 && w1[0] == w2[0] && w1[1] == w2[1] &&
+               w1[2] == w2[2] && w1[3] == w2[3]) {
+            w1 += 4;
+            w2 += 4;
+            words -= 4;
+        }
+        while (words > 0 && *w1 == *w2) {
+            w1++;
+            w2++;
+            words--;
+        }
+        p1 = (const unsigned char *) w1;
+        p2 = (const unsigned char *) w2;
+        n = words * sizeof(uint32_t) + (n & (sizeof(uint32_t) - 1));
+    }
+
     while (n--) {
         if (*p1 != *p2) {
             return *p1 - *p2;
@@ -25,10 +25,13 @@
  *   - Automatic CR+LF line ending conversion
  *   - Printf format specifiers: %c, %s, %d, %u, %x, %X, %ld, %lu, %lld, %llu, %f
  *   - Field width and zero-padding support (e.g., %08x, %4d)
+ *   - Interrupt-driven async transmit path (ring buffer drained on MEIP)
  */
 
 #include "uart.h"
 #include "mmio.h"
+#include "sprintf.h"
+#include "trap.h"
 
 #include <stdarg.h>
 
@@ -341,6 +344,85 @@ void uart_printf(const char *fmt, ...)
     va_end(args);
 }
 
+/* ------------------------------------------------------------------------- */
+/* asynchronous (interrupt-driven) transmit                                  */
+/* ------------------------------------------------------------------------- */
+
+/* Single-producer/single-consumer ring: mainline code owns the head, the
+ * trap handler owns the tail. The free-running 32-bit indices are masked on
+ * access, so full/empty never need a spare slot. */
+#define UART_TX_RING_MASK (UART_TX_RING_SIZE - 1u)
+
+static char uart_tx_ring[UART_TX_RING_SIZE];
+static volatile uint32_t uart_tx_ring_head; /* next slot to fill (producer) */
+static volatile uint32_t uart_tx_ring_tail; /* next byte to send (handler) */
+
+int uart_tx_service(void)
+{
+    while (uart_tx_ring_tail != uart_tx_ring_head && uart_tx_ready()) {
+        UART_TX = (uint8_t) uart_tx_ring[uart_tx_ring_tail & UART_TX_RING_MASK];
+        ++uart_tx_ring_tail;
+    }
+    if (uart_tx_ring_tail == uart_tx_ring_head) {
+        /* Ring empty: stop the level interrupt until the next enqueue. */
+        UART_TX_CTRL = 0;
+        return 0;
+    }
+    return 1;
+}
+
+/* Drain with the handler masked out, so this path and the handler never both
+ * consume the tail. Used when the producer must wait (full ring, drain). */
+static void uart_tx_service_masked(void)
+{
+    uint32_t prev = disable_interrupts();
+    uart_tx_service();
+    restore_interrupts(prev);
+}
+
+static void uart_tx_ring_put(char c)
+{
+    /* Ring full: make space in-line. This is the blocking fallback; it also
+     * keeps the async path functional when interrupts were never enabled. */
+    while (uart_tx_ring_head - uart_tx_ring_tail >= UART_TX_RING_SIZE)
+        uart_tx_service_masked();
+
+    uart_tx_ring[uart_tx_ring_head & UART_TX_RING_MASK] = c;
+    /* Order the data store before the head publish (the handler may preempt
+     * between them and must not read a stale slot). */
+    __asm__ volatile("" ::: "memory");
+    ++uart_tx_ring_head;
+}
+
+void uart_puts_async(const char *s)
+{
+    while (*s) {
+        if (*s == '\n')
+            uart_tx_ring_put('\r');
+        uart_tx_ring_put(*s++);
+    }
+    /* Arm the drain interrupt; level-sensitive, so this is idempotent. */
+    UART_TX_CTRL = UART_TX_IRQ_ENABLE;
+}
+
+void uart_printf_async(const char *fmt, ...)
+{
+    char buf[UART_ASYNC_MSG_MAX];
+    va_list args;
+
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    uart_puts_async(buf);
+}
+
+void uart_tx_drain(void)
+{
+    while (uart_tx_ring_tail != uart_tx_ring_head)
+        uart_tx_service_masked();
+}
+
 /* ------------------------------------------------------------------------- */
 /* UART Receive Functions                                                    */
 /* ------------------------------------------------------------------------- */
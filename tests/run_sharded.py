@@ -0,0 +1,603 @@
+#!/usr/bin/env python3
+
+#    Copyright 2026 Two Sigma Open Source, LLC
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+
+"""Sharded parallel runner for the full cocotb validation suite.
+
+Partitions the whole TEST_REGISTRY (unit benches + real-program tests) plus
+the long random-regression ("torture") tests from cocotb_tests/test_cpu.py
+into independent shard jobs and runs them across all host cores. Each shard
+gets its own seed (base + k * SHARD_SEED_STRIDE), its own run directory
+(sw.mem symlinks, results.xml, log), and a Verilator build directory shared
+per build signature so the expensive full-chip verilation happens once, not
+once per program. The random-regression tests are additionally split into
+DEFAULT_TORTURE_SEGMENTS shorter segments via the COCOTB_NUM_TEST_LOOPS
+override in TestConfig, so a 24000-instruction run becomes N parallel
+independently-seeded runs of 24000/N instructions each.
+
+Shard geometry and seed derivation constants live in verif/config.py
+(DEFAULT_TORTURE_SEGMENTS, TORTURE_SEGMENT_MIN_LOOPS, DEFAULT_SHARD_SEED_BASE,
+SHARD_SEED_STRIDE).
+
+Standalone only (no pytest integration -- this is an orchestrator over tests
+that already have pytest entry points):
+
+    ./run_sharded.py                          # unit + programs + torture
+    ./run_sharded.py --suites torture         # just the segmented random tests
+    ./run_sharded.py --suites all             # also arch compliance + riscv-tests
+    ./run_sharded.py --jobs 8 --seed-base 42
+    ./run_sharded.py --filter coremark        # only jobs whose name matches
+    ./run_sharded.py --list
+
+The arch-compliance and riscv-tests suites keep their own per-test
+parallelism (test_arch_compliance.py / test_riscv_tests.py --parallel); when
+selected they run as delegated phases with --parallel set to the job count.
+"""
+
+import argparse
+import hashlib
+import os
+import subprocess
+import sys
+import tempfile
+import time
+from concurrent.futures import ProcessPoolExecutor, as_completed
+from dataclasses import dataclass, field
+from pathlib import Path
+
+from test_run_cocotb import (
+    CPU_TEST_MODULES,
+    DDR_TIER_EXCLUDE,
+    REAL_PROGRAM_TESTS,
+    TEST_REGISTRY,
+    UNIT_TESTS,
+    CocotbRunner,
+)
+
+# Directory layout
+TESTS_DIR = Path(__file__).parent.resolve()
+REPO_ROOT = TESTS_DIR.parent
+SW_APPS_DIR = REPO_ROOT / "sw" / "apps"
+# Per-build-signature Verilator build dirs, persistent across runs for
+# incremental rebuilds (gitignored).
+SHARD_BUILDS_DIR = TESTS_DIR / "shard_builds"
+
+sys.path.insert(0, str(REPO_ROOT / "verif"))
+try:
+    from config import (
+        DEFAULT_SHARD_SEED_BASE,
+        DEFAULT_TORTURE_SEGMENTS,
+        SHARD_SEED_STRIDE,
+        TORTURE_SEGMENT_MIN_LOOPS,
+        DEFAULT_NUM_TEST_LOOPS,
+    )
+finally:
+    sys.path.pop(0)
+
+sys.path.insert(0, str(SW_APPS_DIR))
+try:
+    from software_registry import app_build_directory_name
+finally:
+    sys.path.pop(0)
+
+# The long random-regression tests in cocotb_tests/test_cpu.py with their
+# serial instruction counts (TestConfig num_loops as written in the test
+# wrappers). These are the tests worth segmenting: everything else in
+# CPU_TEST_MODULES is directed and short.
+TORTURE_TESTS: tuple[tuple[str, int], ...] = (
+    ("test_random_riscv_regression", DEFAULT_NUM_TEST_LOOPS),
+    ("test_random_riscv_regression_force_one_address", DEFAULT_NUM_TEST_LOOPS),
+    ("test_random_riscv_regression_with_fp", 24000),
+    ("test_random_riscv_regression_fp_heavy", 24000),
+    ("test_random_riscv_regression_with_fp_double", 24000),
+    ("test_random_riscv_regression_fp_double_heavy", 24000),
+    ("test_random_riscv_regression_with_fp_mixed", 24000),
+    ("test_random_riscv_regression_fp_mixed_heavy", 24000),
+)
+
+# Rough wall-clock weights for longest-job-first scheduling. Unlisted real
+# programs default to 4, unit benches to 2 (see _job_weight).
+HEAVY_PROGRAM_WEIGHT = {
+    "coremark": 10,
+    "freertos_demo": 10,
+    "isa_test": 8,
+    "fpu_test": 8,
+    "tomasulo_perf": 8,
+    "ddr_heap_test": 8,
+}
+
+SUITE_CHOICES = ("unit", "programs", "torture", "arch", "isa", "all")
+DEFAULT_SUITES = ("unit", "programs", "torture")
+
+
+@dataclass(frozen=True)
+class ShardJob:
+    """One independently-runnable simulation shard."""
+
+    name: str
+    python_test_module: str
+    hdl_toplevel_module: str
+    app_name: str | None = None
+    verilator_extra_args: tuple[str, ...] = ()
+    test_filter: str | None = None  # COCOTB_TEST_FILTER regex
+    num_loops: int | None = None  # COCOTB_NUM_TEST_LOOPS segment override
+    weight: int = 4
+
+    @property
+    def build_signature(self) -> str:
+        """Key for the shared Verilator build dir: toplevel + extra args."""
+        sig = self.hdl_toplevel_module
+        if self.verilator_extra_args:
+            digest = hashlib.sha1(
+                " ".join(self.verilator_extra_args).encode()
+            ).hexdigest()[:8]
+            sig += f"_{digest}"
+        return sig
+
+
+@dataclass
+class JobResult:
+    """Result of a single shard job."""
+
+    name: str
+    passed: bool
+    seed: int
+    duration_s: float
+    log_path: str
+    message: str = ""
+    repro: str = ""
+
+
+def build_jobs(
+    suites: tuple[str, ...],
+    torture_segments: int,
+    mem_config: str,
+) -> list[ShardJob]:
+    """Enumerate shard jobs for the selected pooled suites."""
+    jobs: list[ShardJob] = []
+
+    if "unit" in suites:
+        for name in UNIT_TESTS:
+            cfg = TEST_REGISTRY[name]
+            jobs.append(
+                ShardJob(
+                    name=name,
+                    python_test_module=cfg.python_test_module,
+                    hdl_toplevel_module=cfg.hdl_toplevel_module,
+                    verilator_extra_args=cfg.verilator_extra_args,
+                    weight=2,
+                )
+            )
+
+    if "programs" in suites:
+        for name in REAL_PROGRAM_TESTS:
+            if mem_config == "ddr" and name in DDR_TIER_EXCLUDE:
+                continue
+            cfg = TEST_REGISTRY[name]
+            weight = HEAVY_PROGRAM_WEIGHT.get(name, 4)
+            if name.startswith("coremark_pro"):
+                weight = 10
+            jobs.append(
+                ShardJob(
+                    name=name,
+                    python_test_module=cfg.python_test_module,
+                    hdl_toplevel_module=cfg.hdl_toplevel_module,
+                    app_name=cfg.app_name,
+                    verilator_extra_args=cfg.verilator_extra_args,
+                    weight=weight,
+                )
+            )
+
+    if "torture" in suites:
+        for testcase, total_loops in TORTURE_TESTS:
+            # Clamp so no segment drops below the meaningful-coverage floor.
+            segments = max(
+                1, min(torture_segments, total_loops // TORTURE_SEGMENT_MIN_LOOPS)
+            )
+            loops = total_loops // segments
+            for segment in range(segments):
+                jobs.append(
+                    ShardJob(
+                        name=f"{testcase}.seg{segment}",
+                        python_test_module="cocotb_tests.test_cpu",
+                        hdl_toplevel_module="cpu_tb",
+                        test_filter=f"{testcase}$",
+                        num_loops=loops,
+                        weight=8,
+                    )
+                )
+        # The directed companions of the random suite, unsegmented.
+        directed_modules = ",".join(
+            m for m in CPU_TEST_MODULES.split(",") if m != "cocotb_tests.test_cpu"
+        )
+        jobs.append(
+            ShardJob(
+                name="cpu_directed",
+                python_test_module=directed_modules,
+                hdl_toplevel_module="cpu_tb",
+                weight=6,
+            )
+        )
+
+    return jobs
+
+
+def compile_apps(jobs: list[ShardJob], mem_config: str) -> list[str]:
+    """Compile every app the job list needs, once each, before the pool starts.
+
+    Parallel workers then only read the compiled images (via symlinks into
+    sw/apps), so concurrent jobs for the same app (e.g. hello_world and its
+    fetch-fuzz variant) never race in a shared build directory.
+
+    Returns the list of app names that failed to compile.
+    """
+    app_names = sorted({job.app_name for job in jobs if job.app_name})
+    if not app_names:
+        return []
+
+    sys.path.insert(0, str(SW_APPS_DIR))
+    try:
+        from compile_app import compile_app
+
+        failed = []
+        for app_name in app_names:
+            print(f"  Compiling {app_name} (mem-config={mem_config})...")
+            if not compile_app(
+                app_name, verbose=False, mem_config=mem_config, clean_first=True
+            ):
+                failed.append(app_name)
+        return failed
+    finally:
+        sys.path.pop(0)
+
+
+def _job_env(job: ShardJob, seed: int, build_dir: Path) -> dict[str, str]:
+    """Environment for one shard job's make invocation."""
+    env = os.environ.copy()
+    env["SIM"] = "verilator"
+    env["ROOT"] = str(REPO_ROOT)
+    env["SIM_BUILD"] = str(build_dir)
+    env["FROST_VERILATOR_EXTRA_ARGS"] = " ".join(job.verilator_extra_args)
+    env["COCOTB_RANDOM_SEED"] = str(seed)
+    verif_path = str(REPO_ROOT / "verif")
+    pythonpath = env.get("PYTHONPATH", "")
+    if verif_path not in pythonpath:
+        env["PYTHONPATH"] = verif_path + ":" + pythonpath
+    if job.test_filter:
+        env["COCOTB_TEST_FILTER"] = job.test_filter
+    if job.num_loops is not None:
+        env["COCOTB_NUM_TEST_LOOPS"] = str(job.num_loops)
+    return env
+
+
+def _repro_command(job: ShardJob, seed: int) -> str:
+    """A copy-pasteable command reproducing the shard serially."""
+    if job.name in TEST_REGISTRY:
+        return f"./test_run_cocotb.py {job.name} --random-seed={seed}"
+    parts = [f"COCOTB_RANDOM_SEED={seed}"]
+    if job.test_filter:
+        parts.append(f"COCOTB_TEST_FILTER='{job.test_filter}'")
+    if job.num_loops is not None:
+        parts.append(f"COCOTB_NUM_TEST_LOOPS={job.num_loops}")
+    parts.append(
+        f"make -C tests COCOTB_TEST_MODULES='{job.python_test_module}' "
+        f"TOPLEVEL={job.hdl_toplevel_module}"
+    )
+    return " ".join(parts)
+
+
+def _run_shard_job(
+    job: ShardJob, seed: int, workdir_str: str, build_dir_str: str
+) -> JobResult:
+    """Worker: run one shard in a private run directory.
+
+    The run directory isolates everything written at runtime (sw.mem symlinks,
+    results.xml, waveforms, the log); only the Verilator build dir is shared,
+    and only read-read shared once the warm-up wave has built it.
+    """
+    workdir = Path(workdir_str)
+    workdir.mkdir(parents=True, exist_ok=True)
+    log_path = workdir / "run.log"
+    env = _job_env(job, seed, Path(build_dir_str))
+
+    # The sw.mem symlink must point into sw/apps/<app>/ because
+    # test_real_program.py derives the app name (and thus its cycle budget
+    # and pass criteria) from the link target path.
+    if job.app_name:
+        app_dir = SW_APPS_DIR / app_build_directory_name(job.app_name)
+        for mem_name in ("sw.mem", "sw_ddr.mem"):
+            link = workdir / mem_name
+            if link.exists() or link.is_symlink():
+                link.unlink()
+            source = app_dir / mem_name
+            if source.exists():
+                link.symlink_to(source)
+            else:
+                link.touch()
+
+    cmd = (
+        f"make -f {TESTS_DIR / 'Makefile'} "
+        f"COCOTB_TEST_MODULES='{job.python_test_module}' "
+        f"TOPLEVEL={job.hdl_toplevel_module}"
+    )
+
+    start = time.monotonic()
+    try:
+        result = subprocess.run(
+            ["bash", "-c", cmd],
+            cwd=workdir,
+            env=env,
+            capture_output=True,
+            text=True,
+        )
+    except Exception as e:  # noqa: BLE001 - report, don't kill the pool
+        return JobResult(
+            name=job.name,
+            passed=False,
+            seed=seed,
+            duration_s=time.monotonic() - start,
+            log_path=str(log_path),
+            message=str(e),
+            repro=_repro_command(job, seed),
+        )
+    duration = time.monotonic() - start
+
+    combined = (result.stdout or "") + (result.stderr or "")
+    log_path.write_text(combined)
+
+    checker = CocotbRunner(
+        python_test_module=job.python_test_module,
+        hdl_toplevel_module=job.hdl_toplevel_module,
+    )
+    passed = not checker.check_for_failures(result)
+    message = ""
+    if not passed:
+        lines = combined.strip().splitlines()
+        message = "\n".join(lines[-15:]) if lines else "Unknown error"
+
+    return JobResult(
+        name=job.name,
+        passed=passed,
+        seed=seed,
+        duration_s=duration,
+        log_path=str(log_path),
+        message=message,
+        repro=_repro_command(job, seed),
+    )
+
+
+def run_pooled_jobs(
+    jobs: list[ShardJob], max_workers: int, seed_base: int, workdir_root: Path
+) -> list[JobResult]:
+    """Run shard jobs across the worker pool in two waves.
+
+    Wave 1 runs one job per distinct build signature so each shared Verilator
+    build directory is created by exactly one process; wave 2 runs the rest
+    against the now-warm builds (make sees them up to date and just executes
+    the binary). Within each wave, heaviest jobs launch first.
+    """
+    SHARD_BUILDS_DIR.mkdir(exist_ok=True)
+    seeds = {job.name: seed_base + k * SHARD_SEED_STRIDE for k, job in enumerate(jobs)}
+
+    warmup: list[ShardJob] = []
+    rest: list[ShardJob] = []
+    seen_signatures: set[str] = set()
+    for job in sorted(jobs, key=lambda j: j.weight, reverse=True):
+        if job.build_signature in seen_signatures:
+            rest.append(job)
+        else:
+            seen_signatures.add(job.build_signature)
+            warmup.append(job)
+
+    results: list[JobResult] = []
+    for wave_name, wave in (("build+run", warmup), ("run", rest)):
+        if not wave:
+            continue
+        print(
+            f"\n--- Wave '{wave_name}': {len(wave)} job(s) "
+            f"on up to {max_workers} worker(s) ---"
+        )
+        with ProcessPoolExecutor(max_workers=max_workers) as executor:
+            futures = {
+                executor.submit(
+                    _run_shard_job,
+                    job,
+                    seeds[job.name],
+                    str(workdir_root / job.name),
+                    str(SHARD_BUILDS_DIR / job.build_signature),
+                ): job
+                for job in wave
+            }
+            for future in as_completed(futures):
+                job = futures[future]
+                try:
+                    result = future.result()
+                except Exception as e:  # noqa: BLE001
+                    result = JobResult(
+                        name=job.name,
+                        passed=False,
+                        seed=seeds[job.name],
+                        duration_s=0.0,
+                        log_path="",
+                        message=str(e),
+                        repro=_repro_command(job, seeds[job.name]),
+                    )
+                results.append(result)
+                status = "PASS" if result.passed else "FAIL"
+                print(f"  {result.name:50s} {status}  ({result.duration_s:6.1f}s)")
+
+    return results
+
+
+def run_delegated_suite(suite: str, jobs: int) -> bool:
+    """Run arch compliance / riscv-tests via their own parallel runners."""
+    runner = {
+        "arch": "test_arch_compliance.py",
+        "isa": "test_riscv_tests.py",
+    }[suite]
+    print(f"\n--- Delegated suite '{suite}': ./{runner} --parallel {jobs} ---")
+    args = [sys.executable, str(TESTS_DIR / runner), "--all", "--parallel", str(jobs)]
+    result = subprocess.run(args, cwd=TESTS_DIR)
+    return result.returncode == 0
+
+
+def print_report(
+    results: list[JobResult],
+    delegated: dict[str, bool],
+    wall_s: float,
+) -> bool:
+    """Merged report across pooled shards and delegated suites."""
+    failed = [r for r in results if not r.passed]
+    serial_s = sum(r.duration_s for r in results)
+
+    print(f"\n{'=' * 60}")
+    print("SHARDED REGRESSION REPORT")
+    print(f"{'=' * 60}")
+    print(f"Shard jobs:   {len(results)}")
+    print(f"Passed:       {len(results) - len(failed)}")
+    print(f"Failed:       {len(failed)}")
+    print(f"Wall clock:   {wall_s:.1f}s (serialized shard time: {serial_s:.1f}s)")
+    for suite, ok in delegated.items():
+        print(f"Suite '{suite}': {'PASS' if ok else 'FAIL'} (own report above)")
+
+    if failed:
+        print("\nFailed shards (log + repro):")
+        for r in sorted(failed, key=lambda r: r.name):
+            print(f"  {r.name}  (seed {r.seed})")
+            if r.log_path:
+                print(f"    log:   {r.log_path}")
+            print(f"    repro: {r.repro}")
+    print(f"{'=' * 60}\n")
+
+    return not failed and all(delegated.values())
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(
+        description="Sharded parallel runner for the Frost cocotb suite",
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+Examples:
+  %(prog)s                              # unit + programs + torture, all cores
+  %(prog)s --suites torture --jobs 8    # segmented random regressions only
+  %(prog)s --suites all                 # also arch compliance + riscv-tests
+  %(prog)s --filter frost_cache         # only the cache-shape benches
+""",
+    )
+    parser.add_argument(
+        "--suites",
+        default=",".join(DEFAULT_SUITES),
+        help=f"Comma-separated suites from {SUITE_CHOICES} "
+        f"(default: {','.join(DEFAULT_SUITES)})",
+    )
+    parser.add_argument(
+        "--jobs",
+        type=int,
+        default=os.cpu_count() or 4,
+        help="Parallel workers (default: host core count)",
+    )
+    parser.add_argument(
+        "--seed-base",
+        type=int,
+        default=DEFAULT_SHARD_SEED_BASE,
+        help="Base seed; shard k runs with base + k * "
+        f"{SHARD_SEED_STRIDE} (default: {DEFAULT_SHARD_SEED_BASE})",
+    )
+    parser.add_argument(
+        "--torture-segments",
+        type=int,
+        default=DEFAULT_TORTURE_SEGMENTS,
+        help="Segments per random-regression test "
+        f"(default: {DEFAULT_TORTURE_SEGMENTS}, clamped so each segment "
+        f"keeps >= {TORTURE_SEGMENT_MIN_LOOPS} instructions)",
+    )
+    parser.add_argument(
+        "--filter",
+        default=None,
+        help="Only run shard jobs whose name contains this substring",
+    )
+    parser.add_argument(
+        "--keep-workdirs",
+        action="store_true",
+        help="Keep per-shard run directories (default: temp, deleted on exit)",
+    )
+    parser.add_argument(
+        "--list",
+        action="store_true",
+        help="List the shard jobs that would run and exit",
+    )
+    args = parser.parse_args()
+
+    suites = tuple(s.strip() for s in args.suites.split(",") if s.strip())
+    for suite in suites:
+        if suite not in SUITE_CHOICES:
+            parser.error(f"unknown suite '{suite}' (choose from {SUITE_CHOICES})")
+    if "all" in suites:
+        suites = tuple(s for s in SUITE_CHOICES if s != "all")
+
+    mem_config = os.environ.get("FROST_COCOTB_MEM_CONFIG", "bram")
+    jobs = build_jobs(suites, args.torture_segments, mem_config)
+    if args.filter:
+        jobs = [j for j in jobs if args.filter in j.name]
+
+    if args.list:
+        print(f"{len(jobs)} shard job(s):")
+        for job in jobs:
+            extras = []
+            if job.num_loops is not None:
+                extras.append(f"loops={job.num_loops}")
+            if job.verilator_extra_args:
+                extras.append(" ".join(job.verilator_extra_args))
+            suffix = f"  [{', '.join(extras)}]" if extras else ""
+            print(f"  {job.name:50s} {job.hdl_toplevel_module}{suffix}")
+        sys.exit(0)
+
+    start = time.monotonic()
+    results: list[JobResult] = []
+    delegated: dict[str, bool] = {}
+
+    if jobs:
+        print(f"Compiling applications for {len(jobs)} shard job(s)...")
+        compile_failures = compile_apps(jobs, mem_config)
+        if compile_failures:
+            print(f"ERROR: app compilation failed: {', '.join(compile_failures)}")
+            sys.exit(1)
+
+        if args.keep_workdirs:
+            workdir_root = Path(
+                tempfile.mkdtemp(prefix="frost_shards_", dir=tempfile.gettempdir())
+            )
+            print(f"Shard run directories kept under {workdir_root}")
+            results = run_pooled_jobs(jobs, args.jobs, args.seed_base, workdir_root)
+        else:
+            with tempfile.TemporaryDirectory(prefix="frost_shards_") as tmp:
+                results = run_pooled_jobs(jobs, args.jobs, args.seed_base, Path(tmp))
+                # Preserve failure logs before the temp tree goes away.
+                for r in results:
+                    if not r.passed and r.log_path and Path(r.log_path).exists():
+                        saved = TESTS_DIR / f"shard_fail_{r.name}.log"
+                        saved.write_text(Path(r.log_path).read_text())
+                        r.log_path = str(saved)
+
+    for suite in ("arch", "isa"):
+        if suite in suites:
+            delegated[suite] = run_delegated_suite(suite, args.jobs)
+
+    ok = print_report(results, delegated, time.monotonic() - start)
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
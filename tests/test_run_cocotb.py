@@ -199,6 +199,12 @@ TEST_REGISTRY: dict[str, CocotbRunConfig] = {
         app_name="memory_test",
         description="Memory allocator test suite",
     ),
+    "microbench": CocotbRunConfig(
+        python_test_module="cocotb_tests.test_real_program",
+        hdl_toplevel_module="frost",
+        app_name="microbench",
+        description="Microbenchmark suite with machine-readable CSV output",
+    ),
     "packet_parser": CocotbRunConfig(
         python_test_module="cocotb_tests.test_real_program",
         hdl_toplevel_module="frost",
@@ -404,11 +410,46 @@ TEST_REGISTRY: dict[str, CocotbRunConfig] = {
         description="Cache hierarchy unit tests (L1 -> DDR, Genesys2 shape)",
         verilator_extra_args=("-GHAS_L2=0",),
     ),
+    "frost_cache_4way": CocotbRunConfig(
+        python_test_module="cocotb_tests.cache.test_frost_cache",
+        hdl_toplevel_module="frost_cache_test_harness",
+        description="Cache hierarchy unit tests (4-way L1s + 2-way L2, PLRU replacement)",
+        verilator_extra_args=("-GHAS_L2=1", "-GL1_NUM_WAYS=4", "-GL1I_NUM_WAYS=4", "-GL2_NUM_WAYS=2"),
+    ),
+    "frost_cache_no_prefetch": CocotbRunConfig(
+        python_test_module="cocotb_tests.cache.test_frost_cache",
+        hdl_toplevel_module="frost_cache_test_harness",
+        description="Cache hierarchy unit tests (prefetchers collapsed to wires)",
+        verilator_extra_args=("-GHAS_L2=1", "-GL1_PREFETCH=0", "-GL1I_PREFETCH=0"),
+    ),
+    "frost_cache_serial_evict": CocotbRunConfig(
+        python_test_module="cocotb_tests.cache.test_frost_cache",
+        hdl_toplevel_module="frost_cache_test_harness",
+        description="Cache hierarchy unit tests (victim buffers off: serial writeback-then-fill)",
+        verilator_extra_args=("-GHAS_L2=1", "-GL1_VICTIM_BUFFER=0", "-GL2_VICTIM_BUFFER=0"),
+    ),
+    "frost_cache_l2_prefetch": CocotbRunConfig(
+        python_test_module="cocotb_tests.cache.test_frost_cache",
+        hdl_toplevel_module="frost_cache_test_harness",
+        description="Cache hierarchy unit tests (shared-level prefetcher enabled)",
+        verilator_extra_args=("-GHAS_L2=1", "-GL2_PREFETCH=1"),
+    ),
+    "frost_cache_register_slices": CocotbRunConfig(
+        python_test_module="cocotb_tests.cache.test_frost_cache",
+        hdl_toplevel_module="frost_cache_test_harness",
+        description="Cache hierarchy unit tests (both line-port register slices enabled)",
+        verilator_extra_args=("-GHAS_L2=1", "-GARB_REGISTER_SLICE=1", "-GDOWN_REGISTER_SLICE=1"),
+    ),
     "line_port_arbiter": CocotbRunConfig(
         python_test_module="cocotb_tests.cache.test_line_port_arbiter",
         hdl_toplevel_module="line_port_arbiter_test_harness",
         description="2:1 line-port arbiter unit tests (priority, lock, response routing)",
     ),
+    "dma_engine": CocotbRunConfig(
+        python_test_module="cocotb_tests.dma.test_dma_engine",
+        hdl_toplevel_module="dma_engine_test_harness",
+        description="DMA copy engine unit tests (descriptor launch, line moves, completion irq)",
+    ),
     "imem_predecode_line": CocotbRunConfig(
         python_test_module="cocotb_tests.predecode.test_imem_predecode_line",
         hdl_toplevel_module="imem_predecode_line",
@@ -55,10 +55,12 @@ FORMAL_TARGETS = [
     FormalTarget(
         "reorder_buffer.sby",
         "Reorder buffer - in-order commit with serialization",
+        tasks=("bmc", "cover", "bmc_large", "cover_large"),
     ),
     FormalTarget(
         "register_alias_table.sby",
         "Register alias table - rename mapping with checkpoints",
+        tasks=("bmc", "cover", "bmc_large", "cover_large"),
     ),
     FormalTarget(
         "reservation_station.sby",
@@ -107,6 +109,8 @@ SBY_TASKS = [
     ("bmc", "Bounded model checking (prove assertions hold for N cycles)"),
     ("cover", "Cover checking (prove interesting scenarios are reachable)"),
     ("prove", "Induction proof (unbounded safety)"),
+    ("bmc_large", "BMC with the 64-entry ROB / 16-checkpoint configuration"),
+    ("cover_large", "Cover with the 64-entry ROB / 16-checkpoint configuration"),
 ]
 
 
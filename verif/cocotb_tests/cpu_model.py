@@ -78,6 +78,11 @@ from cocotb_tests.instruction_generator import (
 from models.memory_model import MemoryModel
 from models.branch_model import branch_taken_decision
 from models.alu_model import lw
+from models.native_step import (
+    native_binary_evaluators,
+    native_unary_evaluators,
+    native_amo_evaluators,
+)
 from utils.memory_utils import (
     calculate_byte_mask_for_store,
     get_byte_offset,
@@ -97,6 +102,17 @@ _FP_EVAL_1SRC_FP = {
 _FP_EVAL_3SRC_FP = {**FP_FMA}
 _FP_EVAL_1SRC_INT = {**FP_CVT_I2F, **FP_MV_I2F}
 
+# Integer evaluator dispatch: the op-table evaluators, overlaid with the
+# compiled step core where it is available (see models/native_step.py).
+# The pure-Python evaluators remain the reference implementation and the
+# fallback when the extension is not built.
+_INT_EVAL_BINARY = {op: fn for op, (_, fn) in {**R_ALU, **I_ALU}.items()}
+_INT_EVAL_BINARY.update(native_binary_evaluators())
+_INT_EVAL_UNARY = {op: fn for op, (_, fn) in I_UNARY.items()}
+_INT_EVAL_UNARY.update(native_unary_evaluators())
+_AMO_EVAL = {op: fn for op, (_, fn) in AMO.items()}
+_AMO_EVAL.update(native_amo_evaluators())
+
 
 class CPUModel:
     """Software model of CPU behavior for verification against hardware.
@@ -286,18 +302,18 @@ class CPUModel:
             return fn(memory_model, memory_model.read_address)
         elif operation in I_ALU:
             # Execute immediate ALU operation
-            _, fn = I_ALU[operation]
+            fn = _INT_EVAL_BINARY[operation]
             return fn(
                 state.register_file_previous[source_register_1],
                 immediate_value & MASK32,
             )
         elif operation in I_UNARY:
             # Execute unary ALU operation (Zbb clz, ctz, cpop, sext.b, sext.h, orc.b, rev8)
-            _, fn = I_UNARY[operation]
+            fn = _INT_EVAL_UNARY[operation]
             return fn(state.register_file_previous[source_register_1])
         elif operation in R_ALU:
             # Execute register-register ALU operation
-            _, fn = R_ALU[operation]
+            fn = _INT_EVAL_BINARY[operation]
             return fn(
                 state.register_file_previous[source_register_1],
                 state.register_file_previous[source_register_2],
@@ -493,7 +509,7 @@ class CPUModel:
             # Read old value from memory
             old_value = lw(mem_model, write_address)
             # Compute new value using AMO evaluator
-            _, evaluator = AMO[operation]
+            evaluator = _AMO_EVAL[operation]
             new_value = evaluator(
                 old_value,
                 state.register_file_previous[source_register_2],
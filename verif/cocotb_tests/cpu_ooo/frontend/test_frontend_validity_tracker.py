@@ -28,7 +28,7 @@ FLEN = 64
 INSTR_OP_WIDTH = 32
 BRANCH_OP_WIDTH = 3
 STORE_OP_WIDTH = 2
-RAS_PTR_BITS = 3
+RAS_PTR_BITS = 5
 BP_DIR_IDX_BITS = 10
 NOP_INSTR = 0x00000013
 BRANCH_INSTR = 0x00000063
@@ -24,7 +24,7 @@ from cocotb.triggers import Timer
 XLEN = 32
 ROB_TAG_WIDTH = 5
 CHECKPOINT_ID_WIDTH = 3
-RAS_PTR_BITS = 3
+RAS_PTR_BITS = 5
 MASK32 = (1 << XLEN) - 1
 
 FROM_EX_FIELDS = [
@@ -42,6 +42,9 @@ FROM_EX_FIELDS = [
     ("ras_pop_after_restore", 1),
     ("ras_push_after_restore", 1),
     ("ras_push_address_after_restore", XLEN),
+    ("ind_update", 1),
+    ("ind_update_pc", XLEN),
+    ("ind_update_target", XLEN),
 ]
 
 MISPREDICT_COMMIT_FIELDS = [
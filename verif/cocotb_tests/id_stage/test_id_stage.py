@@ -25,7 +25,7 @@ from cocotb.triggers import FallingEdge, RisingEdge, Timer
 CLOCK_PERIOD_NS = 10
 XLEN = 32
 FLEN = 64
-RAS_PTR_BITS = 3
+RAS_PTR_BITS = 5
 BP_DIR_IDX_BITS = 10
 INSTR_OP_WIDTH = 32
 BRANCH_OP_WIDTH = 3
@@ -99,6 +99,9 @@ def _clear_inputs(dut: Any) -> None:
     dut.i_dir_update_valid.value = 0
     dut.i_dir_update_idx.value = 0
     dut.i_dir_update_taken.value = 0
+    dut.i_ind_update.value = 0
+    dut.i_ind_update_pc.value = 0
+    dut.i_ind_update_target.value = 0
     dut.i_instruction.value = 0
     dut.i_raw_parcel.value = 0
     dut.i_is_compressed.value = 0
@@ -24,7 +24,7 @@ from cocotb.triggers import FallingEdge, RisingEdge, Timer
 
 CLOCK_PERIOD_NS = 10
 XLEN = 32
-RAS_PTR_BITS = 3
+RAS_PTR_BITS = 5
 BP_DIR_IDX_BITS = 10
 NOP_INSTR = 0x00000013
 ADD_INSTR_A = 0x00B50533
@@ -75,6 +75,9 @@ FROM_EX_FIELDS = [
     ("ras_pop_after_restore", 1),
     ("ras_push_after_restore", 1),
     ("ras_push_address_after_restore", XLEN),
+    ("ind_update", 1),
+    ("ind_update_pc", XLEN),
+    ("ind_update_target", XLEN),
 ]
 
 TRAP_CTRL_FIELDS = [
@@ -148,14 +151,26 @@ def _sideband(
     compressed_hi: bool = False,
     compressed_control_lo: bool = False,
     compressed_control_hi: bool = False,
+    native_control_lo: bool = False,
+    native_control_hi: bool = False,
     native_serialize_lo: bool = False,
     native_serialize_hi: bool = False,
     native_fp_compute_lo: bool = False,
     native_fp_compute_hi: bool = False,
 ) -> int:
     """Build one 32-bit-word instruction-memory sideband value."""
-    allows_slot2_after_lo = compressed_lo and not compressed_control_lo
-    allows_slot2_after_hi = compressed_hi and not compressed_control_hi
+    if compressed_lo:
+        allows_slot2_after_lo = not compressed_control_lo
+    else:
+        allows_slot2_after_lo = not (
+            native_control_lo or native_serialize_lo or native_fp_compute_lo
+        )
+    if compressed_hi:
+        allows_slot2_after_hi = not compressed_control_hi
+    else:
+        allows_slot2_after_hi = not (
+            native_control_hi or native_serialize_hi or native_fp_compute_hi
+        )
     slot2_start_valid_lo = compressed_lo or not (
         native_serialize_lo or native_fp_compute_lo
     )
@@ -386,6 +401,49 @@ async def test_compressed_pair_emits_two_valid_if_packets(dut: Any) -> None:
     assert not packet2["ras_predicted"]
 
 
+@cocotb.test()
+async def test_wide_pair_emits_two_valid_if_packets_and_advances_plus_8(
+    dut: Any,
+) -> None:
+    """Two aligned 32-bit instructions pair into one bundle and advance PC by 8."""
+    await _setup_test(dut)
+    await _redirect_to(dut, BASE_PC)
+
+    _drive_fetch(
+        dut,
+        current_word=ADD_INSTR_A,
+        next_word=ADD_INSTR_B,
+        current_sb=_sideband(compressed_hi=True),
+        next_sb=_sideband(compressed_hi=True),
+    )
+    await _settle()
+
+    packet1 = _read_if_packet(dut)
+    _assert_packet(
+        packet1,
+        pc=BASE_PC,
+        raw=ADD_INSTR_A & 0xFFFF,
+        effective=ADD_INSTR_A,
+        compressed=False,
+    )
+    assert packet1["link_address"] == BASE_PC + 4
+
+    packet2 = _read_if_packet(dut, slot2=True)
+    _assert_packet(
+        packet2,
+        pc=BASE_PC + 4,
+        raw=ADD_INSTR_B & 0xFFFF,
+        effective=ADD_INSTR_B,
+        compressed=False,
+    )
+    assert packet2["link_address"] == BASE_PC + 8
+    assert not packet2["btb_hit"]
+    assert not packet2["ras_predicted"]
+
+    await _advance_cycle(dut)
+    assert int(dut.o_pc.value) == BASE_PC + 12  # fetch lead: +8 bundle advance
+
+
 @cocotb.test()
 async def test_stall_registered_replays_captured_if_packet(dut: Any) -> None:
     """Stall entry captures IF outputs and stall_registered replays them."""
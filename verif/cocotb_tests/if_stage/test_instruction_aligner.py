@@ -64,14 +64,26 @@ def _sideband(
     compressed_hi: bool = False,
     compressed_control_lo: bool = False,
     compressed_control_hi: bool = False,
+    native_control_lo: bool = False,
+    native_control_hi: bool = False,
     native_serialize_lo: bool = False,
     native_serialize_hi: bool = False,
     native_fp_compute_lo: bool = False,
     native_fp_compute_hi: bool = False,
 ) -> int:
     """Build one 32-bit-word instruction-memory sideband value."""
-    allows_slot2_after_lo = compressed_lo and not compressed_control_lo
-    allows_slot2_after_hi = compressed_hi and not compressed_control_hi
+    if compressed_lo:
+        allows_slot2_after_lo = not compressed_control_lo
+    else:
+        allows_slot2_after_lo = not (
+            native_control_lo or native_serialize_lo or native_fp_compute_lo
+        )
+    if compressed_hi:
+        allows_slot2_after_hi = not compressed_control_hi
+    else:
+        allows_slot2_after_hi = not (
+            native_control_hi or native_serialize_hi or native_fp_compute_hi
+        )
     slot2_start_valid_lo = compressed_lo or not (
         native_serialize_lo or native_fp_compute_lo
     )
@@ -373,7 +385,9 @@ async def test_slot1_branch_detection_handles_compressed_and_native(dut: Any) ->
     current_word = _word(lo=0x1111, hi=OPC_JAL)
     dut.i_pc_reg.value = PC_HI
     dut.i_instr.value = _fetch(current_word=current_word, next_word=0)
-    dut.i_instr_sideband.value = _fetch_sideband(current_sb=_sideband())
+    dut.i_instr_sideband.value = _fetch_sideband(
+        current_sb=_sideband(native_control_hi=True),
+    )
     await _settle()
 
     assert bool(dut.o_is_compressed.value) is False
@@ -436,3 +450,100 @@ async def test_bram_unsafe_swap_only_allows_current_hi_compressed_slot2(
         compressed=False,
         sel_nop=True,
     )
+
+
+@cocotb.test()
+async def test_wide_aligned_slot1_takes_slot2_from_next_lo(dut: Any) -> None:
+    """An aligned 32-bit slot-1 pairs with an RVC or 32-bit slot-2 at next lo."""
+    await _setup_test(dut)
+
+    current_word = 0x00000513  # addi a0, x0, 0
+    next_word = _word(lo=0x4501, hi=0x9999)  # c.li a0, 0 then junk
+    dut.i_instr.value = _fetch(current_word=current_word, next_word=next_word)
+    dut.i_instr_sideband.value = _fetch_sideband(
+        current_sb=_sideband(compressed_hi=True),
+        next_sb=_sideband(compressed_lo=True),
+    )
+    await _settle()
+
+    _assert_slot1(
+        dut,
+        raw=0x0513,
+        effective=current_word,
+        compressed=False,
+        fast_compressed=False,
+    )
+    _assert_slot2(dut, raw=0x4501, effective=0x00004501, compressed=True, sel_nop=False)
+    assert bool(dut.o_slot2_valid_for_pc.value) is True
+    assert bool(dut.o_slot2_is_compressed_for_pc.value) is True
+
+    next_word = 0x00000593  # addi a1, x0, 0
+    dut.i_instr.value = _fetch(current_word=current_word, next_word=next_word)
+    dut.i_instr_sideband.value = _fetch_sideband(
+        current_sb=_sideband(compressed_hi=True),
+        next_sb=_sideband(compressed_hi=True),
+    )
+    await _settle()
+
+    _assert_slot2(dut, raw=0x0593, effective=next_word, compressed=False, sel_nop=False)
+    assert bool(dut.o_slot2_valid_for_pc.value) is True
+    assert bool(dut.o_slot2_is_compressed_for_pc.value) is False
+
+
+@cocotb.test()
+async def test_wide_spanning_slot1_takes_compressed_slot2_at_next_hi(dut: Any) -> None:
+    """A 32-bit slot-1 spanning from hi pairs only with an RVC slot-2 at next hi."""
+    await _setup_test(dut)
+
+    current_word = _word(lo=0x1111, hi=0x0513)  # hi = opcode half of addi a0
+    next_word = _word(lo=0x0000, hi=0x4501)  # lo = addi tail, hi = c.li a0
+    dut.i_pc_reg.value = PC_HI
+    dut.i_instr.value = _fetch(current_word=current_word, next_word=next_word)
+    dut.i_instr_sideband.value = _fetch_sideband(
+        current_sb=_sideband(compressed_lo=True),
+        next_sb=_sideband(compressed_lo=True, compressed_hi=True),
+    )
+    await _settle()
+
+    assert bool(dut.o_is_compressed.value) is False
+    _assert_slot2(dut, raw=0x4501, effective=0x00004501, compressed=True, sel_nop=False)
+    assert bool(dut.o_slot2_valid_for_pc.value) is True
+    assert bool(dut.o_slot2_is_compressed_for_pc.value) is True
+
+    # A 32-bit slot-2 at next hi would span past the 64-bit fetch: forced NOP.
+    next_word = _word(lo=0x0000, hi=0x0593)
+    dut.i_instr.value = _fetch(current_word=current_word, next_word=next_word)
+    dut.i_instr_sideband.value = _fetch_sideband(
+        current_sb=_sideband(compressed_lo=True),
+        next_sb=_sideband(compressed_lo=True),
+    )
+    await _settle()
+
+    _assert_slot2(dut, raw=0x0593, effective=0x00000013, compressed=False, sel_nop=True)
+    assert bool(dut.o_slot2_valid_for_pc.value) is False
+
+
+@cocotb.test()
+async def test_wide_slot1_control_serialize_and_fp_terminate_bundle(dut: Any) -> None:
+    """Native control/serialize/FP sideband on a 32-bit slot-1 blocks slot-2."""
+    await _setup_test(dut)
+
+    for current_sb in (
+        _sideband(compressed_hi=True, native_control_lo=True),
+        _sideband(compressed_hi=True, native_serialize_lo=True),
+        _sideband(compressed_hi=True, native_fp_compute_lo=True),
+    ):
+        _clear_inputs(dut)
+        dut.i_instr.value = _fetch(
+            current_word=0x00000513,
+            next_word=_word(lo=0x4501, hi=0x9999),
+        )
+        dut.i_instr_sideband.value = _fetch_sideband(
+            current_sb=current_sb,
+            next_sb=_sideband(compressed_lo=True),
+        )
+        await _settle()
+
+        assert bool(dut.o_is_compressed.value) is False
+        assert bool(dut.o_sel_nop_2.value) is True
+        assert bool(dut.o_slot2_valid_for_pc.value) is False
@@ -27,6 +27,7 @@ PC_REG_HALFWORD = PC_REG | 0x2
 PC_ADV_PLUS2 = 0
 PC_ADV_PLUS4 = 1
 PC_ADV_PLUS6 = 2
+PC_ADV_PLUS8 = 3
 
 
 def _clear_inputs(dut: Any) -> None:
@@ -89,13 +90,15 @@ async def test_single_wide_compressed_and_32bit_increments(dut: Any) -> None:
 
 
 @cocotb.test()
-async def test_two_wide_bundle_increments_from_compressed_slot1(dut: Any) -> None:
-    """Two-wide IF bundles advance pc_reg by +4 or +6 behind compressed slot-1."""
+async def test_two_wide_bundle_increments_for_all_size_pairs(dut: Any) -> None:
+    """Two-wide IF bundles advance by the slot-size sum: +4, +6, or +8."""
     await _setup_test(dut)
 
     cases: tuple[tuple[bool, int, int], ...] = (
-        (True, 4, PC_ADV_PLUS4),
-        (True, 6, PC_ADV_PLUS6),
+        (True, 4, PC_ADV_PLUS4),  # RVC + RVC
+        (True, 6, PC_ADV_PLUS6),  # RVC + 32b
+        (False, 6, PC_ADV_PLUS6),  # 32b + RVC
+        (False, 8, PC_ADV_PLUS8),  # 32b + 32b
     )
 
     for slot1_compressed, increment, pc_advance_sel in cases:
@@ -107,6 +110,24 @@ async def test_two_wide_bundle_increments_from_compressed_slot1(dut: Any) -> Non
         _assert_next(dut, pc=PC + increment, pc_reg=PC_REG + increment)
 
 
+@cocotb.test()
+async def test_two_wide_bundle_increments_from_halfword_pcs(dut: Any) -> None:
+    """Mixed and same-size bundle advances stay exact from halfword PCs."""
+    await _setup_test(dut)
+
+    dut.i_pc.value = PC_HALFWORD
+    dut.i_pc_reg.value = PC_REG_HALFWORD
+
+    for increment, pc_advance_sel in ((6, PC_ADV_PLUS6), (8, PC_ADV_PLUS8)):
+        dut.i_pc_fetch_advance_sel.value = pc_advance_sel
+        dut.i_pc_reg_advance_sel.value = pc_advance_sel
+        await _settle()
+
+        _assert_next(
+            dut, pc=PC_HALFWORD + increment, pc_reg=PC_REG_HALFWORD + increment
+        )
+
+
 @cocotb.test()
 async def test_control_flow_halfword_state_uses_halfword_fetch_increment(
     dut: Any,
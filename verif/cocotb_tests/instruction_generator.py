@@ -48,6 +48,15 @@ Example Usage:
 
 import random
 from typing import NamedTuple
+
+try:
+    # Optional accelerator for BatchInstructionGenerator pool refills
+    # (pip install frost[fastgen]). Generation stays correct without it; the
+    # pools just fall back to per-entry scalar generation.
+    import numpy
+except ImportError:
+    numpy = None  # type: ignore[assignment]
+
 from config import (
     MASK32,
     IMM_12BIT_MIN,
@@ -57,6 +66,7 @@ from config import (
     WORD_ALIGNMENT,
     DOUBLEWORD_ALIGNMENT,
     MMIO_BASE_ADDR,
+    DEFAULT_BATCH_POOL_SIZE,
 )
 from encoders.op_tables import (
     R_ALU,
@@ -161,6 +171,18 @@ ALL_FP_OPS = FP_OPS_TO_FP_REG | FP_OPS_TO_INT_REG | FP_OPS_NO_WRITE
 _RANDOM_MEMORY_OPS = LOADS | STORES | FP_LOADS | FP_STORES | AMO | AMO_LR_SC
 """Randomly generated operations that issue a data-memory access."""
 
+_FIVE_BIT_IMM_OPS = (
+    "slli",
+    "srli",
+    "srai",
+    "bseti",
+    "bclri",
+    "binvi",
+    "bexti",
+    "rori",
+)
+"""I-type operations whose immediate is a 5-bit shift amount / bit position."""
+
 
 # Grouped FP op tables by encoder signature for encode_instruction()
 _FP_ENCODE_RD_RS1_RS2 = {**FP_ARITH_2OP, **FP_SGNJ, **FP_MINMAX, **FP_CMP}
@@ -365,6 +387,7 @@ class InstructionGenerator:
         register_file_state: list[int],
         force_one_address: bool = False,
         constrain_to_memory_size: int | None = None,
+        operation: str | None = None,
     ) -> InstructionParams:
         """Generate random RISC-V instruction parameters.
 
@@ -381,6 +404,9 @@ class InstructionGenerator:
                                      to [0, memory_size) to exercise allocated
                                      memory rather than generating many
                                      out-of-range addresses.
+            operation: If provided, generate operands for this specific
+                      mnemonic instead of choosing one at random (used by
+                      BatchInstructionGenerator for its non-pooled classes).
 
         Returns:
             Tuple of (operation, destination_reg, source_reg_1, source_reg_2,
@@ -393,8 +419,9 @@ class InstructionGenerator:
             >>> op in InstructionGenerator.get_all_operations()
             True
         """
-        available_operations = InstructionGenerator.get_all_operations()
-        operation = random.choice(available_operations)
+        if operation is None:
+            available_operations = InstructionGenerator.get_all_operations()
+            operation = random.choice(available_operations)
 
         # RISC-V register indices (rd = destination, rs1/rs2 = sources)
         destination_register = random.randint(
@@ -406,16 +433,7 @@ class InstructionGenerator:
         # Immediate value generation - varies by instruction type
         if force_one_address:
             immediate_value = 0
-        elif operation in (
-            "slli",
-            "srli",
-            "srai",
-            "bseti",
-            "bclri",
-            "binvi",
-            "bexti",
-            "rori",
-        ):
+        elif operation in _FIVE_BIT_IMM_OPS:
             # Shift, Zbs bit-position, and Zbb rotate immediates use only 5 bits
             immediate_value = random.randint(0, SHIFT_AMOUNT_MASK)
         else:
@@ -1130,3 +1148,298 @@ class CompressedInstructionGenerator:
             return ((c_nop & 0xFFFF) << 16) | (instr & 0xFFFF)
         else:
             return ((instr & 0xFFFF) << 16) | (c_nop & 0xFFFF)
+
+
+class BatchInstructionGenerator:
+    """Pool-backed batch mode for long random regressions.
+
+    The scalar path in InstructionGenerator builds each instruction with a
+    handful of Python-level random calls plus a per-instruction encode, and
+    for long torture runs that generation time rivals the simulation time.
+    This class pre-generates encoded instruction pools per operation and
+    assembles the stream by sampling from them:
+
+    - Operation selection is pre-drawn in chunks (one random.choices call per
+      chunk) over the same uniform operation list as the scalar path.
+    - Pools cover the state-independent operation classes (R-type ALU, I-type
+      ALU/unary, branches, JAL, fences, CSR counter reads): their operands
+      never consult the live register file, so operand vectors and the
+      encoded 32-bit words can be produced in bulk. With numpy installed
+      (pip install frost[fastgen]) a refill draws every operand field as an
+      array and encodes the whole pool with vectorized bit operations;
+      without it the refill falls back to per-entry scalar generation, which
+      is still correct, just not faster.
+    - Memory operations, AMOs, and JALR depend on live register values
+      (alignment, MMIO avoidance, target alignment), so they always go
+      through the scalar constraint path with the same knobs.
+
+    Constraint knobs (force_one_address, constrain_to_memory_size) match the
+    scalar generator exactly; every vectorized refill spot-checks a few
+    entries against InstructionGenerator.encode_instruction so the packed
+    encodings can never silently drift from the canonical encoders.
+
+    Usage:
+        >>> gen = BatchInstructionGenerator()
+        >>> params, encoded = gen.generate([0] * 32)
+        >>> params.operation in InstructionGenerator.get_all_operations()
+        True
+    """
+
+    def __init__(
+        self,
+        pool_size: int = DEFAULT_BATCH_POOL_SIZE,
+        force_one_address: bool = False,
+    ) -> None:
+        """Initialize pools lazily; nothing is generated until first use.
+
+        Args:
+            pool_size: Instructions generated per pool refill (and the
+                      operation pre-draw chunk size).
+            force_one_address: Mirror of the scalar knob - rs1=0 and imm=0
+                              on every generated instruction.
+        """
+        self.pool_size = pool_size
+        self.force_one_address = force_one_address
+        self._operations = InstructionGenerator.get_all_operations()
+        self._pooled_ops = frozenset(
+            op
+            for op in self._operations
+            if op in R_ALU
+            or op in I_ALU
+            or op in I_UNARY
+            or op in BRANCHES
+            or op in FENCES
+            or op in CSRS
+            or op == "jal"
+        )
+        # Per-op pools: parallel lists of InstructionParams and encoded words,
+        # consumed back-to-front (cheap list.pop()).
+        self._pool_params: dict[str, list[InstructionParams]] = {}
+        self._pool_words: dict[str, list[int]] = {}
+        # Pre-drawn operation stream, consumed back-to-front.
+        self._op_stream: list[str] = []
+
+    # ------------------------------------------------------------------
+    # Public API
+    # ------------------------------------------------------------------
+
+    def generate(
+        self,
+        register_file_state: list[int],
+        constrain_to_memory_size: int | None = None,
+    ) -> tuple[InstructionParams, int | None]:
+        """Draw the next instruction of the stream.
+
+        Returns:
+            (params, encoded) where encoded is the pre-encoded 32-bit word
+            for pooled operations, or None when the operation came from the
+            scalar path (caller encodes it as usual).
+        """
+        if not self._op_stream:
+            self._op_stream = random.choices(self._operations, k=self.pool_size)
+        operation = self._op_stream.pop()
+
+        if operation in self._pooled_ops:
+            params_pool = self._pool_params.get(operation)
+            if not params_pool:
+                self._refill_pool(operation)
+                params_pool = self._pool_params[operation]
+            return params_pool.pop(), self._pool_words[operation].pop()
+
+        params = InstructionGenerator.generate_random_instruction(
+            register_file_state,
+            self.force_one_address,
+            constrain_to_memory_size,
+            operation=operation,
+        )
+        return params, None
+
+    def generate_with_fp(
+        self,
+        int_register_file_state: list[int],
+        fp_register_file_state: list[int],
+        constrain_to_memory_size: int | None = None,
+        fp_probability: float = 0.3,
+        fp_operations: list[str] | None = None,
+    ) -> tuple[InstructionParams, int | None]:
+        """FP-mixing counterpart of generate() (mirrors the scalar wrapper).
+
+        FP instructions are not pooled (loads/stores consult the register
+        file and the arithmetic ops are a small fraction of each mixed run),
+        so they always take the scalar path.
+        """
+        if random.random() < fp_probability:
+            return (
+                InstructionGenerator.generate_random_fp_instruction(
+                    int_register_file_state,
+                    fp_register_file_state,
+                    constrain_to_memory_size,
+                    fp_operations,
+                ),
+                None,
+            )
+        return self.generate(int_register_file_state, constrain_to_memory_size)
+
+    # ------------------------------------------------------------------
+    # Pool refills
+    # ------------------------------------------------------------------
+
+    def _refill_pool(self, operation: str) -> None:
+        """Rebuild the pool for one operation (vectorized when numpy exists)."""
+        if numpy is None:
+            zeros = [0] * 32  # pooled ops never read the register file
+            params_list = [
+                InstructionGenerator.generate_random_instruction(
+                    zeros, self.force_one_address, None, operation=operation
+                )
+                for _ in range(self.pool_size)
+            ]
+            words = [
+                InstructionGenerator.encode_instruction(
+                    p.operation,
+                    p.destination_register,
+                    p.source_register_1,
+                    p.source_register_2,
+                    p.immediate,
+                    p.branch_offset,
+                    p.csr_address,
+                )
+                for p in params_list
+            ]
+            self._pool_params[operation] = params_list
+            self._pool_words[operation] = words
+            return
+
+        n = self.pool_size
+        # Seed the bulk generator from the global random module so runs stay
+        # reproducible under COCOTB_RANDOM_SEED.
+        rng = numpy.random.default_rng(random.getrandbits(64))
+
+        rd = rng.integers(1, 32, n, dtype=numpy.int64)
+        rs1 = (
+            numpy.zeros(n, dtype=numpy.int64)
+            if self.force_one_address
+            else rng.integers(0, 32, n, dtype=numpy.int64)
+        )
+        rs2 = rng.integers(0, 32, n, dtype=numpy.int64)
+        if self.force_one_address:
+            imm = numpy.zeros(n, dtype=numpy.int64)
+        elif operation in _FIVE_BIT_IMM_OPS:
+            imm = rng.integers(0, SHIFT_AMOUNT_MASK + 1, n, dtype=numpy.int64)
+        else:
+            imm = rng.integers(IMM_12BIT_MIN, IMM_12BIT_MAX + 1, n, dtype=numpy.int64)
+
+        offset = None
+        csr = None
+        if operation in BRANCHES:
+            # random.randrange(-4096, 4096, 4) or 4 - multiples of 4, never 0.
+            offset = rng.integers(-1024, 1024, n, dtype=numpy.int64) * 4
+            offset[offset == 0] = 4
+        elif operation == "jal":
+            offset = rng.integers(-262144, 262144, n, dtype=numpy.int64) * 4
+        elif operation in CSRS:
+            # Pure counter reads: rs1=0, zimm=0 (matches the scalar path).
+            rs1 = numpy.zeros(n, dtype=numpy.int64)
+            imm = numpy.zeros(n, dtype=numpy.int64)
+            csr_table = numpy.asarray(ZICNTR_CSRS, dtype=numpy.int64)
+            csr = csr_table[rng.integers(0, len(ZICNTR_CSRS), n)]
+
+        words = self._encode_pool(operation, rd, rs1, rs2, imm, offset, csr)
+
+        offset_list = offset.tolist() if offset is not None else [None] * n
+        csr_list = csr.tolist() if csr is not None else [None] * n
+        params_list = [
+            InstructionParams(
+                operation=operation,
+                destination_register=int(rd[i]),
+                source_register_1=int(rs1[i]),
+                source_register_2=int(rs2[i]),
+                immediate=int(imm[i]),
+                branch_offset=offset_list[i],
+                csr_address=csr_list[i],
+            )
+            for i in range(n)
+        ]
+
+        self._spot_check(params_list, words)
+        self._pool_params[operation] = params_list
+        self._pool_words[operation] = words
+
+    def _encode_pool(
+        self,
+        operation: str,
+        rd: "numpy.ndarray",
+        rs1: "numpy.ndarray",
+        rs2: "numpy.ndarray",
+        imm: "numpy.ndarray",
+        offset: "numpy.ndarray | None",
+        csr: "numpy.ndarray | None",
+    ) -> list[int]:
+        """Vectorized encode: canonical base word + packed operand fields.
+
+        The base word (opcode/funct fields, plus funct7 bits embedded in the
+        shift immediates) comes from the canonical encoder called once with
+        all-zero operands, so the only knowledge duplicated here is the field
+        placement, which _spot_check guards.
+        """
+        base = InstructionGenerator.encode_instruction(
+            operation, 0, 0, 0, 0, 0 if (operation in BRANCHES or operation == "jal") else None, 0
+        )
+        word = numpy.full(self.pool_size, base, dtype=numpy.int64)
+
+        if operation in R_ALU:
+            word |= (rd << 7) | (rs1 << 15) | (rs2 << 20)
+        elif operation in I_ALU:
+            imm_mask = (
+                SHIFT_AMOUNT_MASK if operation in _FIVE_BIT_IMM_OPS else 0xFFF
+            )
+            word |= (rd << 7) | (rs1 << 15) | ((imm & imm_mask) << 20)
+        elif operation in I_UNARY:
+            # funct12 is fixed in the base word; the drawn immediate is
+            # recorded in the params but not encoded (matches the scalar path).
+            word |= (rd << 7) | (rs1 << 15)
+        elif operation in BRANCHES:
+            assert offset is not None
+            off = offset & 0x1FFF  # 13-bit two's complement, bit 0 implicit
+            word |= (rs1 << 15) | (rs2 << 20)
+            word |= ((off >> 12) & 0x1) << 31
+            word |= ((off >> 5) & 0x3F) << 25
+            word |= ((off >> 1) & 0xF) << 8
+            word |= ((off >> 11) & 0x1) << 7
+        elif operation == "jal":
+            assert offset is not None
+            off = offset & 0x1FFFFF  # 21-bit two's complement, bit 0 implicit
+            word |= rd << 7
+            word |= ((off >> 20) & 0x1) << 31
+            word |= ((off >> 1) & 0x3FF) << 21
+            word |= ((off >> 11) & 0x1) << 20
+            word |= ((off >> 12) & 0xFF) << 12
+        elif operation in FENCES:
+            pass  # fixed encoding: the base word is the instruction
+        elif operation in CSRS:
+            assert csr is not None
+            word |= (rd << 7) | (csr << 20)
+        else:  # pragma: no cover - guarded by _pooled_ops membership
+            raise RuntimeError(f"Operation not vectorizable: {operation}")
+
+        return (word & MASK32).tolist()
+
+    def _spot_check(
+        self, params_list: list[InstructionParams], words: list[int]
+    ) -> None:
+        """Verify a few pool entries against the canonical scalar encoder."""
+        for index in random.sample(range(len(params_list)), min(4, len(params_list))):
+            p = params_list[index]
+            expected = InstructionGenerator.encode_instruction(
+                p.operation,
+                p.destination_register,
+                p.source_register_1,
+                p.source_register_2,
+                p.immediate,
+                p.branch_offset,
+                p.csr_address,
+            )
+            assert words[index] == expected, (
+                f"Vectorized encoding mismatch for {p.operation}: "
+                f"0x{words[index]:08X} != 0x{expected:08X} ({p})"
+            )
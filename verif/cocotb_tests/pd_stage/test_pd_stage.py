@@ -29,6 +29,7 @@ BP_DIR_IDX_BITS = 10
 
 NOP_INSTR = 0x00000013
 OPC_BRANCH = 0b1100011
+OPC_JAL = 0b1101111
 OPC_OP_IMM = 0b0010011
 OPC_OP = 0b0110011
 
@@ -206,6 +207,34 @@ def _pack_b(*, imm: int, rs2: int, rs1: int, funct3: int, opcode: int) -> int:
     )
 
 
+def _pack_j(*, imm: int, rd: int, opcode: int) -> int:
+    """Pack a J-type instruction."""
+    offset = imm & 0x1FFFFF
+    return (
+        (((offset >> 20) & 0x1) << 31)
+        | (((offset >> 1) & 0x3FF) << 21)
+        | (((offset >> 11) & 0x1) << 20)
+        | (((offset >> 12) & 0xFF) << 12)
+        | ((rd & 0x1F) << 7)
+        | (opcode & 0x7F)
+    )
+
+
+def _pack_cj_imm(imm: int) -> int:
+    """Pack a CJ-format jump offset into the bits12_2 field layout."""
+    offset = imm & 0xFFF
+    return (
+        (((offset >> 11) & 0x1) << 10)
+        | (((offset >> 4) & 0x1) << 9)
+        | (((offset >> 8) & 0x3) << 7)
+        | (((offset >> 10) & 0x1) << 6)
+        | (((offset >> 6) & 0x1) << 5)
+        | (((offset >> 7) & 0x1) << 4)
+        | (((offset >> 1) & 0x7) << 1)
+        | ((offset >> 5) & 0x1)
+    )
+
+
 def _pack_compressed(*, funct3: int, quadrant: int, bits12_2: int) -> int:
     """Pack common compressed-instruction fields."""
     return ((funct3 & 0x7) << 13) | ((bits12_2 & 0x7FF) << 2) | (quadrant & 0x3)
@@ -624,3 +653,75 @@ async def test_direction_predicted_branch_redirects_and_squashes_following_cycle
     _assert_nop_slot(_read_pd_packet(dut))
     _assert_nop_slot(_read_pd_packet(dut, slot2=True))
     assert bool(dut.o_pd_redirect.value) is False
+
+
+@cocotb.test()
+async def test_btb_missed_jal_redirects_without_direction_prediction(dut: Any) -> None:
+    """A BTB-missed native JAL redirects to PC+imm with no bp_dir_taken needed."""
+    await _setup_test(dut)
+    jal_instr = _pack_j(imm=-0x100, rd=1, opcode=OPC_JAL)
+
+    _drive_if_packet(
+        dut,
+        {
+            "program_counter": BASE_PC,
+            "raw_parcel": jal_instr & 0xFFFF,
+            "sel_nop": False,
+            "effective_instr": jal_instr,
+            "link_address": BASE_PC + 4,
+        },
+    )
+    await _advance_cycle(dut)
+
+    packet = _read_pd_packet(dut)
+    assert packet["instruction"] == jal_instr
+    assert bool(dut.o_pd_redirect.value) is True
+    assert int(dut.o_pd_redirect_target.value) == (BASE_PC - 0x100) & 0xFFFFFFFF
+
+    # Drain the squash cycle, then present the same JAL with a BTB-taken
+    # prediction: the front-end already redirected, so PD must stay quiet.
+    _drive_if_packet(dut, {})
+    await _advance_cycle(dut)
+
+    _drive_if_packet(
+        dut,
+        {
+            "program_counter": BASE_PC,
+            "raw_parcel": jal_instr & 0xFFFF,
+            "sel_nop": False,
+            "effective_instr": jal_instr,
+            "link_address": BASE_PC + 4,
+            "btb_hit": True,
+            "btb_predicted_taken": True,
+            "btb_predicted_target": (BASE_PC - 0x100) & 0xFFFFFFFF,
+        },
+    )
+    await _advance_cycle(dut)
+
+    assert bool(dut.o_pd_redirect.value) is False
+
+
+@cocotb.test()
+async def test_btb_missed_compressed_jump_redirects(dut: Any) -> None:
+    """A BTB-missed C.J redirects to PC plus the CJ-format offset."""
+    await _setup_test(dut)
+    cj_instr = _pack_compressed(
+        funct3=0b101,
+        quadrant=0b01,
+        bits12_2=_pack_cj_imm(0x2A),
+    )
+
+    _drive_if_packet(
+        dut,
+        {
+            "program_counter": BASE_PC,
+            "raw_parcel": cj_instr,
+            "sel_nop": False,
+            "effective_instr": 0xDEADBEEF,
+            "link_address": BASE_PC + 2,
+        },
+    )
+    await _advance_cycle(dut)
+
+    assert bool(dut.o_pd_redirect.value) is True
+    assert int(dut.o_pd_redirect_target.value) == BASE_PC + 0x2A
@@ -46,6 +46,9 @@ OPC_FMSUB = 0b1000111
 OPC_FNMSUB = 0b1001011
 OPC_FNMADD = 0b1001111
 OPC_OP_FP = 0b1010011
+OPC_BRANCH = 0b1100011
+OPC_JAL = 0b1101111
+OPC_JALR = 0b1100111
 SPECIAL_OPCODES = (
     OPC_MISC_MEM,
     OPC_CSR,
@@ -55,6 +58,9 @@ SPECIAL_OPCODES = (
     OPC_FNMSUB,
     OPC_FNMADD,
     OPC_OP_FP,
+    OPC_BRANCH,
+    OPC_JAL,
+    OPC_JALR,
 )
 NEAR_MISS_OPCODES = (
     0b0000011,  # LOAD (one bit from MISC_MEM)
@@ -63,6 +69,8 @@ NEAR_MISS_OPCODES = (
     0b1110111,  # one bit from CSR
     0b1010111,  # one bit from OP_FP (V-extension space)
     0b1000001,  # non-11 low bits next to FMADD
+    0b1100001,  # non-11 low bits next to BRANCH
+    0b1101011,  # one bit from JAL/JALR (custom space)
 )
 
 
@@ -39,6 +39,8 @@ Usage:
     )
 """
 
+import os
+
 import cocotb
 from cocotb.triggers import RisingEdge, FallingEdge
 from dataclasses import dataclass
@@ -92,6 +94,18 @@ class TestConfig:
             - When > 0: Mix of 32-bit and 16-bit compressed instructions
             - Compressed instructions use PC+2, 32-bit use PC+4
             - Only ALU compressed instructions are used (no branches/jumps)
+
+        batch_generation: Use BatchInstructionGenerator's pre-encoded pools
+            for state-independent instruction classes (fast path for long
+            runs). Constraints and distribution match the scalar generator;
+            disable to reproduce streams recorded before batch mode existed.
+
+    Environment Override:
+        COCOTB_NUM_TEST_LOOPS replaces num_loops after construction, scaling
+        min_coverage_count by the same ratio so the per-instruction coverage
+        check stays proportional. tests/run_sharded.py uses this to split one
+        long random-regression run into several shorter, independently-seeded
+        segments; the segments together cover the original instruction count.
     """
 
     num_loops: int = DEFAULT_NUM_TEST_LOOPS
@@ -103,6 +117,18 @@ class TestConfig:
     constrain_addresses_to_memory: bool = False
     force_one_address: bool = False
     compressed_ratio: float = 0.0
+    batch_generation: bool = True
+
+    def __post_init__(self) -> None:
+        """Apply the COCOTB_NUM_TEST_LOOPS segment override (see class doc)."""
+        override = os.environ.get("COCOTB_NUM_TEST_LOOPS", "")
+        if override and self.num_loops > 0:
+            loops = int(override)
+            if loops != self.num_loops:
+                self.min_coverage_count = max(
+                    1, (self.min_coverage_count * loops) // self.num_loops
+                )
+                self.num_loops = loops
 
 
 def handle_branch_flush(
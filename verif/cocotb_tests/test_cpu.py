@@ -80,7 +80,10 @@ from cocotb_tests.instruction_generator import (
 )
 from models.memory_model import MemoryModel
 from cocotb_tests.test_helpers import DUTInterface, TestStatistics
-from cocotb_tests.instruction_generator import InstructionGenerator
+from cocotb_tests.instruction_generator import (
+    BatchInstructionGenerator,
+    InstructionGenerator,
+)
 from cocotb_tests.cpu_model import CPUModel
 from cocotb_tests.test_state import TestState
 from cocotb_tests.test_common import (
@@ -136,6 +139,14 @@ async def run_random_regression(
     if config is None:
         config = TestConfig()
 
+    # Batch mode: state-independent instruction classes come pre-encoded from
+    # per-op pools; memory ops / AMO / JALR still take the scalar path.
+    batch_generator = (
+        BatchInstructionGenerator(force_one_address=config.force_one_address)
+        if config.batch_generation
+        else None
+    )
+
     # ========================================================================
     # Initialization Phase
     # ========================================================================
@@ -209,6 +220,7 @@ async def run_random_regression(
         # After a taken branch/jump, flush pipeline with NOP to model speculative
         # execution behavior. Otherwise, generate a new random instruction.
         # All control flow (JAL, JALR, branches) resolved in EX stage, need 3 flush cycles.
+        pre_encoded = None
         if state.is_in_flush:
             operation, rd, rs1, rs2, imm = handle_branch_flush(state, operation)
             offset = None
@@ -222,7 +234,21 @@ async def run_random_regression(
                 if config.constrain_addresses_to_memory
                 else None
             )
-            if enable_fp:
+            if batch_generator is not None:
+                if enable_fp:
+                    instr_params, pre_encoded = batch_generator.generate_with_fp(
+                        state.register_file_previous,
+                        state.fp_register_file_previous,
+                        mem_constraint,
+                        fp_probability,
+                        fp_operations,
+                    )
+                else:
+                    instr_params, pre_encoded = batch_generator.generate(
+                        state.register_file_previous,
+                        mem_constraint,
+                    )
+            elif enable_fp:
                 instr_params = InstructionGenerator.generate_random_instruction_with_fp(
                     state.register_file_previous,
                     state.fp_register_file_previous,
@@ -269,9 +295,14 @@ async def run_random_regression(
         # ====================================================================
         # Step 2: Encode Instruction to Binary
         # ====================================================================
-        instr = InstructionGenerator.encode_instruction(
-            operation, rd, rs1, rs2, imm, offset, csr_address, rs3
-        )
+        # Pooled batch-mode instructions arrive pre-encoded; everything else
+        # (scalar path, NOP flushes) goes through the canonical encoder.
+        if pre_encoded is not None:
+            instr = pre_encoded
+        else:
+            instr = InstructionGenerator.encode_instruction(
+                operation, rd, rs1, rs2, imm, offset, csr_address, rs3
+            )
 
         # ====================================================================
         # Step 3: Model Expected Behavior in Software
@@ -115,6 +115,7 @@ class CdbArbiterInterface:
         """Reset the DUT and init all inputs."""
         self.clear_all_fu_completes()
         self.dut.i_kill.value = 0
+        self.dut.i_rob_head_tag.value = 0
         self.dut.i_rst_n.value = 0
 
         for _ in range(cycles):
@@ -174,6 +175,10 @@ class CdbArbiterInterface:
         """Drive the arbiter-wide kill input."""
         self.dut.i_kill.value = int(value)
 
+    def set_rob_head(self, tag: int) -> None:
+        """Drive the ROB head tag used for relative-age computation."""
+        self.dut.i_rob_head_tag.value = tag & MASK_TAG
+
     def read_cdb_output(self) -> CdbBroadcast:
         """Read the lane-0 CDB broadcast output."""
         raw = int(self.dut.o_cdb.value)
@@ -14,9 +14,10 @@
 
 """Golden model for the CDB Arbiter.
 
-Mirrors the RTL priority-based arbitration logic. Given a list of FU completion
-requests, selects the highest-priority valid request and returns the CDB
-broadcast result plus per-FU grant vector.
+Mirrors the RTL age-ordered (oldest-ROB-first) arbitration logic. Given a list
+of FU completion requests and the ROB head tag, selects the two oldest valid
+requests and returns the CDB broadcast results plus per-FU grant vector. The
+legacy fixed-priority order breaks equal-tag ties, matching the RTL.
 """
 
 from dataclasses import dataclass
@@ -39,9 +40,13 @@ FU_FP_DIV = 6
 
 NUM_FUS = 7
 
-# Priority order: highest priority first (CoreMark-relevant traffic first)
+# Legacy priority order (CoreMark-relevant traffic first).  Since the switch
+# to age-ordered arbitration this only breaks equal-tag ties.
 PRIORITY_ORDER = [FU_MUL, FU_MEM, FU_ALU, FU_DIV, FU_FP_DIV, FU_FP_MUL, FU_FP_ADD]
 
+# Tie-break rank per FU index (lower rank wins), mirroring FuPriorityRank.
+PRIORITY_RANK = {fu: rank for rank, fu in enumerate(PRIORITY_ORDER)}
+
 
 @dataclass
 class FuComplete:
@@ -82,21 +87,24 @@ def _broadcast_from(req: FuComplete, fu_idx: int) -> CdbBroadcast:
 
 
 class CdbArbiterModel:
-    """Golden model for CDB arbiter priority arbitration (2-wide CDB).
+    """Golden model for CDB arbiter age-ordered arbitration (2-wide CDB).
 
-    Lane 0 = highest-priority valid request; lane 1 = highest-priority valid
-    request among those lane 0 did not take. Both winners are granted, so the
-    grant vector is 2-hot when two or more FUs request the CDB.
+    Lane 0 = oldest valid request relative to the ROB head; lane 1 = second
+    oldest. Equal-tag ties resolve by the legacy priority rank. Both winners
+    are granted, so the grant vector is 2-hot when two or more FUs request
+    the CDB.
     """
 
     def arbitrate(
         self,
         fu_completes: list[FuComplete],
+        rob_head: int = 0,
     ) -> tuple[CdbBroadcast, CdbBroadcast, list[bool]]:
         """Arbitrate among FU completion requests.
 
         Args:
             fu_completes: List of NUM_FUS FuComplete requests, indexed by fu_type_e.
+            rob_head: Current ROB head tag (age = tag - head, modulo depth).
 
         Returns:
             Tuple of (lane0_cdb, lane1_cdb, grants). lane1_cdb.valid is False when
@@ -109,19 +117,25 @@ class CdbArbiterModel:
         cdb = CdbBroadcast()
         cdb_2 = CdbBroadcast()
 
-        lane0_idx = None
-        for fu_idx in PRIORITY_ORDER:
-            if fu_completes[fu_idx].valid:
-                lane0_idx = fu_idx
-                grants[fu_idx] = True
-                cdb = _broadcast_from(fu_completes[fu_idx], fu_idx)
-                break
-
-        # Lane 1: next-highest-priority valid request, excluding lane 0's winner.
-        for fu_idx in PRIORITY_ORDER:
-            if fu_idx != lane0_idx and fu_completes[fu_idx].valid:
-                grants[fu_idx] = True
-                cdb_2 = _broadcast_from(fu_completes[fu_idx], fu_idx)
-                break
+        # Sort valid requesters by (relative age, tie-break rank), oldest first.
+        valid = [
+            (
+                (fu_completes[fu_idx].tag - rob_head) & MASK_TAG,
+                PRIORITY_RANK[fu_idx],
+                fu_idx,
+            )
+            for fu_idx in range(NUM_FUS)
+            if fu_completes[fu_idx].valid
+        ]
+        valid.sort()
+
+        if valid:
+            fu_idx = valid[0][2]
+            grants[fu_idx] = True
+            cdb = _broadcast_from(fu_completes[fu_idx], fu_idx)
+        if len(valid) >= 2:
+            fu_idx = valid[1][2]
+            grants[fu_idx] = True
+            cdb_2 = _broadcast_from(fu_completes[fu_idx], fu_idx)
 
         return cdb, cdb_2, grants
@@ -14,8 +14,8 @@
 
 """Unit tests for the CDB Arbiter.
 
-Tests priority arbitration, grant exclusivity, data propagation, and
-constrained-random stress scenarios.
+Tests age-ordered (oldest-ROB-first) arbitration, grant exclusivity, data
+propagation, and constrained-random stress scenarios.
 """
 
 import random
@@ -71,14 +71,16 @@ def drive_and_check(
     dut_if: CdbArbiterInterface,
     model: CdbArbiterModel,
     fu_completes: list[FuComplete],
+    rob_head: int = 0,
 ) -> tuple[CdbBroadcast, CdbBroadcast, list[bool]]:
     """Drive FU completes to DUT, run model, return (model_cdb, model_cdb_2, model_grants)."""
     from .cdb_arbiter_interface import pack_fu_complete
 
     for i, req in enumerate(fu_completes):
         dut_if._get_fu_signal(i).value = pack_fu_complete(req)
+    dut_if.set_rob_head(rob_head)
 
-    return model.arbitrate(fu_completes)
+    return model.arbitrate(fu_completes, rob_head)
 
 
 def assert_cdb_match(
@@ -235,11 +237,11 @@ async def test_single_fu_each(dut: Any) -> None:
 
 
 # ============================================================================
-# Test 5: FP_DIV + ALU → ALU wins
+# Test 5: FP_DIV + ALU, ALU older → ALU wins lane 0
 # ============================================================================
 @cocotb.test()
-async def test_priority_alu_over_fp_div(dut: Any) -> None:
-    """FP_DIV + ALU → ALU wins."""
+async def test_age_older_int_wins(dut: Any) -> None:
+    """ALU (tag 1) older than FP_DIV (tag 2) → ALU takes lane 0."""
     dut_if, model = await setup(dut)
 
     fu_completes = make_fu_completes(
@@ -254,23 +256,113 @@ async def test_priority_alu_over_fp_div(dut: Any) -> None:
     dut_cdb = dut_if.read_cdb_output()
     dut_grants = dut_if.read_grant()
 
-    assert_cdb_match(dut_cdb, model_cdb, "alu_over_fp_div")
+    assert_cdb_match(dut_cdb, model_cdb, "older_int_wins")
     assert dut_cdb.fu_type == FU_ALU
     assert dut_cdb.tag == 1
     assert dut_grants[FU_ALU] is True
     # 2-wide CDB: the runner-up is broadcast on lane 1, not denied.
     dut_cdb_2 = dut_if.read_cdb_2_output()
-    assert_cdb_match(dut_cdb_2, model_cdb_2, "alu_over_fp_div lane1")
+    assert_cdb_match(dut_cdb_2, model_cdb_2, "older_int_wins lane1")
     assert dut_cdb_2.fu_type == FU_FP_DIV
     assert dut_grants[FU_FP_DIV] is True
 
 
 # ============================================================================
-# Test 6: DIV + MUL → MUL wins
+# Test 5a: FP_ADD oldest among an INT burst → FP cannot be starved
 # ============================================================================
 @cocotb.test()
-async def test_priority_mul_over_div(dut: Any) -> None:
-    """DIV + MUL → MUL wins."""
+async def test_age_oldest_fp_beats_int_burst(dut: Any) -> None:
+    """FP_ADD (tag 5) older than MUL/MEM/ALU → FP_ADD takes lane 0."""
+    dut_if, model = await setup(dut)
+
+    fu_completes = make_fu_completes(
+        {
+            FU_FP_ADD: {"tag": 5, "value": 0xF0F0},
+            FU_MUL: {"tag": 10, "value": 0x1010},
+            FU_MEM: {"tag": 11, "value": 0x2020},
+            FU_ALU: {"tag": 12, "value": 0x3030},
+        }
+    )
+    model_cdb, model_cdb_2, model_grants = drive_and_check(dut_if, model, fu_completes)
+    await Timer(1, unit="ns")
+
+    dut_cdb = dut_if.read_cdb_output()
+    dut_cdb_2 = dut_if.read_cdb_2_output()
+    dut_grants = dut_if.read_grant()
+
+    assert_cdb_match(dut_cdb, model_cdb, "oldest_fp")
+    assert dut_cdb.fu_type == FU_FP_ADD
+    assert dut_cdb.tag == 5
+    # Second-oldest (MUL, tag 10) takes lane 1.
+    assert_cdb_match(dut_cdb_2, model_cdb_2, "oldest_fp lane1")
+    assert dut_cdb_2.fu_type == FU_MUL
+    assert dut_grants[FU_FP_ADD] is True
+    assert dut_grants[FU_MUL] is True
+    assert dut_grants[FU_MEM] is False
+    assert dut_grants[FU_ALU] is False
+
+
+# ============================================================================
+# Test 5b: Age comparison wraps with the ROB pointer
+# ============================================================================
+@cocotb.test()
+async def test_age_wraparound(dut: Any) -> None:
+    """head=30: FP_MUL tag 31 (age 1) beats ALU tag 2 (age 4) across the wrap."""
+    dut_if, model = await setup(dut)
+
+    fu_completes = make_fu_completes(
+        {
+            FU_FP_MUL: {"tag": 31, "value": 0x5555},
+            FU_ALU: {"tag": 2, "value": 0x6666},
+        }
+    )
+    model_cdb, model_cdb_2, model_grants = drive_and_check(
+        dut_if, model, fu_completes, rob_head=30
+    )
+    await Timer(1, unit="ns")
+
+    dut_cdb = dut_if.read_cdb_output()
+    dut_cdb_2 = dut_if.read_cdb_2_output()
+
+    assert_cdb_match(dut_cdb, model_cdb, "wraparound")
+    assert dut_cdb.fu_type == FU_FP_MUL
+    assert dut_cdb.tag == 31
+    assert_cdb_match(dut_cdb_2, model_cdb_2, "wraparound lane1")
+    assert dut_cdb_2.fu_type == FU_ALU
+
+
+# ============================================================================
+# Test 5c: Equal tags fall back to the legacy priority rank
+# ============================================================================
+@cocotb.test()
+async def test_age_equal_tag_tiebreak(dut: Any) -> None:
+    """MUL and FP_ADD with the same tag → MUL wins the tie on legacy rank."""
+    dut_if, model = await setup(dut)
+
+    fu_completes = make_fu_completes(
+        {
+            FU_FP_ADD: {"tag": 7, "value": 0x7777},
+            FU_MUL: {"tag": 7, "value": 0x8888},
+        }
+    )
+    model_cdb, model_cdb_2, model_grants = drive_and_check(dut_if, model, fu_completes)
+    await Timer(1, unit="ns")
+
+    dut_cdb = dut_if.read_cdb_output()
+    dut_cdb_2 = dut_if.read_cdb_2_output()
+
+    assert_cdb_match(dut_cdb, model_cdb, "tiebreak")
+    assert dut_cdb.fu_type == FU_MUL
+    assert_cdb_match(dut_cdb_2, model_cdb_2, "tiebreak lane1")
+    assert dut_cdb_2.fu_type == FU_FP_ADD
+
+
+# ============================================================================
+# Test 6: DIV + MUL, MUL older → MUL wins lane 0
+# ============================================================================
+@cocotb.test()
+async def test_age_mul_over_younger_div(dut: Any) -> None:
+    """MUL (tag 3) older than DIV (tag 4) → MUL takes lane 0."""
     dut_if, model = await setup(dut)
 
     fu_completes = make_fu_completes(
@@ -296,11 +388,11 @@ async def test_priority_mul_over_div(dut: Any) -> None:
 
 
 # ============================================================================
-# Test 6: All 7 FUs valid -> MUL wins (highest priority)
+# Test 6a: All 7 FUs valid -> two oldest tags win the two lanes
 # ============================================================================
 @cocotb.test()
-async def test_priority_all_valid(dut: Any) -> None:
-    """All 7 FUs valid -> MUL wins (highest priority)."""
+async def test_age_all_valid(dut: Any) -> None:
+    """All 7 FUs valid with tag=fu_idx -> ALU (tag 0) lane 0, MUL (tag 1) lane 1."""
     dut_if, model = await setup(dut)
 
     specs = {}
@@ -315,25 +407,25 @@ async def test_priority_all_valid(dut: Any) -> None:
     dut_grants = dut_if.read_grant()
 
     assert_cdb_match(dut_cdb, model_cdb, "all_valid")
-    assert dut_cdb.fu_type == FU_MUL
-    assert dut_grants[FU_MUL] is True
-    # 2-wide CDB: the second-highest priority (MEM) is granted on lane 1.
+    assert dut_cdb.fu_type == FU_ALU
+    assert dut_grants[FU_ALU] is True
+    # 2-wide CDB: the second-oldest (MUL, tag 1) is granted on lane 1.
     dut_cdb_2 = dut_if.read_cdb_2_output()
     assert_cdb_match(dut_cdb_2, model_cdb_2, "all_valid lane1")
-    assert dut_cdb_2.fu_type == FU_MEM
-    assert dut_grants[FU_MEM] is True
+    assert dut_cdb_2.fu_type == FU_MUL
+    assert dut_grants[FU_MUL] is True
     # Every FU except the two lane winners should be denied.
     for i in range(NUM_FUS):
-        if i not in (FU_MUL, FU_MEM):
+        if i not in (FU_ALU, FU_MUL):
             assert dut_grants[i] is False, f"FU {i} should not be granted"
 
 
 # ============================================================================
-# Test 7: All except MUL -> MEM wins
+# Test 7: All except MUL -> two oldest of the rest win
 # ============================================================================
 @cocotb.test()
-async def test_priority_all_except_highest(dut: Any) -> None:
-    """All except MUL -> MEM wins."""
+async def test_age_all_except_one(dut: Any) -> None:
+    """All but MUL valid with tag=fu_idx+10 -> ALU (tag 10) lane 0, DIV (tag 12) lane 1."""
     dut_if, model = await setup(dut)
 
     specs = {}
@@ -348,14 +440,14 @@ async def test_priority_all_except_highest(dut: Any) -> None:
     dut_cdb = dut_if.read_cdb_output()
     dut_grants = dut_if.read_grant()
 
-    assert_cdb_match(dut_cdb, model_cdb, "all_except_highest")
-    assert dut_cdb.fu_type == FU_MEM
-    assert dut_grants[FU_MEM] is True
-    # 2-wide CDB: next priority after MEM is ALU, granted on lane 1.
-    dut_cdb_2 = dut_if.read_cdb_2_output()
-    assert_cdb_match(dut_cdb_2, model_cdb_2, "all_except_highest lane1")
-    assert dut_cdb_2.fu_type == FU_ALU
+    assert_cdb_match(dut_cdb, model_cdb, "all_except_one")
+    assert dut_cdb.fu_type == FU_ALU
     assert dut_grants[FU_ALU] is True
+    # 2-wide CDB: the next-oldest (DIV, tag 12) is granted on lane 1.
+    dut_cdb_2 = dut_if.read_cdb_2_output()
+    assert_cdb_match(dut_cdb_2, model_cdb_2, "all_except_one lane1")
+    assert dut_cdb_2.fu_type == FU_DIV
+    assert dut_grants[FU_DIV] is True
 
 
 # ============================================================================
@@ -594,8 +686,9 @@ async def test_loser_must_retry(dut: Any) -> None:
     """A third requester (beyond the two CDB lanes) loses and must re-present."""
     dut_if, model = await setup(dut)
 
-    # Cycle 1: MUL + MEM + ALU all valid. 2-wide CDB grants the top two
-    # (MUL on lane 0, MEM on lane 1); ALU loses and must retry.
+    # Cycle 1: MUL + MEM + ALU all valid. 2-wide CDB grants the two oldest
+    # (MUL tag 1 on lane 0, MEM tag 2 on lane 1); ALU (tag 3) loses and must
+    # retry.
     dut_if.drive_fu_complete(FU_MUL, tag=1, value=0x1111)
     dut_if.drive_fu_complete(FU_MEM, tag=2, value=0x2222)
     dut_if.drive_fu_complete(FU_ALU, tag=3, value=0x3333)
@@ -636,7 +729,9 @@ async def test_random_multi_fu_stress(dut: Any) -> None:
     num_cycles = 200
 
     for cycle in range(num_cycles):
-        # Random subset of FUs valid (each with ~50% probability)
+        # Random subset of FUs valid (each with ~50% probability).  Random
+        # tags collide freely, exercising the equal-tag tie-break, and a
+        # random head exercises the wrap-safe age comparison.
         fu_completes = [FuComplete() for _ in range(NUM_FUS)]
         for fu_idx in range(NUM_FUS):
             if rng.random() < 0.5:
@@ -650,7 +745,7 @@ async def test_random_multi_fu_stress(dut: Any) -> None:
                 )
 
         model_cdb, model_cdb_2, model_grants = drive_and_check(
-            dut_if, model, fu_completes
+            dut_if, model, fu_completes, rob_head=rng.randint(0, 31)
         )
 
         await dut_if.step()
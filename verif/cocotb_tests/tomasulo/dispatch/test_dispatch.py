@@ -38,6 +38,8 @@ from .dispatch_interface import (
     JAL,
     WFI,
     ADDI,
+    LUI,
+    AUIPC,
     FADD_S,
     FMUL_S,
     FDIV_S,
@@ -71,6 +73,10 @@ OPC_OP_FP = 0b1010011
 OPC_LOAD_FP = 0b0000111
 # OPC_STORE_FP = 0b0100111
 OPC_STORE_FP = 0b0100111
+# OPC_LUI = 0b0110111
+OPC_LUI = 0b0110111
+# OPC_AUIPC = 0b0010111
+OPC_AUIPC = 0b0010111
 
 
 async def _setup(dut: Any) -> DispatchInterface:
@@ -524,6 +530,69 @@ async def test_slot2_raw_source_uses_slot1_rob_tag(dut: Any) -> None:
     assert slot2_rs["src1_tag"] == 12, f"Expected tag 12, got {slot2_rs['src1_tag']}"
 
 
+@cocotb.test()
+async def test_slot2_folds_lui_producer_to_ready_value(dut: Any) -> None:
+    """lui+addi fusion: the slot-2 source gets the constant, not a tag."""
+    dut_if = await _setup(dut)
+
+    dut_if.drive_rob_alloc_resp(alloc_ready=1, alloc_tag=12, full=0)
+    dut_if.drive_rob_alloc_resp_2(alloc_ready=1, alloc_tag=13, full=0)
+    dut_if.drive_int_src1_2(renamed=0, tag=0, value=0xCAFE)
+
+    dut_if.drive_instruction(
+        valid=True,
+        instruction_operation=LUI,
+        immediate_u_type=0x12345000,
+        instruction=_make_instr(dest_reg=9, opcode=OPC_LUI),
+    )
+    dut_if.drive_instruction_2(
+        valid=True,
+        rs1_addr=9,
+        instruction_operation=ADDI,
+        immediate_i_type=0x678,
+        instruction=_make_instr(dest_reg=10, opcode=OPC_OP_IMM, source_reg_1=9),
+    )
+    await dut_if.step()
+
+    assert not dut_if.stall
+    slot2_rs = dut_if.read_int_rs_dispatch_2()
+    assert slot2_rs["valid"] == 1
+    assert slot2_rs["src1_ready"] == 1, "LUI result is known at dispatch"
+    assert slot2_rs["src1_value"] == 0x12345000
+
+
+@cocotb.test()
+async def test_slot2_folds_auipc_producer_to_ready_value(dut: Any) -> None:
+    """auipc+addi fusion: the slot-2 source gets PC + U-imm, not a tag."""
+    dut_if = await _setup(dut)
+
+    dut_if.drive_rob_alloc_resp(alloc_ready=1, alloc_tag=12, full=0)
+    dut_if.drive_rob_alloc_resp_2(alloc_ready=1, alloc_tag=13, full=0)
+    dut_if.drive_int_src1_2(renamed=0, tag=0, value=0xCAFE)
+
+    dut_if.drive_instruction(
+        valid=True,
+        instruction_operation=AUIPC,
+        immediate_u_type=0x00010000,
+        program_counter=0x2000,
+        instruction=_make_instr(dest_reg=9, opcode=OPC_AUIPC),
+    )
+    dut_if.drive_instruction_2(
+        valid=True,
+        rs1_addr=9,
+        instruction_operation=ADDI,
+        immediate_i_type=4,
+        instruction=_make_instr(dest_reg=10, opcode=OPC_OP_IMM, source_reg_1=9),
+    )
+    await dut_if.step()
+
+    assert not dut_if.stall
+    slot2_rs = dut_if.read_int_rs_dispatch_2()
+    assert slot2_rs["valid"] == 1
+    assert slot2_rs["src1_ready"] == 1, "AUIPC result is known at dispatch"
+    assert slot2_rs["src1_value"] == 0x00012000
+
+
 @cocotb.test()
 async def test_slot2_same_rs_full_for_2_stalls_bundle(dut: Any) -> None:
     """Same-RS bundles should stall when the room-for-2 signal is full."""
@@ -53,7 +53,7 @@ EXPECTED_2_0_SP = 0xFFFF_FFFF_4000_0000  # sqrt(4.0) = 2.0 (SP, NaN-boxed)
 EXPECTED_3_0_DP = 0x4008_0000_0000_0000  # 6.0 / 2.0 = 3.0 (DP)
 EXPECTED_2_0_DP = 0x4000_0000_0000_0000  # sqrt(4.0) = 2.0 (DP)
 
-MAX_LATENCY = 80  # DP pipeline is 65 stages, allow margin
+MAX_LATENCY = 50  # DP pipeline is 38 stages, allow margin
 
 
 async def setup(dut: Any) -> FpDivShimInterface:
@@ -383,15 +383,15 @@ async def test_fifo_backpressure(dut: Any) -> None:
 # ============================================================================
 @cocotb.test()
 async def test_cross_precision_collision(dut: Any) -> None:
-    """Issue FDIV_D then FDIV_S 29 cycles later so both complete same cycle.
+    """Issue FDIV_D then FDIV_S 15 cycles later so both complete same cycle.
 
-    SP pipeline = 36 stages, DP pipeline = 65 stages. Offset = 29.
+    SP pipeline = 23 stages, DP pipeline = 38 stages. Offset = 15.
     Both sub-units' hold registers fill on the same cycle; the arbiter
     can only drain one per cycle. Verifies no result is lost.
     """
     iface = await setup(dut)
 
-    # Issue FDIV_D (65-cycle pipeline)
+    # Issue FDIV_D (38-cycle pipeline)
     iface.drive_issue(
         valid=True,
         rob_tag=14,
@@ -402,11 +402,11 @@ async def test_cross_precision_collision(dut: Any) -> None:
     await RisingEdge(iface.clock)
     iface.clear_issue()
 
-    # Wait 28 cycles so next issue is 29 cycles after the DP issue
-    for _ in range(28):
+    # Wait 14 cycles so next issue is 15 cycles after the DP issue
+    for _ in range(14):
         await RisingEdge(iface.clock)
 
-    # Issue FDIV_S (36-cycle pipeline, completes same cycle as FDIV_D)
+    # Issue FDIV_S (23-cycle pipeline, completes same cycle as FDIV_D)
     iface.drive_issue(
         valid=True,
         rob_tag=15,
@@ -448,9 +448,9 @@ async def test_hold_overwrite_stress(dut: Any) -> None:
     """Issue 2 FDIV_D + 1 FDIV_S timed so FDIV_D completes twice in a row.
 
     FDIV_S hold also contends.
-    FDIV_D#1 @ T, FDIV_D#2 @ T+1, FDIV_S @ T+29.
-    T+65: FDIV_D#1 + FDIV_S complete simultaneously (hold collision).
-    T+66: FDIV_D#2 completes; if DP hold wasn't drained, old code overwrites.
+    FDIV_D#1 @ T, FDIV_D#2 @ T+1, FDIV_S @ T+15.
+    T+38: FDIV_D#1 + FDIV_S complete simultaneously (hold collision).
+    T+39: FDIV_D#2 completes; if DP hold wasn't drained, old code overwrites.
     With 2-deep hold, all three results must survive.
     """
     iface = await setup(dut)
@@ -476,8 +476,8 @@ async def test_hold_overwrite_stress(dut: Any) -> None:
     await RisingEdge(iface.clock)
     iface.clear_issue()
 
-    # Wait until 29 cycles after FDIV_D#1 issue, then issue FDIV_S
-    for _ in range(27):
+    # Wait until 15 cycles after FDIV_D#1 issue, then issue FDIV_S
+    for _ in range(13):
         await RisingEdge(iface.clock)
 
     iface.drive_issue(
@@ -16,7 +16,7 @@
 
 Tests MUL, MULH, MULHSU, MULHU, DIV, DIVU, REM, REMU operations,
 divide-by-zero, signed overflow, busy signalling, and full/partial
-flush behavior.  MUL has ~4-cycle latency, DIV has ~17-cycle latency,
+flush behavior.  MUL has ~4-cycle latency, DIV has DIV_LATENCY cycles,
 so tests poll for completion.
 """
 
@@ -36,6 +36,9 @@ MASK32 = 0xFFFF_FFFF
 # Maximum cycles to wait for completion
 MAX_LATENCY = 50
 
+# Divider pipeline latency: 1 init + XLEN / riscv_pkg::DivBitsPerStage stages
+DIV_LATENCY = 9
+
 # ---------------------------------------------------------------------------
 # Parse instr_op_e from riscv_pkg.sv so op values track the RTL source.
 # ---------------------------------------------------------------------------
@@ -875,7 +878,7 @@ async def test_mul_during_inflight_div(dut: Any) -> None:
     assert mul_result["tag"] == 2, f"MUL tag mismatch: got {mul_result['tag']}"
     assert mul_result["value"] == 42, f"MUL expected 42, got {mul_result['value']}"
 
-    # DIV should complete later (~17 cycles)
+    # DIV should complete later (DIV_LATENCY cycles)
     div_result = await wait_for_div_complete(iface)
     assert div_result["tag"] == 1, f"DIV tag mismatch: got {div_result['tag']}"
     assert div_result["value"] == 6, f"DIV expected 6, got {div_result['value']}"
@@ -1019,10 +1022,10 @@ async def test_partial_flush_at_completion(dut: Any) -> None:
     await RisingEdge(iface.clock)
     iface.clear_issue()
 
-    # Wait until 1 cycle before the divider output is expected (16 cycles
-    # after the issue edge, so the valid appears on the 17th rising edge).
-    # We've already consumed 1 edge above, so wait 15 more.
-    for _ in range(15):
+    # Wait until 1 cycle before the divider output is expected
+    # (DIV_LATENCY - 1 cycles after the issue edge, so the valid appears on
+    # the DIV_LATENCY-th rising edge).  We've already consumed 1 edge above.
+    for _ in range(DIV_LATENCY - 2):
         await RisingEdge(iface.clock)
 
     # Now assert partial flush on the SAME cycle the tail valid goes high.
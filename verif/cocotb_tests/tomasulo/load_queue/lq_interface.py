@@ -57,8 +57,8 @@ LQ_ALLOC_WIDTH = 44
 LQ_ADDR_UPDATE_WIDTH = 71
 
 # sq_forward_result_t packed layout:
-# data(64) | can_forward(1) | match(1) = 66 bits
-SQ_FORWARD_WIDTH = 66
+# data(64) | blocked_bytes(4) | fwd_bytes(4) | can_forward(1) | match(1) = 74 bits
+SQ_FORWARD_WIDTH = 74
 
 # fu_complete_t packed layout:
 # fp_flags(5) | exc_cause(5) | exception(1) | value(64) | tag(5) | valid(1) = 81 bits
@@ -123,12 +123,27 @@ def pack_sq_forward(
     match: bool = False,
     can_forward: bool = False,
     data: int = 0,
+    fwd_bytes: int | None = None,
+    blocked_bytes: int | None = None,
 ) -> int:
-    """Pack sq_forward_result_t into bit vector."""
+    """Pack sq_forward_result_t into bit vector.
+
+    fwd_bytes/blocked_bytes default to what the SQ produces for the classic
+    whole-value cases: all lanes forwarded when can_forward, all lanes
+    blocked on an unforwardable conflict.
+    """
+    if fwd_bytes is None:
+        fwd_bytes = 0xF if can_forward else 0
+    if blocked_bytes is None:
+        blocked_bytes = 0xF if (match and not can_forward) else 0
     val = 0
     bit = 0
     val |= (data & MASK64) << bit
     bit += FLEN
+    val |= (blocked_bytes & 0xF) << bit
+    bit += 4
+    val |= (fwd_bytes & 0xF) << bit
+    bit += 4
     val |= (1 if can_forward else 0) << bit
     bit += 1
     val |= (1 if match else 0) << bit
@@ -312,9 +327,13 @@ class LQInterface:
         match: bool = False,
         can_forward: bool = False,
         data: int = 0,
+        fwd_bytes: int | None = None,
+        blocked_bytes: int | None = None,
     ) -> None:
         """Drive SQ forwarding response."""
-        self.dut.i_sq_forward.value = pack_sq_forward(match, can_forward, data)
+        self.dut.i_sq_forward.value = pack_sq_forward(
+            match, can_forward, data, fwd_bytes, blocked_bytes
+        )
 
     def clear_sq_forward(self) -> None:
         """Clear SQ forwarding response."""
@@ -361,6 +380,9 @@ class LQInterface:
             "en": bool(self.dut.o_mem_read_en.value),
             "addr": int(self.dut.o_mem_read_addr.value),
             "size": int(self.dut.o_mem_read_size.value),
+            "is_amo": bool(self.dut.o_mem_read_is_amo.value),
+            "amo_op": int(self.dut.o_mem_amo_op.value),
+            "amo_operand": int(self.dut.o_mem_amo_operand.value),
         }
 
     # =========================================================================
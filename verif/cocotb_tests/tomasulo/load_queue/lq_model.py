@@ -30,6 +30,12 @@ MASK_TAG = (1 << ROB_TAG_WIDTH) - 1
 MASK32 = (1 << XLEN) - 1
 MASK64 = (1 << FLEN) - 1
 
+# Cached tier window (mirrors is_cached_addr in the RTL). Cached AMOs
+# complete as a single read-modify-write at the cache tier, so the model
+# skips the two-phase write state for them.
+CACHED_BASE = 0x8000_0000
+CACHED_SIZE = 1 << 30
+
 # mem_size_e values
 MEM_SIZE_BYTE = 0
 MEM_SIZE_HALF = 1
@@ -78,6 +84,8 @@ class SQForwardResult:
 
     match: bool = False
     can_forward: bool = False
+    fwd_bytes: int = 0
+    blocked_bytes: int = 0
     data: int = 0
 
 
@@ -364,7 +372,16 @@ class LQModel:
         if sq_forward.can_forward and not e.is_mmio and not e.is_lr and not e.is_amo:
             e.data_valid = True
             e.forwarded = True
-            e.data = sq_forward.data & MASK64
+            if e.size == MEM_SIZE_DOUBLE:
+                e.data = sq_forward.data & MASK64
+            else:
+                # Mirror the DUT's forward-side load unit: sub-word forwards
+                # arrive as a word at the load's word address and are
+                # extracted/sign-extended here (identity for word loads).
+                e.data = (
+                    load_unit_model(e.size, e.sign_ext, e.address, sq_forward.data)
+                    & MASK64
+                )
 
     def cache_hit_complete(self) -> None:
         """Model DUT cache-hit fast path for the current Phase B candidate.
@@ -418,8 +435,14 @@ class LQModel:
         e = self.entries[idx]
         data = data & MASK32
 
-        if e.is_amo:
-            # AMO: latch old value, start write phase
+        if e.is_amo and CACHED_BASE <= e.address < CACHED_BASE + CACHED_SIZE:
+            # Cached AMO: the cache tier applied the write; the response is
+            # the old value and the entry completes like a plain load.
+            e.data = data & MASK64
+            e.data_valid = True
+            self.mem_outstanding = False
+        elif e.is_amo:
+            # BRAM/MMIO AMO: latch old value, start write phase
             self.amo_old_value = data
             self.amo_entry_idx = idx
             self.amo_state = 1  # WRITE_ACTIVE
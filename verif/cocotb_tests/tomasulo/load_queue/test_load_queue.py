@@ -1309,6 +1309,137 @@ async def test_cached_response_after_invalidate_does_not_refill_l0(dut: Any) ->
     await accept_fu_complete(dut_if)
 
 
+# ============================================================================
+# Test 25c: Secondary L0 completion resolves a second load with an empty SQ
+# ============================================================================
+@cocotb.test()
+async def test_dual_l0_resolve_with_empty_sq(dut: Any) -> None:
+    """Two L0-warm loads resolve together when the SQ is empty.
+
+    Warm two different words via memory, then allocate two loads to those
+    words with i_sq_empty held high. The primary completes via the staged
+    fast path; the secondary L0 completion path must deliver the other
+    load's data without either load launching to memory, and both results
+    must drain over the CDB.
+    """
+    dut_if, model = await setup(dut)
+
+    # Warm two cache words via the memory path.
+    await alloc_and_addr(dut_if, model, rob_tag=1, address=0x5000)
+    result = await complete_load_no_forward(dut_if, model, mem_data=0x1111_2222)
+    assert result.valid and result.tag == 1
+    await dut_if.step()
+
+    await alloc_and_addr(dut_if, model, rob_tag=2, address=0x5004)
+    result = await complete_load_no_forward(dut_if, model, mem_data=0x3333_4444)
+    assert result.valid and result.tag == 2
+    await dut_if.step()
+
+    # Two loads to the warmed words with the SQ completely empty — the
+    # condition under which the secondary path may skip disambiguation.
+    dut_if.drive_sq_empty(True)
+    await alloc_and_addr(dut_if, model, rob_tag=3, address=0x5000)
+    await alloc_and_addr(dut_if, model, rob_tag=4, address=0x5004)
+
+    results: dict[int, int] = {}
+    mem_launches = 0
+    for _ in range(10):
+        await Timer(1, unit="ns")
+        if dut_if.read_mem_request()["en"]:
+            mem_launches += 1
+        res = dut_if.read_fu_complete()
+        if res.valid and res.tag not in results:
+            results[res.tag] = res.value
+            await accept_fu_complete(dut_if)
+        else:
+            await dut_if.step()
+        if len(results) == 2:
+            break
+    dut_if.drive_sq_empty(False)
+
+    assert mem_launches == 0, "Warm loads must complete from L0, not memory"
+    assert results.get(3) == 0x1111_2222, f"Load 3 result: {results.get(3)}"
+    assert results.get(4) == 0x3333_4444, f"Load 4 result: {results.get(4)}"
+
+
+@cocotb.test()
+async def test_dual_l0_blocked_while_sq_nonempty(dut: Any) -> None:
+    """With stores in flight the secondary path must stay off.
+
+    Same warm-cache setup, but i_sq_empty low and disambiguation withheld:
+    neither load may complete or launch until the SQ answers for it through
+    the staged primary port.
+    """
+    dut_if, model = await setup(dut)
+
+    await alloc_and_addr(dut_if, model, rob_tag=1, address=0x5100)
+    result = await complete_load_no_forward(dut_if, model, mem_data=0xAAAA_0000)
+    assert result.valid and result.tag == 1
+    await dut_if.step()
+
+    dut_if.drive_sq_empty(False)
+    dut_if.drive_sq_all_older_known(False)
+    dut_if.drive_sq_forward(match=False, can_forward=False)
+    await alloc_and_addr(dut_if, model, rob_tag=2, address=0x5100)
+    await alloc_and_addr(dut_if, model, rob_tag=3, address=0x5100)
+
+    for _ in range(5):
+        await Timer(1, unit="ns")
+        assert not dut_if.read_fu_complete().valid, (
+            "Load completed without SQ disambiguation while stores in flight"
+        )
+        assert not dut_if.read_mem_request()["en"], (
+            "Load launched without SQ disambiguation while stores in flight"
+        )
+        await dut_if.step()
+
+
+# ============================================================================
+# Test 25d: Two words in the same L0 set stay resident (2-way associativity)
+# ============================================================================
+@cocotb.test()
+async def test_l0_two_way_conflict_resident(dut: Any) -> None:
+    """Two words with equal index bits [8:2] both stay resident.
+
+    The direct-mapped L0 evicted one on filling the other; with two ways
+    both re-loads must complete from the cache without a memory launch.
+    """
+    dut_if, model = await setup(dut)
+
+    # 0x6000 and 0x6200 differ only in bit 9: same set, different tags.
+    for tag, (addr, data) in enumerate(
+        [(0x6000, 0xCAFE_0001), (0x6200, 0xCAFE_0002)], start=1
+    ):
+        await alloc_and_addr(dut_if, model, rob_tag=tag, address=addr)
+        result = await complete_load_no_forward(dut_if, model, mem_data=data)
+        assert result.valid and result.tag == tag
+        await dut_if.step()
+
+    dut_if.drive_sq_empty(True)
+    await alloc_and_addr(dut_if, model, rob_tag=3, address=0x6000)
+    await alloc_and_addr(dut_if, model, rob_tag=4, address=0x6200)
+
+    results: dict[int, int] = {}
+    mem_launches = 0
+    for _ in range(10):
+        await Timer(1, unit="ns")
+        if dut_if.read_mem_request()["en"]:
+            mem_launches += 1
+        res = dut_if.read_fu_complete()
+        if res.valid and res.tag not in results:
+            results[res.tag] = res.value
+            await accept_fu_complete(dut_if)
+        else:
+            await dut_if.step()
+        if len(results) == 2:
+            break
+    dut_if.drive_sq_empty(False)
+
+    assert mem_launches == 0, "Both set-conflicting words must stay L0-resident"
+    assert results.get(3) == 0xCAFE_0001
+    assert results.get(4) == 0xCAFE_0002
+
+
 # ============================================================================
 # Test 26: Cache miss fills cache, subsequent hit
 # ============================================================================
@@ -2088,3 +2219,93 @@ async def test_amo_write_invalidates_l0_cache(dut: Any) -> None:
     # (not fast-path from cache)
     mem_req = await wait_for_mem_request(dut_if)
     assert mem_req["en"], "LW after AMO should miss L0 cache and issue to memory"
+
+
+# ============================================================================
+# Test 39: Cached AMO completes as a single trip (no LQ write phase)
+# ============================================================================
+@cocotb.test()
+async def test_cached_amo_rmw_single_trip(dut: Any) -> None:
+    """Cached-tier AMO: op/rs2 ride with the read, no AMO write phase follows.
+
+    The cached tier applies the read-modify-write at the cache and returns
+    the old word, so the LQ must tag the read with the AMO sideband, complete
+    the entry off its own response like a plain load, and never raise the
+    two-phase write port. The response must still invalidate the L0 line.
+    """
+    dut_if, model = await setup(dut)
+
+    from .lq_interface import AMOADD_W
+
+    addr = 0x8000_0300
+    rs2_val = 0x5
+    old_val = 0x1000
+
+    # Allocate the AMO and resolve its address + rs2 operand.
+    dut_if.drive_alloc(rob_tag=0, size=MEM_SIZE_WORD, is_amo=True, amo_op=AMOADD_W)
+    model.alloc(0, False, MEM_SIZE_WORD, False, is_amo=True, amo_op=AMOADD_W)
+    await dut_if.step()
+    dut_if.clear_alloc()
+
+    dut_if.drive_addr_update(rob_tag=0, address=addr, amo_rs2=rs2_val)
+    model.addr_update(0, addr, amo_rs2=rs2_val)
+    await dut_if.step()
+    dut_if.clear_addr_update()
+
+    # Issue from the ROB head with the SQ committed-empty. The read must
+    # carry the RMW sideband for the cached tier.
+    dut_if.drive_rob_head_tag(0)
+    dut_if.drive_sq_all_older_known(True)
+    dut_if.drive_sq_forward(match=False, can_forward=False)
+    dut_if.drive_sq_committed_empty(True)
+    mem_req = await wait_for_mem_request(dut_if)
+    assert mem_req["en"], "Cached AMO should issue a memory read"
+    assert mem_req["addr"] == addr
+    assert mem_req["is_amo"], "Cached AMO read should carry the RMW sideband"
+    assert mem_req["amo_op"] == AMOADD_W, f"AMO op: {mem_req['amo_op']}"
+    assert mem_req["amo_operand"] == rs2_val, f"AMO operand: {mem_req['amo_operand']:#x}"
+    await dut_if.step()
+
+    # Response returns the old word; the entry completes directly.
+    dut_if.drive_mem_response(old_val)
+    model.mem_response(old_val)
+    await dut_if.step()
+    dut_if.clear_mem_response()
+
+    # The two-phase write port must stay quiet for a cached AMO.
+    for _ in range(4):
+        await Timer(1, unit="ns")
+        amo_write = dut_if.read_amo_mem_write()
+        assert not amo_write["en"], "Cached AMO must not enter the LQ write phase"
+        await dut_if.step()
+
+    result = await wait_for_fu_complete(dut_if)
+    assert result.valid, "CDB should broadcast the AMO result"
+    assert result.tag == 0
+    assert result.value == old_val, f"Expected {old_val:#x}, got {result.value:#x}"
+    await accept_fu_complete(dut_if)
+
+    # The response also invalidated the AMO's L0 line: a later load to the
+    # same word must miss and issue to memory.
+    await alloc_and_addr(dut_if, model, rob_tag=1, address=addr)
+    dut_if.drive_rob_head_tag(1)
+    await Timer(1, unit="ns")
+    assert not bool(dut.o_l0_hit.value), "Cached AMO response must not leave L0 warm"
+    mem_req = await wait_for_mem_request(dut_if, max_cycles=4)
+    assert mem_req["en"], "Load after cached AMO should miss L0 and issue to memory"
+    assert mem_req["addr"] == addr
+    await dut_if.step()
+
+    dut_if.drive_mem_response(old_val + rs2_val)
+    model.mem_response(old_val + rs2_val)
+    await dut_if.step()
+    dut_if.clear_mem_response()
+
+    result = await wait_for_fu_complete(dut_if)
+    assert result.valid
+    assert result.tag == 1
+    assert result.value == old_val + rs2_val
+
+    dut_if.drive_sq_all_older_known(False)
+    dut_if.clear_sq_forward()
+    await accept_fu_complete(dut_if)
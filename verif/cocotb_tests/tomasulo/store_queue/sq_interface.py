@@ -48,8 +48,8 @@ SQ_ADDR_UPDATE_WIDTH = 39
 SQ_DATA_UPDATE_WIDTH = 70
 
 # sq_forward_result_t packed layout:
-# data(64) | can_forward(1) | match(1) = 66 bits
-SQ_FORWARD_WIDTH = 66
+# data(64) | blocked_bytes(4) | fwd_bytes(4) | can_forward(1) | match(1) = 74 bits
+SQ_FORWARD_WIDTH = 74
 
 
 def pack_sq_alloc(
@@ -123,10 +123,20 @@ def unpack_sq_forward(raw: int) -> ForwardResult:
     bit = 0
     data = (raw >> bit) & MASK64
     bit += FLEN
+    blocked_bytes = (raw >> bit) & 0xF
+    bit += 4
+    fwd_bytes = (raw >> bit) & 0xF
+    bit += 4
     can_forward = bool((raw >> bit) & 1)
     bit += 1
     match = bool((raw >> bit) & 1)
-    return ForwardResult(match=match, can_forward=can_forward, data=data)
+    return ForwardResult(
+        match=match,
+        can_forward=can_forward,
+        fwd_bytes=fwd_bytes,
+        blocked_bytes=blocked_bytes,
+        data=data,
+    )
 
 
 class SQInterface:
@@ -62,6 +62,8 @@ class ForwardResult:
 
     match: bool = False
     can_forward: bool = False
+    fwd_bytes: int = 0
+    blocked_bytes: int = 0
     data: int = 0
 
 
@@ -296,11 +298,18 @@ class SQModel:
 
         Returns (all_older_addrs_known, ForwardResult).
         Scans from oldest (head) to newest: last match wins (newest store).
+        Byte lanes of the load's word are tracked independently so partial
+        overlaps assemble from multiple entries (mirrors Blocks 2b/2c).
         """
         all_older_known = True
         found_match = False
         can_fwd = False
         fwd_data = 0
+        load_mask = gen_byte_en(check_addr & 0x3, check_size)
+        # Per-lane newest-writer state: covered / forwardable / assembled byte
+        lane_covered = [False] * 4
+        lane_fwd_ok = [False] * 4
+        lane_byte = [0] * 4
 
         for i in range(self.depth):
             idx = (self.head_idx + i) % self.depth
@@ -315,7 +324,14 @@ class SQModel:
 
                 if e.addr_valid:
                     # Check address overlap (word-aligned)
-                    base_match = (e.address >> 2) == ((check_addr & MASK32) >> 2)
+                    same_word = (e.address >> 2) == ((check_addr & MASK32) >> 2)
+                    store_mask = gen_byte_en(e.address & 0x3, e.size)
+                    # Non-double accesses only conflict when byte lanes overlap
+                    base_match = same_word and (
+                        e.size == MEM_SIZE_DOUBLE
+                        or check_size == MEM_SIZE_DOUBLE
+                        or (store_mask & load_mask) != 0
+                    )
                     double_hi = e.size == MEM_SIZE_DOUBLE and (
                         (e.address >> 2) + 1
                     ) == ((check_addr & MASK32) >> 2)
@@ -323,6 +339,24 @@ class SQModel:
                         e.address >> 2
                     ) == (((check_addr & MASK32) >> 2) + 1)
 
+                    # Byte-lane coverage: newest cover owns the lane whether
+                    # or not it is forwardable (DOUBLE stores cover but block)
+                    if e.size == MEM_SIZE_DOUBLE:
+                        cover = 0xF if (same_word or double_hi) else 0
+                    else:
+                        cover = store_mask if same_word else 0
+                    lane_ok = (
+                        e.data_valid
+                        and not e.is_mmio
+                        and e.size != MEM_SIZE_DOUBLE
+                    )
+                    off = e.address & 0x3
+                    for k in range(4):
+                        if cover & (1 << k):
+                            lane_covered[k] = True
+                            lane_fwd_ok[k] = lane_ok
+                            lane_byte[k] = (e.data >> (8 * ((k - off) & 0x3))) & 0xFF
+
                     if base_match or double_hi or load_double_hi:
                         found_match = True
                         if e.data_valid and not e.is_mmio:
@@ -352,10 +386,26 @@ class SQModel:
                             # MMIO or no data — load must wait
                             can_fwd = False
 
+        # Lane results only model one word — never applied to DOUBLE loads
+        lanes_apply = check_size != MEM_SIZE_DOUBLE
+        fwd_bytes = 0
+        blocked_bytes = 0xF
+        if lanes_apply:
+            fwd_bytes = sum(
+                1 << k for k in range(4) if lane_covered[k] and lane_fwd_ok[k]
+            )
+            blocked_bytes = sum(
+                1 << k for k in range(4) if lane_covered[k] and not lane_fwd_ok[k]
+            )
+        lane_full_cover = lanes_apply and (load_mask & ~fwd_bytes & 0xF) == 0
+        asm_word = sum(lane_byte[k] << (8 * k) for k in range(4))
+
         result = ForwardResult(
             match=found_match,
-            can_forward=found_match and can_fwd,
-            data=fwd_data,
+            can_forward=found_match and (can_fwd or lane_full_cover),
+            fwd_bytes=(0xF if can_fwd else fwd_bytes) if found_match else 0,
+            blocked_bytes=blocked_bytes if (found_match and not can_fwd) else 0,
+            data=fwd_data if can_fwd else asm_word,
         )
         return all_older_known, result
 
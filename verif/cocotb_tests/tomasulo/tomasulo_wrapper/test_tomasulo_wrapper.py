@@ -2298,7 +2298,7 @@ async def test_random_multi_rs_dispatch_execute_commit(dut: Any) -> None:
 
 @cocotb.test()
 async def test_multi_fu_arbitration_contention(dut: Any) -> None:
-    """Multiple FU completions contend; highest-priority FU wins CDB grant."""
+    """Multiple FU completions contend; the oldest ROB entries win the CDB lanes."""
     cocotb.log.info("=== Test: Multi-FU Arbitration Contention ===")
     dut_if, model = await setup_test(dut)
 
@@ -2315,43 +2315,44 @@ async def test_multi_fu_arbitration_contention(dut: Any) -> None:
     tag_c = await dut_if.dispatch(req_c)
     model.dispatch(req_c)
 
-    # Drive 3 FU completions simultaneously (FP_ADD, FP_MUL, FP_DIV)
-    # Arbiter latency-based priority: FP_DIV(6) > FP_MUL(5) > FP_ADD(4)
+    # Drive 2 FU completions simultaneously (FP_MUL, FP_DIV).
+    # Arbitration is age-ordered: FP_MUL carries the older tag_b, so it beats
+    # FP_DIV (tag_c) despite FP_DIV's higher legacy tie-break rank.
     # Note: FU_MEM (slot 3) is now internally driven by LQ adapter.
-    # Assign tag_a (head) to lowest priority (FP_ADD) so it completes last,
-    # preventing premature ROB commit during the arbitration test.
-    dut_if.drive_fu_complete(FU_FP_ADD, tag=tag_a, value=0xAAAA)
+    # The head (tag_a) is deliberately left incomplete so no entry commits
+    # mid-test — under age order the head would always win a lane, and its
+    # completion would retire it immediately.
     dut_if.drive_fu_complete(FU_FP_MUL, tag=tag_b, value=0xBBBB)
     dut_if.drive_fu_complete(FU_FP_DIV, tag=tag_c, value=0xCCCC)
     await Timer(1, unit="ps")
 
-    # Round 1: 2-wide CDB grants the top two contenders — FP_DIV on lane 0
-    # (highest priority) and FP_MUL on lane 1. FP_ADD loses and must retry.
+    # Round 1: 2-wide CDB grants both contenders — FP_MUL (older tag) on
+    # lane 0 and FP_DIV on lane 1.
     cdb = dut_if.read_cdb_output()
     grant = dut_if.read_cdb_grant()
-    assert cdb.valid, "CDB should be valid with 3 FUs completing"
+    assert cdb.valid, "CDB should be valid with 2 FUs completing"
     assert (
-        cdb.tag == tag_c
-    ), f"FP_DIV should win lane 0, got tag={cdb.tag} expected={tag_c}"
-    assert cdb.value == 0xCCCC
-    assert (grant >> FU_FP_DIV) & 1, "FP_DIV grant should be set (lane 0)"
-    assert (grant >> FU_FP_MUL) & 1, "FP_MUL grant should be set (lane 1)"
-    assert not ((grant >> FU_FP_ADD) & 1), "FP_ADD should not be granted (lost)"
-
-    # Model: both lane winners (FP_DIV + FP_MUL) complete this cycle.
-    model.fu_complete(FU_FP_DIV, tag=tag_c, value=0xCCCC)
+        cdb.tag == tag_b
+    ), f"FP_MUL (older) should win lane 0, got tag={cdb.tag} expected={tag_b}"
+    assert cdb.value == 0xBBBB
+    assert (grant >> FU_FP_MUL) & 1, "FP_MUL grant should be set (lane 0)"
+    assert (grant >> FU_FP_DIV) & 1, "FP_DIV grant should be set (lane 1)"
+    assert not ((grant >> FU_FP_ADD) & 1), "FP_ADD did not request, no grant"
+
+    # Model: both lane winners (FP_MUL + FP_DIV) complete this cycle.
     model.fu_complete(FU_FP_MUL, tag=tag_b, value=0xBBBB)
+    model.fu_complete(FU_FP_DIV, tag=tag_c, value=0xCCCC)
 
     # Clock: arbiter results latched by ROB
     await dut_if.step()
 
-    # Clear both granted FUs (FP_DIV, FP_MUL); re-drive only FP_ADD (the loser).
-    dut_if.clear_fu_complete(FU_FP_DIV)
+    # Clear both granted FUs; now complete the head (FP_ADD, tag_a).
     dut_if.clear_fu_complete(FU_FP_MUL)
+    dut_if.clear_fu_complete(FU_FP_DIV)
     dut_if.drive_fu_complete(FU_FP_ADD, tag=tag_a, value=0xAAAA)
     await Timer(1, unit="ps")
 
-    # Round 2: FP_ADD is the only remaining contender → wins lane 0.
+    # Round 2: FP_ADD is the only contender (and the oldest) → wins lane 0.
     cdb = dut_if.read_cdb_output()
     assert cdb.valid
     assert (
@@ -2539,7 +2540,7 @@ async def test_div_shim_end_to_end(dut: Any) -> None:
     await dut_if.step()
     dut_if.clear_rs_dispatch()
 
-    # Divider takes 17 cycles; wait for CDB broadcast
+    # Divider takes 9 cycles; wait for CDB broadcast
     cdb = await wait_for_cdb(dut_if, max_cycles=25)
     assert cdb.tag == tag, f"CDB tag mismatch: got {cdb.tag}, expected {tag}"
     assert (
@@ -3316,8 +3317,8 @@ async def test_div_pipeline_adapter_contention_partial_flush(dut: Any) -> None:
     """CDB contention forces DIV adapter pending; partial flush suppresses younger.
 
     Exercises the fu_cdb_adapter pending+grant path under partial flush
-    with the pipelined divider FIFO. FP_DIV (highest CDB priority) blocks
-    DIV grants, forcing the adapter into pending state. Releasing contention
+    with the pipelined divider FIFO. An external FP_DIV completion contends
+    for the CDB while the divider drains its FIFO. Releasing contention
     with simultaneous partial flush verifies the younger result is suppressed
     even in the back-to-back adapter capture window.
     """
@@ -3395,13 +3396,13 @@ async def test_div_pipeline_adapter_contention_partial_flush(dut: Any) -> None:
     dut_if.clear_rs_dispatch()
 
     # Drive FP_DIV externally with tag_d to create CDB contention.
-    # FP_DIV (slot 6, priority 0) beats DIV (slot 2, priority 1).
+    # tag_d is younger than both DIV tags, so age order keeps it behind them.
     # tag_d is allocated in ROB but can't commit (tag_a is at head, incomplete).
     # The external input bypasses the idle FP_DIV adapter via the arbiter mux.
     dut_if.drive_fu_complete(FU_FP_DIV, tag=tag_d, value=0)
     model.fu_complete(FU_FP_DIV, tag=tag_d, value=0)
 
-    # Hold contention for 22 cycles: covers divider pipeline (17) +
+    # Hold contention for 22 cycles: covers divider pipeline (9) +
     # FIFO registration (1) + RS issue latency + margin.
     # During this window:
     #   - Both DIV results complete and enter the FIFO
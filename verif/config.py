@@ -237,6 +237,42 @@ DEFAULT_CLOCK_PERIOD_NS: Final[int] = 3
 DEFAULT_RESET_CYCLES: Final[int] = 3
 """Default number of clock cycles to hold reset."""
 
+DEFAULT_BATCH_POOL_SIZE: Final[int] = 4096
+"""Pool refill size for BatchInstructionGenerator (instructions per class).
+
+Larger pools amortize the vectorized refill cost over more draws; smaller
+pools keep memory low. 4096 makes refill overhead negligible against even a
+fast simulation step while staying well under a megabyte of pool storage."""
+
+# ============================================================================
+# Sharded Regression Configuration
+# ============================================================================
+#
+# Consumed by tests/run_sharded.py (the whole-suite parallel orchestrator) and
+# by TestConfig in cocotb_tests/test_common.py (COCOTB_NUM_TEST_LOOPS segment
+# override). Kept here so shard geometry and seed derivation have one home.
+
+DEFAULT_TORTURE_SEGMENTS: Final[int] = 4
+"""How many independent segments each long random-regression test splits into.
+
+Each segment runs num_loops / N instructions with its own seed, so N segments
+on N cores cover the same instruction count as one serial run in roughly 1/N
+the wall-clock time (with different - strictly broader - random streams)."""
+
+TORTURE_SEGMENT_MIN_LOOPS: Final[int] = 3000
+"""Floor on instructions per torture segment.
+
+Below this the per-instruction coverage check becomes meaningless (the scaled
+minimum count rounds toward 1) and the fixed warmup/drain overhead dominates,
+so requesting more segments than num_loops / floor clamps the segment count."""
+
+DEFAULT_SHARD_SEED_BASE: Final[int] = 1
+"""Base random seed for a sharded run; shard k gets base + k * stride."""
+
+SHARD_SEED_STRIDE: Final[int] = 9973
+"""Spacing between per-shard seeds (prime, so repeated runs with incremented
+bases never collapse two shards onto the same seed)."""
+
 # ============================================================================
 # RISC-V ISA Constants
 # ============================================================================
@@ -0,0 +1,302 @@
+#    Copyright 2026 Two Sigma Open Source, LLC
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+
+"""Loader for the compiled integer step core (verif/native/_frost_step).
+
+Native Step Core
+================
+
+Long co-simulation runs spend a large share of their Python time in the
+per-instruction evaluators in alu_model.py. The optional C extension in
+verif/native implements the same RV32IM + Zba/Zbb/Zbs/Zbkb/Zicond integer
+operations (and the AMO read-modify-write evaluators) as a compiled step
+function; this module loads it and wraps each operation in a callable with
+the same (operand_a, operand_b) -> result signature as the Python
+evaluators, so cpu_model.py can overlay them transparently.
+
+The pure-Python evaluators stay the reference implementation:
+
+1. If the extension is missing, this module runs ``make -C verif/native``
+   once; if that fails (no compiler, no Python headers), every accessor
+   returns an empty dict and the model keeps using Python evaluators.
+2. When the extension does load, every operation is cross-checked against
+   its Python reference on a corpus of edge-case operands before it is
+   handed out. A mismatch raises, loudly, rather than letting a fast but
+   wrong model verify the RTL.
+
+Set FROST_NATIVE_MODEL=0 to force the pure-Python evaluators (e.g. when
+bisecting a model discrepancy).
+"""
+
+import importlib.util
+import os
+import subprocess
+import sysconfig
+from collections.abc import Callable, Mapping
+from functools import partial
+from pathlib import Path
+from types import ModuleType
+
+from models import alu_model
+
+_NATIVE_DIR = Path(__file__).resolve().parent.parent / "native"
+
+_BUILD_TIMEOUT_SECONDS = 60
+"""Ceiling on the one-shot ``make -C verif/native`` invoked at first load."""
+
+# Python reference evaluators, keyed by the mnemonics the C core exports.
+# These deliberately point straight at alu_model (not encoders.op_tables,
+# which imports from models and would create an import cycle); coverage is
+# still tied to the op tables because cpu_model only overlays mnemonics
+# that appear in both.
+_BINARY_REFERENCE: dict[str, Callable[[int, int], int]] = {
+    "add": alu_model.add,
+    "sub": alu_model.sub,
+    "and": alu_model.and_rv,
+    "or": alu_model.or_rv,
+    "xor": alu_model.xor,
+    "sll": alu_model.sll,
+    "srl": alu_model.srl,
+    "sra": alu_model.sra,
+    "slt": alu_model.slt,
+    "sltu": alu_model.sltu,
+    "mul": alu_model.mul,
+    "mulh": alu_model.mulh,
+    "mulhsu": alu_model.mulhsu,
+    "mulhu": alu_model.mulhu,
+    "div": alu_model.div,
+    "divu": alu_model.divu,
+    "rem": alu_model.rem,
+    "remu": alu_model.remu,
+    "sh1add": alu_model.sh1add,
+    "sh2add": alu_model.sh2add,
+    "sh3add": alu_model.sh3add,
+    "bset": alu_model.bset,
+    "bclr": alu_model.bclr,
+    "binv": alu_model.binv,
+    "bext": alu_model.bext,
+    "andn": alu_model.andn,
+    "orn": alu_model.orn,
+    "xnor": alu_model.xnor,
+    "max": alu_model.max_rv,
+    "maxu": alu_model.maxu,
+    "min": alu_model.min_rv,
+    "minu": alu_model.minu,
+    "rol": alu_model.rol,
+    "ror": alu_model.ror,
+    "czero.eqz": alu_model.czero_eqz,
+    "czero.nez": alu_model.czero_nez,
+    "pack": alu_model.pack,
+    "packh": alu_model.packh,
+}
+
+_UNARY_REFERENCE: dict[str, Callable[[int], int]] = {
+    "clz": alu_model.clz,
+    "ctz": alu_model.ctz,
+    "cpop": alu_model.cpop,
+    "sext.b": alu_model.sext_b,
+    "sext.h": alu_model.sext_h,
+    "zext.h": alu_model.zext_h,
+    "orc.b": alu_model.orc_b,
+    "rev8": alu_model.rev8,
+    "brev8": alu_model.brev8,
+    "zip": alu_model.zip_rv,
+    "unzip": alu_model.unzip,
+}
+
+_AMO_REFERENCE: dict[str, Callable[[int, int], int]] = {
+    "amoswap.w": alu_model.amoswap,
+    "amoadd.w": alu_model.amoadd,
+    "amoxor.w": alu_model.amoxor,
+    "amoand.w": alu_model.amoand,
+    "amoor.w": alu_model.amoor,
+    "amomin.w": alu_model.amomin,
+    "amomax.w": alu_model.amomax,
+    "amominu.w": alu_model.amominu,
+    "amomaxu.w": alu_model.amomaxu,
+}
+
+# The I-type ALU mnemonics evaluate identically to their R-type forms (the
+# op tables bind both to the same alu_model function), so they share the
+# same compiled operation.
+_IMMEDIATE_ALIASES: dict[str, str] = {
+    "addi": "add",
+    "andi": "and",
+    "ori": "or",
+    "xori": "xor",
+    "slli": "sll",
+    "srli": "srl",
+    "srai": "sra",
+    "slti": "slt",
+    "sltiu": "sltu",
+    "bseti": "bset",
+    "bclri": "bclr",
+    "binvi": "binv",
+    "bexti": "bext",
+    "rori": "ror",
+}
+
+# Edge-case operand corpus for the load-time cross-check: zeros, extremes,
+# sign boundaries, shift amounts at and past 31, and a couple of dense bit
+# patterns.
+_CHECK_OPERANDS: tuple[int, ...] = (
+    0x00000000,
+    0x00000001,
+    0x00000003,
+    0x0000001F,
+    0x00000020,
+    0x00008000,
+    0x0000FFFF,
+    0x00010000,
+    0x12345678,
+    0x7FFFFFFF,
+    0x80000000,
+    0xDEADBEEF,
+    0xFFFF8000,
+    0xFFFFFFFE,
+    0xFFFFFFFF,
+)
+
+_native_module: ModuleType | None = None
+_load_attempted = False
+
+
+def _build_extension() -> None:
+    """Invoke the native Makefile once, swallowing any build failure."""
+    try:
+        subprocess.run(
+            ["make", "-C", str(_NATIVE_DIR)],
+            capture_output=True,
+            check=True,
+            timeout=_BUILD_TIMEOUT_SECONDS,
+        )
+    except (OSError, subprocess.SubprocessError):
+        pass
+
+
+def _import_extension() -> ModuleType | None:
+    """Import the built extension from verif/native, or None if unavailable."""
+    suffix = sysconfig.get_config_var("EXT_SUFFIX") or ".so"
+    extension_path = _NATIVE_DIR / f"_frost_step{suffix}"
+    if not extension_path.exists():
+        _build_extension()
+    if not extension_path.exists():
+        return None
+
+    spec = importlib.util.spec_from_file_location("_frost_step", extension_path)
+    if spec is None or spec.loader is None:
+        return None
+    module = importlib.util.module_from_spec(spec)
+    try:
+        spec.loader.exec_module(module)
+    except ImportError:
+        return None
+    return module
+
+
+def _verify_operation(
+    name: str,
+    native_fn: Callable[..., int],
+    reference_fn: Callable[..., int],
+    unary: bool,
+) -> None:
+    """Cross-check one compiled operation against its Python reference.
+
+    Raises:
+        AssertionError: If the compiled result diverges from the reference
+            for any operand combination in the corpus. A wrong model must
+            never silently replace the reference implementation.
+    """
+    for operand_a in _CHECK_OPERANDS:
+        if unary:
+            native_result = native_fn(operand_a)
+            reference_result = reference_fn(operand_a)
+            assert native_result == reference_result, (
+                f"native {name}(0x{operand_a:08X}) = 0x{native_result:08X}, "
+                f"reference = 0x{reference_result:08X}"
+            )
+            continue
+        for operand_b in _CHECK_OPERANDS:
+            native_result = native_fn(operand_a, operand_b)
+            reference_result = reference_fn(operand_a, operand_b)
+            assert native_result == reference_result, (
+                f"native {name}(0x{operand_a:08X}, 0x{operand_b:08X}) = "
+                f"0x{native_result:08X}, reference = 0x{reference_result:08X}"
+            )
+
+
+def _get_module() -> ModuleType | None:
+    """Return the verified extension module, loading it on first call."""
+    global _native_module, _load_attempted
+    if _load_attempted:
+        return _native_module
+    _load_attempted = True
+
+    if os.environ.get("FROST_NATIVE_MODEL", "1") == "0":
+        return None
+
+    _native_module = _import_extension()
+    return _native_module
+
+
+def _wrap_operations(
+    reference: Mapping[str, Callable[..., int]], unary: bool
+) -> dict[str, Callable[..., int]]:
+    """Build verified compiled wrappers for every operation in reference."""
+    module = _get_module()
+    if module is None:
+        return {}
+
+    wrapped: dict[str, Callable[..., int]] = {}
+    for name, reference_fn in reference.items():
+        try:
+            operation_id = module.op_id(name)
+        except ValueError:
+            # A stale build of the extension predates this operation; the
+            # Python evaluator simply stays in place for it.
+            continue
+        native_fn = partial(module.eval, operation_id)
+        _verify_operation(name, native_fn, reference_fn, unary)
+        wrapped[name] = native_fn
+    return wrapped
+
+
+def native_binary_evaluators() -> dict[str, Callable[..., int]]:
+    """Compiled (operand_a, operand_b) -> result evaluators by mnemonic.
+
+    Includes both the R-type mnemonics and their I-type aliases (addi,
+    slli, ...), matching the keys of the R_ALU and I_ALU op tables. Empty
+    when the extension is unavailable or disabled.
+    """
+    wrapped = _wrap_operations(_BINARY_REFERENCE, unary=False)
+    for alias, base in _IMMEDIATE_ALIASES.items():
+        if base in wrapped:
+            wrapped[alias] = wrapped[base]
+    return wrapped
+
+
+def native_unary_evaluators() -> dict[str, Callable[..., int]]:
+    """Compiled (value) -> result evaluators for the I_UNARY mnemonics.
+
+    Empty when the extension is unavailable or disabled.
+    """
+    return _wrap_operations(_UNARY_REFERENCE, unary=True)
+
+
+def native_amo_evaluators() -> dict[str, Callable[..., int]]:
+    """Compiled (old_value, rs2_value) -> new_value AMO evaluators.
+
+    Empty when the extension is unavailable or disabled.
+    """
+    return _wrap_operations(_AMO_REFERENCE, unary=False)
@@ -0,0 +1,407 @@
+/*  Copyright 2026 Two Sigma Open Source, LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Compiled integer step core for the CPU reference model.
+ *
+ * This extension implements the RV32IM + Zba/Zbb/Zbs/Zbkb/Zicond register
+ * evaluators (plus the AMO read-modify-write evaluators) in C, so that the
+ * per-committed-instruction modeling in cpu_model.py does not pay Python
+ * interpreter cost for the common integer operations. The Python evaluators
+ * in models/alu_model.py remain the reference implementation: the loader in
+ * models/native_step.py cross-checks every operation against them at import
+ * time and falls back to pure Python when this module is not built.
+ *
+ * Interface (used via models/native_step.py, not directly):
+ *   op_id(name)      -> integer id for an operation mnemonic (or ValueError)
+ *   eval(id, a, b=0) -> 32-bit result; a/b are unsigned 32-bit operand values
+ *
+ * Operation ids are private to one build of this module; the Python side
+ * always resolves mnemonics through op_id() so the two cannot drift.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <stdint.h>
+#include <string.h>
+
+typedef enum {
+    /* RV32I register/immediate ALU */
+    OP_ADD,
+    OP_SUB,
+    OP_AND,
+    OP_OR,
+    OP_XOR,
+    OP_SLL,
+    OP_SRL,
+    OP_SRA,
+    OP_SLT,
+    OP_SLTU,
+    /* M extension */
+    OP_MUL,
+    OP_MULH,
+    OP_MULHSU,
+    OP_MULHU,
+    OP_DIV,
+    OP_DIVU,
+    OP_REM,
+    OP_REMU,
+    /* Zba */
+    OP_SH1ADD,
+    OP_SH2ADD,
+    OP_SH3ADD,
+    /* Zbs */
+    OP_BSET,
+    OP_BCLR,
+    OP_BINV,
+    OP_BEXT,
+    /* Zbb binary */
+    OP_ANDN,
+    OP_ORN,
+    OP_XNOR,
+    OP_MAX,
+    OP_MAXU,
+    OP_MIN,
+    OP_MINU,
+    OP_ROL,
+    OP_ROR,
+    /* Zicond */
+    OP_CZERO_EQZ,
+    OP_CZERO_NEZ,
+    /* Zbkb binary */
+    OP_PACK,
+    OP_PACKH,
+    /* Zbb/Zbkb unary (operand b is ignored) */
+    OP_CLZ,
+    OP_CTZ,
+    OP_CPOP,
+    OP_SEXT_B,
+    OP_SEXT_H,
+    OP_ZEXT_H,
+    OP_ORC_B,
+    OP_REV8,
+    OP_BREV8,
+    OP_ZIP,
+    OP_UNZIP,
+    /* A extension AMO evaluators: a = old memory value, b = rs2 value */
+    OP_AMOSWAP_W,
+    OP_AMOADD_W,
+    OP_AMOXOR_W,
+    OP_AMOAND_W,
+    OP_AMOOR_W,
+    OP_AMOMIN_W,
+    OP_AMOMAX_W,
+    OP_AMOMINU_W,
+    OP_AMOMAXU_W,
+    OP_COUNT
+} frost_op_t;
+
+static const char *const op_names[OP_COUNT] = {
+    [OP_ADD] = "add",
+    [OP_SUB] = "sub",
+    [OP_AND] = "and",
+    [OP_OR] = "or",
+    [OP_XOR] = "xor",
+    [OP_SLL] = "sll",
+    [OP_SRL] = "srl",
+    [OP_SRA] = "sra",
+    [OP_SLT] = "slt",
+    [OP_SLTU] = "sltu",
+    [OP_MUL] = "mul",
+    [OP_MULH] = "mulh",
+    [OP_MULHSU] = "mulhsu",
+    [OP_MULHU] = "mulhu",
+    [OP_DIV] = "div",
+    [OP_DIVU] = "divu",
+    [OP_REM] = "rem",
+    [OP_REMU] = "remu",
+    [OP_SH1ADD] = "sh1add",
+    [OP_SH2ADD] = "sh2add",
+    [OP_SH3ADD] = "sh3add",
+    [OP_BSET] = "bset",
+    [OP_BCLR] = "bclr",
+    [OP_BINV] = "binv",
+    [OP_BEXT] = "bext",
+    [OP_ANDN] = "andn",
+    [OP_ORN] = "orn",
+    [OP_XNOR] = "xnor",
+    [OP_MAX] = "max",
+    [OP_MAXU] = "maxu",
+    [OP_MIN] = "min",
+    [OP_MINU] = "minu",
+    [OP_ROL] = "rol",
+    [OP_ROR] = "ror",
+    [OP_CZERO_EQZ] = "czero.eqz",
+    [OP_CZERO_NEZ] = "czero.nez",
+    [OP_PACK] = "pack",
+    [OP_PACKH] = "packh",
+    [OP_CLZ] = "clz",
+    [OP_CTZ] = "ctz",
+    [OP_CPOP] = "cpop",
+    [OP_SEXT_B] = "sext.b",
+    [OP_SEXT_H] = "sext.h",
+    [OP_ZEXT_H] = "zext.h",
+    [OP_ORC_B] = "orc.b",
+    [OP_REV8] = "rev8",
+    [OP_BREV8] = "brev8",
+    [OP_ZIP] = "zip",
+    [OP_UNZIP] = "unzip",
+    [OP_AMOSWAP_W] = "amoswap.w",
+    [OP_AMOADD_W] = "amoadd.w",
+    [OP_AMOXOR_W] = "amoxor.w",
+    [OP_AMOAND_W] = "amoand.w",
+    [OP_AMOOR_W] = "amoor.w",
+    [OP_AMOMIN_W] = "amomin.w",
+    [OP_AMOMAX_W] = "amomax.w",
+    [OP_AMOMINU_W] = "amominu.w",
+    [OP_AMOMAXU_W] = "amomaxu.w",
+};
+
+/* RISC-V division edge-case results (see DivisionOperations in alu_model.py). */
+#define DIV_BY_ZERO_QUOTIENT 0xFFFFFFFFu
+#define DIV_OVERFLOW_RESULT 0x80000000u
+
+static uint32_t frost_eval(frost_op_t op, uint32_t a, uint32_t b)
+{
+    int32_t sa = (int32_t)a;
+    int32_t sb = (int32_t)b;
+    uint32_t shift = b & 0x1Fu;
+
+    switch (op) {
+    case OP_ADD:
+        return a + b;
+    case OP_SUB:
+        return a - b;
+    case OP_AND:
+        return a & b;
+    case OP_OR:
+        return a | b;
+    case OP_XOR:
+        return a ^ b;
+    case OP_SLL:
+        return a << shift;
+    case OP_SRL:
+        return a >> shift;
+    case OP_SRA:
+        return (uint32_t)(sa >> shift);
+    case OP_SLT:
+        return sa < sb;
+    case OP_SLTU:
+        return a < b;
+    case OP_MUL:
+        return (uint32_t)((int64_t)sa * (int64_t)sb);
+    case OP_MULH:
+        return (uint32_t)(((int64_t)sa * (int64_t)sb) >> 32);
+    case OP_MULHSU:
+        return (uint32_t)(((int64_t)sa * (int64_t)(uint64_t)b) >> 32);
+    case OP_MULHU:
+        return (uint32_t)(((uint64_t)a * (uint64_t)b) >> 32);
+    case OP_DIV:
+        if (sb == 0)
+            return DIV_BY_ZERO_QUOTIENT;
+        if (sa == INT32_MIN && sb == -1)
+            return DIV_OVERFLOW_RESULT;
+        return (uint32_t)(sa / sb);
+    case OP_DIVU:
+        return b == 0 ? DIV_BY_ZERO_QUOTIENT : a / b;
+    case OP_REM:
+        if (sb == 0)
+            return a;
+        if (sa == INT32_MIN && sb == -1)
+            return 0;
+        return (uint32_t)(sa % sb);
+    case OP_REMU:
+        return b == 0 ? a : a % b;
+    case OP_SH1ADD:
+        return (a << 1) + b;
+    case OP_SH2ADD:
+        return (a << 2) + b;
+    case OP_SH3ADD:
+        return (a << 3) + b;
+    case OP_BSET:
+        return a | (1u << shift);
+    case OP_BCLR:
+        return a & ~(1u << shift);
+    case OP_BINV:
+        return a ^ (1u << shift);
+    case OP_BEXT:
+        return (a >> shift) & 1u;
+    case OP_ANDN:
+        return a & ~b;
+    case OP_ORN:
+        return a | ~b;
+    case OP_XNOR:
+        return ~(a ^ b);
+    case OP_MAX:
+        return sa > sb ? a : b;
+    case OP_MAXU:
+        return a > b ? a : b;
+    case OP_MIN:
+        return sa < sb ? a : b;
+    case OP_MINU:
+        return a < b ? a : b;
+    case OP_ROL:
+        return shift ? (a << shift) | (a >> (32 - shift)) : a;
+    case OP_ROR:
+        return shift ? (a >> shift) | (a << (32 - shift)) : a;
+    case OP_CZERO_EQZ:
+        return b == 0 ? 0 : a;
+    case OP_CZERO_NEZ:
+        return b != 0 ? 0 : a;
+    case OP_PACK:
+        return ((b & 0xFFFFu) << 16) | (a & 0xFFFFu);
+    case OP_PACKH:
+        return ((b & 0xFFu) << 8) | (a & 0xFFu);
+    case OP_CLZ:
+        return a == 0 ? 32 : (uint32_t)__builtin_clz(a);
+    case OP_CTZ:
+        return a == 0 ? 32 : (uint32_t)__builtin_ctz(a);
+    case OP_CPOP:
+        return (uint32_t)__builtin_popcount(a);
+    case OP_SEXT_B:
+        return (uint32_t)(int32_t)(int8_t)a;
+    case OP_SEXT_H:
+        return (uint32_t)(int32_t)(int16_t)a;
+    case OP_ZEXT_H:
+        return a & 0xFFFFu;
+    case OP_ORC_B: {
+        uint32_t result = 0;
+        for (int i = 0; i < 4; i++) {
+            if ((a >> (8 * i)) & 0xFFu)
+                result |= 0xFFu << (8 * i);
+        }
+        return result;
+    }
+    case OP_REV8:
+        return __builtin_bswap32(a);
+    case OP_BREV8: {
+        uint32_t result = 0;
+        for (int byte = 0; byte < 4; byte++) {
+            uint32_t byte_val = (a >> (8 * byte)) & 0xFFu;
+            uint32_t reversed = 0;
+            for (int bit = 0; bit < 8; bit++) {
+                if (byte_val & (1u << bit))
+                    reversed |= 1u << (7 - bit);
+            }
+            result |= reversed << (8 * byte);
+        }
+        return result;
+    }
+    case OP_ZIP: {
+        uint32_t result = 0;
+        for (int i = 0; i < 16; i++) {
+            if (a & (1u << i))
+                result |= 1u << (2 * i);
+            if (a & (1u << (i + 16)))
+                result |= 1u << (2 * i + 1);
+        }
+        return result;
+    }
+    case OP_UNZIP: {
+        uint32_t result = 0;
+        for (int i = 0; i < 16; i++) {
+            if (a & (1u << (2 * i)))
+                result |= 1u << i;
+            if (a & (1u << (2 * i + 1)))
+                result |= 1u << (i + 16);
+        }
+        return result;
+    }
+    case OP_AMOSWAP_W:
+        return b;
+    case OP_AMOADD_W:
+        return a + b;
+    case OP_AMOXOR_W:
+        return a ^ b;
+    case OP_AMOAND_W:
+        return a & b;
+    case OP_AMOOR_W:
+        return a | b;
+    case OP_AMOMIN_W:
+        return sa < sb ? a : b;
+    case OP_AMOMAX_W:
+        return sa > sb ? a : b;
+    case OP_AMOMINU_W:
+        return a < b ? a : b;
+    case OP_AMOMAXU_W:
+        return a > b ? a : b;
+    case OP_COUNT:
+        break;
+    }
+    /* Unreachable for valid ids; eval() validates the id before calling. */
+    return 0;
+}
+
+static PyObject *py_op_id(PyObject *self, PyObject *args)
+{
+    const char *name;
+    (void)self;
+
+    if (!PyArg_ParseTuple(args, "s", &name))
+        return NULL;
+
+    for (int i = 0; i < OP_COUNT; i++) {
+        if (strcmp(op_names[i], name) == 0)
+            return PyLong_FromLong(i);
+    }
+    PyErr_Format(PyExc_ValueError, "unknown operation: %s", name);
+    return NULL;
+}
+
+static PyObject *py_eval(PyObject *self, PyObject *args)
+{
+    int op;
+    unsigned long a;
+    unsigned long b = 0;
+    (void)self;
+
+    if (!PyArg_ParseTuple(args, "ik|k", &op, &a, &b))
+        return NULL;
+
+    if (op < 0 || op >= OP_COUNT) {
+        PyErr_Format(PyExc_ValueError, "operation id out of range: %d", op);
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong(
+        frost_eval((frost_op_t)op, (uint32_t)a, (uint32_t)b));
+}
+
+static PyMethodDef frost_step_methods[] = {
+    {"op_id", py_op_id, METH_VARARGS,
+     "op_id(name) -> int\n\nResolve an operation mnemonic to this build's id."},
+    {"eval", py_eval, METH_VARARGS,
+     "eval(id, a, b=0) -> int\n\nEvaluate one integer operation on 32-bit "
+     "operands."},
+    {NULL, NULL, 0, NULL},
+};
+
+static struct PyModuleDef frost_step_module = {
+    PyModuleDef_HEAD_INIT,
+    "_frost_step",
+    "Compiled integer step core for the CPU reference model.",
+    -1,
+    frost_step_methods,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+};
+
+PyMODINIT_FUNC PyInit__frost_step(void)
+{
+    return PyModule_Create(&frost_step_module);
+}